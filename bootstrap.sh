@@ -63,7 +63,7 @@ validate_command_result() {
 
 print_help() {
 	echo "Usage: $0 --prefix=<path> [--with-lpf[=<path>]]\
- [--with-banshee=<path>] [--with-snitch=<path>] [--no-reference] [--no-nonblocking] [--debug-build] [--generator=<value>] [--show] [--delete-files]"
+ [--with-banshee=<path>] [--with-snitch=<path>] [--no-reference] [--no-nonblocking] [--compact-coordinates] [--numa-first-touch] [--debug-build] [--generator=<value>] [--show] [--delete-files]"
 	echo " "
 	echo "Required arguments:"
 	echo "  --prefix=<path/to/install/directory/>"
@@ -78,7 +78,15 @@ the location where LPF is installed"
 	echo "  --with-hyperdags-using=<backend>    - uses the given backend reference for HyperDAG generation"
 	echo "                                        optional; default value is reference"
 	echo "                                        clashes with --no-hyperdags"
+	echo "  --no-profile                        - disables the profile backend"
+	echo "  --with-profile-using=<backend>      - uses the given backend for executing profiled programs"
+	echo "                                        one of reference, reference_omp, or nonblocking"
+	echo "                                        optional; default value is reference"
+	echo "                                        clashes with --no-profile"
 	echo "  --no-nonblocking                    - disables the nonblocking backend"
+	echo "  --compact-coordinates               - stores the sparsity of vectors using one bit per element"
+	echo "                                        clashes with --with-lpf"
+	echo "  --numa-first-touch                  - places shared containers of the OMP backend by first touch"
 	echo "  --debug-build                       - build the project with debug options (tests will run much slower!)"
 	echo "  --generator=<value>                 - set the generator for CMake (otherwise use CMake's default)"
 	echo "  --show                              - show generation commands instead of running them"
@@ -97,7 +105,11 @@ the location where LPF is installed"
 reference=yes
 hyperdags=yes
 hyperdags_using=reference
+profile=yes
+profile_using=reference
 nonblocking=yes
+compact_coordinates=no
+numa_first_touch=no
 banshee=no
 lpf=no
 show=no
@@ -161,9 +173,22 @@ or assume default paths (--with-lpf)"
 			hyperdags=yes
 			hyperdags_using="${arg#--with-hyperdags-using=}"
 			;;
+	--no-profile)
+			profile=no
+			;;
+	--with-profile-using=*)
+			profile=yes
+			profile_using="${arg#--with-profile-using=}"
+			;;
 	--no-nonblocking)
 			nonblocking=no
 			;;
+	--compact-coordinates)
+			compact_coordinates=yes
+			;;
+	--numa-first-touch)
+			numa_first_touch=yes
+			;;
 	--debug-build)
 			debug_build=yes
 			;;
@@ -233,6 +258,25 @@ if [[ "${hyperdags}" == "yes" ]]; then
 	fi
 fi
 
+if [[ "${profile}" == "yes" ]]; then
+	if [[ "${profile_using}" != "reference" && "${profile_using}" != "reference_omp" \
+		&& "${profile_using}" != "nonblocking" ]]; then
+		printf "Profile backend requested using the ${profile_using} backend, "
+		printf "but only the reference, reference_omp, and nonblocking backends are supported."
+		exit 255
+	fi
+	if [[ "${profile_using}" == "nonblocking" && "${nonblocking}" == "no" ]]; then
+		printf "Profile backend is selected using the nonblocking backend, "
+		printf "but the nonblocking backend was not selected."
+		exit 255
+	fi
+	if [[ "${profile_using}" != "nonblocking" && "${reference}" == "no" ]]; then
+		printf "Profile backend is selected using the ${profile_using} backend, "
+		printf "but the reference backends were not selected."
+		exit 255
+	fi
+fi
+
 if [[ "${lpf}" == "yes" ]]; then
 	if [[ -z "${LPF_INSTALL_PATH}" ]]; then
 		check_lpf
@@ -324,9 +368,21 @@ the current directory before invocation or confirm the deletion of its content w
 	if [[ "${hyperdags}" == "yes" ]]; then
 		CMAKE_OPTS+=" -DWITH_HYPERDAGS_USING=${hyperdags_using}"
 	fi
+	if [[ "${profile}" == "no" ]]; then
+		CMAKE_OPTS+=" -DWITH_PROFILE_BACKEND=OFF"
+	fi
+	if [[ "${profile}" == "yes" ]]; then
+		CMAKE_OPTS+=" -DWITH_PROFILE_USING=${profile_using}"
+	fi
 	if [[ "${nonblocking}" == "no" ]]; then
 		CMAKE_OPTS+=" -DWITH_NONBLOCKING_BACKEND=OFF"
 	fi
+	if [[ "${compact_coordinates}" == "yes" ]]; then
+		CMAKE_OPTS+=" -DWITH_COMPACT_COORDINATES=ON"
+	fi
+	if [[ "${numa_first_touch}" == "yes" ]]; then
+		CMAKE_OPTS+=" -DWITH_NUMA_FIRST_TOUCH=ON"
+	fi
 	if [[ "${lpf}" == "yes" ]]; then
 		CMAKE_OPTS+=" -DLPF_INSTALL_PATH='${ABSOLUTE_LPF_INSTALL_PATH}'"
 	fi
@@ -45,6 +45,7 @@ install( EXPORT GraphBLASTargets
 set( ALP_UTILS_INSTALL_DIR "${BINARY_LIBRARIES_INSTALL_DIR}" )
 set( SHMEM_BACKEND_INSTALL_DIR "${BINARY_LIBRARIES_INSTALL_DIR}/sequential" )
 set( HYPERDAGS_BACKEND_INSTALL_DIR "${BINARY_LIBRARIES_INSTALL_DIR}/hyperdags" )
+set( PROFILE_BACKEND_INSTALL_DIR "${BINARY_LIBRARIES_INSTALL_DIR}/profile" )
 set( BSP1D_BACKEND_INSTALL_DIR "${BINARY_LIBRARIES_INSTALL_DIR}/spmd" )
 set( HYBRID_BACKEND_INSTALL_DIR "${BINARY_LIBRARIES_INSTALL_DIR}/hybrid" )
 
@@ -104,10 +105,23 @@ set( COMMON_WRAPPER_OPTIONS
 		"${OpenMP_CXX_FLAGS}"
 )
 
+if( WITH_COMPACT_COORDINATES )
+	list( APPEND COMMON_WRAPPER_DEFINITIONS "${COMPACT_COORDINATES_DEF}" )
+endif()
+
+if( WITH_NUMA_FIRST_TOUCH )
+	list( APPEND COMMON_WRAPPER_DEFINITIONS "${NUMA_FIRST_TOUCH_DEF}" )
+endif()
+
 if( WITH_NUMA )
 	set( NUMA_LFLAG "-lnuma" )
 endif()
 
+# the profile backend resolves call sites via dladdr
+if( CMAKE_DL_LIBS )
+	set( DL_LFLAG "-l${CMAKE_DL_LIBS}" )
+endif()
+
 ### POPULATING WRAPPER INFORMATION FOR INSTALLATION TARGETS
 # for each enabled backend, add its information for the wrapper generation
 # paths may have spaces, hence wrap them inside single quotes ''
@@ -138,6 +152,15 @@ if( WITH_HYPERDAGS_BACKEND )
 	)
 endif()
 
+if( WITH_PROFILE_BACKEND )
+	addBackendWrapperGenOptions( "profile"
+		COMPILE_DEFINITIONS "${PROFILE_SELECTION_DEFS};${PROFILE_INCLUDE_DEFS}"
+		LINK_FLAGS "'${PROFILE_BACKEND_INSTALL_DIR}/lib${BACKEND_LIBRARY_OUTPUT_NAME}.a'"
+		"'${ALP_UTILS_INSTALL_DIR}/lib${ALP_UTILS_LIBRARY_OUTPUT_NAME}.a'" "${NUMA_LFLAG}"
+		"${DL_LFLAG}"
+	)
+endif()
+
 if( WITH_NONBLOCKING_BACKEND )
 	addBackendWrapperGenOptions( "nonblocking"
 		COMPILE_DEFINITIONS "${NONBLOCKING_SELECTION_DEFS};${NONBLOCKING_INCLUDE_DEFS}"
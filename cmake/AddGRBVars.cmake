@@ -32,6 +32,7 @@ set( REFERENCE_OMP_BACKEND_DEFAULT_NAME "backend_reference_omp" )
 set( BSP1D_BACKEND_DEFAULT_NAME "backend_bsp1d" )
 set( HYBRID_BACKEND_DEFAULT_NAME "backend_hybrid" )
 set( HYPERDAGS_BACKEND_DEFAULT_NAME "backend_hyperdags" )
+set( PROFILE_BACKEND_DEFAULT_NAME "backend_profile" )
 set( NONBLOCKING_BACKEND_DEFAULT_NAME "backend_nonblocking" )
 
 ### COMPILER DEFINITIONS FOR HEADERS INCLUSION AND FOR BACKEND SELECTION
@@ -40,6 +41,7 @@ set( NONBLOCKING_BACKEND_DEFAULT_NAME "backend_nonblocking" )
 set( REFERENCE_INCLUDE_DEFS "_GRB_WITH_REFERENCE" )
 set( REFERENCE_OMP_INCLUDE_DEFS "_GRB_WITH_OMP" )
 set( HYPERDAGS_INCLUDE_DEFS "_GRB_WITH_HYPERDAGS" )
+set( PROFILE_INCLUDE_DEFS "_GRB_WITH_PROFILE" )
 set( NONBLOCKING_INCLUDE_DEFS "_GRB_WITH_NONBLOCKING" )
 set( LPF_INCLUDE_DEFS "_GRB_WITH_LPF" )
 
@@ -50,6 +52,10 @@ set( HYPERDAGS_SELECTION_DEFS
 	"_GRB_BACKEND=hyperdags"
 	"_GRB_WITH_HYPERDAGS_USING=${WITH_HYPERDAGS_USING}"
 )
+set( PROFILE_SELECTION_DEFS
+	"_GRB_BACKEND=profile"
+	"_GRB_WITH_PROFILE_USING=${WITH_PROFILE_USING}"
+)
 set( NONBLOCKING_SELECTION_DEFS "_GRB_BACKEND=nonblocking" )
 set( BSP1D_SELECTION_DEFS
 		"_GRB_BACKEND=BSP1D"
@@ -63,8 +69,14 @@ set( HYBRID_SELECTION_DEFS
 # definition to set if not depending on libnuma
 set( NO_NUMA_DEF "_GRB_NO_LIBNUMA" )
 
+# definition to set if vector sparsity metadata is bit-packed
+set( COMPACT_COORDINATES_DEF "_GRB_COMPACT_COORDINATES" )
+
+# definition to set if shared containers are placed by first touch
+set( NUMA_FIRST_TOUCH_DEF "_GRB_NUMA_FIRST_TOUCH" )
+
 ### **ALL** BACKENDS, EVEN IF NOT ENABLED BY USER
-set( ALL_BACKENDS "reference" "reference_omp" "hyperdags" "nonblocking" "bsp1d" "hybrid" )
+set( ALL_BACKENDS "reference" "reference_omp" "hyperdags" "profile" "nonblocking" "bsp1d" "hybrid" )
 
 # list of user-enabled backends, for tests and wrapper scripts (do not change!)
 set( AVAILABLE_BACKENDS "" )
@@ -86,6 +98,10 @@ if( WITH_HYPERDAGS_BACKEND )
 	list( APPEND AVAILABLE_BACKENDS "hyperdags" )
 endif()
 
+if( WITH_PROFILE_BACKEND )
+	list( APPEND AVAILABLE_BACKENDS "profile" )
+endif()
+
 if( WITH_NONBLOCKING_BACKEND )
 	list( APPEND AVAILABLE_BACKENDS "nonblocking" )
 endif()
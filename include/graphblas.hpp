@@ -281,7 +281,11 @@
  *   -# grb::hyperdags, a backend that captures the meta-data of computations
  *      while delegating the actual work to the #grb::reference backend. At
  *      program exit, the #grb::hyperdags backend dumps a HyperDAG of the
- *      computations performed.
+ *      computations performed;
+ *   -# grb::profile, a backend that times every primitive and estimates the
+ *      work it performs, while delegating the actual work to the
+ *      #grb::reference backend. At program exit, the #grb::profile backend
+ *      prints a report of the time and work per primitive and call site.
  *
  * Additionally, the following backends may be enabled by providing their
  * dependences before building ALP:
@@ -27,8 +27,14 @@
 #ifndef _H_GRB_COSSIM
 #define _H_GRB_COSSIM
 
+#include <cmath> // std::sqrt
+#include <vector>
+#include <utility> // std::pair
+#include <algorithm> // std::push_heap, std::pop_heap, std::sort_heap
+
 #include <graphblas.hpp>
 #include <graphblas/algorithms/norm.hpp>
+#include <graphblas/algorithms/utils.hpp>
 
 
 #define NO_CAST_ASSERT( x, y, z )                                                                       \
@@ -50,6 +56,266 @@ namespace grb {
 
 	namespace algorithms {
 
+		namespace internal {
+
+			/**
+			 * \internal
+			 * Stores the local nonzeroes of \a A in compressed form, with either the
+			 * rows or, if \a by_column is <tt>true</tt>, the columns of \a A as the
+			 * major dimension. If \a gather is <tt>true</tt>, every user process
+			 * obtains all nonzeroes of \a A.
+			 *
+			 * On output, major index \f$ i \f$ has minor indices
+			 * <tt>indices[ offsets[ i ] ]</tt> up to
+			 * <tt>indices[ offsets[ i + 1 ] ]</tt>, with the corresponding
+			 * \a values.
+			 * \endinternal
+			 */
+			template< typename D, typename NZType >
+			RC cosine_compress(
+				const Matrix< NZType > &A,
+				const D &one,
+				const bool by_column,
+				const bool gather,
+				std::vector< size_t > &offsets,
+				std::vector< size_t > &indices,
+				std::vector< D > &values
+			) {
+				const size_t major = by_column ? ncols( A ) : nrows( A );
+				std::vector< size_t > majors, minors;
+				std::vector< D > buffer;
+				RC ret = SUCCESS;
+
+				// collect the local nonzeroes
+				try {
+					const size_t local = nnz( A ) / spmd<>::nprocs();
+					majors.reserve( local );
+					minors.reserve( local );
+					buffer.reserve( local );
+					size_t row, col;
+					for( const auto &nz : A ) {
+						nonzero_indices( nz, row, col );
+						const D value = nonzero_value( nz, one );
+						majors.push_back( by_column ? col : row );
+						minors.push_back( by_column ? row : col );
+						buffer.push_back( value );
+					}
+				} catch( const std::bad_alloc & ) {
+					ret = OUTOFMEM;
+				}
+				if( collectives<>::allreduce( ret, operators::any_or< RC >() ) !=
+					SUCCESS
+				) {
+					return PANIC;
+				}
+				if( gather ) {
+					ret = ret ? ret : allgather( majors );
+					ret = ret ? ret : allgather( minors );
+					ret = ret ? ret : allgather( buffer );
+				}
+				if( ret != SUCCESS ) {
+					return ret;
+				}
+
+				// counting sort on the major indices
+				try {
+					offsets.assign( major + 1, 0 );
+					for( const size_t &i : majors ) {
+						(void) ++offsets[ i + 1 ];
+					}
+					for( size_t i = 0; i < major; ++i ) {
+						offsets[ i + 1 ] += offsets[ i ];
+					}
+					indices.resize( majors.size() );
+					values.resize( majors.size() );
+					std::vector< size_t > pos( offsets.begin(), offsets.end() - 1 );
+					for( size_t k = 0; k < majors.size(); ++k ) {
+						const size_t dest = pos[ majors[ k ] ]++;
+						indices[ dest ] = minors[ k ];
+						values[ dest ] = buffer[ k ];
+					}
+				} catch( const std::bad_alloc & ) {
+					ret = OUTOFMEM;
+				}
+				if( collectives<>::allreduce( ret, operators::any_or< RC >() ) !=
+					SUCCESS
+				) {
+					return PANIC;
+				}
+				return ret;
+			}
+
+			/**
+			 * \internal
+			 * Computes the \a k most similar corpus rows for every local query row.
+			 *
+			 * Row \f$ i \f$ of \f$ QC^T \f$ is accumulated by Gustavson's method
+			 * into a sparse accumulator of size \f$ n_C \f$: for every feature of
+			 * query \f$ i \f$, the corpus rows holding that feature are looked up in
+			 * the feature-major index of \f$ C \f$. Only the touched entries are
+			 * normalised, passed through a bounded heap of size \a k, and reset,
+			 * so that no work or memory is spent on absent pairs. Query rows are
+			 * distributed dynamically over threads in blocks on shared-memory
+			 * parallel backends. If \a gathered is <tt>true</tt>, every user process
+			 * holds all queries, and processes only those whose index modulo the
+			 * number of processes equals its ID.
+			 *
+			 * On output, \a rows, \a cols, and \a similarities hold the retained
+			 * pairs.
+			 * \endinternal
+			 */
+			template<
+				typename OutputType, typename QueryType, typename CorpusType,
+				class Ring, class Division
+			>
+			RC cosine_topk(
+				const std::vector< size_t > &q_offsets,
+				const std::vector< size_t > &q_features,
+				const std::vector< QueryType > &q_values,
+				const std::vector< size_t > &c_offsets,
+				const std::vector< size_t > &c_rows,
+				const std::vector< CorpusType > &c_values,
+				const std::vector< OutputType > &c_norms,
+				const size_t k,
+				const bool gathered,
+				const Ring &ring,
+				const Division &div,
+				std::vector< size_t > &rows,
+				std::vector< size_t > &cols,
+				std::vector< OutputType > &similarities
+			) {
+				typedef std::pair< OutputType, size_t > Candidate;
+				typedef typename Ring::D3 ProductType;
+				const size_t nq = q_offsets.size() - 1;
+				const size_t nc = c_norms.size();
+				const OutputType zero = ring.template getZero< OutputType >();
+				const size_t s = spmd<>::pid();
+				const size_t P = gathered ? spmd<>::nprocs() : 1;
+
+				const size_t threads = local_threads();
+
+				std::vector< OutputType > accumulators;
+				std::vector< char > touched;
+				std::vector< std::vector< size_t > > thread_rows, thread_cols;
+				std::vector< std::vector< OutputType > > thread_similarities;
+				std::vector< RC > rcs;
+				try {
+					accumulators.assign( threads * nc, zero );
+					touched.assign( threads * nc, 0 );
+					thread_rows.resize( threads );
+					thread_cols.resize( threads );
+					thread_similarities.resize( threads );
+					rcs.assign( threads, SUCCESS );
+				} catch( const std::bad_alloc & ) {
+					return OUTOFMEM;
+				}
+
+				// a candidate precedes another if it is more similar, with ties broken
+				// by the lower corpus row
+				const auto better = []( const Candidate &a, const Candidate &b ) {
+					return a.first > b.first ||
+						(a.first == b.first && a.second < b.second);
+				};
+
+				#pragma omp parallel num_threads( threads ) if( threads > 1 )
+				{
+					size_t t = 0;
+#ifdef _GRB_WITH_OMP
+					t = static_cast< size_t >( omp_get_thread_num() );
+#endif
+					OutputType * const accumulator = accumulators.data() + t * nc;
+					char * const seen = touched.data() + t * nc;
+					std::vector< size_t > nonzeroes;
+					std::vector< Candidate > heap;
+					const auto &add = ring.getAdditiveOperator();
+					const auto &mul = ring.getMultiplicativeOperator();
+
+					#pragma omp for schedule( dynamic, 64 )
+					for( size_t i = 0; i < nq; ++i ) {
+						if( rcs[ t ] != SUCCESS || (P > 1 && i % P != s) ||
+							q_offsets[ i ] == q_offsets[ i + 1 ]
+						) {
+							continue;
+						}
+						try {
+							// accumulate row i of Q C^T and the norm of query i
+							OutputType q_norm = zero;
+							ProductType temp;
+							for( size_t e = q_offsets[ i ]; e < q_offsets[ i + 1 ]; ++e ) {
+								const size_t f = q_features[ e ];
+								(void) grb::apply( temp, q_values[ e ], q_values[ e ], mul );
+								(void) grb::foldl( q_norm, temp, add );
+								for( size_t g = c_offsets[ f ]; g < c_offsets[ f + 1 ]; ++g ) {
+									const size_t j = c_rows[ g ];
+									if( !seen[ j ] ) {
+										seen[ j ] = 1;
+										nonzeroes.push_back( j );
+									}
+									(void) grb::apply( temp, q_values[ e ], c_values[ g ], mul );
+									(void) grb::foldl( accumulator[ j ], temp, add );
+								}
+							}
+							q_norm = std::sqrt( q_norm );
+
+							// retain the k most similar corpus rows
+							for( const size_t &j : nonzeroes ) {
+								OutputType denominator = q_norm;
+								(void) grb::foldl( denominator, c_norms[ j ], mul );
+								if( denominator != zero && accumulator[ j ] != zero ) {
+									Candidate candidate( zero, j );
+									(void) grb::apply( candidate.first, accumulator[ j ],
+										denominator, div );
+									if( heap.size() < k ) {
+										heap.push_back( candidate );
+										std::push_heap( heap.begin(), heap.end(), better );
+									} else if( better( candidate, heap.front() ) ) {
+										std::pop_heap( heap.begin(), heap.end(), better );
+										heap.back() = candidate;
+										std::push_heap( heap.begin(), heap.end(), better );
+									}
+								}
+								accumulator[ j ] = zero;
+								seen[ j ] = 0;
+							}
+							nonzeroes.clear();
+
+							std::sort_heap( heap.begin(), heap.end(), better );
+							for( const Candidate &candidate : heap ) {
+								thread_rows[ t ].push_back( i );
+								thread_cols[ t ].push_back( candidate.second );
+								thread_similarities[ t ].push_back( candidate.first );
+							}
+							heap.clear();
+						} catch( const std::bad_alloc & ) {
+							rcs[ t ] = OUTOFMEM;
+						}
+					}
+				}
+				for( const RC &rc : rcs ) {
+					if( rc != SUCCESS ) {
+						return rc;
+					}
+				}
+
+				// concatenate the retained pairs of all threads
+				try {
+					for( size_t t = 0; t < threads; ++t ) {
+						rows.insert( rows.end(), thread_rows[ t ].begin(),
+							thread_rows[ t ].end() );
+						cols.insert( cols.end(), thread_cols[ t ].begin(),
+							thread_cols[ t ].end() );
+						similarities.insert( similarities.end(),
+							thread_similarities[ t ].begin(),
+							thread_similarities[ t ].end() );
+					}
+				} catch( const std::bad_alloc & ) {
+					return OUTOFMEM;
+				}
+				return SUCCESS;
+			}
+
+		} // end namespace ``grb::algorithms::internal''
+
 		/**
 		 * Computes the cosine similarity.
 		 *
@@ -180,9 +446,9 @@ namespace grb {
 			} else {
 				// cannot stream each vector once, stream each one twice instead using
 				// standard grb functions
-				rc = grb::norm2( nominator, x, ring );
+				rc = grb::algorithms::norm2( nominator, x, ring );
 				if( rc == SUCCESS ) {
-					rc = grb::norm2( denominator, y, ring );
+					rc = grb::algorithms::norm2( denominator, y, ring );
 				}
 				if( rc == SUCCESS ) {
 					rc = grb::foldl( denominator, nominator,
@@ -209,6 +475,218 @@ namespace grb {
 			return rc;
 		}
 
+		/**
+		 * Computes the cosine similarities between the rows of two matrices,
+		 * retaining only the \a k largest similarities of every row.
+		 *
+		 * Given a query matrix \f$ Q \f$ and a corpus matrix \f$ C \f$ whose rows
+		 * are feature vectors over the same \f$ f \f$ features, this function
+		 * computes \f$ S \f$ with \f$ S_{ij} \f$ the cosine similarity between
+		 * row \f$ i \f$ of \f$ Q \f$ and row \f$ j \f$ of \f$ C \f$, as defined
+		 * by #grb::algorithms::cosine_similarity, and keeps per row of \f$ S \f$
+		 * only the \a k entries of largest similarity. For all-pairs similarity,
+		 * pass the same matrix as \a Q and \a C.
+		 *
+		 * The similarities follow from the sparse product \f$ QC^T \f$, scaled by
+		 * the norms of the rows of \f$ Q \f$ and \f$ C \f$. The product is
+		 * computed row by row, and the top-\a k selection is applied to every row
+		 * as soon as it is accumulated. Hence only pairs of rows that share a
+		 * feature are considered, and neither \f$ QC^T \f$ nor the dense
+		 * similarity matrix is ever materialised. The norms of the rows of
+		 * \f$ C \f$ are computed once and reused for all queries.
+		 *
+		 * @tparam descr      The descriptor under which to perform the computation.
+		 *                    Only #grb::descriptors::no_casting and
+		 *                    #grb::descriptors::transpose_matrix are supported;
+		 *                    the latter takes the feature vectors to be the columns
+		 *                    rather than the rows of both \a Q and \a C.
+		 * @tparam OutputType The type of the output similarities, which must be a
+		 *                    floating-point type.
+		 * @tparam InputType1 The type of the query matrix.
+		 * @tparam InputType2 The type of the corpus matrix.
+		 * @tparam Ring       The semiring used.
+		 * @tparam Division   Which binary operator correspond to division
+		 *                    corresponding to the given \a Ring.
+		 *
+		 * @param[out] S    An \f$ n_Q \times n_C \f$ matrix. On output, if
+		 *                  #grb::SUCCESS is returned, every row \f$ i \f$ holds
+		 *                  the at most \a k largest similarities of query
+		 *                  \f$ i \f$, with ties broken in favour of the lower
+		 *                  corpus row. Zero similarities are not stored.
+		 * @param[in]  Q    The \f$ n_Q \times f \f$ query matrix, or the
+		 *                  \f$ f \times n_Q \f$ one under
+		 *                  #grb::descriptors::transpose_matrix.
+		 * @param[in]  C    The \f$ n_C \times f \f$ corpus matrix, or the
+		 *                  \f$ f \times n_C \f$ one under
+		 *                  #grb::descriptors::transpose_matrix.
+		 * @param[in]  k    The number of similarities to retain per query.
+		 * @param[in]  ring The semiring to compute over.
+		 * @param[in]  div  The division operator corresponding to \a ring.
+		 *
+		 * \note Pattern matrices are supported, and are interpreted as holding the
+		 *       multiplicative identity of \a ring at every nonzero.
+		 *
+		 * \note When \a Q and \a C are the same matrix, the similarity of every
+		 *       nonzero row with itself is included.
+		 *
+		 * The argument \a div is optional. It will map to grb::operators::divide by
+		 * default.
+		 *
+		 * @returns #grb::SUCCESS  If the computation was successful.
+		 * @returns #grb::MISMATCH If the number of features of \a Q and \a C do
+		 *                         not match, or if the dimensions of \a S do not
+		 *                         match the number of queries and corpus rows. The
+		 *                         output is left untouched.
+		 * @returns #grb::ILLEGAL  If \a k is zero. The output is left untouched.
+		 * @returns #grb::OUTOFMEM If the workspace could not be allocated. The
+		 *                         output is left untouched.
+		 * @returns #grb::PANIC    If an unrecoverable error has been encountered. The
+		 *                         output as well as the state of ALP/GraphBLAS is
+		 *                         undefined.
+		 *
+		 * \par Performance semantics
+		 *
+		 *   -# This function allocates \f$ \Theta( f + n_Q + \mathit{nnz}(Q) +
+		 *      \mathit{nnz}(C) ) \f$ bytes of dynamic memory, plus
+		 *      \f$ \Theta( n_C + k ) \f$ bytes per thread, plus storage for the
+		 *      \f$ \mathcal{O}( n_Q k ) \f$ retained similarities.
+		 *   -# The work is proportional to the number of nonzeroes in
+		 *      \f$ QC^T \f$ times \f$ \log k \f$, plus the number of
+		 *      multiplications required to form \f$ QC^T \f$.
+		 *   -# With more than one user process, every process receives all of
+		 *      \f$ C \f$, which incurs \f$ \Theta( \mathit{nnz}(C) ) \f$
+		 *      inter-process data movement per process and \f$ \Theta( P ) \f$
+		 *      synchronisations, while the rows of \f$ Q \f$ remain local.
+		 *      Under #grb::descriptors::transpose_matrix, every process receives
+		 *      all of \f$ Q \f$ as well, and computes a \f$ 1 / P \f$ share of
+		 *      its queries.
+		 *
+		 * For the performance semantics of building the output \a S, please see
+		 * the specification of #grb::buildMatrixUnique.
+		 */
+		template<
+			Descriptor descr = descriptors::no_operation,
+			typename OutputType,
+			typename InputType1,
+			typename InputType2,
+			class Ring,
+			class Division = grb::operators::divide<
+				typename Ring::D3, typename Ring::D3, typename Ring::D4
+			>
+		>
+		RC all_pairs_cosine_similarity(
+			Matrix< OutputType > &S,
+			const Matrix< InputType1 > &Q, const Matrix< InputType2 > &C,
+			const size_t k,
+			const Ring &ring = Ring(), const Division &div = Division()
+		) {
+			static_assert( std::is_floating_point< OutputType >::value,
+				"Cosine similarity requires a floating-point output type." );
+
+			// static sanity checks
+			NO_CAST_ASSERT( ( !(descr & descriptors::no_casting) ||
+					std::is_void< InputType1 >::value ||
+					std::is_same< InputType1, typename Ring::D1 >::value
+				), "grb::algorithms::all_pairs_cosine_similarity",
+				"called with a query matrix value type that does not match the "
+				"first domain of the given semiring" );
+			NO_CAST_ASSERT( ( !(descr & descriptors::no_casting) ||
+					std::is_void< InputType2 >::value ||
+					std::is_same< InputType2, typename Ring::D2 >::value
+				), "grb::algorithms::all_pairs_cosine_similarity",
+				"called with a corpus matrix value type that does not match the "
+				"second domain of the given semiring" );
+			NO_CAST_ASSERT( ( !(descr & descriptors::no_casting) ||
+					std::is_same< OutputType, typename Ring::D4 >::value
+				), "grb::algorithms::all_pairs_cosine_similarity",
+				"called with an output matrix value type that does not match the "
+				"fourth domain of the given semiring" );
+			NO_CAST_ASSERT( ( !(descr & descriptors::no_casting) ||
+					std::is_same< typename Ring::D3, typename Ring::D4 >::value
+				), "grb::algorithms::all_pairs_cosine_similarity",
+				"called with a semiring that has unequal additive input domains" );
+			static_assert( (descr & ~(descriptors::no_casting |
+					descriptors::transpose_matrix)) == 0,
+				"grb::algorithms::all_pairs_cosine_similarity only supports the "
+				"no_casting and transpose_matrix descriptors" );
+
+			// whether the feature vectors are the columns of Q and C
+			constexpr bool transposed = descr & descriptors::transpose_matrix;
+			const size_t nq = transposed ? ncols( Q ) : nrows( Q );
+			const size_t nc = transposed ? ncols( C ) : nrows( C );
+			const size_t f = transposed ? nrows( Q ) : ncols( Q );
+
+			// run-time sanity checks
+			if( f != (transposed ? nrows( C ) : ncols( C )) ||
+				nrows( S ) != nq || ncols( S ) != nc
+			) {
+				return MISMATCH;
+			}
+			if( k == 0 ) {
+				return ILLEGAL;
+			}
+
+			typedef typename Ring::D1 QueryType;
+			typedef typename Ring::D2 CorpusType;
+			const OutputType zero = ring.template getZero< OutputType >();
+
+			// the local query rows, and a feature-major index of the full corpus; a
+			// transposed query matrix is distributed by feature, and hence gathered
+			const bool gather_queries = transposed && spmd<>::nprocs() > 1;
+			std::vector< size_t > q_offsets, q_features, c_offsets, c_rows;
+			std::vector< QueryType > q_values;
+			std::vector< CorpusType > c_values;
+			RC ret = internal::cosine_compress( Q,
+				ring.template getOne< QueryType >(), transposed, gather_queries,
+				q_offsets, q_features, q_values );
+			ret = ret ? ret : internal::cosine_compress( C,
+				ring.template getOne< CorpusType >(), !transposed, true,
+				c_offsets, c_rows, c_values );
+
+			// precompute the corpus norms
+			std::vector< OutputType > c_norms;
+			if( ret == SUCCESS ) {
+				try {
+					c_norms.assign( nc, zero );
+				} catch( const std::bad_alloc & ) {
+					ret = OUTOFMEM;
+				}
+			}
+			if( ret == SUCCESS ) {
+				typename Ring::D3 temp;
+				for( size_t g = 0; g < c_rows.size(); ++g ) {
+					(void) grb::apply( temp, c_values[ g ], c_values[ g ],
+						ring.getMultiplicativeOperator() );
+					(void) grb::foldl( c_norms[ c_rows[ g ] ], temp,
+						ring.getAdditiveOperator() );
+				}
+				for( size_t j = 0; j < nc; ++j ) {
+					c_norms[ j ] = std::sqrt( c_norms[ j ] );
+				}
+			}
+
+			// compute the top-k similarities of the local query rows
+			std::vector< size_t > rows, cols;
+			std::vector< OutputType > similarities;
+			ret = ret ? ret : internal::cosine_topk( q_offsets, q_features, q_values,
+				c_offsets, c_rows, c_values, c_norms, k, gather_queries, ring, div,
+				rows, cols, similarities );
+			if( collectives<>::allreduce( ret, operators::any_or< RC >() ) !=
+				SUCCESS
+			) {
+				return PANIC;
+			}
+			if( ret != SUCCESS ) {
+				return ret;
+			}
+
+			// every user process contributes the similarities of its queries
+			ret = clear( S );
+			ret = ret ? ret : buildMatrixUnique( S, rows.data(), cols.data(),
+				similarities.data(), similarities.size(), PARALLEL );
+			return ret;
+		}
+
 	} // end namespace algorithms
 
 } // end namespace grb
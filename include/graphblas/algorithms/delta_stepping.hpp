@@ -0,0 +1,316 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Implements single-source shortest paths by delta-stepping.
+ */
+
+#ifndef _H_GRB_ALGORITHMS_DELTA_STEPPING
+#define _H_GRB_ALGORITHMS_DELTA_STEPPING
+
+#include <vector>
+#include <utility> // std::swap
+
+#include <graphblas.hpp>
+
+
+namespace grb {
+
+	namespace algorithms {
+
+		namespace internal {
+
+			/**
+			 * \internal
+			 * Splits the edges of \a A into the light edges of weight at most
+			 * \a delta, and the heavy edges of larger weight.
+			 *
+			 * @returns #grb::ILLEGAL If \a A has a negative edge weight.
+			 * \endinternal
+			 */
+			template< typename IOType, typename NZType >
+			RC delta_stepping_split(
+				Matrix< NZType > &light,
+				Matrix< NZType > &heavy,
+				const Matrix< NZType > &A,
+				const IOType delta
+			) {
+				std::vector< size_t > light_rows, light_cols, heavy_rows, heavy_cols;
+				std::vector< NZType > light_vals, heavy_vals;
+				RC ret = SUCCESS;
+				try {
+					for( const auto &triple : A ) {
+						const IOType weight = static_cast< IOType >( triple.second );
+						if( weight < static_cast< IOType >( 0 ) ) {
+							ret = ILLEGAL;
+						} else if( weight <= delta ) {
+							light_rows.push_back( triple.first.first );
+							light_cols.push_back( triple.first.second );
+							light_vals.push_back( triple.second );
+						} else {
+							heavy_rows.push_back( triple.first.first );
+							heavy_cols.push_back( triple.first.second );
+							heavy_vals.push_back( triple.second );
+						}
+					}
+				} catch( const std::bad_alloc & ) {
+					ret = OUTOFMEM;
+				}
+				if( collectives<>::allreduce( ret, operators::any_or< RC >() ) !=
+					SUCCESS
+				) {
+					return PANIC;
+				}
+
+				// every user process contributes its local edges
+				ret = ret ? ret : clear( light );
+				ret = ret ? ret : clear( heavy );
+				ret = ret ? ret : buildMatrixUnique( light,
+					light_rows.data(), light_cols.data(), light_vals.data(),
+					light_vals.size(), PARALLEL );
+				ret = ret ? ret : buildMatrixUnique( heavy,
+					heavy_rows.data(), heavy_cols.data(), heavy_vals.data(),
+					heavy_vals.size(), PARALLEL );
+				return ret;
+			}
+
+			/**
+			 * \internal
+			 * Lowers the tentative \a distances and the \a pending distances to the
+			 * requested distances \a request, wherever the latter are strictly
+			 * smaller. On output, \a improved holds <tt>true</tt> exactly at those
+			 * vertices.
+			 * \endinternal
+			 */
+			template< typename IOType, class MinMonoid, class LessThan >
+			RC delta_stepping_relax(
+				Vector< IOType > &distances,
+				Vector< IOType > &pending,
+				Vector< bool > &improved,
+				const Vector< IOType > &request,
+				const MinMonoid &min,
+				const LessThan &less_than
+			) {
+				RC ret = clear( improved );
+				ret = ret ? ret : eWiseApply( improved, request, distances, less_than );
+				ret = ret ? ret : foldl( distances, improved, request, min );
+				ret = ret ? ret : foldl( pending, improved, request, min );
+				return ret;
+			}
+
+		} // end namespace ``grb::algorithms::internal''
+
+		/**
+		 * Computes single-source shortest paths using delta-stepping.
+		 *
+		 * Delta-stepping by Meyer and Sanders, in the algebraic formulation
+		 * of Sridhar et al. Tentative distances of vertices that are reached but
+		 * not yet settled are kept in a sparse \a pending vector. Each step settles
+		 * the bucket of pending vertices with a distance less than the smallest
+		 * pending distance plus \f$ \Delta \f$: the bucket repeatedly relaxes its
+		 * light edges, of weight at most \f$ \Delta \f$, until no distance within
+		 * the bucket improves, after which its heavy edges are relaxed once. Every
+		 * relaxation is a #grb::vxm over the min-plus semiring, masked to exclude
+		 * the settled vertices.
+		 *
+		 * Empty buckets are skipped, while all work is proportional to the sizes
+		 * of the frontiers and the bucket. A \f$ \Delta \f$ of the order of the
+		 * average edge weight divided by the average degree tends to perform well.
+		 * In the limit of a very small \f$ \Delta \f$ the algorithm resembles
+		 * Dijkstra's algorithm; for a \f$ \Delta \f$ larger than any path length,
+		 * it performs the Bellman-Ford algorithm.
+		 *
+		 * @tparam descr  The descriptor under which to perform the computation.
+		 *                With #grb::descriptors::transpose_matrix, the edges of
+		 *                the graph are those of \f$ A^T \f$.
+		 * @tparam IOType The type of the distances.
+		 * @tparam NZType The type of the edge weights.
+		 *
+		 * @param[out] distances A vector of size \f$ n \f$. On output, if
+		 *                       #grb::SUCCESS is returned, holds the distances from
+		 *                       \a source to every vertex. Vertices that are not
+		 *                       reachable have distance
+		 *                       #grb::identities::infinity.
+		 * @param[in]  A         Matrix representing a directed graph with a
+		 *                       nonzero value at \f$ (i, j) \f$ the weight of the
+		 *                       edge from \f$ i \f$ to \f$ j \f$. All weights must
+		 *                       be non-negative.
+		 * @param[in]  source    The vertex from which distances are computed.
+		 * @param[in]  delta     The bucket width \f$ \Delta \f$, which must be
+		 *                       positive.
+		 *
+		 * To operate, this algorithm requires a workspace of two matrices and five
+		 * vectors. Their sizes must equal those of \a A and \a distances, while
+		 * their contents on input are ignored and those on output are undefined.
+		 * The matrices must have sufficient capacity to hold the light and heavy
+		 * edges of \a A, respectively, or it must be possible to obtain it.
+		 *
+		 * @param[in,out] light     The matrix of light edges.
+		 * @param[in,out] heavy     The matrix of heavy edges.
+		 * @param[in,out] pending   Tentative distances of unsettled vertices.
+		 * @param[in,out] frontier  The vertices to relax the edges of.
+		 * @param[in,out] request   The distances requested by a relaxation.
+		 * @param[in,out] settled   The vertices with final distances.
+		 * @param[in,out] selection A selection of vertices.
+		 *
+		 * @returns #grb::SUCCESS  If the distances were computed.
+		 * @returns #grb::ILLEGAL  If \a A is not square, if \a source is not a
+		 *                         vertex, if \a delta is not positive, or if \a A
+		 *                         has a negative edge weight. In the latter case,
+		 *                         the contents of \a distances and of the
+		 *                         workspace are undefined; otherwise, all outputs
+		 *                         are left untouched.
+		 * @returns #grb::MISMATCH If the size of \a distances or of any workspace
+		 *                         container does not match \a A. All outputs are
+		 *                         left untouched.
+		 * @returns #grb::OUTOFMEM If the light and heavy edges could not be
+		 *                         stored.
+		 * @returns #grb::PANIC    If an unrecoverable error has been encountered. The
+		 *                         output as well as the state of ALP/GraphBLAS is
+		 *                         undefined.
+		 *
+		 * \par Performance semantics
+		 *
+		 *   -# This function allocates \f$ \Theta( m ) \f$ bytes of dynamic
+		 *      memory to split the \f$ m \f$ local edges into light and heavy
+		 *      ones, and frees it before returning.
+		 *
+		 * For performance semantics regarding work, inter-process data movement,
+		 * intra-process data movement, synchronisations, and memory use, please see
+		 * the specification of the ALP primitives this function relies on. These
+		 * performance semantics, with the exception of getters such as #grb::nnz, are
+		 * specific to the backend selected during compilation.
+		 */
+		template<
+			Descriptor descr = descriptors::no_operation,
+			typename IOType, typename NZType
+		>
+		RC delta_stepping(
+			Vector< IOType > &distances,
+			const Matrix< NZType > &A,
+			const size_t source,
+			const IOType delta,
+			Matrix< NZType > &light,
+			Matrix< NZType > &heavy,
+			Vector< IOType > &pending,
+			Vector< IOType > &frontier,
+			Vector< IOType > &request,
+			Vector< bool > &settled,
+			Vector< bool > &selection
+		) {
+			static_assert( !std::is_void< NZType >::value,
+				"Delta-stepping requires edge weights." );
+
+			const Semiring<
+				operators::min< IOType >, operators::add< IOType >,
+				identities::infinity, identities::zero
+			> minPlus;
+			const Monoid< operators::min< IOType >, identities::infinity > min;
+			const operators::less_than< IOType, IOType, bool > less_than;
+
+			// run-time sanity checks
+			const size_t n = nrows( A );
+			if( n != ncols( A ) ) {
+				return ILLEGAL;
+			}
+			if( size( distances ) != n ||
+				nrows( light ) != n || ncols( light ) != n ||
+				nrows( heavy ) != n || ncols( heavy ) != n ||
+				size( pending ) != n ||
+				size( frontier ) != n ||
+				size( request ) != n ||
+				size( settled ) != n ||
+				size( selection ) != n
+			) {
+				return MISMATCH;
+			}
+			if( source >= n || !( delta > static_cast< IOType >( 0 ) ) ) {
+				return ILLEGAL;
+			}
+
+			// initialise
+			RC ret = internal::delta_stepping_split( light, heavy, A, delta );
+			ret = ret ? ret : set( distances, identities::infinity< IOType >::value() );
+			ret = ret ? ret : setElement( distances, static_cast< IOType >( 0 ),
+				source );
+			ret = ret ? ret : clear( pending );
+			ret = ret ? ret : setElement( pending, static_cast< IOType >( 0 ),
+				source );
+			ret = ret ? ret : clear( settled );
+
+			while( ret == SUCCESS && nnz( pending ) > 0 ) {
+				// the next bucket starts at the smallest pending distance
+				IOType lowest = identities::infinity< IOType >::value();
+				ret = foldl( lowest, pending, min );
+				const IOType upper = lowest + delta;
+
+				// relax light edges from the bucket until its distances are final
+				ret = ret ? ret : clear( selection );
+				ret = ret ? ret : eWiseApply( selection, pending, upper, less_than );
+				ret = ret ? ret : clear( frontier );
+				ret = ret ? ret : set( frontier, selection, pending );
+				while( ret == SUCCESS && nnz( frontier ) > 0 ) {
+					ret = clear( request );
+					ret = ret ? ret : vxm< descr | descriptors::invert_mask >(
+						request, settled, frontier, light, minPlus );
+					ret = ret ? ret : internal::delta_stepping_relax(
+						distances, pending, selection, request, min, less_than );
+
+					// improved vertices in the bucket form the next frontier
+					ret = ret ? ret : clear( frontier );
+					ret = ret ? ret : set( frontier, selection, request );
+					ret = ret ? ret : clear( selection );
+					ret = ret ? ret : eWiseApply( selection, frontier, upper, less_than );
+					ret = ret ? ret : clear( request );
+					ret = ret ? ret : set( request, selection, frontier );
+					if( ret == SUCCESS ) {
+						std::swap( frontier, request );
+					}
+				}
+
+				// settle the bucket, and remove it from the pending vertices
+				ret = ret ? ret : clear( selection );
+				ret = ret ? ret : eWiseApply( selection, pending, upper, less_than );
+				ret = ret ? ret : clear( frontier );
+				ret = ret ? ret : set( frontier, selection, pending );
+				ret = ret ? ret : set( settled, selection, true );
+				ret = ret ? ret : clear( request );
+				ret = ret ? ret : set< descriptors::invert_mask >(
+					request, selection, pending );
+				if( ret == SUCCESS ) {
+					std::swap( pending, request );
+				}
+
+				// relax the heavy edges from the bucket once
+				ret = ret ? ret : clear( request );
+				ret = ret ? ret : vxm< descr | descriptors::invert_mask >(
+					request, settled, frontier, heavy, minPlus );
+				ret = ret ? ret : internal::delta_stepping_relax(
+					distances, pending, selection, request, min, less_than );
+			}
+
+			return ret;
+		}
+
+	} // end namespace ``grb::algorithms''
+
+} // end namespace ``grb''
+
+#endif // end _H_GRB_ALGORITHMS_DELTA_STEPPING
+
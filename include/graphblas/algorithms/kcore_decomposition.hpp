@@ -28,13 +28,220 @@
 #ifndef _H_GRB_KCORE_DECOMPOSITION
 #define _H_GRB_KCORE_DECOMPOSITION
 
+#include <vector>
+#include <utility> // std::pair
+#include <algorithm> // std::max
+
 #include <graphblas.hpp>
+#include <graphblas/algorithms/utils.hpp>
 
 
 namespace grb {
 
 	namespace algorithms {
 
+		namespace internal {
+
+			/**
+			 * \internal
+			 * The smallest coreness level \f$ k \f$ at which a vertex with the given
+			 * remaining \a degree is peeled; i.e., the smallest non-negative integer
+			 * \f$ k \geq \f$ \a degree.
+			 * \endinternal
+			 */
+			template< typename IOType >
+			size_t kcore_bucket( const IOType &degree ) {
+				if( !( degree > static_cast< IOType >( 0 ) ) ) {
+					return 0;
+				}
+				size_t bucket = static_cast< size_t >( degree );
+				if( static_cast< IOType >( bucket ) < degree ) {
+					(void) ++bucket;
+				}
+				return bucket;
+			}
+
+			/**
+			 * \internal
+			 * The bucket-queue variant of #grb::algorithms::kcore_decomposition, after
+			 * Batagelj and Zaversnik. Requires that \a A is locally available.
+			 *
+			 * Vertices are kept in buckets indexed by the coreness level at which
+			 * their remaining degree allows them to be peeled. Level \f$ k \f$ starts
+			 * from the live vertices in bucket \f$ k \f$, and peels in rounds: all
+			 * vertices of a round are removed, after which only their neighbours have
+			 * their degrees decremented. A neighbour whose degree drops to at most
+			 * \f$ k \f$ joins the next round; one whose bucket changes otherwise is
+			 * re-inserted lazily into its new bucket, leaving a stale entry in its old
+			 * one. Work thus is \f$ \Theta( n + m + k_{\max} ) \f$.
+			 *
+			 * Rounds of sufficient size are processed by multiple threads on
+			 * shared-memory parallel backends, with atomic degree decrements. Each
+			 * thread collects its next-round vertices and re-inserted vertices in its
+			 * own buffers, which are merged between rounds.
+			 * \endinternal
+			 */
+			template< Descriptor descr, typename IOType, typename NZType >
+			RC kcore_bucketed(
+				const Matrix< NZType > &A,
+				Vector< IOType > &core,
+				IOType &k
+			) {
+				constexpr bool transposed = descr & descriptors::transpose_matrix;
+				constexpr size_t parallel_threshold = 1024;
+				const size_t n = nrows( A );
+				assert( spmd<>::nprocs() == 1 );
+
+				const size_t threads = local_threads();
+
+				std::vector< size_t > offsets, sources;
+				std::vector< IOType > weights, degrees, cores;
+				std::vector< char > alive;
+				std::vector< std::vector< size_t > > buckets, next;
+				std::vector< std::vector< std::pair< size_t, size_t > > > moved;
+				std::vector< size_t > frontier;
+				try {
+					// build the transposed adjacency and compute the (weighted) degrees
+					offsets.assign( n + 1, 0 );
+					degrees.assign( n, static_cast< IOType >( 0 ) );
+					size_t row, col;
+					for( const auto &nz : A ) {
+						nonzero_indices( nz, row, col );
+						const IOType weight = nonzero_value( nz, static_cast< IOType >( 1 ) );
+						if( transposed ) {
+							std::swap( row, col );
+						}
+						degrees[ row ] += weight;
+						(void) ++offsets[ col + 1 ];
+					}
+					for( size_t i = 0; i < n; ++i ) {
+						offsets[ i + 1 ] += offsets[ i ];
+					}
+					sources.resize( offsets[ n ] );
+					weights.resize( offsets[ n ] );
+					{
+						std::vector< size_t > pos( offsets.begin(), offsets.end() - 1 );
+						for( const auto &nz : A ) {
+							nonzero_indices( nz, row, col );
+							const IOType weight = nonzero_value( nz, static_cast< IOType >( 1 ) );
+							if( transposed ) {
+								std::swap( row, col );
+							}
+							sources[ pos[ col ] ] = row;
+							weights[ pos[ col ] ] = weight;
+							(void) ++pos[ col ];
+						}
+					}
+
+					// bucket the vertices by their initial degrees
+					size_t max_bucket = 0;
+					for( size_t i = 0; i < n; ++i ) {
+						max_bucket = std::max( max_bucket, kcore_bucket( degrees[ i ] ) );
+					}
+					buckets.resize( max_bucket + 1 );
+					for( size_t i = 0; i < n; ++i ) {
+						buckets[ kcore_bucket( degrees[ i ] ) ].push_back( i );
+					}
+					cores.assign( n, static_cast< IOType >( 0 ) );
+					alive.assign( n, 1 );
+					next.resize( threads );
+					moved.resize( threads );
+					frontier.reserve( n );
+				} catch( const std::bad_alloc & ) {
+					return OUTOFMEM;
+				}
+
+				size_t count = 0;
+				size_t level = 0;
+				for( ; count < n; ++level ) {
+					assert( level < buckets.size() );
+					const IOType current_k = static_cast< IOType >( level );
+
+					// gather the live vertices of this level, dropping stale entries
+					frontier.clear();
+					for( const size_t i : buckets[ level ] ) {
+						if( alive[ i ] ) {
+							assert( degrees[ i ] <= current_k );
+							frontier.push_back( i );
+						}
+					}
+					std::vector< size_t >().swap( buckets[ level ] );
+
+					while( !frontier.empty() ) {
+						const size_t size = frontier.size();
+						#pragma omp parallel num_threads( threads ) \
+							if( threads > 1 && size >= parallel_threshold )
+						{
+							size_t t = 0;
+#ifdef _GRB_WITH_OMP
+							t = static_cast< size_t >( omp_get_thread_num() );
+#endif
+							// peel this round
+							#pragma omp for schedule( static )
+							for( size_t f = 0; f < size; ++f ) {
+								const size_t i = frontier[ f ];
+								cores[ i ] = current_k;
+								alive[ i ] = 0;
+							}
+
+							// decrement the degrees of the live neighbours
+							#pragma omp for schedule( dynamic, 64 )
+							for( size_t f = 0; f < size; ++f ) {
+								const size_t i = frontier[ f ];
+								for( size_t e = offsets[ i ]; e < offsets[ i + 1 ]; ++e ) {
+									const size_t j = sources[ e ];
+									if( !alive[ j ] ) {
+										continue;
+									}
+									IOType old_degree;
+									#pragma omp atomic capture
+									{
+										old_degree = degrees[ j ];
+										degrees[ j ] -= weights[ e ];
+									}
+									const IOType new_degree = old_degree - weights[ e ];
+									if( new_degree <= current_k ) {
+										if( old_degree > current_k ) {
+											next[ t ].push_back( j );
+										}
+									} else {
+										const size_t bucket = kcore_bucket( new_degree );
+										if( bucket < kcore_bucket( old_degree ) ) {
+											moved[ t ].push_back( std::make_pair( bucket, j ) );
+										}
+									}
+								}
+							}
+						}
+						count += size;
+
+						// merge the per-thread buffers
+						frontier.clear();
+						for( size_t t = 0; t < threads; ++t ) {
+							frontier.insert( frontier.end(), next[ t ].begin(), next[ t ].end() );
+							next[ t ].clear();
+							for( const auto &entry : moved[ t ] ) {
+								buckets[ entry.first ].push_back( entry.second );
+							}
+							moved[ t ].clear();
+						}
+					}
+				}
+
+				// write back
+				RC ret = set( core, static_cast< IOType >( 0 ) );
+				ret = ret ? ret : eWiseLambda( [ &core, &cores ]( const size_t i ) {
+						core[ i ] = cores[ i ];
+					}, core );
+				ret = ret ? ret : wait();
+				if( ret == SUCCESS ) {
+					k = static_cast< IOType >( level );
+				}
+				return ret;
+			}
+
+		} // end namespace ``grb::algorithms::internal''
+
 		/**
 		 * The \f$ k \f$-core decomposition algorithm.
 		 *
@@ -82,6 +289,8 @@ namespace grb {
 		 *                         untouched.
 		 * @returns #grb::ILLEGAL  If the capacity of one or more of \a core and the
 		 *                         buffer vectors is less than \f$ n \f$.
+		 * @returns #grb::OUTOFMEM If \a bucketed is <tt>true</tt> and its workspace
+		 *                         could not be allocated.
 		 * @returns #grb::PANIC    If an unrecoverable error has been encountered. The
 		 *                         output as well as the state of ALP/GraphBLAS is
 		 *                         undefined.
@@ -116,11 +325,30 @@ namespace grb {
 		 * For the above considerations, the default for \a criticalSection is
 		 * presently set to <tt>false</tt>.
 		 *
+		 * @tparam bucketed Both of the above variants scan all unfinished vertices
+		 *                  for every coreness level and every peeling round, and
+		 *                  hence perform \f$ \Omega( k_{\max} n ) \f$ work. Setting
+		 *                  this template argument to <tt>true</tt> instead selects a
+		 *                  bucket-queue variant after Batagelj and Zaversnik that
+		 *                  only touches vertices whose degree dropped, for
+		 *                  \f$ \Theta( n + m + k_{\max} ) \f$ work. Large peeling
+		 *                  rounds are processed in parallel on the shared-memory
+		 *                  parallel backends. The output is the same as that of the
+		 *                  other variants. This variant ignores \a criticalSection
+		 *                  and does not use the buffer vectors.
+		 *
+		 * \warning The bucketed variant requires \a A to be locally available. If
+		 *          there are multiple user processes, the pure ALP/GraphBLAS
+		 *          variant is used instead.
+		 *
 		 * \parblock
 		 * \par Performance semantics
 		 *
 		 *   -# This function does not allocate nor free dynamic memory, nor shall it
-		 *      make any system calls.
+		 *      make any system calls, unless \a bucketed is <tt>true</tt>.
+		 *   -# If \a bucketed is <tt>true</tt>, this function allocates
+		 *      \f$ \Theta( n + m + k_{\max} ) \f$ memory, with \f$ m \f$ the
+		 *      number of nonzeroes in \a A, and frees it before returning.
 		 *
 		 * For additional performance semantics regarding work, inter-process data
 		 * movement, intra-process data movement, synchronisations, and memory use,
@@ -136,6 +364,7 @@ namespace grb {
 		template<
 			Descriptor descr = descriptors::no_operation,
 			bool criticalSection = false,
+			bool bucketed = false,
 			typename IOType, typename NZType
 		>
 		RC kcore_decomposition(
@@ -184,6 +413,10 @@ namespace grb {
 				}
 			}
 
+			if( bucketed && spmd<>::nprocs() == 1 ) {
+				return internal::kcore_bucketed< descr >( A, core, k );
+			}
+
 			// Initialise
 			IOType current_k = 0; // current coreness level
 
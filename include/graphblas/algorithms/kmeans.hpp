@@ -29,6 +29,8 @@
 
 #include <chrono>
 #include <random>
+#include <vector>
+#include <algorithm>
 
 #include <assert.h>
 
@@ -39,6 +41,226 @@ namespace grb {
 
 	namespace algorithms {
 
+		namespace internal {
+
+			/**
+			 * \internal
+			 * Copies the points of \a X into the point-major dense array \a Xd, so
+			 * that the \a m features of point \a p are found at
+			 * <tt>Xd[ p * m ]</tt>.
+			 *
+			 * @returns Whether the dense fast path applies; i.e., whether \a X is
+			 *          fully dense and all of it is locally available. If not, \a Xd
+			 *          is left empty.
+			 * \endinternal
+			 */
+			template< typename IOType >
+			bool kmeans_dense_points(
+				std::vector< IOType > &Xd,
+				const grb::Matrix< IOType > &X
+			) {
+				const size_t m = grb::nrows( X );
+				const size_t n = grb::ncols( X );
+				Xd.clear();
+				if( grb::spmd<>::nprocs() != 1 || m == 0 ||
+					grb::nnz( X ) != m * n
+				) {
+					return false;
+				}
+				try {
+					Xd.resize( m * n );
+				} catch( ... ) {
+					return false;
+				}
+				for( const auto &triple : X ) {
+					Xd[ triple.first.second * m + triple.first.first ] = triple.second;
+				}
+				return true;
+			}
+
+			/**
+			 * \internal
+			 * Copies the centroids of \a K into the row-major dense array \a Kd.
+			 * A centroid without any nonzeroes, such as one whose cluster became
+			 * empty, is marked inactive in \a active.
+			 *
+			 * On output, \a applies holds whether every centroid is either fully
+			 * dense or empty. If not, the dense fast path does not apply.
+			 *
+			 * @returns #grb::SUCCESS  On successful copy.
+			 * @returns #grb::OUTOFMEM If the dense arrays could not be allocated.
+			 * \endinternal
+			 */
+			template< typename IOType >
+			grb::RC kmeans_dense_centroids(
+				bool &applies,
+				std::vector< IOType > &Kd,
+				std::vector< char > &active,
+				const grb::Matrix< IOType > &K
+			) {
+				const size_t k = grb::nrows( K );
+				const size_t m = grb::ncols( K );
+				applies = false;
+				std::vector< size_t > counts;
+				try {
+					counts.resize( k, 0 );
+					Kd.resize( k * m );
+					active.resize( k );
+				} catch( const std::bad_alloc & ) {
+					return grb::OUTOFMEM;
+				}
+				for( const auto &triple : K ) {
+					Kd[ triple.first.first * m + triple.first.second ] = triple.second;
+					(void) ++counts[ triple.first.first ];
+				}
+				for( size_t c = 0; c < k; ++c ) {
+					if( counts[ c ] != 0 && counts[ c ] != m ) {
+						return grb::SUCCESS;
+					}
+					active[ c ] = counts[ c ] == m;
+				}
+				applies = true;
+				return grb::SUCCESS;
+			}
+
+			/**
+			 * \internal
+			 * Accumulates \a dist_op over the \a m features of the dense points
+			 * \a a and \a b. Independent partial sums let the compiler vectorise
+			 * the reduction; this reassociates the sum compared to the generic
+			 * path.
+			 * \endinternal
+			 */
+			template< typename IOType, class Operator >
+			IOType kmeans_dense_distance(
+				const IOType * __restrict__ const a,
+				const IOType * __restrict__ const b,
+				const size_t m,
+				const Operator &dist_op
+			) {
+				constexpr size_t lanes = 8;
+				IOType partial[ lanes ];
+				for( size_t l = 0; l < lanes; ++l ) {
+					partial[ l ] = 0;
+				}
+				const size_t bulk = m - m % lanes;
+				for( size_t f = 0; f < bulk; f += lanes ) {
+					for( size_t l = 0; l < lanes; ++l ) {
+						IOType d;
+						(void) grb::apply( d, a[ f + l ], b[ f + l ], dist_op );
+						partial[ l ] += d;
+					}
+				}
+				for( size_t f = bulk; f < m; ++f ) {
+					IOType d;
+					(void) grb::apply( d, a[ f ], b[ f ], dist_op );
+					partial[ f - bulk ] += d;
+				}
+				IOType ret = 0;
+				for( size_t l = 0; l < lanes; ++l ) {
+					ret += partial[ l ];
+				}
+				return ret;
+			}
+
+			/**
+			 * \internal
+			 * Assigns every point of \a Xd to its nearest active centroid in \a Kd,
+			 * writing the cluster and distance of point \a p to
+			 * <tt>clusters_and_distances[ p ]</tt>. Ties resolve to the lowest
+			 * centroid index.
+			 *
+			 * The points are split in tiles that are processed in parallel by the
+			 * backend. Each tile of points is compared against one tile of centroids
+			 * at a time, where both tiles together fit in the L1 cache, so that
+			 * every point is loaded once per tile of centroids rather than once per
+			 * centroid, and each centroid is loaded once per tile of points rather
+			 * than once per point.
+			 *
+			 * @returns #grb::OUTOFMEM If the buffer of per-point results could not
+			 *                         be allocated.
+			 * \endinternal
+			 */
+			template< typename IOType, class Operator >
+			grb::RC kmeans_dense_assign(
+				grb::Vector< std::pair< size_t, IOType > > &clusters_and_distances,
+				const std::vector< IOType > &Xd,
+				const std::vector< IOType > &Kd,
+				const std::vector< char > &active,
+				const size_t m,
+				const Operator &dist_op
+			) {
+				const size_t n = grb::size( clusters_and_distances );
+				const size_t k = active.size();
+				const IOType * const points = Xd.data();
+				const IOType * const centroids = Kd.data();
+				const char * const act = active.data();
+
+				// half of the L1 cache holds a tile of points, the other a tile of
+				// centroids
+				const size_t row_bytes = std::max( m * sizeof( IOType ),
+					static_cast< size_t >( 1 ) );
+				const size_t tile = std::max(
+					grb::config::MEMORY::l1_cache_size() / 2 / row_bytes,
+					static_cast< size_t >( 1 ) );
+				const size_t tiles = (n + tile - 1) / tile;
+
+				std::vector< std::pair< size_t, IOType > > best;
+				try {
+					best.resize( n );
+				} catch( const std::bad_alloc & ) {
+					return grb::OUTOFMEM;
+				}
+				std::pair< size_t, IOType > * const results = best.data();
+
+				grb::Vector< bool > point_tiles( tiles );
+				grb::RC ret = grb::set( point_tiles, true );
+				ret = ret ? ret : grb::eWiseLambda(
+					[results, points, centroids, act, n, k, m, tile, &dist_op](
+						const size_t t
+					) {
+						const size_t p_lo = t * tile;
+						const size_t p_hi = std::min( p_lo + tile, n );
+						for( size_t p = p_lo; p < p_hi; ++p ) {
+							results[ p ] = std::make_pair( static_cast< size_t >( 0 ),
+								grb::identities::infinity< IOType >::value() );
+						}
+						for( size_t c_lo = 0; c_lo < k; c_lo += tile ) {
+							const size_t c_hi = std::min( c_lo + tile, k );
+							for( size_t p = p_lo; p < p_hi; ++p ) {
+								const IOType * const point = points + p * m;
+								std::pair< size_t, IOType > &result = results[ p ];
+								for( size_t c = c_lo; c < c_hi; ++c ) {
+									if( !act[ c ] ) {
+										continue;
+									}
+									const IOType distance = kmeans_dense_distance(
+										centroids + c * m, point, m, dist_op );
+									if( distance < result.second ) {
+										result = std::make_pair( c, distance );
+									}
+								}
+							}
+						}
+					}, point_tiles
+				);
+				// the results buffer is not tracked by the backend
+				ret = ret ? ret : grb::wait();
+
+				ret = ret ? ret : grb::set( clusters_and_distances,
+					std::make_pair( static_cast< size_t >( 0 ),
+						grb::identities::infinity< IOType >::value() )
+				);
+				ret = ret ? ret : grb::eWiseLambda(
+					[&clusters_and_distances, results]( const size_t p ) {
+						clusters_and_distances[ p ] = results[ p ];
+					}, clusters_and_distances
+				);
+				return ret ? ret : grb::wait();
+			}
+
+		} // namespace internal
+
 		/**
 		 * a simple implementation of the k++ initialisation algorithm for kmeans
 		 *
@@ -48,6 +270,11 @@ namespace grb {
 		 * @param[in] dist_op Coordinatewise distance operator, squared difference by
 		 *                    default
 		 *
+		 * If \a X is fully dense and the program runs on a single user process,
+		 * distances are computed by a dense kernel over a point-major copy of
+		 * \a X, instead of via sparse matrix--vector multiplications. This copy
+		 * requires \f$ \Theta( mn ) \f$ additional memory.
+		 *
 		 * \todo more efficient implementation using Walker's alias method
 		 *
 		 * \todo expand documentation
@@ -107,6 +334,10 @@ namespace grb {
 				grb::identities::infinity< IOType >::value()
 			);
 
+			// use the dense fast path if X is fully dense
+			std::vector< IOType > Xd;
+			const bool dense = internal::kmeans_dense_points( Xd, X );
+
 			// generate first centroid by selecting a column of X uniformly at random
 
 			size_t i;
@@ -128,11 +359,24 @@ namespace grb {
 
 				ret = ret ? ret : grb::setElement( col_select, true, i );
 
-				ret = ret ? ret : grb::vxm< grb::descriptors::transpose_matrix >(
-					selected, col_select, X, pattern_sum );
-
-				ret = ret ? ret : grb::vxm( selected_distances, selected, X, add_monoid,
-					dist_op );
+				if( dense ) {
+					const IOType * const point = Xd.data() + i * m;
+					const IOType * const points = Xd.data();
+					ret = ret ? ret : grb::set( selected_distances,
+						add_monoid.template getIdentity< IOType >() );
+					ret = ret ? ret : grb::eWiseLambda(
+						[&selected_distances, point, points, m, &dist_op]( const size_t p ) {
+							selected_distances[ p ] = internal::kmeans_dense_distance(
+								point, points + p * m, m, dist_op );
+						}, selected_distances
+					);
+				} else {
+					ret = ret ? ret : grb::vxm< grb::descriptors::transpose_matrix >(
+						selected, col_select, X, pattern_sum );
+
+					ret = ret ? ret : grb::vxm( selected_distances, selected, X,
+						add_monoid, dist_op );
+				}
 
 				ret = ret ? ret : grb::foldl( min_distances, selected_distances,
 					min_monoid );
@@ -160,7 +404,7 @@ namespace grb {
 				//    (TODO internal issue #320)
 				if( ret == SUCCESS ) {
 					assert( grb::spmd<>::nprocs() == 1 );
-					IOType * const raw = internal::getRaw( selected_distances );
+					IOType * const raw = grb::internal::getRaw( selected_distances );
 					IOType running_sum = 0;
 					i = 0;
 					do {
@@ -212,6 +456,13 @@ namespace grb {
 		 * @param[in] dist_op Coordinatewise distance operator, squared difference by
 		 *                    default
 		 *
+		 * If \a X is fully dense and the program runs on a single user process,
+		 * the distances and nearest centroids are computed by a dense kernel over
+		 * point-major and row-major copies of \a X and \a K, respectively, instead
+		 * of via a sparse distance matrix. The copy of \a X requires
+		 * \f$ \Theta( mn ) \f$ additional memory. The centroid updates remain
+		 * unchanged.
+		 *
 		 * \internal
 		 * \todo expand documentation
 		 * \endeinternal
@@ -295,6 +546,11 @@ namespace grb {
 			Matrix< IOType > K_aux( k, m );
 			Matrix< size_t > V_aux( k, m );
 
+			// use the dense fast path if X is fully dense
+			std::vector< IOType > Xd, Kd;
+			std::vector< char > active;
+			const bool dense = internal::kmeans_dense_points( Xd, X );
+
 			// control variables
 			size_t iter = 0;
 			Vector< indexIOType > clusters_and_distances_prev( n );
@@ -306,11 +562,21 @@ namespace grb {
 				ret = ret ? ret : grb::set( clusters_and_distances_prev,
 					clusters_and_distances );
 
-				ret = ret ? ret : mxm( Dist, K, X, add_monoid, dist_op, RESIZE );
-				ret = ret ? ret : mxm( Dist, K, X, add_monoid, dist_op );
-
-				ret = ret ? ret : vxm( clusters_and_distances, labels, Dist, argmin_monoid,
-					operators::zip< size_t, IOType >() );
+				bool dense_centroids = false;
+				if( ret == SUCCESS && dense ) {
+					ret = internal::kmeans_dense_centroids( dense_centroids, Kd, active,
+						K );
+				}
+				if( ret == SUCCESS && dense_centroids ) {
+					ret = internal::kmeans_dense_assign( clusters_and_distances, Xd, Kd,
+						active, m, dist_op );
+				} else {
+					ret = ret ? ret : mxm( Dist, K, X, add_monoid, dist_op, RESIZE );
+					ret = ret ? ret : mxm( Dist, K, X, add_monoid, dist_op );
+
+					ret = ret ? ret : vxm( clusters_and_distances, labels, Dist,
+						argmin_monoid, operators::zip< size_t, IOType >() );
+				}
 
 				auto converter = grb::utils::makeVectorToMatrixConverter<
 					void, indexIOType
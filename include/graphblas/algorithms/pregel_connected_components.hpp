@@ -120,13 +120,25 @@ namespace grb {
 				 * @param[out] steps_taken A pointer to where the number of rounds should
 				 *                         be recorded. Will not be used if equal to
 				 *                         <tt>nullptr</tt>.
+				 *
+				 * Since a vertex that votes to halt has not changed its ID, this program
+				 * may also run in the #grb::interfaces::SPARSE_ACTIVE_SET mode, in which
+				 * later rounds only touch the vertices whose IDs still change. On
+				 * shared-memory backends, it may also run in the
+				 * #grb::interfaces::ASYNCHRONOUS mode, in which IDs travel along
+				 * increasing vertex IDs within a single round:
+				 *
+				 * @param[in] mode The execution mode. The default is
+				 *                 #grb::interfaces::BULK_SYNCHRONOUS.
 				 */
 				template< typename PregelType >
 				static grb::RC execute(
 					grb::interfaces::Pregel< PregelType > &pregel,
 					grb::Vector< VertexIDType > &group_ids,
 					const size_t max_steps = 0,
-					size_t * const steps_taken = nullptr
+					size_t * const steps_taken = nullptr,
+					const grb::interfaces::ExecutionMode mode =
+						grb::interfaces::BULK_SYNCHRONOUS
 				) {
 					const size_t n = pregel.num_vertices();
 					if( grb::size( group_ids ) != n ) {
@@ -156,7 +168,8 @@ namespace grb {
 						in, out,
 						steps,
 						out_buffer,
-						max_steps
+						max_steps,
+						mode
 					);
 
 					if( ret == grb::SUCCESS && steps_taken != nullptr ) {
@@ -178,6 +178,11 @@ namespace grb {
 				 * @param[in] max_steps  The maximum number of rounds this program may take.
 				 *                       If not given, the number of rounds will be
 				 *                       unlimited.
+				 * @param[in] mode       The execution mode. The default is
+				 *                       #grb::interfaces::BULK_SYNCHRONOUS. On
+				 *                       shared-memory backends, the
+				 *                       #grb::interfaces::ASYNCHRONOUS mode typically
+				 *                       converges in fewer rounds.
 				 */
 				template< typename PregelType >
 				static grb::RC execute(
@@ -185,7 +190,9 @@ namespace grb {
 					grb::Vector< IOType > &scores,
 					size_t &steps_taken,
 					const Data &parameters = Data(),
-					const size_t max_steps = 0
+					const size_t max_steps = 0,
+					const grb::interfaces::ExecutionMode mode =
+						grb::interfaces::BULK_SYNCHRONOUS
 				) {
 					const size_t n = pregel.num_vertices();
 					if( grb::size( scores ) != n ) {
@@ -208,7 +215,8 @@ namespace grb {
 							in, out,
 							steps_taken,
 							out_buffer,
-							max_steps
+							max_steps,
+							mode
 						);
 				}
 
@@ -358,7 +358,13 @@ namespace grb {
 				// multiply with row-normalised link matrix (no change to dangling rows)
 				// note that the later eWiseLambda requires the output be dense
 				ret = ret ? ret : set( pr_nextnext, 0 ); assert( ret == SUCCESS );
-				ret = ret ? ret : vxm< descr >( pr_nextnext, pr_next, L, realRing );
+				if( grb::Properties<>::writableCaptured ) {
+					ret = ret ? ret : vxm< descr >( pr_nextnext, pr_next, L, realRing );
+				} else {
+					// the dangling factor is added as an epilogue of the multiplication
+					ret = ret ? ret : vxm< descr >( pr_nextnext, pr_next, L, realRing,
+						epilogues::foldl( dangling, addM.getOperator() ) );
+				}
 				assert( ret == SUCCESS );
 				assert( n == grb::nnz( pr_nextnext ) );
 
@@ -424,10 +430,9 @@ namespace grb {
 						}
 						assert( ret == SUCCESS );
 					} else {
-						// we cannot reduce via lambdas, so calculate new pr vector
-						ret = foldl< descriptors::dense >( pr_nextnext, dangling, addM );
-						assert( ret == SUCCESS );
-						// do a dot product under the one-norm ``ring''
+						// we cannot reduce via lambdas, so the new pr vector was computed by
+						// the epilogue of the above vxm; do a dot product under the one-norm
+						// ``ring''
 						if( ret == SUCCESS ) {
 							residual = zero;
 							ret = dot< descriptors::dense >(
@@ -0,0 +1,399 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Implements batched sparse neural network inference.
+ */
+
+#ifndef _H_GRB_ALGORITHMS_SPARSE_NN_BATCH_INFERENCE
+#define _H_GRB_ALGORITHMS_SPARSE_NN_BATCH_INFERENCE
+
+#include <atomic>
+#include <vector>
+#include <utility>
+
+#include <graphblas.hpp>
+
+
+namespace grb {
+
+	namespace algorithms {
+
+		namespace internal {
+
+			/**
+			 * \internal
+			 * Applies the bias, the ReLU, and (optionally) the threshold in-place to
+			 * every nonzero of the product \a temp. Stored zeroes, which result from
+			 * earlier layers zeroing a feature, are left untouched, so that the bias
+			 * is only added to nonzeroes as in the GraphChallenge reference.
+			 *
+			 * @param[out] zeroes The number of zeroes stored in \a temp after the
+			 *                    call, summed over all user processes.
+			 * \endinternal
+			 */
+			template<
+				Descriptor descr, bool thresholded,
+				typename IOType, typename BiasType, typename ThresholdType,
+				class ReluMonoid, class MinMonoid, class Ring
+			>
+			grb::RC sparse_nn_batch_epilogue(
+				grb::Matrix< IOType > &temp,
+				const BiasType bias,
+				const ThresholdType threshold,
+				size_t &zeroes,
+				const ReluMonoid &relu,
+				const MinMonoid &min,
+				const Ring &ring
+			) {
+				const IOType zero = ring.template getZero< IOType >();
+				std::atomic< size_t > local( 0 );
+				grb::RC ret = grb::eWiseLambda(
+					[ &local, &bias, &threshold, &zero, &relu, &min, &ring ](
+						const size_t, const size_t, IOType &value
+					) {
+						if( value != zero ) {
+							(void) grb::foldl< descr >( value, bias,
+								ring.getAdditiveOperator() );
+							(void) grb::foldl< descr >( value, zero, relu.getOperator() );
+							if( thresholded ) {
+								(void) grb::foldl< descr >( value, threshold,
+									min.getOperator() );
+							}
+						}
+						if( value == zero ) {
+							(void) local.fetch_add( 1, std::memory_order_relaxed );
+						}
+					}, temp );
+				zeroes = local.load();
+				return ret ? ret : grb::collectives<>::allreduce(
+					zeroes, grb::operators::add< size_t >() );
+			}
+
+			/**
+			 * \internal
+			 * Rebuilds \a out from the nonzeroes of \a temp, thus removing all zeroes
+			 * stored in \a temp.
+			 *
+			 * The nonzero triples are buffered in \a rows, \a cols, and \a vals,
+			 * which retain their capacity across calls.
+			 * \endinternal
+			 */
+			template< typename IOType, class Ring >
+			grb::RC sparse_nn_batch_compact(
+				grb::Matrix< IOType > &out,
+				const grb::Matrix< IOType > &temp,
+				std::vector< size_t > &rows,
+				std::vector< size_t > &cols,
+				std::vector< IOType > &vals,
+				const Ring &ring
+			) {
+				const IOType zero = ring.template getZero< IOType >();
+				rows.clear();
+				cols.clear();
+				vals.clear();
+				try {
+					for( const auto &triple : temp ) {
+						if( triple.second != zero ) {
+							rows.push_back( triple.first.first );
+							cols.push_back( triple.first.second );
+							vals.push_back( triple.second );
+						}
+					}
+				} catch( const std::bad_alloc & ) {
+					return OUTOFMEM;
+				}
+
+				grb::RC ret = grb::clear( out );
+				ret = ret ? ret : grb::resize( out, vals.size() );
+				ret = ret ? ret : grb::buildMatrixUnique( out,
+					rows.data(), cols.data(), vals.data(), vals.size(), PARALLEL );
+				return ret;
+			}
+
+			/**
+			 * \internal
+			 * Tresholded and non-tresholded batched sparse neural network inference.
+			 *
+			 * @tparam thresholded A compile-time parameter controlling whether the
+			 *                     inference shall be thresholded.
+			 * \endinternal
+			 */
+			template<
+				Descriptor descr,
+				bool thresholded, typename ThresholdType,
+				typename IOType, typename WeightType, typename BiasType,
+				class ReluMonoid, class Ring, class MinMonoid
+			>
+			grb::RC sparse_nn_batch_inference(
+				grb::Matrix< IOType > &out,
+				const grb::Matrix< IOType > &in,
+				const std::vector< grb::Matrix< WeightType > > &layers,
+				const std::vector< BiasType > &biases,
+				const ThresholdType threshold,
+				grb::Matrix< IOType > &temp,
+				const ReluMonoid &relu,
+				const MinMonoid &min,
+				const Ring &ring
+			) {
+				static_assert( !(descr & descriptors::no_casting) ||
+					(
+						std::is_same< IOType, WeightType >::value &&
+						std::is_same< IOType, BiasType >::value
+					), "Input containers have different domains even though the no_casting"
+					"descriptor was given"
+				);
+
+				const size_t num_layers = layers.size();
+
+				// run-time checks
+				{
+					if( num_layers == 0 ) {
+						return ILLEGAL;
+					}
+					if( biases.size() != num_layers ) {
+						return ILLEGAL;
+					}
+					const size_t batch = grb::nrows( in );
+					if( grb::ncols( in ) != grb::nrows( layers[ 0 ] ) ||
+						grb::nrows( out ) != batch || grb::nrows( temp ) != batch ||
+						grb::ncols( out ) != grb::ncols( layers[ num_layers - 1 ] ) ||
+						grb::ncols( out ) != grb::ncols( temp )
+					) {
+						return MISMATCH;
+					}
+					for( size_t i = 1; i < num_layers; ++i ) {
+						if( grb::ncols( layers[ i - 1 ] ) != grb::nrows( layers[ i ] ) ) {
+							return MISMATCH;
+						}
+					}
+					for( size_t i = 0; i < num_layers; ++i ) {
+						if( grb::ncols( layers[ i ] ) != grb::nrows( layers[ i ] ) ) {
+							return ILLEGAL;
+						}
+					}
+				}
+
+				// buffers for compacting the features
+				std::vector< size_t > rows, cols;
+				std::vector< IOType > vals;
+
+				// the layers and biases are paired as in sparse_nn_single_inference;
+				// the epilogue of each layer is applied in-place to its product, after
+				// which the product and out swap roles
+				grb::RC ret = SUCCESS;
+				size_t zeroes = 0;
+				for( size_t i = 0; ret == SUCCESS && i < num_layers - 1; ++i ) {
+					const grb::Matrix< IOType > &features = i == 0 ? in : out;
+					ret = grb::clear( temp );
+					ret = ret ? ret : grb::mxm< descr >( temp, features, layers[ i ], ring,
+						RESIZE );
+					ret = ret ? ret : grb::mxm< descr >( temp, features, layers[ i ], ring );
+					ret = ret ? ret : sparse_nn_batch_epilogue< descr, thresholded >(
+						temp, biases[ i + 1 ], threshold, zeroes, relu, min, ring );
+					if( ret != SUCCESS ) {
+						break;
+					}
+					// zeroed features are only removed once they make up half of the
+					// stored ones, or after the last layer
+					if( zeroes > 0 && (
+						2 * zeroes >= grb::nnz( temp ) || i + 2 == num_layers
+					) ) {
+						ret = sparse_nn_batch_compact( out, temp, rows, cols, vals, ring );
+						zeroes = 0;
+					} else {
+						std::swap( out, temp );
+					}
+					assert( ret == SUCCESS );
+				}
+
+				// with a single layer, no multiplication takes place
+				if( ret == SUCCESS && num_layers == 1 ) {
+					ret = grb::set( out, in );
+				}
+
+				return ret;
+			}
+
+		} // end namespace ``grb::internal''
+
+		/**
+		 * Performs inference of a batch of data elements through a Sparse Neural
+		 * Network defined by \a num_layers sparse weight matrices and \a num_layers
+		 * biases.
+		 *
+		 * This is the batched variant of #grb::algorithms::sparse_nn_single_inference.
+		 * The batch is given as a sparse feature matrix with one row per data
+		 * element, which is propagated through all layers using sparse matrix--
+		 * sparse matrix multiplication. This amortises the cost of traversing the
+		 * weight matrices over the full batch.
+		 *
+		 * Layers and biases are paired identically to
+		 * #grb::algorithms::sparse_nn_single_inference. In line with the
+		 * GraphChallenge, the bias is added to the nonzeroes of each product only.
+		 * For non-positive biases, as is common, every row of \a out hence equals
+		 * the result of #grb::algorithms::sparse_nn_single_inference on the
+		 * corresponding row of \a in.
+		 *
+		 * The addition of the bias and the application of the ReLU are performed
+		 * in-place on the output of each product, which then becomes the input of
+		 * the next layer without being copied. Features that became zero are kept
+		 * as stored zeroes until they make up half of all stored features, at
+		 * which point they are removed so that rows of the batch that no longer
+		 * carry any feature incur no work in subsequent layers. The result \a out
+		 * stores no zeroes.
+		 *
+		 * @param[out] out    The result of inference through the neural network,
+		 *                    a \f$ b \times n \f$ matrix.
+		 * @param[in]  in     The input batch, a \f$ b \times n \f$ matrix.
+		 * @param[in]  layers A collection of linear layers. Each layer is assumed
+		 *                    to be square and of the equal size to one another.
+		 * @param[in]  biases An array of \a num_layers bias factors.
+		 *
+		 * Inference is done using a single buffer alternated with \a out:
+		 *
+		 * @param[in,out] temp A buffer of size \f$ b \times n \f$.
+		 *
+		 * Finally, optional arguments define the algebraic structures under which
+		 * inference proceeds:
+		 *
+		 * @param[in] relu The non-linear ReLU function to apply element-wise.
+		 * @param[in] ring The semiring under which to perform the inference.
+		 *
+		 * Valid descriptors for this algorithm are:
+		 *   -# descriptor::no_casting
+		 *
+		 * \warning The matrices \a in and \a out may not be the same.
+		 *
+		 * @returns #grb::SUCCESS  If the inference was successful
+		 * @returns #grb::ILLEGAL  If the size of \a layers does not match that of
+		 *                         \a biases.
+		 * @returns #grb::MISMATCH If at least one pair of dimensions between
+		 *                         \a layers, \a in, \a out, and \a temp do not match.
+		 * @returns #grb::ILLEGAL  If at least one layer was not square.
+		 * @returns #grb::OUTOFMEM If the capacities of \a out or \a temp could not
+		 *                         be increased as required.
+		 *
+		 * \par Performance semantics
+		 *
+		 *   -# Contrary to #grb::algorithms::sparse_nn_single_inference, this
+		 *      function resizes \a temp and \a out as required, and allocates
+		 *      buffers proportional to the number of nonzeroes of the largest
+		 *      intermediate product from which zeroes are removed.
+		 *   -# The contents of \a out and \a temp may be swapped, including their
+		 *      capacities.
+		 *
+		 * For performance semantics regarding work, inter-process data movement,
+		 * intra-process data movement, synchronisations, and memory use, please see
+		 * the specification of the ALP primitives this function relies on. These
+		 * performance semantics, with the exception of getters such as #grb::nnz, are
+		 * specific to the backend selected during compilation.
+		 */
+		template< Descriptor descr = descriptors::no_operation,
+			typename IOType,
+			typename WeightType,
+			typename BiasType,
+			class ReluMonoid = Monoid<
+				grb::operators::relu< IOType >,
+				grb::identities::negative_infinity
+			>,
+			class Ring = Semiring<
+				grb::operators::add< IOType >, grb::operators::mul< IOType >,
+				grb::identities::zero, grb::identities::one
+			>
+		>
+		grb::RC sparse_nn_batch_inference(
+			grb::Matrix< IOType > &out,
+			const grb::Matrix< IOType > &in,
+			const std::vector< grb::Matrix< WeightType > > &layers,
+			const std::vector< BiasType > &biases,
+			grb::Matrix< IOType > &temp,
+			const ReluMonoid &relu = ReluMonoid(),
+			const Ring &ring = Ring()
+		) {
+			Monoid<
+				grb::operators::min< IOType >, grb::identities::infinity
+			> dummyTresholdMonoid;
+			return internal::sparse_nn_batch_inference<
+				descr, false, double
+			> (
+				out, in, layers,
+				biases, 0.0,
+				temp,
+				relu, dummyTresholdMonoid, ring
+			);
+		}
+
+		/**
+		 * Performs thresholded inference of a batch of data elements through a
+		 * Sparse Neural Network.
+		 *
+		 * This is the batched variant of the thresholded
+		 * #grb::algorithms::sparse_nn_single_inference. Apart from the additional
+		 * arguments below, the semantics are those of the non-thresholded
+		 * #grb::algorithms::sparse_nn_batch_inference.
+		 *
+		 * @param[in] threshold The value used for thresholding. It is applied in
+		 *                      the same pass as the bias and the ReLU.
+		 * @param[in] min       Operator used for thresholding.
+		 */
+		template< Descriptor descr = descriptors::no_operation,
+			typename IOType,
+			typename WeightType,
+			typename BiasType,
+			typename ThresholdType = IOType,
+			class MinMonoid = Monoid<
+				grb::operators::min< IOType >, grb::identities::infinity
+			>,
+			class ReluMonoid = Monoid<
+				grb::operators::relu< IOType >,
+				grb::identities::negative_infinity
+			>,
+			class Ring = Semiring<
+				grb::operators::add< IOType >, grb::operators::mul< IOType >,
+				grb::identities::zero, grb::identities::one
+			>
+		>
+		grb::RC sparse_nn_batch_inference(
+			grb::Matrix< IOType > &out,
+			const grb::Matrix< IOType > &in,
+			const std::vector< grb::Matrix< WeightType > > &layers,
+			const std::vector< BiasType > &biases,
+			const ThresholdType threshold,
+			grb::Matrix< IOType > &temp,
+			const ReluMonoid &relu = ReluMonoid(),
+			const MinMonoid &min = MinMonoid(),
+			const Ring &ring = Ring()
+		) {
+			return internal::sparse_nn_batch_inference<
+				descr, true
+			> (
+				out, in, layers,
+				biases, threshold,
+				temp,
+				relu, min, ring
+			);
+		}
+
+	} // namespace algorithms
+
+} // end namespace grb
+
+#endif // end _H_GRB_ALGORITHMS_SPARSE_NN_BATCH_INFERENCE
+
@@ -128,47 +128,40 @@ namespace grb {
 				}
 	*/
 
-				ret = grb::set( out, 0 ); assert( ret == SUCCESS );
-
-				ret = ret ? ret : grb::vxm( out, in, ( layers[ 0 ] ), ring );
-				assert( ret == SUCCESS );
-
-				ret = ret ? ret : grb::foldl< descriptors::dense >(
-					out, biases[ 1 ], ring.getAdditiveMonoid()
-				); assert( ret == SUCCESS );
-
-				for( size_t i = 1; ret == SUCCESS && i < num_layers - 1; ++i ) {
-
-					ret = ret ? ret : grb::foldl< descriptors::dense >( out, 0, relu );
-					assert( ret == SUCCESS );
-
-					if( thresholded ) {
-						ret = ret ? ret : grb::foldl< descriptors::dense >( out, threshold, min );
-						assert( ret == SUCCESS );
-					}
-
-					if( ret == SUCCESS ) {
+				// the bias, the ReLU, and the optional thresholding are applied as an
+				// epilogue of each multiplication, which saves passes over the output
+				const IOType zero = ring.template getZero< IOType >();
+				for( size_t i = 0; ret == SUCCESS && i < num_layers - 1; ++i ) {
+					if( i > 0 ) {
 						std::swap( out, temp );
 					}
 
 					ret = grb::set( out, 0 );
 					assert( ret == SUCCESS );
 
-					ret = ret ? ret : grb::vxm< descriptors::dense >(
-						out, temp, ( layers[ i ] ), ring
-					); assert( ret == SUCCESS );
-
-					ret = ret ? ret : grb::foldl< descriptors::dense >(
-						out, biases[ i + 1 ], ring.getAdditiveMonoid()
-					); assert( ret == SUCCESS );
+					const auto bias_relu = epilogues::sequence(
+						epilogues::foldl( biases[ i + 1 ], ring.getAdditiveOperator() ),
+						epilogues::foldl( zero, relu.getOperator() )
+					);
+					if( thresholded ) {
+						const auto epilogue = epilogues::sequence( bias_relu,
+							epilogues::foldl( threshold, min.getOperator() ) );
+						ret = ret ? ret : ( i == 0 ?
+							grb::vxm( out, in, layers[ i ], ring, epilogue ) :
+							grb::vxm< descriptors::dense >( out, temp, layers[ i ], ring,
+								epilogue ) );
+					} else {
+						ret = ret ? ret : ( i == 0 ?
+							grb::vxm( out, in, layers[ i ], ring, bias_relu ) :
+							grb::vxm< descriptors::dense >( out, temp, layers[ i ], ring,
+								bias_relu ) );
+					}
+					assert( ret == SUCCESS );
 				}
 
-				ret = ret ? ret : grb::foldl< descriptors::dense >( out, 0, relu );
-				assert( ret == SUCCESS );
-
-				if( thresholded ) {
-					ret = ret ? ret : grb::foldl< descriptors::dense >( out, threshold, min );
-					assert( ret == SUCCESS );
+				// with a single layer, no multiplication takes place
+				if( ret == SUCCESS && num_layers == 1 ) {
+					ret = grb::set( out, in );
 				}
 
 				return ret;
@@ -0,0 +1,468 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Implements triangle counting and local clustering coefficients.
+ */
+
+#ifndef _H_GRB_ALGORITHMS_TRIANGLE_COUNT
+#define _H_GRB_ALGORITHMS_TRIANGLE_COUNT
+
+#include <vector>
+#include <utility> // std::pair
+#include <algorithm> // std::max
+
+#include <graphblas.hpp>
+#include <graphblas/algorithms/utils.hpp>
+
+
+namespace grb {
+
+	namespace algorithms {
+
+		namespace internal {
+
+			/**
+			 * \internal
+			 * Replaces \a data at every user process with the element-wise sum of
+			 * \a data over all user processes. All \a data must be of equal size.
+			 * \endinternal
+			 */
+			inline RC triangle_sum( std::vector< size_t > &data ) {
+				const size_t s = spmd<>::pid();
+				const size_t P = spmd<>::nprocs();
+				if( P == 1 ) {
+					return SUCCESS;
+				}
+				std::vector< size_t > sum( data.size(), 0 ), buffer;
+				RC ret = SUCCESS;
+				for( size_t root = 0; ret == SUCCESS && root < P; ++root ) {
+					if( s == root ) {
+						buffer = data;
+					} else {
+						buffer.resize( data.size() );
+					}
+					ret = collectives<>::broadcast( buffer.data(), buffer.size(), root );
+					for( size_t i = 0; i < sum.size(); ++i ) {
+						sum[ i ] += buffer[ i ];
+					}
+				}
+				if( ret == SUCCESS ) {
+					data.swap( sum );
+				}
+				return ret;
+			}
+
+			/**
+			 * \internal
+			 * Derives the degree-oriented graph of the undirected graph that \a A
+			 * represents.
+			 *
+			 * Every off-diagonal nonzero \f$ (i, j) \f$ of \a A denotes the edge
+			 * \f$ \{ i, j \} \f$. Vertices are relabelled by their rank in order of
+			 * non-decreasing degree, with ties broken by vertex ID, and every edge is
+			 * stored at the row of its lower-ranked end-point only. This equals taking
+			 * the strictly lower triangle \f$ L \f$ after reordering the rows and
+			 * columns of \a A by non-increasing degree, and bounds the number of
+			 * nonzeroes per row of \f$ L \f$ by \f$ \sqrt{2m} \f$ for \f$ m \f$
+			 * edges. The relabelling furthermore clusters the accesses to the rows of
+			 * high-degree vertices.
+			 *
+			 * On output, the columns of row \f$ r \f$ of \f$ L \f$ are
+			 * <tt>targets[ offsets[ r ] ]</tt> up to
+			 * <tt>targets[ offsets[ r + 1 ] ]</tt>, where rows and columns are ranks.
+			 * The vertex of rank \f$ r \f$ is <tt>order[ r ]</tt>, while \a degrees
+			 * holds the number of distinct neighbours of each vertex.
+			 *
+			 * With multiple user processes, every process obtains the full \f$ L \f$.
+			 * \endinternal
+			 */
+			template< typename NZType >
+			RC triangle_orient(
+				const Matrix< NZType > &A,
+				std::vector< size_t > &offsets,
+				std::vector< size_t > &targets,
+				std::vector< size_t > &degrees,
+				std::vector< size_t > &order
+			) {
+				const size_t n = nrows( A );
+				std::vector< size_t > edges;
+				RC ret = SUCCESS;
+
+				// collect the local edges
+				try {
+					edges.reserve( 2 * nnz( A ) / spmd<>::nprocs() );
+					size_t row, col;
+					for( const auto &nz : A ) {
+						nonzero_indices( nz, row, col );
+						if( row != col ) {
+							edges.push_back( row );
+							edges.push_back( col );
+						}
+					}
+				} catch( const std::bad_alloc & ) {
+					ret = OUTOFMEM;
+				}
+				if( collectives<>::allreduce( ret, operators::any_or< RC >() ) !=
+					SUCCESS
+				) {
+					return PANIC;
+				}
+				ret = ret ? ret : allgather( edges );
+				if( ret != SUCCESS ) {
+					return ret;
+				}
+
+				try {
+					// symmetrise into a neighbourhood array, duplicates included
+					const size_t m = edges.size() / 2;
+					std::vector< size_t > start( n + 1, 0 ), neighbours( 2 * m );
+					for( size_t e = 0; e < m; ++e ) {
+						(void) ++start[ edges[ 2 * e ] + 1 ];
+						(void) ++start[ edges[ 2 * e + 1 ] + 1 ];
+					}
+					for( size_t i = 0; i < n; ++i ) {
+						start[ i + 1 ] += start[ i ];
+					}
+					{
+						std::vector< size_t > pos( start.begin(), start.end() - 1 );
+						for( size_t e = 0; e < m; ++e ) {
+							const size_t i = edges[ 2 * e ];
+							const size_t j = edges[ 2 * e + 1 ];
+							neighbours[ pos[ i ]++ ] = j;
+							neighbours[ pos[ j ]++ ] = i;
+						}
+					}
+					std::vector< size_t >().swap( edges );
+
+					// remove duplicates in-place and record the degrees
+					std::vector< size_t > marker( n, n );
+					degrees.assign( n, 0 );
+					for( size_t i = 0; i < n; ++i ) {
+						size_t d = start[ i ];
+						for( size_t e = start[ i ]; e < start[ i + 1 ]; ++e ) {
+							const size_t j = neighbours[ e ];
+							if( marker[ j ] != i ) {
+								marker[ j ] = i;
+								neighbours[ d++ ] = j;
+							}
+						}
+						degrees[ i ] = d - start[ i ];
+					}
+
+					// rank the vertices by a counting sort on their degrees
+					size_t max_degree = 0;
+					for( size_t i = 0; i < n; ++i ) {
+						max_degree = std::max( max_degree, degrees[ i ] );
+					}
+					std::vector< size_t > rank( max_degree + 2, 0 );
+					for( size_t i = 0; i < n; ++i ) {
+						(void) ++rank[ degrees[ i ] + 1 ];
+					}
+					for( size_t d = 0; d <= max_degree; ++d ) {
+						rank[ d + 1 ] += rank[ d ];
+					}
+					order.resize( n );
+					for( size_t i = 0; i < n; ++i ) {
+						order[ rank[ degrees[ i ] ]++ ] = i;
+					}
+					rank.resize( n );
+					for( size_t r = 0; r < n; ++r ) {
+						rank[ order[ r ] ] = r;
+					}
+
+					// keep the edges towards higher-ranked neighbours only
+					offsets.assign( n + 1, 0 );
+					for( size_t r = 0; r < n; ++r ) {
+						const size_t i = order[ r ];
+						for( size_t e = start[ i ]; e < start[ i ] + degrees[ i ]; ++e ) {
+							if( rank[ neighbours[ e ] ] > r ) {
+								(void) ++offsets[ r + 1 ];
+							}
+						}
+					}
+					for( size_t r = 0; r < n; ++r ) {
+						offsets[ r + 1 ] += offsets[ r ];
+					}
+					targets.resize( offsets[ n ] );
+					for( size_t r = 0; r < n; ++r ) {
+						const size_t i = order[ r ];
+						size_t k = offsets[ r ];
+						for( size_t e = start[ i ]; e < start[ i ] + degrees[ i ]; ++e ) {
+							if( rank[ neighbours[ e ] ] > r ) {
+								targets[ k++ ] = rank[ neighbours[ e ] ];
+							}
+						}
+					}
+				} catch( const std::bad_alloc & ) {
+					ret = OUTOFMEM;
+				}
+				if( collectives<>::allreduce( ret, operators::any_or< RC >() ) !=
+					SUCCESS
+				) {
+					return PANIC;
+				}
+				return ret;
+			}
+
+			/**
+			 * \internal
+			 * Counts the triangles of the degree-oriented graph \f$ L \f$, as
+			 * produced by #triangle_orient.
+			 *
+			 * Computes the sum of \f$ (L \cdot L) \odot L \f$ without materialising
+			 * the product: row \f$ i \f$ of the product is computed only at the
+			 * nonzeroes of row \f$ i \f$ of the mask \f$ L \f$, which a marker array
+			 * holds while the row is processed. Rows are distributed cyclically over
+			 * the user processes, and dynamically over threads on shared-memory
+			 * parallel backends.
+			 *
+			 * If \a triangles is not <tt>nullptr</tt>, it must have \f$ n \f$ zero
+			 * entries on input, and on output holds the number of triangles each
+			 * rank is part of, counting only triangles found by this process.
+			 * \endinternal
+			 */
+			inline RC triangle_enumerate(
+				const std::vector< size_t > &offsets,
+				const std::vector< size_t > &targets,
+				size_t &count,
+				size_t * const triangles
+			) {
+				const size_t n = offsets.size() - 1;
+				const size_t s = spmd<>::pid();
+				const size_t P = spmd<>::nprocs();
+
+				const size_t threads = local_threads();
+
+				std::vector< size_t > markers;
+				try {
+					markers.assign( threads * n, n );
+				} catch( const std::bad_alloc & ) {
+					return OUTOFMEM;
+				}
+
+				size_t local = 0;
+				#pragma omp parallel num_threads( threads ) if( threads > 1 ) \
+					reduction( + : local )
+				{
+					size_t t = 0;
+#ifdef _GRB_WITH_OMP
+					t = static_cast< size_t >( omp_get_thread_num() );
+#endif
+					size_t * const marker = markers.data() + t * n;
+
+					#pragma omp for schedule( dynamic, 64 )
+					for( size_t i = s; i < n; i += P ) {
+						for( size_t e = offsets[ i ]; e < offsets[ i + 1 ]; ++e ) {
+							marker[ targets[ e ] ] = i;
+						}
+						size_t row = 0;
+						for( size_t e = offsets[ i ]; e < offsets[ i + 1 ]; ++e ) {
+							const size_t j = targets[ e ];
+							size_t pair = 0;
+							for( size_t f = offsets[ j ]; f < offsets[ j + 1 ]; ++f ) {
+								const size_t k = targets[ f ];
+								if( marker[ k ] == i ) {
+									(void) ++pair;
+									if( triangles != nullptr ) {
+										#pragma omp atomic
+										triangles[ k ] += 1;
+									}
+								}
+							}
+							if( triangles != nullptr && pair > 0 ) {
+								#pragma omp atomic
+								triangles[ j ] += pair;
+							}
+							row += pair;
+						}
+						if( triangles != nullptr && row > 0 ) {
+							#pragma omp atomic
+							triangles[ i ] += row;
+						}
+						local += row;
+					}
+				}
+				count = local;
+				return SUCCESS;
+			}
+
+		} // end namespace ``grb::algorithms::internal''
+
+		/**
+		 * Counts the number of triangles in an undirected graph.
+		 *
+		 * Implements the Sandia variant of algebraic triangle counting: with
+		 * \f$ L \f$ the strictly lower triangular part of the adjacency matrix
+		 * after reordering its rows and columns by non-increasing degree, the
+		 * number of triangles equals the sum of \f$ (L \cdot L) \odot L \f$.
+		 * The product is masked by \f$ L \f$ during its computation and never
+		 * materialised. The degree ordering ensures that the work is bounded by
+		 * \f$ \mathcal{O}( m^{3/2} ) \f$ for a graph with \f$ m \f$ edges,
+		 * regardless of the degree distribution.
+		 *
+		 * @tparam NZType The type of the nonzero elements in the matrix.
+		 *
+		 * @param[out] count The number of triangles in the graph.
+		 * @param[in]  A     Matrix representing a graph. Every off-diagonal
+		 *                   nonzero \f$ (i, j) \f$ denotes the undirected edge
+		 *                   \f$ \{ i, j \} \f$. The nonzero values, the diagonal,
+		 *                   and whether \a A is symmetric are all irrelevant.
+		 *
+		 * @returns #grb::SUCCESS  If the triangles were counted.
+		 * @returns #grb::ILLEGAL  If \a A is not square. The output \a count is left
+		 *                         untouched.
+		 * @returns #grb::OUTOFMEM If the workspace could not be allocated. The
+		 *                         output \a count is left untouched.
+		 * @returns #grb::PANIC    If an unrecoverable error has been encountered. The
+		 *                         output as well as the state of ALP/GraphBLAS is
+		 *                         undefined.
+		 *
+		 * \par Performance semantics
+		 *
+		 *   -# This function allocates \f$ \Theta( n + m ) \f$ bytes of dynamic
+		 *      memory, plus \f$ \Theta( n ) \f$ bytes per thread.
+		 *   -# With more than one user process, every process receives all edges,
+		 *      which incurs \f$ \Theta( m ) \f$ inter-process data movement per
+		 *      process, and \f$ \Theta( P ) \f$ synchronisations.
+		 */
+		template< typename NZType >
+		RC triangle_count( size_t &count, const Matrix< NZType > &A ) {
+			if( nrows( A ) != ncols( A ) ) {
+				return ILLEGAL;
+			}
+
+			std::vector< size_t > offsets, targets, degrees, order;
+			RC ret = internal::triangle_orient( A, offsets, targets, degrees,
+				order );
+			size_t local = 0;
+			ret = ret ? ret : internal::triangle_enumerate(
+				offsets, targets, local, nullptr );
+			if( collectives<>::allreduce( ret, operators::any_or< RC >() ) !=
+				SUCCESS
+			) {
+				return PANIC;
+			}
+			ret = ret ? ret : collectives<>::allreduce(
+				local, operators::add< size_t >() );
+			if( ret == SUCCESS ) {
+				count = local;
+			}
+			return ret;
+		}
+
+		/**
+		 * Computes the local clustering coefficient of every vertex of an
+		 * undirected graph.
+		 *
+		 * The local clustering coefficient of a vertex \f$ v \f$ with \f$ d_v \f$
+		 * distinct neighbours is \f$ 2 t_v / (d_v(d_v - 1)) \f$, where \f$ t_v \f$
+		 * is the number of triangles \f$ v \f$ is part of; i.e., the fraction of
+		 * pairs of neighbours of \f$ v \f$ that are neighbours themselves. It is
+		 * zero for vertices with fewer than two neighbours. The triangles are
+		 * enumerated as in #grb::algorithms::triangle_count.
+		 *
+		 * @tparam IOType The value type of the output vector, which must be a
+		 *                floating-point type.
+		 * @tparam NZType The type of the nonzero elements in the matrix.
+		 *
+		 * @param[out] coefficients A vector of size and capacity \f$ n \f$. On
+		 *                          output, if #grb::SUCCESS is returned, it is
+		 *                          dense and holds the local clustering
+		 *                          coefficient of every vertex.
+		 * @param[in]  A            Matrix representing a graph, interpreted as by
+		 *                          #grb::algorithms::triangle_count.
+		 *
+		 * @returns #grb::SUCCESS  If the coefficients were computed.
+		 * @returns #grb::ILLEGAL  If \a A is not square. The output is left
+		 *                         untouched.
+		 * @returns #grb::MISMATCH If the size of \a coefficients does not match
+		 *                         \a A. The output is left untouched.
+		 * @returns #grb::OUTOFMEM If the workspace could not be allocated. The
+		 *                         output is left untouched.
+		 * @returns #grb::PANIC    If an unrecoverable error has been encountered. The
+		 *                         output as well as the state of ALP/GraphBLAS is
+		 *                         undefined.
+		 *
+		 * \par Performance semantics
+		 *
+		 * Those of #grb::algorithms::triangle_count, plus \f$ \Theta( n ) \f$
+		 * inter-process data movement per user process and \f$ \Theta( P ) \f$
+		 * synchronisations to combine the per-vertex triangle counts, plus those
+		 * of #grb::buildVector.
+		 */
+		template< typename IOType, typename NZType >
+		RC clustering_coefficient(
+			Vector< IOType > &coefficients,
+			const Matrix< NZType > &A
+		) {
+			static_assert( std::is_floating_point< IOType >::value,
+				"Clustering coefficients require a floating-point output type." );
+
+			const size_t n = nrows( A );
+			if( n != ncols( A ) ) {
+				return ILLEGAL;
+			}
+			if( size( coefficients ) != n ) {
+				return MISMATCH;
+			}
+
+			std::vector< size_t > offsets, targets, degrees, order, triangles;
+			std::vector< IOType > values;
+			RC ret = internal::triangle_orient( A, offsets, targets, degrees,
+				order );
+			if( ret == SUCCESS ) {
+				try {
+					triangles.assign( n, 0 );
+					values.resize( n );
+				} catch( const std::bad_alloc & ) {
+					ret = OUTOFMEM;
+				}
+			}
+			size_t count = 0;
+			ret = ret ? ret : internal::triangle_enumerate(
+				offsets, targets, count, triangles.data() );
+			if( collectives<>::allreduce( ret, operators::any_or< RC >() ) !=
+				SUCCESS
+			) {
+				return PANIC;
+			}
+			ret = ret ? ret : internal::triangle_sum( triangles );
+			if( ret != SUCCESS ) {
+				return ret;
+			}
+
+			for( size_t r = 0; r < n; ++r ) {
+				const size_t i = order[ r ];
+				const size_t d = degrees[ i ];
+				values[ i ] = d < 2
+					? static_cast< IOType >( 0 )
+					: static_cast< IOType >( 2 * triangles[ r ] ) /
+						static_cast< IOType >( d * (d - 1) );
+			}
+			return buildVector( coefficients, values.begin(), values.end(),
+				SEQUENTIAL );
+		}
+
+	} // end namespace ``grb::algorithms''
+
+} // end namespace ``grb''
+
+#endif // end _H_GRB_ALGORITHMS_TRIANGLE_COUNT
+
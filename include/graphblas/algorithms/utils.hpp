@@ -0,0 +1,154 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Utilities shared by algorithms that process the nonzeroes of a matrix
+ * directly, rather than via ALP/GraphBLAS primitives. For internal use only.
+ */
+
+#ifndef _H_GRB_ALGORITHMS_UTILS
+#define _H_GRB_ALGORITHMS_UTILS
+
+#include <vector>
+#include <utility> // std::pair
+
+#include <graphblas.hpp>
+
+
+namespace grb {
+
+	namespace algorithms {
+
+		namespace internal {
+
+			/**
+			 * \internal
+			 * Retrieves the row and column index of the nonzero \a nz, as returned by
+			 * a matrix iterator.
+			 * \endinternal
+			 */
+			template< typename RowType, typename ColType, typename ValType >
+			void nonzero_indices(
+				const std::pair< std::pair< RowType, ColType >, ValType > &nz,
+				size_t &row, size_t &col
+			) {
+				row = nz.first.first;
+				col = nz.first.second;
+			}
+
+			/** \internal Overload of #nonzero_indices for pattern matrices. */
+			template< typename RowType, typename ColType >
+			void nonzero_indices(
+				const std::pair< RowType, ColType > &nz,
+				size_t &row, size_t &col
+			) {
+				row = nz.first;
+				col = nz.second;
+			}
+
+			/**
+			 * \internal
+			 * @returns The value of the nonzero \a nz, as returned by a matrix
+			 *          iterator, cast to \a D.
+			 * \endinternal
+			 */
+			template<
+				typename D, typename RowType, typename ColType, typename ValType
+			>
+			D nonzero_value(
+				const std::pair< std::pair< RowType, ColType >, ValType > &nz,
+				const D &one
+			) {
+				(void) one;
+				return static_cast< D >( nz.second );
+			}
+
+			/**
+			 * \internal
+			 * Overload of #nonzero_value for pattern matrices, of which every nonzero
+			 * has value \a one.
+			 * \endinternal
+			 */
+			template< typename D, typename RowType, typename ColType >
+			D nonzero_value( const std::pair< RowType, ColType > &nz, const D &one ) {
+				(void) nz;
+				return one;
+			}
+
+			/**
+			 * \internal
+			 * @returns The number of threads an algorithm may spawn to process data
+			 *          that is local to the calling user process. This is one unless
+			 *          the selected backend is shared-memory parallel.
+			 * \endinternal
+			 */
+			inline size_t local_threads() {
+#ifdef _GRB_WITH_OMP
+				if( config::default_backend == reference_omp ||
+					config::default_backend == nonblocking
+				) {
+					return config::OMP::threads();
+				}
+#endif
+				return 1;
+			}
+
+			/**
+			 * \internal
+			 * Replaces \a data at every user process with the concatenation of
+			 * \a data over all user processes, in order of process ID.
+			 * \endinternal
+			 */
+			template< typename T >
+			RC allgather( std::vector< T > &data ) {
+				const size_t s = spmd<>::pid();
+				const size_t P = spmd<>::nprocs();
+				if( P == 1 ) {
+					return SUCCESS;
+				}
+				std::vector< T > all, buffer;
+				RC ret = SUCCESS;
+				for( size_t root = 0; ret == SUCCESS && root < P; ++root ) {
+					size_t size = data.size();
+					ret = collectives<>::broadcast( size, root );
+					if( ret != SUCCESS || size == 0 ) {
+						continue;
+					}
+					if( s == root ) {
+						buffer = data;
+					} else {
+						buffer.resize( size );
+					}
+					ret = collectives<>::broadcast( buffer.data(), size, root );
+					all.insert( all.end(), buffer.begin(), buffer.end() );
+				}
+				if( ret == SUCCESS ) {
+					data.swap( all );
+				}
+				return ret;
+			}
+
+		} // end namespace ``grb::algorithms::internal''
+
+	} // end namespace ``grb::algorithms''
+
+} // end namespace ``grb''
+
+#endif // end _H_GRB_ALGORITHMS_UTILS
+
@@ -66,6 +66,14 @@ namespace grb {
 		 */
 		hyperdags,
 
+		/**
+		 * A backend that measures the time spent in, and estimates the work done
+		 * by, every primitive that user computations call. It relies on another
+		 * backend to actually execute the requested computations-- by default, this
+		 * is the #reference backend. A report is printed at #grb::finalize.
+		 */
+		profile,
+
 		/**
 		 * The threaded nonblocking implementation. Supports fast operations with both
 		 * sparse and dense vectors. This backend is currently under development.
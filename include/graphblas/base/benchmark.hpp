@@ -32,6 +32,13 @@
 #include <ios>
 #include <limits>
 #include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include <time.h> //nanosleep
+#include <assert.h>
+#include <stdlib.h> //getenv, abort
 
 #include <graphblas/backends.hpp>
 #include <graphblas/ops.hpp>
@@ -42,8 +49,12 @@
 #include "collectives.hpp"
 #include "config.hpp"
 #include "exec.hpp"
+#include "spmd.hpp"
 
 #ifndef _GRB_NO_STDIO
+ #include <iomanip>
+ #include <sstream>
+ #include <fstream>
  #include <iostream>
 #endif
 
@@ -62,10 +73,11 @@
  * strategy of any given ALP program as described below.
  *
  * The program is called \a inner times \a outer times. Between every
- * \a inner repetitions there is a one-second sleep that ensures machine
- * variability is taken into account. Several statistics are measured
- * across the \a outer repetitions: the minimum, maximum, average, and the
- * (unbiased) sample standard deviation. By contrast, for the \a inner
+ * \a inner repetitions there is a pause, by default of one second, that
+ * ensures machine variability is taken into account. Several statistics are
+ * measured across the \a outer repetitions: the minimum, maximum, average,
+ * the (unbiased) sample standard deviation, the median, and the 90th and 99th
+ * percentiles. By contrast, for the \a inner
  * repetitions, only an average is computed -- the function of \a inner
  * repetitions is solely to avoid timing programs that execute in too short
  * a time frame, meaning a time frame that is of a similar order as the time
@@ -77,6 +89,24 @@
  *
  * \note In published experiments, \a inner is chosen such that a single
  *       outer repetition takes 10 to 100 milliseconds.
+ *
+ * The strategy may be tuned via the following environment variables:
+ *  - <tt>GRB_BENCH_PAUSE</tt>: the pause after every outer repetition, in
+ *    seconds, instead of one second;
+ *  - <tt>GRB_BENCH_WARMUP</tt>: a non-negative number of calls to the program
+ *    before the outer repetitions start, which are excluded from all
+ *    statistics;
+ *  - <tt>GRB_BENCH_FORMAT</tt>: <tt>text</tt> (the default), <tt>json</tt>,
+ *    or <tt>csv</tt>. The latter two report every outer repetition, all
+ *    statistics, and the average timings of every user process, in a
+ *    machine-readable format;
+ *  - <tt>GRB_BENCH_OUTPUT</tt>: a file that JSON or CSV results are appended
+ *    to, instead of writing them to stdout;
+ *  - <tt>GRB_BENCH_LABEL</tt>: a label that identifies the benchmark in JSON
+ *    and CSV results.
+ *
+ * Timings of the outer repetitions are the maxima over all user processes.
+ * The average timings of every user process are reported separately.
  */
 
 namespace grb {
@@ -113,80 +143,516 @@ namespace grb {
 				}
 #endif
 
+				/** The formats in which benchmark results may be reported. */
+				enum Format {
+
+					/** Human-readable text on stdout. */
+					TEXT,
+
+					/** A single-line JSON object per benchmark. */
+					JSON,
+
+					/** Comma-separated values with one row per sample or statistic. */
+					CSV
+
+				};
+
 				/**
-				 * Calculate inner loop performance stats
+				 * Settings of the benchmarking strategy that may be overridden via the
+				 * environment.
 				 */
-				static void benchmark_calc_inner(
-					const size_t loop,
-					const size_t total,
-					grb::utils::TimerResults &inner_times,
-					grb::utils::TimerResults &total_times,
-					grb::utils::TimerResults &min_times,
-					grb::utils::TimerResults &max_times,
-					grb::utils::TimerResults * sdev_times
-				) {
-					inner_times.normalize( total );
-					total_times.accum( inner_times );
-					min_times.min( inner_times );
-					max_times.max( inner_times );
-					sdev_times[ loop ] = inner_times;
+				struct Settings {
+
+					/**
+					 * The format results are reported in. Environment variable
+					 * <tt>GRB_BENCH_FORMAT</tt>, with value <tt>text</tt> (the default),
+					 * <tt>json</tt>, or <tt>csv</tt>.
+					 */
+					Format format;
+
+					/**
+					 * The file JSON or CSV results are appended to. Environment variable
+					 * <tt>GRB_BENCH_OUTPUT</tt>. If empty, results are written to stdout.
+					 */
+					std::string output;
+
+					/**
+					 * A label that identifies the benchmark in JSON and CSV results.
+					 * Environment variable <tt>GRB_BENCH_LABEL</tt>.
+					 */
+					std::string label;
+
+					/**
+					 * The pause after every outer repetition, in seconds. Environment
+					 * variable <tt>GRB_BENCH_PAUSE</tt>. The default is one.
+					 */
+					double pause;
+
+					/**
+					 * The number of calls to the program before the outer repetitions
+					 * start, which are excluded from all statistics. Environment variable
+					 * <tt>GRB_BENCH_WARMUP</tt>. The default is zero.
+					 */
+					size_t warmup;
+
+				};
+
+				/** Statistics of the timings of the outer repetitions. */
+				struct Statistics {
+					grb::utils::TimerResults avg, min, max, std, median, p90, p99;
+				};
+
+				/** @returns The name of the \a f-th field of #grb::utils::TimerResults. */
+				static const char * fieldName( const size_t f ) noexcept {
+					switch( f ) {
+						case 0: return "io";
+						case 1: return "preamble";
+						case 2: return "useful";
+						default: return "postamble";
+					}
+				}
+
+				/** @returns The \a f-th field of \a times. */
+				static double & field(
+					grb::utils::TimerResults &times, const size_t f
+				) noexcept {
+					switch( f ) {
+						case 0: return times.io;
+						case 1: return times.preamble;
+						case 2: return times.useful;
+						default: return times.postamble;
+					}
+				}
+
+				/** @returns The \a f-th field of \a times. */
+				static double field(
+					const grb::utils::TimerResults &times, const size_t f
+				) noexcept {
+					switch( f ) {
+						case 0: return times.io;
+						case 1: return times.preamble;
+						case 2: return times.useful;
+						default: return times.postamble;
+					}
+				}
+
+				/** Reads the benchmark settings from the environment. */
+				static Settings readSettings() {
+					Settings ret;
+					ret.format = TEXT;
+					ret.pause = 1.0;
+					ret.warmup = 0;
+#ifndef _GRB_NO_STDIO
+					const char * value = getenv( "GRB_BENCH_FORMAT" );
+					if( value != nullptr ) {
+						const std::string format( value );
+						if( format == "json" ) {
+							ret.format = JSON;
+						} else if( format == "csv" ) {
+							ret.format = CSV;
+						} else if( format != "text" ) {
+							std::cerr << "Warning: unknown GRB_BENCH_FORMAT " << format << "; "
+								<< "reporting benchmark results as text instead.\n";
+						}
+					}
+					value = getenv( "GRB_BENCH_OUTPUT" );
+					if( value != nullptr ) {
+						ret.output = value;
+					}
+					value = getenv( "GRB_BENCH_LABEL" );
+					if( value != nullptr ) {
+						ret.label = value;
+					}
+					value = getenv( "GRB_BENCH_PAUSE" );
+					if( value != nullptr ) {
+						std::istringstream ss( value );
+						double pause;
+						if( ss >> pause && ss.eof() && pause >= 0 ) {
+							ret.pause = pause;
+						} else {
+							std::cerr << "Warning: could not parse GRB_BENCH_PAUSE; pausing for "
+								<< ret.pause << " second(s) instead.\n";
+						}
+					}
+					value = getenv( "GRB_BENCH_WARMUP" );
+					if( value != nullptr ) {
+						// parse as a signed number, since parsing -1 as an unsigned type
+						// succeeds with a huge value
+						std::istringstream ss( value );
+						long long warmup;
+						if( ss >> warmup && ss.eof() && warmup >= 0 ) {
+							ret.warmup = static_cast< size_t >( warmup );
+						} else {
+							std::cerr << "Warning: could not parse GRB_BENCH_WARMUP; not warming "
+								<< "up instead.\n";
+						}
+					}
+#endif
+					return ret;
 				}
 
 				/**
-				 * Calculate outer loop performance stats
+				 * @returns The \a q-quantile of the given sorted \a values, linearly
+				 *          interpolated between the two nearest values.
 				 */
-				static void benchmark_calc_outer(
-					const size_t total,
-					grb::utils::TimerResults &total_times,
-					grb::utils::TimerResults &min_times,
-					grb::utils::TimerResults &max_times,
-					grb::utils::TimerResults * sdev_times,
-					const size_t pid
+				static double quantile(
+					const std::vector< double > &values, const double q
+				) noexcept {
+					assert( values.size() > 0 );
+					const double h = q * static_cast< double >( values.size() - 1 );
+					const size_t lower = static_cast< size_t >( h );
+					if( lower + 1 >= values.size() ) {
+						return values.back();
+					}
+					return values[ lower ] +
+						( h - lower ) * ( values[ lower + 1 ] - values[ lower ] );
+				}
+
+				/** Computes the statistics of the given \a samples. */
+				static Statistics computeStatistics(
+					const std::vector< grb::utils::TimerResults > &samples
 				) {
-					total_times.normalize( total );
-					grb::utils::TimerResults sdev;
-					// compute standard dev of average times, leaving sqrt calculation until
-					// the output of the values
-					sdev.set( 0 );
-					for( size_t i = 0; i < total; i++ ) {
-						double diff = sdev_times[ i ].io - total_times.io;
-						sdev.io += diff * diff;
-						diff = sdev_times[ i ].preamble - total_times.preamble;
-						sdev.preamble += diff * diff;
-						diff = sdev_times[ i ].useful - total_times.useful;
-						sdev.useful += diff * diff;
-						diff = sdev_times[ i ].postamble - total_times.postamble;
-						sdev.postamble += diff * diff;
+					assert( samples.size() > 0 );
+					Statistics ret;
+					ret.avg.set( 0 );
+					ret.min.set( std::numeric_limits< double >::infinity() );
+					ret.max.set( 0 );
+					ret.std.set( 0 );
+					for( const auto &sample : samples ) {
+						grb::utils::TimerResults copy = sample;
+						ret.avg.accum( copy );
+						ret.min.min( sample );
+						ret.max.max( sample );
 					}
-					// unbiased normalisation of the standard deviation
-					sdev.normalize( total - 1 );
+					ret.avg.normalize( samples.size() );
+					std::vector< double > values( samples.size() );
+					for( size_t f = 0; f < 4; ++f ) {
+						// unbiased sample standard deviation
+						double sdev = 0;
+						for( size_t i = 0; i < samples.size(); ++i ) {
+							values[ i ] = field( samples[ i ], f );
+							const double diff = values[ i ] - field( ret.avg, f );
+							sdev += diff * diff;
+						}
+						field( ret.std, f ) = samples.size() > 1
+							? sqrt( sdev / static_cast< double >( samples.size() - 1 ) )
+							: 0;
+						std::sort( values.begin(), values.end() );
+						field( ret.median, f ) = quantile( values, 0.5 );
+						field( ret.p90, f ) = quantile( values, 0.9 );
+						field( ret.p99, f ) = quantile( values, 0.99 );
+					}
+					return ret;
+				}
 
 #ifndef _GRB_NO_STDIO
-					// output results
-					if( pid == 0 ) {
-						std::cout << "Overall timings (io, preamble, useful, postamble):\n"
-							<< std::scientific;
-						std::cout << "Avg: " << total_times.io << ", " << total_times.preamble
-							<< ", " << total_times.useful << ", " << total_times.postamble << "\n";
-						std::cout << "Min: " << min_times.io << ", " << min_times.preamble << ", "
-							<< min_times.useful << ", " << min_times.postamble << "\n";
-						std::cout << "Max: " << max_times.io << ", " << max_times.preamble << ", "
-							<< max_times.useful << ", " << max_times.postamble << "\n";
-						std::cout << "Std: " << sqrt( sdev.io ) << ", " << sqrt( sdev.preamble )
-							<< ", " << sqrt( sdev.useful ) << ", " << sqrt( sdev.postamble ) << "\n";
+				/** Prints a single line of timings in the text format. */
+				static void printTimings(
+					std::ostream &out, const char * const name,
+					const grb::utils::TimerResults &times
+				) {
+					out << name << times.io << ", " << times.preamble << ", " << times.useful
+						<< ", " << times.postamble << "\n";
+				}
+
+				/** Prints the results in the text format. */
+				static void printText(
+					const Statistics &stats,
+					const std::vector< grb::utils::TimerResults > &processes
+				) {
+					std::cout << "Overall timings (io, preamble, useful, postamble):\n"
+						<< std::scientific;
+					printTimings( std::cout, "Avg: ", stats.avg );
+					printTimings( std::cout, "Min: ", stats.min );
+					printTimings( std::cout, "Max: ", stats.max );
+					printTimings( std::cout, "Std: ", stats.std );
+					printTimings( std::cout, "Med: ", stats.median );
+					printTimings( std::cout, "P90: ", stats.p90 );
+					printTimings( std::cout, "P99: ", stats.p99 );
+					if( processes.size() > 1 ) {
+						std::cout << "Average timings per process (io, preamble, useful, "
+							<< "postamble):\n";
+						for( size_t k = 0; k < processes.size(); ++k ) {
+							std::cout << "#" << k << ": ";
+							printTimings( std::cout, "", processes[ k ] );
+						}
+					}
  #if __GNUC__ > 4
-						std::cout << std::defaultfloat;
+					std::cout << std::defaultfloat;
  #endif
-						printTimeSinceEpoch();
+					printTimeSinceEpoch();
+				}
+
+				/** Writes \a value as a JSON string. */
+				static void writeJSONString( std::ostream &out, const std::string &value ) {
+					out << '"';
+					for( const char c : value ) {
+						if( c == '"' || c == '\\' ) {
+							out << '\\' << c;
+						} else if( static_cast< unsigned char >( c ) < 0x20 ) {
+							out << ' ';
+						} else {
+							out << c;
+						}
+					}
+					out << '"';
+				}
+
+				/** Writes \a times as a JSON object. */
+				static void writeJSONTimings(
+					std::ostream &out, const grb::utils::TimerResults &times
+				) {
+					out << "{";
+					for( size_t f = 0; f < 4; ++f ) {
+						out << ( f > 0 ? "," : "" ) << "\"" << fieldName( f ) << "\":"
+							<< field( times, f );
+					}
+					out << "}";
+				}
+
+				/** Writes the results as a single-line JSON object. */
+				static void writeJSON(
+					std::ostream &out, const Settings &settings,
+					const size_t inner,
+					const std::vector< grb::utils::TimerResults > &samples,
+					const Statistics &stats,
+					const std::vector< grb::utils::TimerResults > &processes
+				) {
+					out << "{\"label\":";
+					writeJSONString( out, settings.label );
+					out << ",\"nprocs\":" << processes.size() << ",\"inner\":" << inner
+						<< ",\"outer\":" << samples.size() << ",\"warmup\":"
+						<< settings.warmup << ",\"epoch_ms\":"
+						<< std::chrono::duration_cast< std::chrono::milliseconds >(
+							std::chrono::system_clock::now().time_since_epoch() ).count()
+						<< ",\"samples\":[";
+					for( size_t i = 0; i < samples.size(); ++i ) {
+						out << ( i > 0 ? "," : "" );
+						writeJSONTimings( out, samples[ i ] );
+					}
+					out << "],\"statistics\":{";
+					const std::pair< const char *, const grb::utils::TimerResults * >
+						named[ 7 ] = {
+							{ "avg", &stats.avg }, { "min", &stats.min }, { "max", &stats.max },
+							{ "std", &stats.std }, { "median", &stats.median },
+							{ "p90", &stats.p90 }, { "p99", &stats.p99 }
+						};
+					for( size_t i = 0; i < 7; ++i ) {
+						out << ( i > 0 ? "," : "" ) << "\"" << named[ i ].first << "\":";
+						writeJSONTimings( out, *named[ i ].second );
+					}
+					out << "},\"processes\":[";
+					for( size_t k = 0; k < processes.size(); ++k ) {
+						out << ( k > 0 ? "," : "" );
+						writeJSONTimings( out, processes[ k ] );
+					}
+					out << "]}\n";
+				}
+
+				/** Writes a single row in the CSV format. */
+				static void writeCSVRow(
+					std::ostream &out, const std::string &label, const char * const kind,
+					const size_t index, const grb::utils::TimerResults &times
+				) {
+					// labels may not contain separators
+					for( const char c : label ) {
+						out << ( c == ',' || c == '\n' ? ' ' : c );
+					}
+					out << "," << kind << "," << index;
+					for( size_t f = 0; f < 4; ++f ) {
+						out << "," << field( times, f );
+					}
+					out << "\n";
+				}
+
+				/**
+				 * Writes the results in the CSV format. The header is written only if
+				 * \a header is <tt>true</tt>.
+				 */
+				static void writeCSV(
+					std::ostream &out, const bool header, const Settings &settings,
+					const std::vector< grb::utils::TimerResults > &samples,
+					const Statistics &stats,
+					const std::vector< grb::utils::TimerResults > &processes
+				) {
+					if( header ) {
+						out << "label,kind,index,io,preamble,useful,postamble\n";
+					}
+					for( size_t i = 0; i < samples.size(); ++i ) {
+						writeCSVRow( out, settings.label, "sample", i, samples[ i ] );
+					}
+					writeCSVRow( out, settings.label, "avg", 0, stats.avg );
+					writeCSVRow( out, settings.label, "min", 0, stats.min );
+					writeCSVRow( out, settings.label, "max", 0, stats.max );
+					writeCSVRow( out, settings.label, "std", 0, stats.std );
+					writeCSVRow( out, settings.label, "median", 0, stats.median );
+					writeCSVRow( out, settings.label, "p90", 0, stats.p90 );
+					writeCSVRow( out, settings.label, "p99", 0, stats.p99 );
+					for( size_t k = 0; k < processes.size(); ++k ) {
+						writeCSVRow( out, settings.label, "process", k, processes[ k ] );
+					}
+				}
+
+				/** Reports the results in the configured format. */
+				static void report(
+					const Settings &settings, const size_t inner,
+					const std::vector< grb::utils::TimerResults > &samples,
+					const Statistics &stats,
+					const std::vector< grb::utils::TimerResults > &processes
+				) {
+					if( settings.format == TEXT || !settings.output.empty() ) {
+						printText( stats, processes );
+					}
+					if( settings.format == TEXT ) {
+						return;
+					}
+					std::ofstream file;
+					bool header = true;
+					if( !settings.output.empty() ) {
+						{
+							std::ifstream existing( settings.output );
+							header = !existing.good() ||
+								existing.peek() == std::ifstream::traits_type::eof();
+						}
+						file.open( settings.output, std::ios::app );
+						if( !file.is_open() ) {
+							std::cerr << "Warning: could not open " << settings.output << "; "
+								<< "writing benchmark results to stdout instead.\n";
+						}
+					}
+					std::ostream &out = file.is_open() ? file : std::cout;
+					const std::streamsize precision = out.precision();
+					out << std::setprecision( std::numeric_limits< double >::max_digits10 );
+					if( settings.format == JSON ) {
+						writeJSON( out, settings, inner, samples, stats, processes );
+					} else {
+						writeCSV( out, header, settings, samples, stats, processes );
+					}
+					out << std::setprecision( precision ) << std::flush;
+				}
+#endif
+
+				/**
+				 * The benchmarking strategy common to all variants of #benchmark.
+				 *
+				 * @tparam implementation The backend the program is using.
+				 * @tparam U              Output type of the given user program.
+				 * @tparam Program        A callable that calls the user program once.
+				 *
+				 * @param[in]  program  The callable that calls the user program.
+				 * @param[out] data_out The output data of the user program.
+				 * @param[in]  inner    The number of inner repetitions of the benchmark.
+				 * @param[in]  outer    The number of outer repetitions of the benchmark.
+				 * @param[in]  pid      Unique ID of the calling user process.
+				 */
+				template<
+					enum Backend implementation,
+					typename U, typename Program
+				>
+				static RC benchmark_loop(
+					const Program &program, U &data_out,
+					const size_t inner, const size_t outer,
+					const size_t pid
+				) {
+					const Settings settings = readSettings();
+
+					// warm-up calls are not timed
+					for( size_t w = 0; w < settings.warmup; ++w ) {
+						data_out.times.set( 0 );
+						program();
+					}
+
+					std::vector< grb::utils::TimerResults > samples( outer );
+					grb::utils::TimerResults local_total;
+					local_total.set( 0 );
+
+					// outer loop
+					for( size_t out = 0; out < outer; ++out ) {
+						grb::utils::TimerResults inner_times, local_times;
+						inner_times.set( 0 );
+						local_times.set( 0 );
+
+						// inner loop
+						for( size_t in = 0; in < inner; ++in ) {
+							data_out.times.set( 0 );
+							program();
+							local_times.accum( data_out.times );
+							grb::collectives< implementation >::reduce( data_out.times.io, 0,
+								grb::operators::max< double >() );
+							grb::collectives< implementation >::reduce( data_out.times.preamble, 0,
+								grb::operators::max< double >() );
+							grb::collectives< implementation >::reduce( data_out.times.useful, 0,
+								grb::operators::max< double >() );
+							grb::collectives< implementation >::reduce( data_out.times.postamble, 0,
+								grb::operators::max< double >() );
+							inner_times.accum( data_out.times );
+						}
+						inner_times.normalize( inner );
+						local_times.normalize( inner );
+						samples[ out ] = inner_times;
+						local_total.accum( local_times );
+
+#ifndef _GRB_NO_STDIO
+						// give experiment output line
+						if( pid == 0 && settings.format == TEXT ) {
+							std::cout << "Outer iteration #" << out << " timings "
+								<< "(io, preamble, useful, postamble, time since epoch): " << std::fixed
+								<< inner_times.io << ", " << inner_times.preamble << ", "
+								<< inner_times.useful << ", " << inner_times.postamble << ", ";
+								printTimeSinceEpoch( false );
+							std::cout << std::scientific;
+						}
+#endif
+
+						// pause for next outer loop
+						if( settings.pause > 0 ) {
+							struct timespec pause;
+							pause.tv_sec = static_cast< time_t >( settings.pause );
+							pause.tv_nsec = static_cast< long >(
+								( settings.pause - pause.tv_sec ) * 1e9 );
+							if( nanosleep( &pause, nullptr ) != 0 ) {
+#ifndef _GRB_NO_STDIO
+								std::cerr << "Sleep interrupted, assume benchmark is unreliable; "
+									<< "exiting.\n";
+#endif
+								abort();
+							}
+						}
 					}
+
+					// collect the average timings of every process
+					local_total.normalize( outer );
+					const size_t nprocs = grb::spmd< implementation >::nprocs();
+					std::vector< grb::utils::TimerResults > processes( nprocs );
+					for( size_t k = 0; k < nprocs; ++k ) {
+						grb::utils::TimerResults times = local_total;
+						for( size_t f = 0; f < 4; ++f ) {
+							const RC rc = grb::collectives< implementation >::broadcast(
+								field( times, f ), k );
+							if( rc != SUCCESS ) {
+								return rc;
+							}
+						}
+						processes[ k ] = times;
+					}
+
+					// calculate and report performance stats
+					if( outer > 0 ) {
+						const Statistics stats = computeStatistics( samples );
+#ifndef _GRB_NO_STDIO
+						if( pid == 0 ) {
+							report( settings, inner, samples, stats, processes );
+						}
 #else
-					// we ran the benchmark, but may not have a way to output it in this case
-					// this currently only is touched by the #grb::banshee backend, which
-					// provides other timing mechanisms.
-					(void) min_times;
-					(void) max_times;
-					(void) pid;
+						// we ran the benchmark, but may not have a way to output it in this
+						// case this currently only is touched by the #grb::banshee backend,
+						// which provides other timing mechanisms.
+						(void) stats;
+						(void) pid;
 #endif
+					}
+
+					return SUCCESS;
 				}
 
 				/**
@@ -223,65 +689,12 @@ namespace grb {
 					const size_t outer,
 					const size_t pid
 				) {
-					const double inf = std::numeric_limits< double >::infinity();
-					grb::utils::TimerResults total_times, min_times, max_times;
-					grb::utils::TimerResults * sdev_times =
-						new grb::utils::TimerResults[ outer ];
-					total_times.set( 0 );
-					min_times.set( inf );
-					max_times.set( 0 );
-
-					// outer loop
-					for( size_t out = 0; out < outer; ++out ) {
-						grb::utils::TimerResults inner_times;
-						inner_times.set( 0 );
-
-						// inner loop
-						for( size_t in = 0; in < inner; in++ ) {
-							data_out.times.set( 0 );
+					return benchmark_loop< implementation >(
+						[ alp_program, data_in, in_size, &data_out ]() {
 							( *alp_program )( data_in, in_size, data_out );
-							grb::collectives< implementation >::reduce(
-								data_out.times.io, 0, grb::operators::max< double >() );
-							grb::collectives< implementation >::reduce(
-								data_out.times.preamble, 0, grb::operators::max< double >() );
-							grb::collectives< implementation >::reduce(
-								data_out.times.useful, 0, grb::operators::max< double >() );
-							grb::collectives< implementation >::reduce(
-								data_out.times.postamble, 0, grb::operators::max< double >() );
-							inner_times.accum( data_out.times );
-						}
-
-						// calculate performance stats
-						benchmark_calc_inner( out, inner, inner_times, total_times, min_times,
-							max_times, sdev_times );
-
-#ifndef _GRB_NO_STDIO
-						// give experiment output line
-						if( pid == 0 ) {
-							std::cout << "Outer iteration #" << out << " timings (io, preamble, "
-								<< "useful, postamble, time since epoch): ";
-							std::cout << inner_times.io << ", " << inner_times.preamble << ", "
-								<< inner_times.useful << ", " << inner_times.postamble << ", ";
-							printTimeSinceEpoch( false );
-						}
-#endif
-
-						// pause for next outer loop
-						if( sleep( 1 ) != 0 ) {
-#ifndef _GRB_NO_STDIO
-							std::cerr << "Sleep interrupted, assume benchmark is unreliable; "
-								<< "exiting.\n";
-#endif
-							abort();
-						}
-					}
-
-					// calculate performance stats
-					benchmark_calc_outer( outer, total_times, min_times, max_times, sdev_times,
-						pid );
-					delete [] sdev_times;
-
-					return SUCCESS;
+						},
+						data_out, inner, outer, pid
+					);
 				}
 
 				/**
@@ -317,67 +730,12 @@ namespace grb {
 					const size_t outer,
 					const size_t pid
 				) {
-					const double inf = std::numeric_limits< double >::infinity();
-					grb::utils::TimerResults total_times, min_times, max_times;
-					grb::utils::TimerResults * sdev_times =
-						new grb::utils::TimerResults[ outer ];
-					total_times.set( 0 );
-					min_times.set( inf );
-					max_times.set( 0 );
-
-					// outer loop
-					for( size_t out = 0; out < outer; ++out ) {
-						grb::utils::TimerResults inner_times;
-						inner_times.set( 0 );
-
-						// inner loop
-						for( size_t in = 0; in < inner; ++in ) {
-							data_out.times.set( 0 );
-
+					return benchmark_loop< implementation >(
+						[ alp_program, &data_in, &data_out ]() {
 							( *alp_program )( data_in, data_out );
-							grb::collectives< implementation >::reduce( data_out.times.io, 0,
-								grb::operators::max< double >() );
-							grb::collectives< implementation >::reduce( data_out.times.preamble, 0,
-								grb::operators::max< double >() );
-							grb::collectives< implementation >::reduce( data_out.times.useful, 0,
-								grb::operators::max< double >() );
-							grb::collectives< implementation >::reduce( data_out.times.postamble, 0,
-								grb::operators::max< double >() );
-							inner_times.accum( data_out.times );
-						}
-
-						// calculate performance stats
-						benchmark_calc_inner( out, inner, inner_times, total_times, min_times,
-							max_times, sdev_times );
-
-#ifndef _GRB_NO_STDIO
-						// give experiment output line
-						if( pid == 0 ) {
-							std::cout << "Outer iteration #" << out << " timings "
-								<< "(io, preamble, useful, postamble, time since epoch): " << std::fixed
-								<< inner_times.io << ", " << inner_times.preamble << ", "
-								<< inner_times.useful << ", " << inner_times.postamble << ", ";
-								printTimeSinceEpoch( false );
-							std::cout << std::scientific;
-						}
-#endif
-
-						// pause for next outer loop
-						if( sleep( 1 ) != 0 ) {
-#ifndef _GRB_NO_STDIO
-							std::cerr << "Sleep interrupted, assume benchmark is unreliable; "
-								<< "exiting.\n";
-#endif
-							abort();
-						}
-					}
-
-					// calculate performance stats
-					benchmark_calc_outer( outer, total_times, min_times, max_times, sdev_times,
-						pid );
-					delete[] sdev_times;
-
-					return SUCCESS;
+						},
+						data_out, inner, outer, pid
+					);
 				}
 
 
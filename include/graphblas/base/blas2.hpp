@@ -32,8 +32,10 @@
 #include <graphblas/backends.hpp>
 #include <graphblas/blas1.hpp>
 #include <graphblas/descriptors.hpp>
+#include <graphblas/epilogues.hpp>
 #include <graphblas/rc.hpp>
 #include <graphblas/semiring.hpp>
+#include <graphblas/triangular.hpp>
 
 #include "config.hpp"
 #include "matrix.hpp"
@@ -964,9 +966,378 @@ namespace grb {
 		return UNSUPPORTED;
 	}
 
+	/**
+	 * Right-handed in-place masked sparse matrix--vector multiplication followed
+	 * by an epilogue, \f$ u = f(u + Av) \f$.
+	 *
+	 * Aliases to this function exist that do not include a mask:
+	 *  - grb::mxv( u, A, v, semiring, epilogue );
+	 *
+	 * This function computes \f$ u = u + Av \f$ exactly as #grb::mxv does, and
+	 * then applies the given \a epilogue \f$ f \f$ to each element
+	 * \f$ u_i \f$ that is assigned on output and for which
+	 * \f$ \mathit{mask}_i \f$ evaluates <tt>true</tt>. Its semantics hence
+	 * equal those of a call to #grb::mxv followed by the (masked) calls to
+	 * #grb::foldl that the epilogue describes; see #grb::epilogues.
+	 *
+	 * Backends may apply the epilogue to each output element as it is
+	 * finalised, thus saving one or more passes over \a u.
+	 *
+	 * @tparam Epilogue The type of the epilogue; see #grb::epilogues.
+	 *
+	 * @param[in] epilogue The epilogue to apply to the output elements.
+	 *
+	 * All other template and function arguments are as for #grb::mxv. In
+	 * addition to the return codes of #grb::mxv, this function returns:
+	 *
+	 * @returns #grb::MISMATCH If the epilogue refers to a vector whose size does
+	 *                         not match that of \a u.
+	 *
+	 * \par Performance semantics
+	 * Each backend must define performance semantics for this primitive.
+	 *
+	 * @see perfSemantics
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename RIT, typename CIT, typename NIT,
+		typename Coords,
+		enum Backend implementation = config::default_backend
+	>
+	RC mxv(
+		Vector< IOType, implementation, Coords > &u,
+		const Vector< InputType3, implementation, Coords > &mask,
+		const Matrix< InputType2, implementation, RIT, CIT, NIT > &A,
+		const Vector< InputType1, implementation, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * = nullptr
+	) {
+#ifdef _DEBUG
+		std::cerr << "Selected backend does not implement grb::mxv (output-masked, "
+			<< "with epilogue)\n";
+#endif
+#ifndef NDEBUG
+		const bool backend_does_not_support_output_masked_mxv_epilogue = false;
+		assert( backend_does_not_support_output_masked_mxv_epilogue );
+#endif
+		(void) u;
+		(void) mask;
+		(void) A;
+		(void) v;
+		(void) ring;
+		(void) epilogue;
+		(void) phase;
+		return UNSUPPORTED;
+	}
+
+	/**
+	 * Right-handed in-place sparse matrix--vector multiplication followed by an
+	 * epilogue, \f$ u = f(u + Av) \f$.
+	 *
+	 * See the documentation of the masked variant for the full specification of
+	 * this function.
+	 *
+	 * \par Performance semantics
+	 * Each backend must define performance semantics for this primitive.
+	 *
+	 * @see perfSemantics
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT,
+		enum Backend implementation = config::default_backend
+	>
+	RC mxv(
+		Vector< IOType, implementation, Coords > &u,
+		const Matrix< InputType2, implementation, RIT, CIT, NIT > &A,
+		const Vector< InputType1, implementation, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * = nullptr
+	) {
+#ifdef _DEBUG
+		std::cerr << "Selected backend does not implement grb::mxv (with "
+			<< "epilogue)\n";
+#endif
+#ifndef NDEBUG
+		const bool backend_does_not_support_mxv_epilogue = false;
+		assert( backend_does_not_support_mxv_epilogue );
+#endif
+		(void) u;
+		(void) A;
+		(void) v;
+		(void) ring;
+		(void) epilogue;
+		(void) phase;
+		return UNSUPPORTED;
+	}
+
+	/**
+	 * Left-handed in-place masked sparse matrix--vector multiplication followed
+	 * by an epilogue, \f$ u = f(u + vA) \f$.
+	 *
+	 * See the documentation of the masked #grb::mxv with an epilogue for the
+	 * full specification of this function.
+	 *
+	 * \par Performance semantics
+	 * Each backend must define performance semantics for this primitive.
+	 *
+	 * @see perfSemantics
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename Coords, typename RIT, typename CIT, typename NIT,
+		enum Backend implementation = config::default_backend
+	>
+	RC vxm(
+		Vector< IOType, implementation, Coords > &u,
+		const Vector< InputType3, implementation, Coords > &mask,
+		const Vector< InputType1, implementation, Coords > &v,
+		const Matrix< InputType2, implementation, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * = nullptr
+	) {
+#ifdef _DEBUG
+		std::cerr << "Selected backend does not implement grb::vxm (output-masked, "
+			<< "with epilogue)\n";
+#endif
+#ifndef NDEBUG
+		const bool backend_does_not_support_output_masked_vxm_epilogue = false;
+		assert( backend_does_not_support_output_masked_vxm_epilogue );
+#endif
+		(void) u;
+		(void) mask;
+		(void) v;
+		(void) A;
+		(void) ring;
+		(void) epilogue;
+		(void) phase;
+		return UNSUPPORTED;
+	}
+
+	/**
+	 * Left-handed in-place sparse matrix--vector multiplication followed by an
+	 * epilogue, \f$ u = f(u + vA) \f$.
+	 *
+	 * See the documentation of the masked #grb::mxv with an epilogue for the
+	 * full specification of this function.
+	 *
+	 * \par Performance semantics
+	 * Each backend must define performance semantics for this primitive.
+	 *
+	 * @see perfSemantics
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT,
+		enum Backend implementation = config::default_backend
+	>
+	RC vxm(
+		Vector< IOType, implementation, Coords > &u,
+		const Vector< InputType1, implementation, Coords > &v,
+		const Matrix< InputType2, implementation, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * = nullptr
+	) {
+#ifdef _DEBUG
+		std::cerr << "Selected backend does not implement grb::vxm (with "
+			<< "epilogue)\n";
+#endif
+#ifndef NDEBUG
+		const bool backend_does_not_support_vxm_epilogue = false;
+		assert( backend_does_not_support_vxm_epilogue );
+#endif
+		(void) u;
+		(void) v;
+		(void) A;
+		(void) ring;
+		(void) epilogue;
+		(void) phase;
+		return UNSUPPORTED;
+	}
+
+	/**
+	 * Analyses the sparsity structure of a square matrix in preparation of one
+	 * or more sparse triangular solves via #grb::triangularSolve.
+	 *
+	 * The analysis computes a level-set schedule: the rows of the matrix are
+	 * partitioned into levels such that each row depends only on rows contained
+	 * in preceding levels. Within a single level, rows may be solved for
+	 * concurrently.
+	 *
+	 * @tparam descr The descriptor to be used. Supported descriptors are
+	 *               #grb::descriptors::transpose_matrix, in which case the
+	 *               analysis applies to \f$ T^T \f$ instead of \f$ T \f$.
+	 *
+	 * @param[out] schedule The computed schedule. Any previous contents are
+	 *                      overwritten.
+	 * @param[in]  T        The square matrix to analyse.
+	 * @param[in]  triangle Which triangle of \a T (or its transpose) to use.
+	 * @param[in]  diagonal Whether the diagonal of \a T is stored or implied.
+	 *
+	 * @returns #grb::SUCCESS  On successful analysis.
+	 * @returns #grb::MISMATCH If \a T is not square. The \a schedule is left
+	 *                         untouched.
+	 * @returns #grb::ILLEGAL  If \a diagonal is #grb::NON_UNIT while some row of
+	 *                         \a T has no diagonal nonzero. The \a schedule is
+	 *                         left untouched.
+	 * @returns #grb::OUTOFMEM If the schedule could not be allocated. The
+	 *                         \a schedule is left untouched.
+	 *
+	 * \parblock
+	 * \par Performance semantics
+	 * Each backend must define performance semantics for this primitive.
+	 *
+	 * @see perfSemantics
+	 * \endparblock
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType, typename RIT, typename CIT, typename NIT,
+		enum Backend backend
+	>
+	RC triangularAnalysis(
+		TriangularSchedule &schedule,
+		const Matrix< InputType, backend, RIT, CIT, NIT > &T,
+		const Triangle triangle,
+		const Diagonal diagonal = NON_UNIT
+	) {
+#ifdef _DEBUG
+		std::cerr << "Selected backend does not implement grb::triangularAnalysis\n";
+#endif
+#ifndef NDEBUG
+		const bool selected_backend_does_not_support_triangular_analysis = false;
+		assert( selected_backend_does_not_support_triangular_analysis );
+#endif
+		(void) schedule;
+		(void) T;
+		(void) triangle;
+		(void) diagonal;
+		return UNSUPPORTED;
+	}
+
+	/**
+	 * Solves a sparse triangular system \f$ Tx = b \f$ for \f$ x \f$.
+	 *
+	 * Only the triangle of \f$ T \f$ selected during the analysis phase is
+	 * used; see #grb::triangularAnalysis, which must have been called on \a T
+	 * with the same descriptor prior to calling this function.
+	 *
+	 * Let \f$ t_{ij} \f$ be the nonzeroes of the selected triangle excluding
+	 * the diagonal. This function computes, in the order prescribed by the
+	 * \a schedule,
+	 *   \f$ x_i = \left( b_i - \bigoplus_j t_{ij} \otimes x_j \right) / t_{ii} \f$,
+	 * where \f$ \oplus \f$ and \f$ \otimes \f$ are the additive and
+	 * multiplicative operators of the given \a ring, and where subtraction and
+	 * division are given by \a minus and \a divide, respectively. If the
+	 * schedule has a #grb::UNIT diagonal, no division is performed.
+	 *
+	 * Missing entries of \a b are interpreted as the zero of \a ring. On output,
+	 * \a x is dense. The vectors \a x and \a b may be the same container, in
+	 * which case the solve proceeds in-place.
+	 *
+	 * @tparam descr The descriptor to be used. Supported descriptors are
+	 *               #grb::descriptors::transpose_matrix, which must match the
+	 *               descriptor used during analysis, and
+	 *               #grb::descriptors::dense.
+	 *
+	 * @param[out] x        The solution vector.
+	 * @param[in]  T        The triangular matrix.
+	 * @param[in]  b        The right-hand side vector.
+	 * @param[in]  schedule The result of analysing \a T.
+	 * @param[in]  ring     The semiring under which to accumulate.
+	 * @param[in]  minus    The inverse of the additive operator of \a ring.
+	 * @param[in]  divide   The inverse of the multiplicative operator of
+	 *                      \a ring.
+	 *
+	 * @returns #grb::SUCCESS  On successful completion.
+	 * @returns #grb::MISMATCH If the dimensions of \a x, \a T, \a b, or
+	 *                         \a schedule do not match.
+	 * @returns #grb::ILLEGAL  If \a schedule was computed for a different
+	 *                         transposition of \a T, or if the dense descriptor
+	 *                         was given while \a b is sparse.
+	 *
+	 * When any error code is returned, the contents of \a x are undefined.
+	 *
+	 * \parblock
+	 * \par Performance semantics
+	 * Each backend must define performance semantics for this primitive.
+	 *
+	 * @see perfSemantics
+	 * \endparblock
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring,
+		class Minus = operators::subtract< typename Ring::D4 >,
+		class Divide = operators::divide< typename Ring::D4 >,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT,
+		enum Backend backend
+	>
+	RC triangularSolve(
+		Vector< IOType, backend, Coords > &x,
+		const Matrix< InputType2, backend, RIT, CIT, NIT > &T,
+		const Vector< InputType1, backend, Coords > &b,
+		const TriangularSchedule &schedule,
+		const Ring &ring = Ring(),
+		const Minus &minus = Minus(),
+		const Divide &divide = Divide(),
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value,
+		void >::type * const = nullptr
+	) {
+#ifdef _DEBUG
+		std::cerr << "Selected backend does not implement grb::triangularSolve\n";
+#endif
+#ifndef NDEBUG
+		const bool selected_backend_does_not_support_triangular_solve = false;
+		assert( selected_backend_does_not_support_triangular_solve );
+#endif
+		(void) x;
+		(void) T;
+		(void) b;
+		(void) schedule;
+		(void) ring;
+		(void) minus;
+		(void) divide;
+		return UNSUPPORTED;
+	}
+
 	/** @} */
 
 } // namespace grb
 
 #endif // end _H_GRB_BLAS2_BASE
-
@@ -344,6 +344,46 @@ namespace grb {
 				}
 		};
 
+		/**
+		 * Configuration parameters of the pool that recycles the memory areas of
+		 * ALP containers; see #grb::utils::ContainerPool.
+		 *
+		 * \note The defaults may be overridden by modifying this class.
+		 *
+		 * \ingroup config
+		 */
+		class MEMORY_POOL {
+
+			public:
+
+				/**
+				 * Whether the pool retains released memory areas for reuse. If not, every
+				 * allocation results in a system call, while the pool still collects
+				 * statistics.
+				 */
+				static constexpr bool enabled() {
+					return true;
+				}
+
+				/**
+				 * The maximum number of bytes the pool may retain without them being in
+				 * use. Memory areas released beyond this limit are returned to the
+				 * system. This also is the largest memory area the pool recycles.
+				 */
+				static constexpr size_t maxRetained() {
+					return 1ul << 28;
+				}
+
+				/**
+				 * The size of a huge page, in bytes. Memory areas requested to be backed
+				 * by huge pages are aligned to, and padded to a multiple of, this size.
+				 */
+				static constexpr size_t hugePageSize() {
+					return 1ul << 21;
+				}
+
+		};
+
 		/**
 		 * Collects a series of implementation choices corresponding to some given
 		 * \a backend.
@@ -34,6 +34,9 @@
 #ifdef _GRB_WITH_NONBLOCKING
  #include "graphblas/nonblocking/blas1.hpp"
 #endif
+#ifdef _GRB_WITH_PROFILE
+ #include <graphblas/profile/blas1.hpp>
+#endif
 #ifdef _GRB_WITH_BANSHEE
  #include <graphblas/banshee/blas1.hpp>
 #endif
@@ -36,6 +36,9 @@
 #ifdef _GRB_WITH_NONBLOCKING
  #include "graphblas/nonblocking/blas3.hpp"
 #endif
+#ifdef _GRB_WITH_PROFILE
+ #include <graphblas/profile/blas3.hpp>
+#endif
 #ifdef _GRB_WITH_LPF
  #include <graphblas/bsp1d/blas3.hpp>
 #endif
@@ -578,7 +578,7 @@ namespace grb {
 	>
 	RC foldl(
 		Vector< IOType, BSP1D, Coords > &x,
-		Vector< MaskType, BSP1D, Coords > &mask,
+		const Vector< MaskType, BSP1D, Coords > &mask,
 		const InputType &beta,
 		const Operator &op,
 		const Phase &phase = EXECUTE,
@@ -641,7 +641,7 @@ namespace grb {
 	>
 	RC foldl(
 		Vector< IOType, BSP1D, Coords > &x,
-		Vector< MaskType, BSP1D, Coords > &mask,
+		const Vector< MaskType, BSP1D, Coords > &mask,
 		const InputType &beta,
 		const Monoid &monoid,
 		const Phase &phase = EXECUTE,
@@ -639,6 +639,119 @@ namespace grb {
 		return ret;
 	}
 
+	/**
+	 * \internal
+	 * Composes the multiplication with the folds the epilogue translates to.
+	 * These folds are local to each process and require no communication.
+	 * \endinternal
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC vxm(
+		Vector< IOType, BSP1D, Coords > &u,
+		const Vector< InputType3, BSP1D, Coords > &mask,
+		const Vector< InputType1, BSP1D, Coords > &v,
+		const Matrix< InputType2, BSP1D, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		if( !internal::epilogueFits( epilogue, size( u ) ) ) {
+			return MISMATCH;
+		}
+		RC ret = vxm< descr >( u, mask, v, A, ring, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			ret = internal::foldEpilogue< descr >( u, mask, epilogue );
+		}
+		return ret;
+	}
+
+	/** \internal Delegates to the masked variant */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC vxm(
+		Vector< IOType, BSP1D, Coords > &u,
+		const Vector< InputType1, BSP1D, Coords > &v,
+		const Matrix< InputType2, BSP1D, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		const Vector< bool, BSP1D, Coords > empty_mask( 0 );
+		return vxm< descr >( u, empty_mask, v, A, ring, epilogue, phase );
+	}
+
+	/** \internal See the above #grb::vxm with an epilogue */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC mxv(
+		Vector< IOType, BSP1D, Coords > &u,
+		const Vector< InputType3, BSP1D, Coords > &mask,
+		const Matrix< InputType2, BSP1D, RIT, CIT, NIT > &A,
+		const Vector< InputType1, BSP1D, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		if( !internal::epilogueFits( epilogue, size( u ) ) ) {
+			return MISMATCH;
+		}
+		RC ret = mxv< descr >( u, mask, A, v, ring, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			ret = internal::foldEpilogue< descr >( u, mask, epilogue );
+		}
+		return ret;
+	}
+
+	/** \internal Delegates to the masked variant */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC mxv(
+		Vector< IOType, BSP1D, Coords > &u,
+		const Matrix< InputType2, BSP1D, RIT, CIT, NIT > &A,
+		const Vector< InputType1, BSP1D, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		const Vector< bool, BSP1D, Coords > empty_mask( 0 );
+		return mxv< descr >( u, empty_mask, A, v, ring, epilogue, phase );
+	}
+
 	/** @} */
 
 } // namespace grb
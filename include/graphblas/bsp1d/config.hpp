@@ -94,7 +94,7 @@ namespace grb {
 				 * @returns The default allocation strategy for private memory segments.
 				 */
 				static constexpr ALLOC_MODE defaultAllocMode() {
-					return grb::config::ALLOC_MODE::ALIGNED;
+					return IMPLEMENTATION< _GRB_BSP1D_BACKEND >::defaultAllocMode();
 				}
 
 				/**
@@ -135,6 +135,26 @@ namespace grb {
 					return IMPLEMENTATION< _GRB_BSP1D_BACKEND >::coordinatesBackend();
 				}
 
+				/**
+				 * @returns The maximum number of input nonzeroes a user process reads
+				 *          during #grb::buildMatrixUnique in #grb::PARALLEL I/O mode
+				 *          before exchanging non-local nonzeroes with their owners.
+				 *
+				 * Ingestion proceeds in as many rounds as required for every process to
+				 * consume its input, which bounds the size of the outgoing caches to the
+				 * value returned here. Larger values result in fewer (collective)
+				 * rounds, while smaller values reduce peak memory use.
+				 *
+				 * A return value of zero disables streaming ingestion: then, all input
+				 * nonzeroes are cached before a single exchange takes place.
+				 *
+				 * This default may be overridden at run-time via the
+				 * <tt>GRB_BSP1D_BUILD_CHUNK_SIZE</tt> environment variable.
+				 */
+				static constexpr size_t buildMatrixChunkSize() {
+					return (1UL << 22);
+				}
+
 		};
 
 		/** @} */
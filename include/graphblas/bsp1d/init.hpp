@@ -173,6 +173,14 @@ namespace grb {
 			/** Mapper to assign IDs to BSP1D containers .*/
 			utils::DMapper< uintptr_t > mapper;
 
+			/**
+			 * The maximum number of input nonzeroes read during a round of
+			 * #grb::buildMatrixUnique in #grb::PARALLEL I/O mode.
+			 *
+			 * @see config::IMPLEMENTATION< BSP1D >::buildMatrixChunkSize.
+			 */
+			size_t build_chunk_size;
+
 			/**
 			 * Initialises all fields.
 			 *
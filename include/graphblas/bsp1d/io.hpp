@@ -1509,143 +1509,144 @@ namespace grb {
 			);
 		}
 
-	} // end namespace grb::internal
-
-	/**
-	 * \internal No implementation details.
-	 */
-	template<
-		Descriptor descr = descriptors::no_operation,
-		typename InputType,
-		typename RIT,
-		typename CIT,
-		typename NIT,
-		typename fwd_iterator
-	>
-	RC buildMatrixUnique(
-		Matrix< InputType, BSP1D, RIT, CIT, NIT > &A,
-		const fwd_iterator start, const fwd_iterator end,
-		const IOMode mode
-	) {
-		static_assert(
-			utils::is_alp_matrix_iterator<
-				InputType, fwd_iterator
-			>::value,
-			"the given iterator is not a valid input iterator, "
-			"see the ALP specification for input iterators"
-		);
-		// static checks
-		NO_CAST_ASSERT( !(descr & descriptors::no_casting) || (
-			std::is_same< InputType,
-				typename utils::is_alp_matrix_iterator<
-					InputType, fwd_iterator
-				>::ValueType
-			>::value &&
-			std::is_integral< RIT >::value &&
-			std::is_integral< CIT >::value
-		), "grb::buildMatrixUnique (BSP1D implementation)",
-			"Input iterator does not match output vector type while no_casting "
-			"descriptor was set"
-		);
-
-		static_assert(
-			std::is_convertible<
-				typename utils::is_alp_matrix_iterator<
-					InputType, fwd_iterator
-				>::RowIndexType,
-				RIT
-			>::value,
-			"grb::buildMatrixUnique (BSP1D): cannot convert input iterator row type to "
-			"internal format"
-		);
-		static_assert(
-			std::is_convertible<
-				typename utils::is_alp_matrix_iterator<
-					InputType, fwd_iterator
-				>::ColumnIndexType,
-				CIT
-			>::value,
-			"grb::buildMatrixUnique (BSP1D): cannot convert input iterator column type "
-			"to internal format"
-		);
-		static_assert(
-			std::is_convertible<
-				typename utils::is_alp_matrix_iterator<
-					InputType, fwd_iterator
-				>::ValueType,
-				InputType
-			>::value || std::is_same< InputType, void >::value,
-			"grb::buildMatrixUnique (BSP1D): cannot convert input value type to "
-			"internal format"
-		);
-
-		typedef internal::NonzeroStorage< RIT, CIT, InputType > StorageType;
-
-		// get access to user process data on s and P
-		internal::BSP1D_Data &data = internal::grb_BSP1D.load();
-#ifdef _DEBUG
-		std::cout << "buildMatrixUnique is called from process " << data.s << " "
-			<< "out of " << data.P << " processes total.\n";
-#endif
-		// delegate for sequential case
-		if( data.P == 1 ) {
-			return buildMatrixUnique< descr >( internal::getLocal(A), start, end, mode );
-		}
-
-		// function semantics require the matrix be cleared first
-		RC ret = clear( A );
-
-		// local cache, used to delegate to reference buildMatrixUnique
-		std::vector< StorageType > cache;
-
-		// caches non-local nonzeroes (in case of Parallel IO)
-		std::vector< std::vector< StorageType > > outgoing;
-		// NOTE: this copies a lot of the above methodology
-
-#ifdef _DEBUG
-		const size_t my_offset =
-			internal::Distribution< BSP1D >::local_offset( A._n, data.s, data.P );
-		std::cout << "Local column-wise offset at PID " << data.s << " is "
-			<< my_offset << "\n";
-#endif
-		ret = internal::populateMatrixBuildCaches(
-			data,
-			start, end,
-			mode,
-			A._m, A._n,
-			cache, outgoing
-		);
-		if( ret != SUCCESS ) {
-#ifndef NDEBUG
-			std::cout << "Process " << data.s << " failure while reading input iterator" << std::endl;
-#endif
-			return ret;
-		}
 
-#ifdef _DEBUG
-		for( lpf_pid_t i = 0; i < data.P; i++ ) {
-			if( data.s == i ) {
-				std::cout << "Process " << data.s << std::endl;
-				for( lpf_pid_t k = 0; k < data.P; k++) {
-					std::cout << "\tnum nnz " << outgoing[ k ].size() << std::endl;
+		/**
+		 * Caches at most \a chunk nonzeroes from a container defined by an iterator
+		 * pair, starting from the current position of \a it.
+		 *
+		 * @param[in]     data     The parallel context.
+		 * @param[in,out] it       Iterator to the next nonzero to be ingested. On
+		 *                         output, it points to the first nonzero that has
+		 *                         not yet been cached.
+		 * @param[in]     end      Iterator matching \a it pointing to the end of the
+		 *                         container.
+		 * @param[in]     chunk    The maximum number of nonzeroes to cache.
+		 * @param[in]     mode     Which I/O mode is used.
+		 * @param[in]     rows     The number of rows in the matrix to be ingested into.
+		 * @param[in]     cols     The number of columns of that matrix.
+		 * @param[out]    cache    The nonzeroes that this process should ingest.
+		 * @param[out]    outgoing The nonzeroes that this process should send to
+		 *                         another one.
+		 *
+		 * Sequential implementation activated by passing a forward iterator tag.
+		 * This variant avoids traversing the chunk twice, which matters for
+		 * iterators whose increment is expensive, such as file parsers.
+		 */
+		template<
+			typename fwd_iterator,
+			typename IType,
+			typename JType,
+			typename VType
+		>
+		RC populateMatrixBuildCachesChunk(
+			const BSP1D_Data &data,
+			fwd_iterator &it, const fwd_iterator &end,
+			const size_t chunk,
+			const IOMode mode,
+			const size_t &rows, const size_t &cols,
+			std::vector< internal::NonzeroStorage< IType, JType, VType > > &cache,
+			std::vector<
+				std::vector<
+					internal::NonzeroStorage< IType, JType, VType >
+				>
+			> &outgoing,
+			const std::forward_iterator_tag &
+		) {
+			if( mode == PARALLEL ) {
+				outgoing.resize( data.P );
+			}
+			for( size_t k = 0; k < chunk && it != end; ++k, ++it ) {
+				if( utils::check_input_coordinates( it, rows, cols ) != SUCCESS ) {
+					return MISMATCH;
 				}
-				std::cout << "\tcache size " << cache.size() << std::endl;
+				handleSingleNonzero( data, it, mode, rows, cols, cache, outgoing );
 			}
-			const lpf_err_t lpf_err = lpf_sync( data.context, LPF_SYNC_DEFAULT );
-			if( lpf_err != LPF_SUCCESS ) {
-				std::cerr << "cannot synchronize" << std::endl;
-				return PANIC;
+			return SUCCESS;
+		}
+
+		/**
+		 * Caches at most \a chunk nonzeroes from a container defined by an iterator
+		 * pair, starting from the current position of \a it.
+		 *
+		 * Implementation for random access iterators, which delegates to
+		 * #populateMatrixBuildCaches and hence retains its shared-memory
+		 * parallelisation.
+		 *
+		 * For more detailed documentation, see the forward iterator variant.
+		 */
+		template<
+			typename fwd_iterator,
+			typename IType,
+			typename JType,
+			typename VType
+		>
+		RC populateMatrixBuildCachesChunk(
+			const BSP1D_Data &data,
+			fwd_iterator &it, const fwd_iterator &end,
+			const size_t chunk,
+			const IOMode mode,
+			const size_t &rows, const size_t &cols,
+			std::vector< internal::NonzeroStorage< IType, JType, VType > > &cache,
+			std::vector<
+				std::vector<
+					internal::NonzeroStorage< IType, JType, VType >
+				>
+			> &outgoing,
+			const std::random_access_iterator_tag &
+		) {
+			const size_t remaining = static_cast< size_t >( end - it );
+			fwd_iterator chunk_end = end;
+			if( remaining > chunk ) {
+				chunk_end = it;
+				chunk_end += chunk;
 			}
+			const RC ret = populateMatrixBuildCaches(
+				data,
+				it, chunk_end,
+				mode,
+				rows, cols,
+				cache, outgoing
+			);
+			it = chunk_end;
+			return ret;
 		}
-#endif
 
-		// report on memory usage
-		(void) config::MEMORY::report( "grb::buildMatrixUnique",
-			"has local cache of size",
-			cache.size() * sizeof( StorageType )
-		);
+		/**
+		 * Sends all nonzeroes in the \a outgoing caches to their owners, and appends
+		 * all nonzeroes received from remote processes to \a cache.
+		 *
+		 * This is a collective call: all user processes must call it, even if they
+		 * have no nonzeroes to send.
+		 *
+		 * @param[in]     data     The parallel context.
+		 * @param[in,out] cache    The nonzeroes local to this process. Any existing
+		 *                         contents are retained, while received nonzeroes are
+		 *                         appended.
+		 * @param[in]     outgoing The nonzeroes that should be sent to other
+		 *                         processes. The entry at position <tt>data.s</tt>
+		 *                         must be empty.
+		 *
+		 * On output, the contents of \a outgoing are unmodified; callers are
+		 * responsible for clearing it.
+		 */
+		template<
+			typename IType,
+			typename JType,
+			typename VType
+		>
+		RC exchangeMatrixBuildCaches(
+			BSP1D_Data &data,
+			std::vector< internal::NonzeroStorage< IType, JType, VType > > &cache,
+			std::vector<
+				std::vector<
+					internal::NonzeroStorage< IType, JType, VType >
+				>
+			> &outgoing
+		) {
+			typedef internal::NonzeroStorage< IType, JType, VType > StorageType;
+			assert( outgoing.size() == data.P );
+			RC ret = SUCCESS;
 
-		if( mode == PARALLEL ) {
 			// declare memory slots
 			lpf_memslot_t cache_slot = LPF_INVALID_MEMSLOT;
 			std::vector< lpf_memslot_t > out_slot( data.P, LPF_INVALID_MEMSLOT );
@@ -1801,7 +1802,7 @@ namespace grb {
 					);
 #ifdef _DEBUG
 				std::cout << data.s << ": address " << &( outgoing[ k ][ 0 ] ) << " (size "
-					<< outgoing[ k ].size() * sizeof( typename fwd_iterator::value_type )
+					<< outgoing[ k ].size() * sizeof( StorageType )
 					<< ") binds to slot " << out_slot[ k ] << "\n";
 #endif
 				if( brc != LPF_SUCCESS ) {
@@ -1828,9 +1829,9 @@ namespace grb {
 						std::cout << data.s << ": lpf_put( ctx, "
 							<< out_slot[ k ] << ", 0, " << k << ", " << cache_slot << ", "
 							<< buffer_sizet[ 2 * data.P + k ] *
-								sizeof( typename fwd_iterator::value_type )
+								sizeof( StorageType )
 							<< ", " << outgoing[ k ].size() *
-								sizeof( typename fwd_iterator::value_type )
+								sizeof( StorageType )
 							<< ", LPF_MSG_DEFAULT );\n";
 					}
 					const lpf_err_t lpf_err = lpf_sync( data.context, LPF_SYNC_DEFAULT );
@@ -1876,11 +1877,220 @@ namespace grb {
 					ret = PANIC;
 				}
 			}
-			// clean up outgoing slots, which goes from 2x to 1x memory store for the
-			// nonzeroes here contained
-			{
-				std::vector< std::vector< StorageType > > emptyVector;
-				std::swap( emptyVector, outgoing );
+
+			return ret;
+		}
+
+	} // end namespace grb::internal
+
+	/**
+	 * \internal No implementation details.
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType,
+		typename RIT,
+		typename CIT,
+		typename NIT,
+		typename fwd_iterator
+	>
+	RC buildMatrixUnique(
+		Matrix< InputType, BSP1D, RIT, CIT, NIT > &A,
+		const fwd_iterator start, const fwd_iterator end,
+		const IOMode mode
+	) {
+		static_assert(
+			utils::is_alp_matrix_iterator<
+				InputType, fwd_iterator
+			>::value,
+			"the given iterator is not a valid input iterator, "
+			"see the ALP specification for input iterators"
+		);
+		// static checks
+		NO_CAST_ASSERT( !(descr & descriptors::no_casting) || (
+			std::is_same< InputType,
+				typename utils::is_alp_matrix_iterator<
+					InputType, fwd_iterator
+				>::ValueType
+			>::value &&
+			std::is_integral< RIT >::value &&
+			std::is_integral< CIT >::value
+		), "grb::buildMatrixUnique (BSP1D implementation)",
+			"Input iterator does not match output vector type while no_casting "
+			"descriptor was set"
+		);
+
+		static_assert(
+			std::is_convertible<
+				typename utils::is_alp_matrix_iterator<
+					InputType, fwd_iterator
+				>::RowIndexType,
+				RIT
+			>::value,
+			"grb::buildMatrixUnique (BSP1D): cannot convert input iterator row type to "
+			"internal format"
+		);
+		static_assert(
+			std::is_convertible<
+				typename utils::is_alp_matrix_iterator<
+					InputType, fwd_iterator
+				>::ColumnIndexType,
+				CIT
+			>::value,
+			"grb::buildMatrixUnique (BSP1D): cannot convert input iterator column type "
+			"to internal format"
+		);
+		static_assert(
+			std::is_convertible<
+				typename utils::is_alp_matrix_iterator<
+					InputType, fwd_iterator
+				>::ValueType,
+				InputType
+			>::value || std::is_same< InputType, void >::value,
+			"grb::buildMatrixUnique (BSP1D): cannot convert input value type to "
+			"internal format"
+		);
+
+		typedef internal::NonzeroStorage< RIT, CIT, InputType > StorageType;
+
+		// get access to user process data on s and P
+		internal::BSP1D_Data &data = internal::grb_BSP1D.load();
+#ifdef _DEBUG
+		std::cout << "buildMatrixUnique is called from process " << data.s << " "
+			<< "out of " << data.P << " processes total.\n";
+#endif
+		// delegate for sequential case
+		if( data.P == 1 ) {
+			return buildMatrixUnique< descr >( internal::getLocal(A), start, end, mode );
+		}
+
+		// function semantics require the matrix be cleared first
+		RC ret = clear( A );
+
+		// local cache, used to delegate to reference buildMatrixUnique
+		std::vector< StorageType > cache;
+
+		// caches non-local nonzeroes (in case of Parallel IO)
+		std::vector< std::vector< StorageType > > outgoing;
+		// NOTE: this copies a lot of the above methodology
+
+#ifdef _DEBUG
+		const size_t my_offset =
+			internal::Distribution< BSP1D >::local_offset( A._n, data.s, data.P );
+		std::cout << "Local column-wise offset at PID " << data.s << " is "
+			<< my_offset << "\n";
+#endif
+		// the maximum number of input nonzeroes to read before communicating
+		const size_t chunk = data.build_chunk_size;
+		if( mode == PARALLEL && chunk > 0 ) {
+			// streaming ingestion: read and exchange nonzeroes in rounds, so that the
+			// outgoing caches never exceed the chunk size
+			typename std::iterator_traits< fwd_iterator >::iterator_category category;
+			std::vector< StorageType > chunk_cache;
+			fwd_iterator it = start;
+			size_t rounds = 0;
+			bool more = true;
+			while( more ) {
+				chunk_cache.clear();
+				for( auto &out : outgoing ) {
+					out.clear();
+				}
+				if( ret == SUCCESS ) {
+					ret = internal::populateMatrixBuildCachesChunk(
+						data,
+						it, end, chunk,
+						mode,
+						A._m, A._n,
+						chunk_cache, outgoing,
+						category
+					);
+				}
+				// errors must be collective, since all processes leave the loop together
+				if( collectives< BSP1D >::allreduce(
+					ret, grb::operators::any_or< RC >()
+				) != SUCCESS ) {
+					return PANIC;
+				}
+				if( ret != SUCCESS ) {
+#ifndef NDEBUG
+					std::cout << "Process " << data.s << " failure while reading input "
+						<< "iterator" << std::endl;
+#endif
+					return ret;
+				}
+				cache.insert( cache.end(), chunk_cache.cbegin(), chunk_cache.cend() );
+				ret = internal::exchangeMatrixBuildCaches( data, cache, outgoing );
+				if( ret != SUCCESS ) {
+					return ret;
+				}
+				more = it != end;
+				if( collectives< BSP1D >::allreduce<
+					descriptors::no_casting,
+					grb::operators::logical_or< bool >
+				>( more ) != SUCCESS ) {
+					return PANIC;
+				}
+				(void) ++rounds;
+			}
+#ifdef _DEBUG
+			std::cout << "Process " << data.s << " ingested its nonzeroes in " << rounds
+				<< " rounds of at most " << chunk << " nonzeroes each\n";
+#endif
+			(void) config::MEMORY::report( "grb::buildMatrixUnique (PARALLEL mode)",
+				"has an outgoing cache of at most size", chunk * sizeof( StorageType )
+			);
+			(void) config::MEMORY::report( "grb::buildMatrixUnique (PARALLEL mode)",
+				"has local cache of size", cache.size() * sizeof( StorageType )
+			);
+			// release the round buffers before delegating to the local build
+			std::vector< StorageType >().swap( chunk_cache );
+			std::vector< std::vector< StorageType > >().swap( outgoing );
+		} else {
+			ret = internal::populateMatrixBuildCaches(
+				data,
+				start, end,
+				mode,
+				A._m, A._n,
+				cache, outgoing
+			);
+			if( ret != SUCCESS ) {
+#ifndef NDEBUG
+				std::cout << "Process " << data.s << " failure while reading input iterator" << std::endl;
+#endif
+				return ret;
+			}
+
+#ifdef _DEBUG
+			for( lpf_pid_t i = 0; i < data.P; i++ ) {
+				if( data.s == i ) {
+					std::cout << "Process " << data.s << std::endl;
+					for( lpf_pid_t k = 0; k < data.P; k++) {
+						std::cout << "\tnum nnz " << outgoing[ k ].size() << std::endl;
+					}
+					std::cout << "\tcache size " << cache.size() << std::endl;
+				}
+				const lpf_err_t lpf_err = lpf_sync( data.context, LPF_SYNC_DEFAULT );
+				if( lpf_err != LPF_SUCCESS ) {
+					std::cerr << "cannot synchronize" << std::endl;
+					return PANIC;
+				}
+			}
+#endif
+
+			// report on memory usage
+			(void) config::MEMORY::report( "grb::buildMatrixUnique",
+				"has local cache of size",
+				cache.size() * sizeof( StorageType )
+			);
+
+			if( mode == PARALLEL ) {
+				ret = internal::exchangeMatrixBuildCaches( data, cache, outgoing );
+				// clean up outgoing slots, which goes from 2x to 1x memory store for the
+				// nonzeroes here contained
+				{
+					std::vector< std::vector< StorageType > > emptyVector;
+					std::swap( emptyVector, outgoing );
+				}
 			}
 		}
 
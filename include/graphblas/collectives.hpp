@@ -36,6 +36,9 @@
 #ifdef _GRB_WITH_NONBLOCKING
  #include "graphblas/nonblocking/collectives.hpp"
 #endif
+#ifdef _GRB_WITH_PROFILE
+ #include <graphblas/profile/collectives.hpp>
+#endif
 #ifdef _GRB_WITH_LPF
  #include <graphblas/bsp/collectives.hpp>
 #endif
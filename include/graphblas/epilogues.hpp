@@ -0,0 +1,386 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Defines the epilogues that may be passed to #grb::vxm and #grb::mxv.
+ *
+ * An epilogue is an element-wise transformation of the output vector of a
+ * sparse matrix--vector multiplication, such as the addition of a bias
+ * followed by an activation function. Backends may apply an epilogue to each
+ * output element as it is finalised, thus avoiding additional passes over the
+ * output vector.
+ */
+
+#ifndef _H_GRB_EPILOGUES
+#define _H_GRB_EPILOGUES
+
+#include <type_traits>
+
+#include <graphblas/rc.hpp>
+#include <graphblas/backends.hpp>
+#include <graphblas/descriptors.hpp>
+#include <graphblas/type_traits.hpp>
+
+#include <graphblas/base/vector.hpp>
+
+
+namespace grb {
+
+	/**
+	 * Collects the epilogues that may be passed to #grb::vxm and #grb::mxv.
+	 *
+	 * Epilogues should be constructed using the factory functions
+	 * #grb::epilogues::foldl and #grb::epilogues::sequence.
+	 */
+	namespace epilogues {
+
+		/**
+		 * The empty epilogue, which leaves every output element unmodified.
+		 */
+		class None {
+
+			public:
+
+				/** Whether this epilogue modifies any output element. */
+				static constexpr bool active = false;
+
+		};
+
+		/**
+		 * Folds a scalar into every output element: \f$ u_i = u_i \odot s \f$.
+		 *
+		 * @tparam T  The type of the scalar \f$ s \f$.
+		 * @tparam OP The operator \f$ \odot \f$.
+		 */
+		template< typename T, class OP >
+		class Scalar {
+
+			public:
+
+				/** Whether this epilogue modifies any output element. */
+				static constexpr bool active = true;
+
+				/** Constructs the epilogue from a scalar and an operator. */
+				Scalar( const T &value, const OP &op ) : _value( value ), _op( op ) {}
+
+				/** @returns The scalar folded into each output element. */
+				const T & value() const noexcept {
+					return _value;
+				}
+
+				/** @returns The operator used for folding. */
+				const OP & op() const noexcept {
+					return _op;
+				}
+
+
+			private:
+
+				/** The scalar to fold. */
+				const T _value;
+
+				/** The operator to fold with. */
+				const OP _op;
+
+		};
+
+		/**
+		 * Folds the elements of a vector into the corresponding output elements:
+		 * \f$ u_i = u_i \odot w_i \f$.
+		 *
+		 * Output elements \f$ u_i \f$ for which \f$ w_i \f$ is not assigned are
+		 * left unmodified.
+		 *
+		 * @tparam VectorType The type of the vector \f$ w \f$.
+		 * @tparam OP         The operator \f$ \odot \f$.
+		 *
+		 * \warning The vector \f$ w \f$ is captured by reference; it must remain
+		 *          valid while this epilogue is in use.
+		 */
+		template< class VectorType, class OP >
+		class Elementwise {
+
+			public:
+
+				/** Whether this epilogue modifies any output element. */
+				static constexpr bool active = true;
+
+				/** Constructs the epilogue from a vector and an operator. */
+				Elementwise( const VectorType &vector, const OP &op ) :
+					_vector( vector ), _op( op )
+				{}
+
+				/** @returns The vector whose elements are folded into the output. */
+				const VectorType & vector() const noexcept {
+					return _vector;
+				}
+
+				/** @returns The operator used for folding. */
+				const OP & op() const noexcept {
+					return _op;
+				}
+
+
+			private:
+
+				/** The vector to fold. */
+				const VectorType &_vector;
+
+				/** The operator to fold with. */
+				const OP _op;
+
+		};
+
+		/**
+		 * Applies two epilogues one after the other to each output element.
+		 *
+		 * @tparam First  The epilogue that is applied first.
+		 * @tparam Second The epilogue that is applied second.
+		 */
+		template< class First, class Second >
+		class Sequence {
+
+			public:
+
+				/** Whether this epilogue modifies any output element. */
+				static constexpr bool active = First::active || Second::active;
+
+				/** Constructs the epilogue from two given epilogues. */
+				Sequence( const First &first, const Second &second ) :
+					_first( first ), _second( second )
+				{}
+
+				/** @returns The epilogue that is applied first. */
+				const First & first() const noexcept {
+					return _first;
+				}
+
+				/** @returns The epilogue that is applied second. */
+				const Second & second() const noexcept {
+					return _second;
+				}
+
+
+			private:
+
+				/** The epilogue that is applied first. */
+				const First _first;
+
+				/** The epilogue that is applied second. */
+				const Second _second;
+
+		};
+
+		/**
+		 * @returns An epilogue that folds \a value into every output element
+		 *          using \a op.
+		 */
+		template< class OP, typename T >
+		Scalar< T, OP > foldl(
+			const T &value, const OP &op = OP(),
+			const typename std::enable_if<
+				!grb::is_object< T >::value &&
+				grb::is_operator< OP >::value, void
+			>::type * const = nullptr
+		) {
+			return Scalar< T, OP >( value, op );
+		}
+
+		/**
+		 * @returns An epilogue that folds the elements of \a w into the
+		 *          corresponding output elements using \a op.
+		 */
+		template<
+			class OP, typename T, enum Backend backend, typename Coords
+		>
+		Elementwise< Vector< T, backend, Coords >, OP > foldl(
+			const Vector< T, backend, Coords > &w, const OP &op = OP(),
+			const typename std::enable_if<
+				!grb::is_object< T >::value &&
+				grb::is_operator< OP >::value, void
+			>::type * const = nullptr
+		) {
+			return Elementwise< Vector< T, backend, Coords >, OP >( w, op );
+		}
+
+		/**
+		 * @returns An epilogue that first applies \a first and then \a second.
+		 */
+		template< class First, class Second >
+		Sequence< First, Second > sequence(
+			const First &first, const Second &second,
+			const typename std::enable_if<
+				grb::is_epilogue< First >::value &&
+				grb::is_epilogue< Second >::value, void
+			>::type * const = nullptr
+		) {
+			return Sequence< First, Second >( first, second );
+		}
+
+		/**
+		 * @returns An epilogue that applies all given epilogues in order.
+		 */
+		template< class First, class Second, class Third, class... Remainder >
+		auto sequence(
+			const First &first, const Second &second, const Third &third,
+			const Remainder &... remainder
+		) -> decltype( sequence( sequence( first, second ), third, remainder... ) ) {
+			return sequence( sequence( first, second ), third, remainder... );
+		}
+
+	} // end namespace ``grb::epilogues''
+
+	// type traits
+
+	template<>
+	struct is_epilogue< epilogues::None > {
+		/** This is an ALP epilogue. */
+		static const constexpr bool value = true;
+	};
+
+	template< typename T, class OP >
+	struct is_epilogue< epilogues::Scalar< T, OP > > {
+		/** This is an ALP epilogue. */
+		static const constexpr bool value = true;
+	};
+
+	template< class VectorType, class OP >
+	struct is_epilogue< epilogues::Elementwise< VectorType, OP > > {
+		/** This is an ALP epilogue. */
+		static const constexpr bool value = true;
+	};
+
+	template< class First, class Second >
+	struct is_epilogue< epilogues::Sequence< First, Second > > {
+		/** This is an ALP epilogue. */
+		static const constexpr bool value = true;
+	};
+
+	namespace internal {
+
+		/**
+		 * \internal
+		 * The descriptors of a call to #grb::vxm or #grb::mxv that carry over to
+		 * the folds an epilogue translates to.
+		 * \endinternal
+		 */
+		static constexpr Descriptor epilogue_descriptors =
+			descriptors::invert_mask | descriptors::structural |
+			descriptors::dense | descriptors::no_casting;
+
+		/**
+		 * \internal
+		 * @returns Whether the given epilogue may be applied to an output vector
+		 *          of size \a n.
+		 * \endinternal
+		 */
+		inline bool epilogueFits( const epilogues::None &, const size_t ) {
+			return true;
+		}
+
+		/** \internal Scalar variant. */
+		template< typename T, class OP >
+		bool epilogueFits( const epilogues::Scalar< T, OP > &, const size_t ) {
+			return true;
+		}
+
+		/** \internal Element-wise variant. */
+		template< class VectorType, class OP >
+		bool epilogueFits(
+			const epilogues::Elementwise< VectorType, OP > &epilogue,
+			const size_t n
+		) {
+			return size( epilogue.vector() ) == n;
+		}
+
+		/** \internal Sequence variant. */
+		template< class First, class Second >
+		bool epilogueFits(
+			const epilogues::Sequence< First, Second > &epilogue,
+			const size_t n
+		) {
+			return epilogueFits( epilogue.first(), n ) &&
+				epilogueFits( epilogue.second(), n );
+		}
+
+		/**
+		 * \internal
+		 * Applies an epilogue to an output vector by translating it into a series
+		 * of calls to #grb::foldl. This is the fallback used by backends that do
+		 * not fuse epilogues with the multiplication itself.
+		 * \endinternal
+		 */
+		template<
+			Descriptor descr, typename T, class OP,
+			typename IOType, typename MaskType,
+			enum Backend backend, typename Coords
+		>
+		RC foldEpilogue(
+			Vector< IOType, backend, Coords > &u,
+			const Vector< MaskType, backend, Coords > &mask,
+			const epilogues::Scalar< T, OP > &epilogue
+		) {
+			constexpr Descriptor fold_descr = descr & epilogue_descriptors;
+			if( size( mask ) == 0 ) {
+				return foldl< fold_descr >( u, epilogue.value(), epilogue.op() );
+			} else {
+				return foldl< fold_descr >( u, mask, epilogue.value(), epilogue.op() );
+			}
+		}
+
+		/** \internal Element-wise variant. */
+		template<
+			Descriptor descr, class VectorType, class OP,
+			typename IOType, typename MaskType,
+			enum Backend backend, typename Coords
+		>
+		RC foldEpilogue(
+			Vector< IOType, backend, Coords > &u,
+			const Vector< MaskType, backend, Coords > &mask,
+			const epilogues::Elementwise< VectorType, OP > &epilogue
+		) {
+			constexpr Descriptor fold_descr = descr & epilogue_descriptors;
+			if( size( mask ) == 0 ) {
+				return foldl< fold_descr >( u, epilogue.vector(), epilogue.op() );
+			} else {
+				return foldl< fold_descr >( u, mask, epilogue.vector(), epilogue.op() );
+			}
+		}
+
+		/** \internal Sequence variant. */
+		template<
+			Descriptor descr, class First, class Second,
+			typename IOType, typename MaskType,
+			enum Backend backend, typename Coords
+		>
+		RC foldEpilogue(
+			Vector< IOType, backend, Coords > &u,
+			const Vector< MaskType, backend, Coords > &mask,
+			const epilogues::Sequence< First, Second > &epilogue
+		) {
+			RC ret = foldEpilogue< descr >( u, mask, epilogue.first() );
+			return ret ? ret : foldEpilogue< descr >( u, mask, epilogue.second() );
+		}
+
+	} // end namespace ``grb::internal''
+
+} // end namespace grb
+
+#endif // end ``_H_GRB_EPILOGUES''
+
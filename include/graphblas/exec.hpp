@@ -36,6 +36,9 @@
 #ifdef _GRB_WITH_NONBLOCKING
  #include "graphblas/nonblocking/exec.hpp"
 #endif
+#ifdef _GRB_WITH_PROFILE
+ #include "graphblas/profile/exec.hpp"
+#endif
 #ifdef _GRB_WITH_LPF
  #include "graphblas/bsp1d/exec.hpp"
 #endif
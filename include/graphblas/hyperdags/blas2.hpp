@@ -36,6 +36,47 @@
 
 namespace grb {
 
+	namespace internal {
+
+		namespace hyperdags {
+
+			/**
+			 * \internal
+			 * Records a matrix--vector multiplication with the fine-grained HyperDAG
+			 * generator, if it is enabled.
+			 *
+			 * @tparam descr The descriptor passed to the multiplication.
+			 * @tparam left  Whether the multiplication is a #grb::vxm.
+			 * \endinternal
+			 */
+			template<
+				Descriptor descr, bool left,
+				typename IOType, typename InputType1, typename InputType2,
+				typename Coords
+			>
+			void addMultiplication(
+				const OperationVertexType type,
+				const Vector< IOType, grb::hyperdags, Coords > &u,
+				const Matrix< InputType2, grb::hyperdags > &A,
+				const Vector< InputType1, grb::hyperdags, Coords > &v
+			) {
+				FineHyperDAGGenerator &fine = generator.fineGrained();
+				if( !fine.isEnabled() ) {
+					return;
+				}
+				const bool transposed = left !=
+					static_cast< bool >( descr & descriptors::transpose_matrix );
+				fine.addMultiplication(
+					type, getID( getVector( u ) ), getID( getMatrix( A ) ),
+					getID( getVector( v ) ), ncols( A ), transposed,
+					A.cbegin(), A.cend()
+				);
+			}
+
+		} // end namespace grb::internal::hyperdags
+
+	} // end namespace grb::internal
+
 	template<
 		Descriptor descr = descriptors::no_operation, class Ring,
 		typename IOType, typename InputType1, typename InputType2,
@@ -80,6 +121,9 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, true >(
+			internal::hyperdags::VXM_VECTOR_VECTOR_VECTOR_MATRIX, u, A, v
+		);
 		return ret;
 	}
 
@@ -131,6 +175,9 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, true >(
+			internal::hyperdags::VXM_VECTOR_VECTOR_VECTOR_MATRIX_ADD_MUL, u, A, v
+		);
 		return ret;
 	}
 
@@ -176,6 +223,9 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, true >(
+			internal::hyperdags::VXM_VECTOR_VECTOR_MATRIX_RING, u, A, v
+		);
 		return ret;
 	}
 
@@ -228,6 +278,9 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, false >(
+			internal::hyperdags::MXV_VECTOR_VECTOR_MATRIX_VECTOR_RING, u, A, v
+		);
 		return ret;
 	}
 
@@ -283,6 +336,9 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, false >(
+			internal::hyperdags::MXV_VECTOR_VECTOR_MATRIX_VECTOR_VECTOR_R, u, A, v
+		);
 		return ret;
 	}
 
@@ -341,6 +397,9 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, false >(
+			internal::hyperdags::MXV_VECTOR_VECTOR_MATRIX_VECTOR_VECTOR_A, u, A, v
+		);
 		return ret;
 	}
 
@@ -386,6 +445,9 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, false >(
+			internal::hyperdags::MXV_VECTOR_MATRIX_VECTOR_RING, u, A, v
+		);
 		return ret;
 	}
 
@@ -431,6 +493,9 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, false >(
+			internal::hyperdags::MXV_VECTOR_MATRIX_VECTOR_ADD_MUL, u, A, v
+		);
 		return ret;
 	}
 
@@ -574,6 +639,9 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, true >(
+			internal::hyperdags::VXM_GENERIC_VECTOR_VECTOR_VECTOR_VECTOR_MATRIX_ADD_MUL, u, A, v
+		);
 		return ret;
 	}
 
@@ -633,6 +701,9 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, true >(
+			internal::hyperdags::VXM_VECTOR_VECTOR_VECTOR_VECTOR_MATRIX_ADD_MUL, u, A, v
+		);
 		return ret;
 	}
 
@@ -678,9 +749,185 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::addMultiplication< descr, true >(
+			internal::hyperdags::VXM_VECTOR_VECTOR_MATRIX_ADD_MUL, u, A, v
+		);
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType, typename RIT, typename CIT, typename NIT
+	>
+	RC triangularAnalysis(
+		TriangularSchedule &schedule,
+		const Matrix< InputType, hyperdags, RIT, CIT, NIT > &T,
+		const Triangle triangle,
+		const Diagonal diagonal = NON_UNIT
+	) {
+		// the schedule is not an ALP container, hence the analysis is not recorded
+		return triangularAnalysis< descr >(
+			schedule, internal::getMatrix( T ), triangle, diagonal );
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring,
+		class Minus = operators::subtract< typename Ring::D4 >,
+		class Divide = operators::divide< typename Ring::D4 >,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC triangularSolve(
+		Vector< IOType, hyperdags, Coords > &x,
+		const Matrix< InputType2, hyperdags, RIT, CIT, NIT > &T,
+		const Vector< InputType1, hyperdags, Coords > &b,
+		const TriangularSchedule &schedule,
+		const Ring &ring = Ring(),
+		const Minus &minus = Minus(),
+		const Divide &divide = Divide(),
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value,
+		void >::type * const = nullptr
+	) {
+		const RC ret = triangularSolve< descr >(
+			internal::getVector(x), internal::getMatrix(T), internal::getVector(b),
+			schedule, ring, minus, divide
+		);
+		if( ret != SUCCESS ) { return ret; }
+		if( size( x ) == 0 ) { return ret; }
+		std::array< const void *, 0 > sourcesP{};
+		std::array< uintptr_t, 3 > sourcesC{
+			getID( internal::getMatrix(T) ),
+			getID( internal::getVector(b) ),
+			getID( internal::getVector(x) )
+		};
+		std::array< uintptr_t, 1 > destinations{ getID( internal::getVector(x) ) };
+		internal::hyperdags::generator.addOperation(
+			internal::hyperdags::TRIANGULARSOLVE_VECTOR_MATRIX_VECTOR_RING,
+			sourcesP.begin(), sourcesP.end(),
+			sourcesC.begin(), sourcesC.end(),
+			destinations.begin(), destinations.end()
+		);
+		return ret;
+	}
+
+	/**
+	 * \internal
+	 * Composes the multiplication with the folds the epilogue translates to, so
+	 * that each of these operations is recorded in the HyperDAG.
+	 * \endinternal
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC vxm(
+		Vector< IOType, hyperdags, Coords > &u,
+		const Vector< InputType3, hyperdags, Coords > &mask,
+		const Vector< InputType1, hyperdags, Coords > &v,
+		const Matrix< InputType2, hyperdags, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		if( !internal::epilogueFits( epilogue, size( u ) ) ) {
+			return MISMATCH;
+		}
+		RC ret = vxm< descr >( u, mask, v, A, ring, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			ret = internal::foldEpilogue< descr >( u, mask, epilogue );
+		}
+		return ret;
+	}
+
+	/** \internal Delegates to the masked variant */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC vxm(
+		Vector< IOType, hyperdags, Coords > &u,
+		const Vector< InputType1, hyperdags, Coords > &v,
+		const Matrix< InputType2, hyperdags, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		const Vector< bool, hyperdags, Coords > empty_mask( 0 );
+		return vxm< descr >( u, empty_mask, v, A, ring, epilogue, phase );
+	}
+
+	/** \internal See the above #grb::vxm with an epilogue */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC mxv(
+		Vector< IOType, hyperdags, Coords > &u,
+		const Vector< InputType3, hyperdags, Coords > &mask,
+		const Matrix< InputType2, hyperdags, RIT, CIT, NIT > &A,
+		const Vector< InputType1, hyperdags, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		if( !internal::epilogueFits( epilogue, size( u ) ) ) {
+			return MISMATCH;
+		}
+		RC ret = mxv< descr >( u, mask, A, v, ring, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			ret = internal::foldEpilogue< descr >( u, mask, epilogue );
+		}
 		return ret;
 	}
 
+	/** \internal Delegates to the masked variant */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC mxv(
+		Vector< IOType, hyperdags, Coords > &u,
+		const Matrix< InputType2, hyperdags, RIT, CIT, NIT > &A,
+		const Vector< InputType1, hyperdags, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		const Vector< bool, hyperdags, Coords > empty_mask( 0 );
+		return mxv< descr >( u, empty_mask, A, v, ring, epilogue, phase );
+	}
+
 } // end namespace grb
 
 #endif
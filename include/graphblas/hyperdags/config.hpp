@@ -97,6 +97,18 @@ namespace grb {
 						fixedVectorCapacities();
 				}
 
+				/**
+				 * @returns The default number of 64-bit words of HyperDAG records that
+				 *          are buffered before being written, when the HyperDAG is
+				 *          streamed to a file.
+				 *
+				 * This default may be overridden at run-time via the
+				 * <tt>GRB_HYPERDAGS_STREAM_BUFFER</tt> environment variable.
+				 */
+				static constexpr size_t streamBufferWords() {
+					return 1 << 22;
+				}
+
 		};
 
 	}
@@ -28,11 +28,18 @@
 #define _H_GRB_HYPERDAGS_STATE
 
 #include <map>
-#include <set>
+#include <cstdint>
+#include <array>
+#include <limits>
+#include <string>
 #include <vector>
+#include <fstream>
 #include <ostream>
+#include <utility>
 #include <iostream>
+#include <algorithm>
 #include <type_traits>
+#include <unordered_map>
 
 #include <assert.h>
 
@@ -141,8 +148,8 @@ namespace grb {
 
 				private:
 
-					/** \internal Map of next local IDs. */
-					std::map< enum SourceVertexType, size_t > nextID;
+					/** \internal The next local ID, per source vertex type. */
+					std::array< size_t, numSourceVertexTypes > nextID;
 
 
 				public:
@@ -488,12 +495,14 @@ namespace grb {
 
 				EWISEMUL_VECTOR_VECTOR_ALPHA_BETA_RING,
 
-				EWISELAMBDA_FUNC_VECTOR
+				EWISELAMBDA_FUNC_VECTOR,
+
+				TRIANGULARSOLVE_VECTOR_MATRIX_VECTOR_RING
 
 			};
 
 			/** \internal How many operation vertex types exist. */
-			const constexpr size_t numOperationVertexTypes = 106;
+			const constexpr size_t numOperationVertexTypes = 107;
 
 			/** \internal An array of all operation vertex types. */
 			const constexpr enum OperationVertexType
@@ -604,7 +613,8 @@ namespace grb {
 				EWISEMUL_VECTOR_VECTOR_ALPHA_VECTOR_RING,
 				EWISEMUL_VECTOR_VECTOR_VECTOR_BETA_RING,
 				EWISEMUL_VECTOR_VECTOR_ALPHA_BETA_RING,
-				EWISELAMBDA_FUNC_VECTOR
+				EWISELAMBDA_FUNC_VECTOR,
+				TRIANGULARSOLVE_VECTOR_MATRIX_VECTOR_RING
 			};
 
 			/** \internal @returns The operation vertex type as a string. */
@@ -667,10 +677,10 @@ namespace grb {
 
 					/**
 					 * \internal
-					 * A map that keeps track of the number of vertices of each type.
+					 * Keeps track of the number of vertices of each type.
 					 * \endinternal
 					 */
-					std::map< enum OperationVertexType, size_t > nextID;
+					std::array< size_t, numOperationVertexTypes > nextID;
 
 
 				public:
@@ -704,11 +714,49 @@ namespace grb {
 
 			};
 
+			/**
+			 * \internal
+			 *
+			 * The types of records in a binary HyperDAG stream.
+			 *
+			 * A stream starts with the eight bytes of #streamMagic, followed by a
+			 * sequence of records. Every record consists of native-endian 64-bit
+			 * unsigned integers, the first of which is the record type:
+			 *  - #VERTEX_RECORD: followed by the #VertexType, the source, operation, or
+			 *    output vertex type, the local ID, and the global ID of the vertex;
+			 *  - #HYPEREDGE_RECORD: followed by the global ID of the source vertex, the
+			 *    number of destination vertices, and their global IDs;
+			 *  - #END_RECORD: followed by the number of vertices, hyperedges, and pins,
+			 *    as also reported in the header line of the MatrixMarket output.
+			 *
+			 * The hyperedge of a source vertex is the union of all hyperedge records
+			 * with that source, which need not be consecutive. Records may refer to
+			 * vertices whose vertex records appear later in the stream. Only streams
+			 * that end with an #END_RECORD are complete.
+			 *
+			 * \endinternal
+			 */
+			enum StreamRecordType {
+				VERTEX_RECORD,
+				HYPEREDGE_RECORD,
+				END_RECORD
+			};
+
+			/** \internal The first bytes of a binary HyperDAG stream. */
+			const constexpr char streamMagic[ 8 ] = { 'A', 'L', 'P', 'H', 'D', 'A', 'G', '1' };
+
 			/**
 			 * \internal
 			 *
 			 * Encodes any directed hypergraph that may yet grow.
 			 *
+			 * Hyperedges are stored as a flat, append-only sequence of records in a
+			 * CRS-like layout, one record per call to #appendHyperedge. Records with
+			 * the same source vertex are merged only when rendering, so that appending
+			 * does not require any search structure. Buffered records may be written
+			 * out and dropped via #flush, while the vertex, hyperedge, and pin counts
+			 * remain those of the whole hypergraph.
+			 *
 			 * \endinternal
 			 */
 			class DHypergraph {
@@ -718,17 +766,30 @@ namespace grb {
 					/** \internal The total number of vertices in the hypergraph. */
 					size_t num_vertices;
 
+					/** \internal The total number of hyperedges in the hypergraph. */
+					size_t num_hyperedges;
+
+					/** \internal The total number of pins in the hypergraph. */
+					size_t num_pins;
+
+					/** \internal Whether a vertex is the source of a hyperedge. */
+					std::vector< bool > is_source;
+
+					/** \internal The source vertex of every buffered record. */
+					std::vector< size_t > sources;
+
 					/**
 					 * \internal
 					 *
-					 * All hyperedges in the hypergraph.
+					 * The destinations of record \a i are those in #destinations from
+					 * <tt>offsets[ i ]</tt> up to <tt>offsets[ i + 1 ]</tt>.
 					 *
 					 * \endinternal
 					 */
-					std::map< size_t, std::set< size_t > > hyperedges;
+					std::vector< size_t > offsets;
 
-					/** \internal The total number of pins in the hypergraph. */
-					size_t num_pins;
+					/** \internal The destination vertices of all buffered records. */
+					std::vector< size_t > destinations;
 
 
 				public:
@@ -738,16 +799,18 @@ namespace grb {
 					/**
 					 * \internal
 					 *
-					 * @param[in] start The iterator over vertex IDs that need be added into
-					 *                  the hypergraph.
-					 * @param[in] end   The end iterator over the vertex IDs to be added.
-					 *
-					 * There must be at least one vertex ID added, or undefined behaviour will
-					 * occur.
+					 * @param[in] source The source vertex of the hyperedge to extend.
+					 * @param[in] start  The iterator over vertex IDs that need be added into
+					 *                   the hypergraph.
+					 * @param[in] end    The end iterator over the vertex IDs to be added.
 					 *
-					 * Non-unique elements in the IDs to be added will be filtered out.
+					 * Non-unique elements in the IDs to be added will be filtered out. IDs
+					 * added to the same \a source by separate calls must be distinct, which
+					 * holds for the #HyperDAGGenerator since it assigns a new ID to every
+					 * destination.
 					 *
-					 * Performance is log-linear in the number of IDs to be added.
+					 * Performance is amortised constant in the number of IDs to be added, if
+					 * the IDs to be added are sorted.
 					 * \endinternal
 					 */
 					template< typename FwdIt >
@@ -758,39 +821,34 @@ namespace grb {
 						static_assert( std::is_unsigned<
 							typename std::iterator_traits< FwdIt >::value_type
 						>::value, "Expected an iterator over positive integral values" );
+						assert( source < num_vertices );
 #ifdef _DEBUG
 						std::cerr << "in appendHyperedge\n\t source " << source
 							<< "\n\t adds destinations ( ";
-						std::vector< size_t > warn;
 #endif
-						const auto it = hyperedges.find( source );
-						if( it == hyperedges.end() ) {
-							hyperedges[ source ] = std::set< size_t >();
-						}
-
-						std::set< size_t > &toAdd = hyperedges[ source ];
+						const size_t first = destinations.size();
 						for( ; start != end; ++start ) {
 							assert( *start < num_vertices );
-							if( toAdd.find( static_cast< size_t >( *start ) ) == toAdd.end() ) {
-								toAdd.insert( *start );
-								(void) ++num_pins;
+							destinations.push_back( static_cast< size_t >( *start ) );
 #ifdef _DEBUG
-								std::cerr << *start << " ";
+							std::cerr << *start << " ";
 #endif
-							} else {
-#ifdef _DEBUG
-								warn.push_back( *start );
-#endif
-							}
 						}
-#ifdef _DEBUG
-						std::cerr << ")\n";
-						if( warn.size() > 0 ) {
-							std::cerr << "\t Warning: the following edges were multiply-defined: ( ";
-							for( const auto &id : warn ) {
-								std::cerr << id << " ";
-							}
+						if( !std::is_sorted( destinations.begin() + first, destinations.end() ) ) {
+							std::sort( destinations.begin() + first, destinations.end() );
 						}
+						destinations.erase(
+							std::unique( destinations.begin() + first, destinations.end() ),
+							destinations.end()
+						);
+						sources.push_back( source );
+						offsets.push_back( destinations.size() );
+						num_pins += destinations.size() - first;
+						if( !is_source[ source ] ) {
+							is_source[ source ] = true;
+							(void) ++num_hyperedges;
+						}
+#ifdef _DEBUG
 						std::cerr << ")\n\t exiting\n";
 #endif
 					}
@@ -802,7 +860,7 @@ namespace grb {
 					 *
 					 * \endinternal
 					 */
-					size_t createVertex() noexcept;
+					size_t createVertex();
 
 					/** \internal @returns The number of vertices in the current graph. */
 					size_t numVertices() const noexcept;
@@ -813,6 +871,21 @@ namespace grb {
 					/** \internal @returns The total number of pins in the current graph. */
 					size_t numPins() const noexcept;
 
+					/**
+					 * \internal
+					 * @returns Whether the given vertex is the source of a hyperedge.
+					 * \endinternal
+					 */
+					bool hasHyperedge( const size_t vertex ) const noexcept;
+
+					/**
+					 * \internal
+					 * @returns The number of 64-bit words the buffered records take in a
+					 *          binary stream.
+					 * \endinternal
+					 */
+					size_t bufferedWords() const noexcept;
+
 					/**
 					 * \internal
 					 *
@@ -823,10 +896,24 @@ namespace grb {
 					 *
 					 * @param[in,out] out Where to print the hypergraph to.
 					 *
+					 * This function may only be called if #flush never was.
+					 *
 					 * \endinternal
 					 */
 					void render( std::ostream &out ) const;
 
+					/**
+					 * \internal
+					 *
+					 * Writes all buffered records to a binary stream as a series of
+					 * #HYPEREDGE_RECORD records, and drops them from the buffer.
+					 *
+					 * @param[in,out] out Where to write the records to.
+					 *
+					 * \endinternal
+					 */
+					void flush( std::ostream &out );
+
 			};
 
 			/** \internal Represents a finalised HyperDAG */
@@ -834,6 +921,8 @@ namespace grb {
 
 				friend class HyperDAGGenerator;
 
+				friend class FineHyperDAGGenerator;
+
 				private:
 
 					/** \internal The underlying hypergraph. */
@@ -925,6 +1014,373 @@ namespace grb {
 
 			};
 
+			/**
+			 * \internal
+			 * @returns The row and column index of a nonzero that is given as a pair of
+			 *          coordinates and a value.
+			 * \endinternal
+			 */
+			template< typename RowType, typename ColType, typename ValueType >
+			std::pair< size_t, size_t > nonzeroCoordinates(
+				const std::pair< std::pair< RowType, ColType >, ValueType > &nonzero
+			) noexcept {
+				return std::make_pair( nonzero.first.first, nonzero.first.second );
+			}
+
+			/**
+			 * \internal
+			 * @returns The row and column index of a pattern nonzero.
+			 * \endinternal
+			 */
+			template< typename RowType, typename ColType >
+			std::pair< size_t, size_t > nonzeroCoordinates(
+				const std::pair< RowType, ColType > &nonzero
+			) noexcept {
+				return std::make_pair( nonzero.first, nonzero.second );
+			}
+
+			/**
+			 * \internal
+			 *
+			 * Builds a fine-grained HyperDAG representation of an ongoing computation.
+			 *
+			 * Vertices correspond to elements of vectors and to nonzeroes of matrices,
+			 * rather than to whole containers. Every vector element is associated with
+			 * the vertex that last produced it, or with no vertex if it is empty:
+			 *  - multiplications of a matrix with a vector, via #addMultiplication,
+			 *    create one operation vertex per matrix nonzero, with a hyperedge from
+			 *    the nonzero and one from the input vector element, and one operation
+			 *    vertex per output element that reduces those products together with
+			 *    the previous value of that element;
+			 *  - any other primitive that writes to a vector, via #addOperation,
+			 *    creates one vertex per output element with hyperedges from the
+			 *    elements at the same index of all input vectors of the same size.
+			 *    Elements without any nonempty input remain empty. Primitives that
+			 *    initialise a vector from scalars or iterators instead create source
+			 *    vertices.
+			 * Matrix nonzeroes are source vertices that are created on first use, and
+			 * are discarded once a primitive writes to the matrix. Scalar inputs and
+			 * outputs, as well as masks, are not represented.
+			 *
+			 * To keep the HyperDAG tractable, consecutive indices may be coarsened into
+			 * blocks, in which case a vertex represents a block of vector elements or
+			 * a tile of matrix nonzeroes. Matrix tiles may furthermore be sampled, in
+			 * which case multiplications only represent a deterministic fraction of
+			 * the tiles, always the same ones.
+			 *
+			 * Operation vertices that no other vertex depends on at the time of
+			 * finalisation are output vertices.
+			 *
+			 * \endinternal
+			 */
+			class FineHyperDAGGenerator {
+
+				private:
+
+					/** \internal Marks an empty vector element. */
+					static constexpr size_t none = std::numeric_limits< size_t >::max();
+
+					/** \internal Marks a source vertex in #types. */
+					static constexpr size_t source = numOperationVertexTypes;
+
+					/** \internal Whether fine-grained HyperDAGs are generated. */
+					bool enabled;
+
+					/** \internal The number of consecutive indices per block. */
+					size_t blockSize;
+
+					/**
+					 * \internal
+					 * Tiles whose hash is at most this threshold are sampled.
+					 * \endinternal
+					 */
+					uint64_t sampleThreshold;
+
+					/** \internal The hypergraph under construction. */
+					DHypergraph hypergraph;
+
+					/**
+					 * \internal
+					 * The operation vertex type of every vertex, or #source for source
+					 * vertices.
+					 * \endinternal
+					 */
+					std::vector< size_t > types;
+
+					/**
+					 * \internal
+					 * The vertex that last produced every block of every vector, indexed by
+					 * container ID.
+					 * \endinternal
+					 */
+					std::unordered_map< uintptr_t, std::vector< size_t > > elements;
+
+					/**
+					 * \internal
+					 * The source vertex of every matrix tile used thus far, indexed by
+					 * container ID and by tile.
+					 * \endinternal
+					 */
+					std::unordered_map<
+						uintptr_t, std::unordered_map< uint64_t, size_t >
+					> tiles;
+
+					/** \internal Buffers the pins of an operation until #commit. */
+					std::vector< std::pair< size_t, size_t > > pins;
+
+					/** \internal Buffers the products of a multiplication. */
+					std::vector< std::pair< size_t, size_t > > products;
+
+					/** \internal Creates a new vertex of the given type. */
+					size_t createVertex( const size_t type );
+
+					/** \internal @returns The number of blocks of \a n indices. */
+					size_t numBlocks( const size_t n ) const noexcept;
+
+					/** \internal @returns Whether a matrix tile is sampled. */
+					bool isSampled( const size_t i, const size_t j ) const noexcept;
+
+					/**
+					 * \internal
+					 * @returns The source vertex of a tile of a matrix, which is created if
+					 *          it did not exist yet.
+					 * \endinternal
+					 */
+					size_t getTile(
+						std::unordered_map< uint64_t, size_t > &matrix,
+						const size_t i, const size_t j, const size_t n
+					);
+
+					/** \internal Adds all buffered #pins to the hypergraph. */
+					void commit();
+
+					/**
+					 * \internal
+					 * @returns Whether operations of \a type are matrix--vector
+					 *          multiplications, which are recorded via #addMultiplication
+					 *          instead of #addOperation.
+					 * \endinternal
+					 */
+					static bool isMultiplication( const OperationVertexType type ) noexcept;
+
+					/**
+					 * \internal
+					 * @returns Whether operations of \a type initialise their output vectors
+					 *          from scalars or iterators.
+					 * \endinternal
+					 */
+					static bool isInitialisation( const OperationVertexType type ) noexcept;
+
+
+				public:
+
+					/** \internal Base constructor. Generation is disabled by default. */
+					FineHyperDAGGenerator() noexcept;
+
+					/**
+					 * \internal
+					 *
+					 * Enables fine-grained HyperDAG generation, discarding any previously
+					 * generated HyperDAG.
+					 *
+					 * @param[in] blockSize The number of consecutive indices that are
+					 *                      coarsened into a single vertex. Must be positive.
+					 * @param[in] sample    The fraction of matrix tiles that are recorded.
+					 *                      Must be larger than zero and at most one.
+					 *
+					 * \endinternal
+					 */
+					void enable( const size_t blockSize, const double sample );
+
+					/** \internal @returns Whether fine-grained generation is enabled. */
+					bool isEnabled() const noexcept;
+
+					/**
+					 * \internal
+					 * Registers a new, empty vector with the given ID and size.
+					 * \endinternal
+					 */
+					void addVector( const uintptr_t id, const size_t n );
+
+					/**
+					 * \internal
+					 * Registers that the vector \a to now holds a copy of the vector
+					 * \a from.
+					 * \endinternal
+					 */
+					void copyVector( const uintptr_t from, const uintptr_t to );
+
+					/** \internal Unregisters a container that is destroyed. */
+					void removeContainer( const uintptr_t id );
+
+					/**
+					 * \internal
+					 * Registers that a single element of a vector is initialised.
+					 * \endinternal
+					 */
+					void setElement( const uintptr_t id, const size_t i );
+
+					/**
+					 * \internal
+					 *
+					 * Registers a primitive that is not a matrix--vector multiplication.
+					 *
+					 * @param[in] type The type of the primitive.
+					 * @param[in] src_start, src_end Iterators to the IDs of source containers.
+					 * @param[in] dst_start, dst_end Iterators to the IDs of destination
+					 *                               containers.
+					 *
+					 * \endinternal
+					 */
+					template< typename SrcIt, typename DstIt >
+					void addOperation(
+						const OperationVertexType type,
+						SrcIt src_start, const SrcIt &src_end,
+						DstIt dst_start, const DstIt &dst_end
+					) {
+						if( !enabled || isMultiplication( type ) ) {
+							return;
+						}
+						if( type == SET_VECTOR_ELEMENT ) {
+							// recorded via setElement instead
+							return;
+						}
+						std::vector< const std::vector< size_t > * > inputs;
+						for( ; src_start != src_end; ++src_start ) {
+							const auto it = elements.find( *src_start );
+							if( it != elements.end() ) {
+								inputs.push_back( &( it->second ) );
+							}
+						}
+						for( ; dst_start != dst_end; ++dst_start ) {
+							const auto it = elements.find( *dst_start );
+							if( it == elements.end() ) {
+								// the destination is a matrix, whose nonzeroes now are new sources
+								(void) tiles.erase( *dst_start );
+								continue;
+							}
+							std::vector< size_t > &output = it->second;
+							if( type == CLEAR_VECTOR ) {
+								std::fill( output.begin(), output.end(), none );
+								continue;
+							}
+							std::vector< const std::vector< size_t > * > aligned;
+							for( const auto &input : inputs ) {
+								if( input->size() == output.size() ) {
+									aligned.push_back( input );
+								}
+							}
+							const bool initialises = isInitialisation( type ) || aligned.empty();
+							for( size_t k = 0; k < output.size(); ++k ) {
+								if( initialises ) {
+									output[ k ] = createVertex( source );
+									continue;
+								}
+								size_t vertex = none;
+								for( const auto &input : aligned ) {
+									if( ( *input )[ k ] == none ) {
+										continue;
+									}
+									if( vertex == none ) {
+										vertex = createVertex( type );
+									}
+									pins.push_back( std::make_pair( ( *input )[ k ], vertex ) );
+								}
+								output[ k ] = vertex;
+							}
+						}
+						commit();
+					}
+
+					/**
+					 * \internal
+					 *
+					 * Registers a multiplication of a matrix \a A with a vector \a v into a
+					 * vector \a u.
+					 *
+					 * @param[in] type       The type of the primitive.
+					 * @param[in] u          The ID of the output vector.
+					 * @param[in] A          The ID of the input matrix.
+					 * @param[in] v          The ID of the input vector.
+					 * @param[in] n          The number of columns of \a A.
+					 * @param[in] transposed Whether \a A is used transposed, as for
+					 *                       #grb::vxm.
+					 * @param[in] start, end Iterators over the nonzeroes of \a A.
+					 *
+					 * Performance is log-linear in the number of nonzeroes of \a A.
+					 *
+					 * \endinternal
+					 */
+					template< typename NzIt >
+					void addMultiplication(
+						const OperationVertexType type,
+						const uintptr_t u, const uintptr_t A, const uintptr_t v,
+						const size_t n, const bool transposed,
+						NzIt start, const NzIt &end
+					) {
+						if( !enabled ) {
+							return;
+						}
+						const auto outIt = elements.find( u );
+						const auto inIt = elements.find( v );
+						if( outIt == elements.end() || inIt == elements.end() ) {
+							return;
+						}
+						std::vector< size_t > &output = outIt->second;
+						const std::vector< size_t > &input = inIt->second;
+						// collect the sampled tiles that meet a nonempty input element
+						products.clear();
+						for( ; start != end; ++start ) {
+							const std::pair< size_t, size_t > ij = nonzeroCoordinates( *start );
+							const size_t i = ij.first / blockSize;
+							const size_t j = ij.second / blockSize;
+							const size_t out = transposed ? j : i;
+							const size_t in = transposed ? i : j;
+							assert( out < output.size() );
+							assert( in < input.size() );
+							if( input[ in ] != none && isSampled( i, j ) ) {
+								products.push_back( std::make_pair( out, in ) );
+							}
+						}
+						std::sort( products.begin(), products.end() );
+						products.erase( std::unique( products.begin(), products.end() ),
+							products.end() );
+						// one reduction per output element, one product per tile
+						std::unordered_map< uint64_t, size_t > &matrix = tiles[ A ];
+						for( size_t k = 0; k < products.size(); ) {
+							const size_t out = products[ k ].first;
+							const size_t reduction = createVertex( type );
+							if( output[ out ] != none ) {
+								pins.push_back( std::make_pair( output[ out ], reduction ) );
+							}
+							for( ; k < products.size() && products[ k ].first == out; ++k ) {
+								const size_t in = products[ k ].second;
+								const size_t tile = transposed
+									? getTile( matrix, in, out, n )
+									: getTile( matrix, out, in, n );
+								const size_t product = createVertex( type );
+								pins.push_back( std::make_pair( tile, product ) );
+								pins.push_back( std::make_pair( input[ in ], product ) );
+								pins.push_back( std::make_pair( product, reduction ) );
+							}
+							output[ out ] = reduction;
+						}
+						commit();
+					}
+
+					/**
+					 * \internal
+					 *
+					 * Generates the fine-grained HyperDAG of the computation thus far.
+					 *
+					 * @returns The resulting HyperDAG.
+					 *
+					 * \endinternal
+					 */
+					HyperDAG finalize() const;
+
+			};
+
 			/** \internal Builds a HyperDAG representation of an ongoing computation. */
 			class HyperDAGGenerator {
 
@@ -958,13 +1414,13 @@ namespace grb {
 					std::vector< OperationVertex > operationVec;
 
 					/** \internal Map of pointers to source vertices. */
-					std::map< const void *, SourceVertex > sourceVerticesP;
+					std::unordered_map< const void *, SourceVertex > sourceVerticesP;
 
 					/** \internal Map of IDs to source vertices. */
-					std::map< uintptr_t, SourceVertex > sourceVerticesC;
+					std::unordered_map< uintptr_t, SourceVertex > sourceVerticesC;
 
 					/** \internal Map of IDs to operation vertices. */
-					std::map< uintptr_t, OperationVertex > operationVertices;
+					std::unordered_map< uintptr_t, OperationVertex > operationVertices;
 
 					// note: there is no map of OutputVertices because only at the point we
 					//       finalize to generate the final HyperDAG do we know for sure what
@@ -980,7 +1436,7 @@ namespace grb {
 					 *
 					 * \endinternal
 					 */
-					std::map< uintptr_t,
+					std::unordered_map< uintptr_t,
 						std::pair< size_t, OperationVertexType >
 					> operationOrOutputVertices;
 
@@ -992,6 +1448,65 @@ namespace grb {
 
 					// OutputVertexGenerator is a local field of #finalize()
 
+					/**
+					 * \internal
+					 *
+					 * The binary stream that records are written to, if any. While it is
+					 * open, #sourceVec, #operationVec, and the records of #hypergraph only
+					 * buffer those records that have not yet been written.
+					 *
+					 * \endinternal
+					 */
+					std::ofstream stream;
+
+					/**
+					 * \internal
+					 * The number of buffered 64-bit words after which records are written to
+					 * #stream.
+					 * \endinternal
+					 */
+					size_t streamLimit;
+
+					/** \internal Buffers the source IDs of an operation. */
+					std::vector< size_t > sourceIDs;
+
+					/** \internal The fine-grained representation, if enabled. */
+					FineHyperDAGGenerator fine;
+
+					/** \internal Buffers the destination IDs of an operation. */
+					std::vector< size_t > destinationIDs;
+
+					/**
+					 * \internal
+					 * Writes a #VERTEX_RECORD to #stream.
+					 *
+					 * @param[in] kind      Whether the vertex is a source, operation, or
+					 *                      output vertex.
+					 * @param[in] type      The type of the vertex, amongst those of \a kind.
+					 * @param[in] local_id  The ID amongst vertices of the same type.
+					 * @param[in] global_id The ID amongst all vertices.
+					 * \endinternal
+					 */
+					void writeVertex(
+						const enum VertexType kind, const size_t type,
+						const size_t local_id, const size_t global_id
+					);
+
+					/**
+					 * \internal
+					 * Writes all buffered vertices and hyperedges to #stream, if it is open,
+					 * and drops them from the buffers.
+					 * \endinternal
+					 */
+					void flush();
+
+					/**
+					 * \internal
+					 * Calls #flush if the buffered records exceed #streamLimit.
+					 * \endinternal
+					 */
+					void flushIfFull();
+
 					/**
 					 * \internal
 					 * Adds a source vertex to the hypergraph.
@@ -1117,8 +1632,11 @@ namespace grb {
 							<< "\t sourceVec size: " << sourceVec.size() << "\n";
 #endif
 
+						fine.addOperation( type, src_c_start, src_c_end, dst_start, dst_end );
+
 						// steps 1, 2, and 3
-						std::vector< std::pair< size_t, std::set< size_t > > > hyperedges;
+						sourceIDs.clear();
+						destinationIDs.clear();
 						for( ; src_p_start != src_p_end; ++src_p_start ) {
 #ifdef _DEBUG
 							std::cerr << "\t processing source pointer " << *src_p_start << "\n";
@@ -1145,7 +1663,7 @@ namespace grb {
 								sourceID = alreadySource->second.getGlobalID();
 							}
 							// step 3
-							hyperedges.push_back( std::make_pair( sourceID, std::set< size_t >() ) );
+							sourceIDs.push_back( sourceID );
 						}
 						for( ; src_c_start != src_c_end; ++src_c_start ) {
 #ifdef _DEBUG
@@ -1205,7 +1723,7 @@ namespace grb {
 								sourceID = global_id;
 							}
 							// step 3
-							hyperedges.push_back( std::make_pair( sourceID, std::set< size_t >() ) );
+							sourceIDs.push_back( sourceID );
 						}
 
 
@@ -1260,22 +1778,25 @@ namespace grb {
 								<< global_id << "\n";
 #endif
 							// step 6
-							for( auto &hyperedge : hyperedges ) {
-								hyperedge.second.insert( global_id );
-							}
+							destinationIDs.push_back( global_id );
 						}
 
-						// step 7
-						for( const auto &hyperedge : hyperedges ) {
+						// step 7; a source that is passed more than once, such as both inputs
+						// to grb::dot( z, x, x, ring ), still induces a single hyperedge
+						std::sort( sourceIDs.begin(), sourceIDs.end() );
+						sourceIDs.erase( std::unique( sourceIDs.begin(), sourceIDs.end() ),
+							sourceIDs.end() );
+						for( const size_t &sourceID : sourceIDs ) {
 #ifdef _DEBUG
 							std::cerr << "\t storing a hyperedge of size "
-								<< (hyperedge.second.size()+1) << "\n";
+								<< (destinationIDs.size()+1) << "\n";
 #endif
 							hypergraph.appendHyperedge(
-								hyperedge.first,
-								hyperedge.second.begin(), hyperedge.second.end()
+								sourceID,
+								destinationIDs.begin(), destinationIDs.end()
 							);
 						}
+						flushIfFull();
 					}
 
 					/**
@@ -1289,10 +1810,57 @@ namespace grb {
 					 * The current generator instance is left unmodified; this function takes
 					 * a snapshot of the current state, and allows its further extension.
 					 *
+					 * This function may not be called while streaming.
+					 *
 					 * \endinternal
 					 */
 					HyperDAG finalize() const;
 
+					/**
+					 * \internal
+					 *
+					 * Starts streaming a new HyperDAG to a binary file; see
+					 * #StreamRecordType for its format.
+					 *
+					 * @param[in] path  The file to write to. An existing file is overwritten.
+					 * @param[in] limit The number of buffered 64-bit words after which the
+					 *                  buffered records are written to the file.
+					 *
+					 * Any previously generated HyperDAG is discarded. From then on, memory
+					 * use of the generator is bounded by \a limit plus the number of
+					 * containers and source pointers that are in use.
+					 *
+					 * @returns Whether \a path could be opened for writing. If not, the
+					 *          generator remains unmodified.
+					 *
+					 * \endinternal
+					 */
+					bool streamTo( const std::string &path, const size_t limit );
+
+					/** \internal @returns Whether records are being streamed to a file. */
+					bool isStreaming() const noexcept;
+
+					/**
+					 * \internal
+					 * @returns The generator of the fine-grained representation of the
+					 *          same computation.
+					 * \endinternal
+					 */
+					FineHyperDAGGenerator & fineGrained() noexcept;
+
+					/**
+					 * \internal
+					 *
+					 * Assumes that all remaining vertices in #operationVertexOrOutputVertex
+					 * are of type #OutputVertex. It then writes all buffered records, the
+					 * output vertices, and an #END_RECORD to the stream, and closes it.
+					 *
+					 * @returns Whether all records were written successfully.
+					 *
+					 * \endinternal
+					 */
+					bool closeStream();
+
 			};
 
 		} // end namespace grb::internal::hyperdags
@@ -170,6 +170,8 @@ namespace grb {
 			sourcesC.begin(), sourcesC.end(),
 			destinations.begin(), destinations.end()
 		);
+		internal::hyperdags::generator.fineGrained().setElement(
+			getID( internal::getVector(x) ), i );
 		return ret;
 	}
 
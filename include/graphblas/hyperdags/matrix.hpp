@@ -149,6 +149,10 @@ namespace grb {
 #ifdef _DEBUG
 				std::cout << "Matrix (hyperdags) destructor\n";
 #endif
+				if( nrows( matrix ) > 0 && ncols( matrix ) > 0 ) {
+					internal::hyperdags::generator.fineGrained().removeContainer(
+						getID( matrix ) );
+				}
 			}
 
 			/** \internal Copy-assignment */
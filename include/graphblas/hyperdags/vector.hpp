@@ -131,6 +131,10 @@ namespace grb {
 				std::cout << "Vector (hyperdags) constructor\n";
 #endif
 				register_vector();
+				if( n > 0 ) {
+					internal::hyperdags::generator.fineGrained().addVector(
+						getID( vector ), n );
+				}
 			}
 
 			Vector() : Vector( 0 ) {
@@ -144,6 +148,10 @@ namespace grb {
 				std::cout << "Vector (hyperdags) copy constructor\n";
 #endif
 				register_vector();
+				if( size( vector ) > 0 ) {
+					internal::hyperdags::generator.fineGrained().copyVector(
+						getID( x.vector ), getID( vector ) );
+				}
 			}
 
 			Vector( SelfType &&x ) noexcept {
@@ -159,12 +167,20 @@ namespace grb {
 				std::cout << "Vector (hyperdags) capacity constructor\n";
 #endif
 				register_vector();
+				if( n > 0 ) {
+					internal::hyperdags::generator.fineGrained().addVector(
+						getID( vector ), n );
+				}
 			}
 
 			~Vector() {
 #ifdef _DEBUG
 				std::cout << "Vector (hyperdags) destructor\n";
 #endif
+				if( size( vector ) > 0 ) {
+					internal::hyperdags::generator.fineGrained().removeContainer(
+						getID( vector ) );
+				}
 			}
 
 			SelfType & operator=( const SelfType &x ) {
@@ -172,6 +188,10 @@ namespace grb {
 				std::cout << "Vector (hyperdags) copy assignment\n";
 #endif
 				vector = x.vector;
+				if( size( vector ) > 0 ) {
+					internal::hyperdags::generator.fineGrained().copyVector(
+						getID( x.vector ), getID( vector ) );
+				}
 				return *this;
 			}
 
@@ -99,6 +99,30 @@
  * <tt>voteToHalt</tt> flag set to <tt>true</tt>, then that Pregel program
  * terminates as well.
  *
+ * \par Execution modes
+ *
+ * By default, every active vertex executes during every round, and every round
+ * hence costs work proportional to the number of active vertices. Programs for
+ * which a vertex that votes to halt need not execute again until it receives a
+ * message, such as #grb::algorithms::pregel::ConnectedComponents, may instead
+ * run in the #grb::interfaces::SPARSE_ACTIVE_SET mode. In this mode, the cost
+ * of a round is proportional to the number of vertices that execute in it, plus
+ * the number of edges over which messages are sent. Programs that converge
+ * faster when vertices read the freshest values of their neighbours, such as
+ * label propagation, may instead run in the #grb::interfaces::ASYNCHRONOUS
+ * mode on shared-memory backends. See #grb::interfaces::ExecutionMode for
+ * details.
+ *
+ * \par Aggregators
+ *
+ * Vertices may furthermore contribute to global reductions, called
+ * aggregators, from within the vertex-centric program. The result of such a
+ * reduction is available to all vertices during the next round, as well as to
+ * the caller once the program terminates. Global quantities such as residuals
+ * or the number of vertices that changed state hence need not be computed by
+ * separate passes over the vertex states. See #grb::interfaces::Aggregator for
+ * details.
+ *
  * \par Using vertex-centric algorithms
  *
  * By convention, ALP/Pregel algorithms allow for a simplified way of executing
@@ -144,7 +168,11 @@
 
 #include <graphblas.hpp>
 #include <graphblas/utils/parser.hpp>
+#include <graphblas/algorithms/utils.hpp>
 
+#include <vector>
+#include <memory> // std::unique_ptr
+#include <algorithm> // std::min
 #include <stdexcept> // std::runtime_error
 
 
@@ -241,8 +269,95 @@ namespace grb {
 			 */
 			constexpr const SparsificationStrategy out_sparsify = NONE;
 
+			/**
+			 * In the #grb::interfaces::SPARSE_ACTIVE_SET mode, the fraction of all
+			 * vertices that must execute during a round for that round to operate on
+			 * dense vectors. Smaller active sets keep all internal vectors sparse.
+			 *
+			 * \ingroup Pregel
+			 */
+			constexpr const double sparse_active_set_dense_ratio = 0.5;
+
 		} // end namespace grb::interfaces::config
 
+		/**
+		 * The modes in which #grb::interfaces::Pregel::execute may run a
+		 * vertex-centric program.
+		 *
+		 * \ingroup Pregel
+		 */
+		enum ExecutionMode {
+
+			/**
+			 * Every active vertex executes during every round, and broadcasts its
+			 * outgoing message after every round. Inactive vertices keep broadcasting
+			 * their last outgoing message.
+			 *
+			 * This is the default mode.
+			 */
+			BULK_SYNCHRONOUS = 0,
+
+			/**
+			 * A vertex that votes to halt does not broadcast its outgoing message, and
+			 * sleeps until it receives a message from a neighbour. A vertex that does
+			 * not vote to halt broadcasts its outgoing message, and executes again
+			 * during the next round. During the first round, all vertices execute.
+			 *
+			 * The incoming message of a vertex that wakes up is the accumulation of
+			 * only those messages sent to it during the preceding round. A vertex
+			 * that did not vote to halt but receives no messages sees the identity of
+			 * the accumulation monoid.
+			 *
+			 * The set of executing vertices is compacted each round, and messages are
+			 * exchanged via a sparse matrix times sparse vector multiplication from
+			 * only the broadcasting vertices. Hence the cost of every round is
+			 * proportional to the number of executing vertices and their edges,
+			 * rather than to the number of active vertices. Rounds in which a large
+			 * fraction of all vertices execute, as configured by
+			 * #grb::interfaces::config::sparse_active_set_dense_ratio, instead operate
+			 * on dense vectors and cost work proportional to the number of vertices.
+			 *
+			 * Termination conditions are unchanged: the program terminates once all
+			 * vertices that executed during a round vote to halt.
+			 */
+			SPARSE_ACTIVE_SET,
+
+			/**
+			 * Every active vertex executes during every round, as with
+			 * #BULK_SYNCHRONOUS, but reads the freshest outgoing messages of its
+			 * neighbours instead of those of the preceding round.
+			 *
+			 * The vertices are partitioned into contiguous ranges, one per thread.
+			 * Within a range, vertices execute in increasing order during even rounds
+			 * and in decreasing order during odd rounds, and the incoming message of a
+			 * vertex is accumulated just before it executes. Hence messages sent by
+			 * vertices of the same range that executed earlier are delivered during
+			 * the same round (Gauss--Seidel), while messages from other ranges are
+			 * delivered at the start of the next round (Jacobi). With a single thread,
+			 * all messages are delivered in-place. Alternating the order lets
+			 * information travel in both directions of the vertex numbering.
+			 *
+			 * For label-propagation type programs, such as
+			 * #grb::algorithms::pregel::ConnectedComponents and
+			 * #grb::algorithms::pregel::PageRank, this typically reduces the number of
+			 * rounds until convergence significantly. The result of the program may
+			 * differ from that of a #BULK_SYNCHRONOUS execution if the program does
+			 * not converge to a unique fixed point, and may depend on the number of
+			 * threads.
+			 *
+			 * Termination conditions are unchanged: the program terminates once all
+			 * active vertices vote to halt during the same round, or once no vertex is
+			 * active.
+			 *
+			 * This mode requires the vertex states and messages to be locally
+			 * available, and therefore only applies to shared-memory execution. If
+			 * there are multiple user processes, the #BULK_SYNCHRONOUS mode is used
+			 * instead.
+			 */
+			ASYNCHRONOUS
+
+		};
+
 		/**
 		 * The state of the vertex-center Pregel program that the user may interface
 		 * with.
@@ -325,6 +440,175 @@ namespace grb {
 
 		};
 
+		/**
+		 * The interface through which #grb::interfaces::Pregel::execute drives
+		 * aggregators; see #grb::interfaces::Aggregator.
+		 *
+		 * \ingroup Pregel
+		 */
+		class AggregatorBase {
+
+			public:
+
+				/** Base destructor. */
+				virtual ~AggregatorBase() {}
+
+				/**
+				 * Resets the aggregate as well as all contributions to the identity.
+				 * Called on program start.
+				 */
+				virtual void clear() = 0;
+
+				/**
+				 * Reduces all contributions made during the last round into the
+				 * aggregate, and resets the contributions for the next round. Called at
+				 * the end of each round.
+				 *
+				 * This is a collective call.
+				 */
+				virtual grb::RC reduce() = 0;
+
+		};
+
+		/**
+		 * A global reduction that vertex-centric programs contribute to.
+		 *
+		 * During a round, any vertex may call #contribute any number of times. At
+		 * the end of the round, the ALP/Pregel run-time reduces all contributions
+		 * using the given monoid, first per thread and then across user processes,
+		 * after which #value returns the result. The result hence is available to
+		 * all vertices during the next round, and to the caller of
+		 * #grb::interfaces::Pregel::execute once the program terminates.
+		 *
+		 * Typical uses are global convergence criteria, such as the residual of
+		 * an iterative method or the number of vertices that changed their state.
+		 * Vertices may, for example, vote to halt once the aggregate computed during
+		 * the previous round drops below some threshold. Such criteria then require
+		 * no passes over the vertex set beyond the rounds of the program itself.
+		 *
+		 * Vertex programs may only access an aggregator via their global program
+		 * data, for example by storing a pointer to it. To be driven, aggregators
+		 * must be passed to #grb::interfaces::Pregel::execute.
+		 *
+		 * @tparam T      The type of the contributions and the aggregate.
+		 * @tparam Monoid The monoid used to reduce contributions.
+		 *
+		 * \par Performance semantics
+		 *   -# A call to #contribute costs \f$ \Theta(1) \f$ work, and touches
+		 *      only the calling thread's slot.
+		 *   -# Reducing the contributions at the end of a round costs
+		 *      \f$ \Theta(T) \f$ work, with \f$ T \f$ the maximum number of
+		 *      threads, plus one all-reduce collective of a single \a T.
+		 *   -# An aggregator requires \f$ \Theta(T) \f$ memory, with every
+		 *      thread's slot on its own cache line.
+		 *
+		 * \ingroup Pregel
+		 */
+		template< typename T, class Monoid >
+		class Aggregator : public AggregatorBase {
+
+			static_assert( grb::is_monoid< Monoid >::value,
+				"grb::interfaces::Aggregator: the given Monoid is not a monoid" );
+
+			private:
+
+				/** \internal The monoid used to reduce contributions. */
+				const Monoid monoid;
+
+				/** \internal The distance between two thread slots in #slots. */
+				const size_t stride;
+
+				/** \internal The maximum number of threads that may contribute. */
+				const size_t threads;
+
+				/** \internal The contributions of every thread. */
+				std::unique_ptr< T[] > slots;
+
+				/** \internal The aggregate of the last completed round. */
+				T aggregate;
+
+				/** \internal The index of the slot of the calling thread. */
+				static size_t thread() {
+#ifdef _GRB_WITH_OMP
+					return static_cast< size_t >( omp_get_thread_num() );
+#else
+					return 0;
+#endif
+				}
+
+				/** \internal The maximum number of threads that may contribute. */
+				static size_t maxThreads() {
+#ifdef _GRB_WITH_OMP
+					return grb::config::OMP::threads();
+#else
+					return 1;
+#endif
+				}
+
+
+			public:
+
+				/**
+				 * Constructs an aggregator with its aggregate equal to the identity of
+				 * the given \a monoid.
+				 *
+				 * This constructor throws std::bad_alloc if the thread slots could not
+				 * be allocated.
+				 */
+				Aggregator( const Monoid &_monoid = Monoid() ) :
+					monoid( _monoid ),
+					stride( std::max( static_cast< size_t >( 1 ),
+						grb::config::CACHE_LINE_SIZE::value() / sizeof( T ) ) ),
+					threads( maxThreads() ),
+					slots( new T[ threads * stride ] ),
+					aggregate( _monoid.template getIdentity< T >() )
+				{
+					clear();
+				}
+
+				/**
+				 * Contributes a value to the aggregate of the current round.
+				 *
+				 * May be called concurrently by the threads of a single user process.
+				 */
+				void contribute( const T &value ) {
+					const size_t t = thread();
+					assert( t < threads );
+					(void) grb::foldl( slots[ t * stride ], value, monoid.getOperator() );
+				}
+
+				/**
+				 * @returns The aggregate of the last completed round. Before the first
+				 *          round has completed, this is the identity of the monoid.
+				 */
+				const T & value() const noexcept {
+					return aggregate;
+				}
+
+				/** Resets the aggregate and all contributions. */
+				void clear() override {
+					std::fill( slots.get(), slots.get() + threads * stride,
+						monoid.template getIdentity< T >() );
+					aggregate = monoid.template getIdentity< T >();
+				}
+
+				/** Reduces the contributions of the last round into the aggregate. */
+				grb::RC reduce() override {
+					T local = monoid.template getIdentity< T >();
+					for( size_t t = 0; t < threads; ++t ) {
+						(void) grb::foldl( local, slots[ t * stride ], monoid.getOperator() );
+						slots[ t * stride ] = monoid.template getIdentity< T >();
+					}
+					const grb::RC ret = grb::collectives<>::allreduce(
+						local, monoid.getOperator() );
+					if( ret == SUCCESS ) {
+						aggregate = local;
+					}
+					return ret;
+				}
+
+		};
+
 		/**
 		 * A Pregel run-time instance.
 		 *
@@ -356,7 +640,10 @@ namespace grb {
 				/** \internal Which vertices voted to halt. */
 				grb::Vector< bool > haltVotes;
 
-				/** \internal A buffer used to sparsify #activeVertices. */
+				/**
+				 * \internal A buffer used to sparsify #activeVertices. In the sparse
+				 * active-set mode, records instead which executed vertices broadcast.
+				 */
 				grb::Vector< bool > buffer;
 
 				/** \internal Pre-computed outdegrees. */
@@ -368,6 +655,15 @@ namespace grb {
 				/** \internal Global vertex IDs. */
 				grb::Vector< size_t > IDs;
 
+				/**
+				 * \internal Where the in-neighbours of each vertex start in #pullSources.
+				 * Only built on the first #ASYNCHRONOUS execution.
+				 */
+				std::vector< size_t > pullOffsets;
+
+				/** \internal The in-neighbours of every vertex, see #pullOffsets. */
+				std::vector< size_t > pullSources;
+
 				/**
 				 * \internal
 				 * Initialises the following fields:
@@ -626,6 +922,14 @@ namespace grb {
 				 * To turn off termination after a maximum number of rounds, \a max_rounds
 				 * may be set to zero. This is also the default.
 				 *
+				 * @param[in] mode The execution mode; see #grb::interfaces::ExecutionMode.
+				 *                 The default is #grb::interfaces::BULK_SYNCHRONOUS.
+				 *
+				 * @param[in] aggregators The aggregators that \a program contributes to;
+				 *                        see #grb::interfaces::Aggregator. They are
+				 *                        cleared on program start and reduced at the end
+				 *                        of every round. By default, there are none.
+				 *
 				 * Executing a Pregel function returns one of the following error codes:
 				 *
 				 * @returns #grb::SUCCESS  The \a program executed (and terminated)
@@ -635,6 +939,8 @@ namespace grb {
 				 * @returns #grb::ILLEGAL  At least one of \a vertex_state, \a in, or \a out
 				 *                         does not have the required capacity.
 				 * @returns #grb::ILLEGAL  If \a vertex_state is not dense.
+				 * @returns #grb::OUTOFMEM If \a mode is #grb::interfaces::ASYNCHRONOUS
+				 *                         and its workspace could not be allocated.
 				 * @returns #grb::PANIC    In case an unrecoverable error was encountered
 				 *                         during execution.
 				 */
@@ -656,7 +962,10 @@ namespace grb {
 					size_t &rounds,
 					grb::Vector< OutgoingMessageType > &out_buffer =
 						grb::Vector< OutgoingMessageType >(0),
-					const size_t max_rounds = 0
+					const size_t max_rounds = 0,
+					const ExecutionMode mode = BULK_SYNCHRONOUS,
+					const std::vector< AggregatorBase * > &aggregators =
+						std::vector< AggregatorBase * >()
 				) {
 					static_assert( grb::is_operator< Op >::value &&
 							grb::is_associative< Op >::value,
@@ -757,6 +1066,22 @@ namespace grb {
 						return PANIC;
 					}
 
+					// reset aggregators
+					for( AggregatorBase * const aggregator : aggregators ) {
+						aggregator->clear();
+					}
+
+					if( mode == SPARSE_ACTIVE_SET ) {
+						ret = executeSparse< Id >( program, vertex_state, data, in, out,
+							rounds, max_rounds, ring, andMonoid, aggregators );
+						return ret;
+					}
+					if( mode == ASYNCHRONOUS && grb::spmd<>::nprocs() == 1 ) {
+						ret = executeAsync< Id >( program, vertex_state, data, in, out,
+							rounds, max_rounds, ring, aggregators );
+						return ret;
+					}
+
 					// while there are active vertices, execute
 					while( ret == SUCCESS ) {
 
@@ -803,6 +1128,11 @@ namespace grb {
 							}, activeVertices, vertex_state, in, out, outdegrees, haltVotes, indegrees, IDs
 						);
 
+						// reduce aggregators
+						if( ret == SUCCESS ) {
+							ret = reduceAggregators( aggregators );
+						}
+
 						// increment counter
 						(void) ++step;
 
@@ -919,6 +1249,461 @@ namespace grb {
 					return ret;
 				}
 
+			private:
+
+				/**
+				 * \internal
+				 * Reduces the contributions of the last round into each of the given
+				 * \a aggregators. Any lazily evaluated round is completed first.
+				 * \endinternal
+				 */
+				static grb::RC reduceAggregators(
+					const std::vector< AggregatorBase * > &aggregators
+				) {
+					if( aggregators.empty() ) {
+						return SUCCESS;
+					}
+					grb::RC ret = grb::wait();
+					for( AggregatorBase * const aggregator : aggregators ) {
+						ret = ret ? ret : aggregator->reduce();
+					}
+					return ret;
+				}
+
+				/**
+				 * \internal
+				 * Executes \a program in the #SPARSE_ACTIVE_SET mode. Assumes all
+				 * arguments have been checked, and that #activeVertices, #haltVotes,
+				 * \a in, and \a out have been initialised as for the
+				 * #BULK_SYNCHRONOUS mode.
+				 *
+				 * The vertices that execute during a round are exactly those that hold
+				 * an incoming message. Between rounds, #haltVotes, #buffer, and \a out
+				 * hold entries for at most the vertices that executed during the last
+				 * round. A sparse round clears them and sets their entries for the
+				 * vertices in \a in only, folds the halt votes of those vertices only,
+				 * and exchanges the messages of the vertices that broadcast, as recorded
+				 * in #buffer, via an input-masked #grb::vxm into the cleared \a in, which
+				 * thus becomes the set of vertices that execute during the next round.
+				 * Every step of a sparse round hence costs work proportional to the
+				 * number of executing vertices and their edges.
+				 *
+				 * A round in which more than a fraction
+				 * #config::sparse_active_set_dense_ratio of all vertices execute instead
+				 * makes #haltVotes, #buffer, and \a out dense, where vertices that do not
+				 * execute vote to halt and do not broadcast. This avoids the overhead of
+				 * sparse bookkeeping when it would not pay off. The first sparse round
+				 * following a dense one pays work proportional to the number of vertices
+				 * to clear those vectors.
+				 *
+				 * #activeVertices remains dense; vertices that deactivate themselves keep
+				 * a <tt>false</tt> entry, and are skipped if they receive messages.
+				 * \endinternal
+				 */
+				template<
+					template< typename > class Id,
+					class Program,
+					typename IOType,
+					typename GlobalProgramData,
+					typename IncomingMessageType,
+					typename OutgoingMessageType,
+					class Ring,
+					class AndMonoid
+				>
+				grb::RC executeSparse(
+					const Program program,
+					grb::Vector< IOType > &vertex_state,
+					const GlobalProgramData &data,
+					grb::Vector< IncomingMessageType > &in,
+					grb::Vector< OutgoingMessageType > &out,
+					size_t &rounds,
+					const size_t max_rounds,
+					const Ring &ring,
+					const AndMonoid &andMonoid,
+					const std::vector< AggregatorBase * > &aggregators
+				) {
+					size_t step = 0;
+					grb::RC ret = SUCCESS;
+					const grb::Vector< bool > no_mask( 0 );
+
+					while( ret == SUCCESS ) {
+
+						assert( max_rounds == 0 || step < max_rounds );
+
+						// reset the state of the vertices that execute during this round;
+						// only if many vertices execute are all vertices reset
+						const bool dense = static_cast< double >( grb::nnz( in ) ) >
+							config::sparse_active_set_dense_ratio * static_cast< double >( n );
+						if( dense ) {
+							ret = grb::set( haltVotes, true );
+							ret = ret ? ret : grb::set( buffer, false );
+							ret = ret ? ret : grb::set( out, Id< OutgoingMessageType >::value() );
+						} else {
+							ret = grb::clear( haltVotes );
+							ret = ret ? ret : grb::clear( buffer );
+							ret = ret ? ret : grb::clear( out );
+							ret = ret ? ret : grb::set< grb::descriptors::structural >(
+								haltVotes, in, false );
+							ret = ret ? ret : grb::set< grb::descriptors::structural >(
+								buffer, in, false );
+							ret = ret ? ret : grb::set< grb::descriptors::structural >(
+								out, in, Id< OutgoingMessageType >::value() );
+						}
+
+						// run one step of the program on those vertices only
+						ret = ret ? ret : grb::eWiseLambda(
+							[
+								this,
+								&vertex_state,
+								&in,
+								&out,
+								&program,
+								step,
+								&data
+							]( const size_t i ) {
+								// executing vertices have not voted to halt yet, even in dense
+								// rounds where all others have
+								haltVotes[ i ] = false;
+								// vertices that deactivated themselves ignore messages
+								if( !activeVertices[ i ] ) {
+									haltVotes[ i ] = true;
+									return;
+								}
+								PregelState pregel = {
+									activeVertices[ i ],
+									haltVotes[ i ],
+									n,
+									nz,
+									outdegrees[ i ],
+									indegrees[ i ],
+									step,
+									IDs[ i ]
+								};
+								program(
+									vertex_state[ i ],
+									in[ i ],
+									out[ i ],
+									data,
+									pregel
+								);
+								buffer[ i ] = activeVertices[ i ] && !haltVotes[ i ];
+							}, in, vertex_state, out, activeVertices, haltVotes, buffer,
+								outdegrees, indegrees, IDs
+						);
+
+						// reduce aggregators
+						if( ret == SUCCESS ) {
+							ret = reduceAggregators( aggregators );
+						}
+
+						// increment counter
+						(void) ++step;
+
+						// check if every vertex that executed voted to halt
+						if( ret == SUCCESS ) {
+							bool halt = true;
+							ret = dense
+								? grb::foldl( halt, haltVotes, andMonoid )
+								: grb::foldl< grb::descriptors::structural >(
+									halt, haltVotes, in, andMonoid );
+							if( ret == SUCCESS && halt ) {
+#ifdef _DEBUG
+								std::cout << "\t All executing vertices voted to halt; "
+									<< "terminating Pregel program.\n";
+#endif
+								break;
+							}
+						}
+
+						// check if we exceed the maximum number of rounds
+						if( max_rounds > 0 && step > max_rounds ) {
+							ret = FAILED;
+							break;
+						}
+
+						// vertices that broadcast execute again, even if they receive nothing
+						if( ret == SUCCESS ) {
+							ret = grb::set( in, buffer, Id< IncomingMessageType >::value() );
+						}
+
+						// send messages from broadcasting vertices only
+						if( ret == SUCCESS ) {
+							ret = grb::vxm( in, no_mask, out, buffer, graph, ring );
+						}
+
+#ifdef _DEBUG
+						std::cout << "\t " << grb::nnz( in ) << " vertices execute during "
+							<< "the next round\n";
+#endif
+					}
+
+					rounds = step;
+					return ret;
+				}
+
+				/**
+				 * \internal
+				 * Builds #pullOffsets and #pullSources, unless they were built before.
+				 * Messages only travel over edges whose value evaluates <tt>true</tt>, as
+				 * with the bulk-synchronous #grb::vxm.
+				 *
+				 * Requires that #graph is locally available.
+				 * \endinternal
+				 */
+				void initializePull() {
+					if( pullOffsets.size() == n + 1 ) {
+						return;
+					}
+					pullOffsets.assign( n + 1, 0 );
+					size_t source, destination;
+					for( const auto &nz : graph ) {
+						grb::algorithms::internal::nonzero_indices( nz, source, destination );
+						if( grb::algorithms::internal::nonzero_value( nz, true ) ) {
+							(void) ++pullOffsets[ destination + 1 ];
+						}
+					}
+					for( size_t i = 0; i < n; ++i ) {
+						pullOffsets[ i + 1 ] += pullOffsets[ i ];
+					}
+					pullSources.resize( pullOffsets[ n ] );
+					std::vector< size_t > pos( pullOffsets.begin(), pullOffsets.end() - 1 );
+					for( const auto &nz : graph ) {
+						grb::algorithms::internal::nonzero_indices( nz, source, destination );
+						if( grb::algorithms::internal::nonzero_value( nz, true ) ) {
+							pullSources[ pos[ destination ]++ ] = source;
+						}
+					}
+				}
+
+				/**
+				 * \internal
+				 * Executes \a program in the #ASYNCHRONOUS mode. Assumes all arguments
+				 * have been checked, that \a in and \a out are dense, and that there is
+				 * a single user process.
+				 *
+				 * The vertex states and messages are copied into local arrays, on which
+				 * every thread executes the program over its own range of vertices. Each
+				 * vertex pulls its incoming message from its in-neighbours just before it
+				 * executes: from the freshest outgoing messages if the neighbour lies in
+				 * the same range, and from a copy of the outgoing messages taken at the
+				 * end of the previous round otherwise. Only vertices in the same range
+				 * hence ever read a message while it may change, and those execute on the
+				 * same thread.
+				 *
+				 * This requires work and memory proportional to the number of vertices
+				 * for the copies, plus that of #initializePull on the first call.
+				 * \endinternal
+				 */
+				template<
+					template< typename > class Id,
+					class Program,
+					typename IOType,
+					typename GlobalProgramData,
+					typename IncomingMessageType,
+					typename OutgoingMessageType,
+					class Ring
+				>
+				grb::RC executeAsync(
+					const Program program,
+					grb::Vector< IOType > &vertex_state,
+					const GlobalProgramData &data,
+					grb::Vector< IncomingMessageType > &in,
+					grb::Vector< OutgoingMessageType > &out,
+					size_t &rounds,
+					const size_t max_rounds,
+					const Ring &ring,
+					const std::vector< AggregatorBase * > &aggregators
+				) {
+					assert( grb::spmd<>::nprocs() == 1 );
+					assert( grb::nnz( in ) == n );
+					assert( grb::nnz( out ) == n );
+
+					const size_t threads = grb::algorithms::internal::local_threads();
+
+					// allocate workspace
+					std::unique_ptr< IOType[] > state_buffer;
+					std::unique_ptr< IncomingMessageType[] > first_buffer;
+					std::unique_ptr< OutgoingMessageType[] > fresh_buffer, published_buffer;
+					std::unique_ptr< size_t[] > outdegree_buffer, indegree_buffer;
+					std::unique_ptr< bool[] > active_buffer;
+					try {
+						initializePull();
+						state_buffer.reset( new IOType[ n ] );
+						first_buffer.reset( new IncomingMessageType[ n ] );
+						fresh_buffer.reset( new OutgoingMessageType[ n ] );
+						if( threads > 1 ) {
+							published_buffer.reset( new OutgoingMessageType[ n ] );
+						}
+						outdegree_buffer.reset( new size_t[ n ] );
+						indegree_buffer.reset( new size_t[ n ] );
+						active_buffer.reset( new bool[ n ] );
+					} catch( const std::bad_alloc & ) {
+						return OUTOFMEM;
+					}
+					IOType * const state = state_buffer.get();
+					IncomingMessageType * const first = first_buffer.get();
+					OutgoingMessageType * const fresh = fresh_buffer.get();
+					OutgoingMessageType * const published = threads > 1
+						? published_buffer.get()
+						: fresh;
+					size_t * const outdegree = outdegree_buffer.get();
+					size_t * const indegree = indegree_buffer.get();
+					bool * const active = active_buffer.get();
+					const size_t * const offsets = pullOffsets.data();
+					const size_t * const sources = pullSources.data();
+
+					// copy in
+					grb::RC ret = grb::eWiseLambda(
+						[ this, &vertex_state, &in, &out, state, first, fresh, outdegree,
+							indegree, active
+						]( const size_t i ) {
+							state[ i ] = vertex_state[ i ];
+							first[ i ] = in[ i ];
+							fresh[ i ] = out[ i ];
+							outdegree[ i ] = outdegrees[ i ];
+							indegree[ i ] = indegrees[ i ];
+							active[ i ] = true;
+						}, vertex_state, in, out, outdegrees, indegrees
+					);
+					ret = ret ? ret : grb::wait();
+					if( ret != SUCCESS ) {
+						return ret;
+					}
+
+					const auto &accumulator = ring.getAdditiveOperator();
+					size_t step = 0;
+					while( ret == SUCCESS ) {
+
+						assert( max_rounds == 0 || step < max_rounds );
+						size_t executed = 0;
+						size_t voted = 0;
+						size_t remaining = 0;
+
+						#pragma omp parallel num_threads( threads ) \
+							reduction( + : executed, voted, remaining )
+						{
+							size_t t = 0;
+							size_t T = 1;
+#ifdef _GRB_WITH_OMP
+							t = static_cast< size_t >( omp_get_thread_num() );
+							T = static_cast< size_t >( omp_get_num_threads() );
+#endif
+							const size_t chunk = ( n + T - 1 ) / T;
+							const size_t lo = std::min( n, t * chunk );
+							const size_t hi = std::min( n, lo + chunk );
+							for( size_t k = lo; k < hi; ++k ) {
+								const size_t i = step % 2 == 0 ? k : lo + hi - 1 - k;
+								if( !active[ i ] ) {
+									continue;
+								}
+								IncomingMessageType incoming = first[ i ];
+								if( step > 0 ) {
+									incoming = Id< IncomingMessageType >::value();
+									for( size_t e = offsets[ i ]; e < offsets[ i + 1 ]; ++e ) {
+										const size_t j = sources[ e ];
+										const IncomingMessageType message = ( j >= lo && j < hi )
+											? fresh[ j ]
+											: published[ j ];
+										(void) grb::foldl( incoming, message, accumulator );
+									}
+								}
+								bool vertex_active = true;
+								bool vote = false;
+								const size_t id = i;
+								PregelState pregel = {
+									vertex_active,
+									vote,
+									n,
+									nz,
+									outdegree[ i ],
+									indegree[ i ],
+									step,
+									id
+								};
+								program(
+									state[ i ],
+									incoming,
+									fresh[ i ],
+									data,
+									pregel
+								);
+								active[ i ] = vertex_active;
+								(void) ++executed;
+								if( vote ) {
+									(void) ++voted;
+								}
+								if( vertex_active ) {
+									(void) ++remaining;
+								}
+							}
+							// publish the messages of this range for the next round
+							if( published != fresh ) {
+								#pragma omp barrier
+								for( size_t i = lo; i < hi; ++i ) {
+									published[ i ] = fresh[ i ];
+								}
+							}
+						}
+
+						// reduce aggregators
+						ret = reduceAggregators( aggregators );
+						if( ret != SUCCESS ) {
+							break;
+						}
+
+						// increment counter
+						(void) ++step;
+
+						// check if every active vertex voted to halt
+						if( voted == executed ) {
+#ifdef _DEBUG
+							std::cout << "\t All active vertices voted to halt; "
+								<< "terminating Pregel program.\n";
+#endif
+							break;
+						}
+
+						// check if there is a next round
+						if( remaining == 0 ) {
+#ifdef _DEBUG
+							std::cout << "\t All vertices are inactive; "
+								<< "terminating Pregel program.\n";
+#endif
+							break;
+						}
+
+						// check if we reached the maximum number of rounds
+						if( max_rounds > 0 && step >= max_rounds ) {
+#ifdef _DEBUG
+							std::cout << "\t Maximum number of Pregel rounds met "
+								<< "without the program returning a valid termination condition. "
+								<< "Exiting prematurely with a FAILED error code.\n";
+#endif
+							ret = FAILED;
+							break;
+						}
+					}
+
+					// copy out, also on failure, so that the vertex states and outgoing
+					// messages reflect all executed rounds as in the bulk-synchronous modes
+					grb::RC copy_ret = grb::eWiseLambda(
+						[ &vertex_state, &out, state, fresh ]( const size_t i ) {
+							vertex_state[ i ] = state[ i ];
+							out[ i ] = fresh[ i ];
+						}, vertex_state, out
+					);
+					copy_ret = copy_ret ? copy_ret : grb::wait();
+					if( ret == SUCCESS ) {
+						ret = copy_ret;
+					}
+
+					rounds = step;
+					return ret;
+				}
+
+
+			public:
+
 				/**
 				 * Queries the maximum vertex ID for programs running on this Pregel
 				 * instance.
@@ -1188,8 +1188,10 @@ namespace grb {
 #endif
 						}
 					}
-				} else if( !masked && local_to_fold_nz == local_n ) {
-					// use sparsity structure of fold_into for this eWiseFold
+				} else if( !masked && !monoid && local_to_fold_nz == local_n ) {
+					// use sparsity structure of fold_into for this eWiseFold. This does not
+					// apply to monoids, which should also assign the unassigned elements of
+					// fold_into
 					if( left ) {
 #ifdef _DEBUG
 						std::cout << "fold_from_vector_to_vector_generic: foldl, using "
@@ -1549,6 +1549,179 @@ namespace grb {
 		return eWiseLambda( f, A, args... );
 	}
 
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType, typename RIT, typename CIT, typename NIT
+	>
+	RC triangularAnalysis(
+		TriangularSchedule &schedule,
+		const Matrix< InputType, nonblocking, RIT, CIT, NIT > &T,
+		const Triangle triangle,
+		const Diagonal diagonal = NON_UNIT
+	) {
+		// the analysis reads the matrix structure, hence requires it be computed
+		internal::le.execution();
+
+		return triangularAnalysis< descr >(
+			schedule, internal::getRefMatrix( T ), triangle, diagonal );
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring,
+		class Minus = operators::subtract< typename Ring::D4 >,
+		class Divide = operators::divide< typename Ring::D4 >,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC triangularSolve(
+		Vector< IOType, nonblocking, Coords > &x,
+		const Matrix< InputType2, nonblocking, RIT, CIT, NIT > &T,
+		const Vector< InputType1, nonblocking, Coords > &b,
+		const TriangularSchedule &schedule,
+		const Ring &ring = Ring(),
+		const Minus &minus = Minus(),
+		const Divide &divide = Divide(),
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value,
+		void >::type * const = nullptr
+	) {
+		if( internal::NONBLOCKING::warn_if_not_native &&
+			config::PIPELINE::warn_if_not_native
+		) {
+			std::cerr << "Warning: triangularSolve (nonblocking) currently delegates "
+				<< "to a blocking implementation.\n"
+				<< "         Further similar such warnings will be suppressed.\n";
+			internal::NONBLOCKING::warn_if_not_native = false;
+		}
+
+		// nonblocking execution is not supported
+		// first, execute any computation that is not completed
+		internal::le.execution();
+
+		// second, delegate to the reference backend
+		return triangularSolve< descr >(
+			internal::getRefVector( x ), internal::getRefMatrix( T ),
+			internal::getRefVector( b ), schedule, ring, minus, divide );
+	}
+
+	/**
+	 * \internal
+	 * Composes the multiplication with the folds the epilogue translates to. The
+	 * nonblocking backend pipelines these, so that the epilogue is applied while
+	 * the output elements remain in cache.
+	 * \endinternal
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC vxm(
+		Vector< IOType, nonblocking, Coords > &u,
+		const Vector< InputType3, nonblocking, Coords > &mask,
+		const Vector< InputType1, nonblocking, Coords > &v,
+		const Matrix< InputType2, nonblocking, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		if( !internal::epilogueFits( epilogue, size( u ) ) ) {
+			return MISMATCH;
+		}
+		RC ret = vxm< descr >( u, mask, v, A, ring, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			ret = internal::foldEpilogue< descr >( u, mask, epilogue );
+		}
+		return ret;
+	}
+
+	/** \internal Delegates to the masked variant */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC vxm(
+		Vector< IOType, nonblocking, Coords > &u,
+		const Vector< InputType1, nonblocking, Coords > &v,
+		const Matrix< InputType2, nonblocking, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		const Vector< bool, nonblocking, Coords > empty_mask( 0 );
+		return vxm< descr >( u, empty_mask, v, A, ring, epilogue, phase );
+	}
+
+	/** \internal See the above #grb::vxm with an epilogue */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC mxv(
+		Vector< IOType, nonblocking, Coords > &u,
+		const Vector< InputType3, nonblocking, Coords > &mask,
+		const Matrix< InputType2, nonblocking, RIT, CIT, NIT > &A,
+		const Vector< InputType1, nonblocking, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		if( !internal::epilogueFits( epilogue, size( u ) ) ) {
+			return MISMATCH;
+		}
+		RC ret = mxv< descr >( u, mask, A, v, ring, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			ret = internal::foldEpilogue< descr >( u, mask, epilogue );
+		}
+		return ret;
+	}
+
+	/** \internal Delegates to the masked variant */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC mxv(
+		Vector< IOType, nonblocking, Coords > &u,
+		const Matrix< InputType2, nonblocking, RIT, CIT, NIT > &A,
+		const Vector< InputType1, nonblocking, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		const Vector< bool, nonblocking, Coords > empty_mask( 0 );
+		return mxv< descr >( u, empty_mask, A, v, ring, epilogue, phase );
+	}
+
 	/** @} */
 
 } // namespace grb
@@ -0,0 +1,55 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Provides allocators for the profile backend
+ */
+
+#ifndef _H_GRB_PROFILE_ALLOC
+#define _H_GRB_PROFILE_ALLOC
+
+
+namespace grb {
+
+	namespace utils {
+
+		namespace internal {
+
+			template<>
+			class Allocator< profile > {
+
+				private:
+
+					/** Prevent initialisation. */
+					Allocator();
+
+				public:
+
+					/** Refer to the allocation mechanism of the underlying backend. */
+					typedef Allocator< _GRB_WITH_PROFILE_USING >::functions functions;
+			};
+
+		} // namespace internal
+
+	}     // namespace utils
+
+} // namespace grb
+
+#endif
+
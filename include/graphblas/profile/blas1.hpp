@@ -0,0 +1,2106 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Provides the "level-1" primitives for the profile backend
+ */
+
+#ifndef _H_GRB_PROFILE_BLAS1
+#define _H_GRB_PROFILE_BLAS1
+
+#include <graphblas/vector.hpp>
+
+#include <graphblas/profile/init.hpp>
+
+
+namespace grb {
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class AddMonoid, class AnyOp,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC dot(
+		OutputType &z,
+		const Vector< InputType1, profile, Coords > &x,
+		const Vector< InputType2, profile, Coords > &y,
+		const AddMonoid &addMonoid = AddMonoid(),
+		const AnyOp &anyOp = AnyOp(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_monoid< AddMonoid >::value &&
+			grb::is_operator< AnyOp >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::DOT );
+		const RC ret = dot< descr >(
+			z, internal::getVector(x), internal::getVector(y),
+			addMonoid, anyOp, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * std::min( internal::profile::nonzeroes( x ),
+					internal::profile::nonzeroes( y ) ),
+				x, y
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename OutputType, typename InputType1, typename InputType2,
+		class Semiring, typename Coords
+	>
+	RC dot(
+		OutputType &z,
+		const Vector< InputType1, profile, Coords > &x,
+		const Vector< InputType2, profile, Coords > &y,
+		const Semiring &ring = Semiring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_semiring< Semiring >::value,
+		void >::type * const = nullptr
+	) {
+		// note: dispatches to the above dot-variant, which will handle the
+		// profiling.
+		return dot< descr >(
+			z, x, y,
+			ring.getAdditiveMonoid(), ring.getMultiplicativeOperator(),
+			phase
+		);
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename T, typename U, typename Coords
+	>
+	RC zip(
+		Vector< std::pair< T, U >, profile, Coords > &z,
+		const Vector< T, profile, Coords > &x,
+		const Vector< U, profile, Coords > &y,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< T >::value &&
+			!grb::is_object< U >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::ZIP );
+		const RC ret = zip< descr >(
+			internal::getVector(z),
+			internal::getVector(x), internal::getVector(y),
+			phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, x, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename T, typename U, typename Coords
+	>
+	RC unzip(
+		Vector< T, profile, Coords > &x,
+		Vector< U, profile, Coords > &y,
+		const Vector< std::pair< T, U >, profile, Coords > &in,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< T >::value &&
+			!grb::is_object< U >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::UNZIP );
+		const RC ret = unzip< descr >(
+			internal::getVector(x), internal::getVector(y), internal::getVector(in),
+			phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, y, in );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class OP,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< InputType1, profile, Coords > &x,
+		const Vector< InputType2, profile, Coords > &y,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_operator< OP >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z),
+			internal::getVector(x), internal::getVector(y),
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, x, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename InputType, typename IOType, typename Coords
+	>
+	RC foldr(
+		const Vector< InputType, profile, Coords > &x,
+		IOType &beta,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< InputType >::value &&
+			!grb::is_object< IOType >::value &&
+			grb::is_monoid< Monoid >::value, void
+		>::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::FOLDR );
+		const RC ret = foldr< descr >( internal::getVector(x), beta, monoid, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename InputType, typename MaskType, typename IOType, typename Coords
+	>
+	RC foldr(
+		const Vector< InputType, profile, Coords > &x,
+		const Vector< MaskType, profile, Coords > &m,
+		IOType &beta,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< InputType >::value &&
+			!grb::is_object< IOType >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return foldr< descr >( x, beta, monoid, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::FOLDR );
+		const RC ret = foldr< descr >(
+			internal::getVector(x), internal::getVector(m),
+			beta, monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, m );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename IOType, typename InputType, typename Coords
+	>
+	RC foldr(
+		const InputType &alpha,
+		Vector< IOType, profile, Coords > &y,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< InputType >::value &&
+			!grb::is_object< IOType >::value &&
+			grb::is_monoid< Monoid >::value, void
+		>::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::FOLDR );
+		const RC ret = foldr< descr >( alpha, internal::getVector(y), monoid, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		 class OP, typename IOType, typename InputType, typename Coords
+	>
+	RC foldr(
+		const InputType &alpha,
+		Vector< IOType, profile, Coords > &y,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< InputType >::value &&
+			!grb::is_object< IOType >::value &&
+			grb::is_operator< OP >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::FOLDR );
+		const RC ret = foldr< descr >( alpha, internal::getVector(y), op, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class OP,
+		typename IOType, typename InputType, typename Coords
+	>
+	RC foldr(
+		const Vector< InputType, profile, Coords > &x,
+		Vector< IOType, profile, Coords > &y,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_operator< OP >::value &&
+			!grb::is_object< InputType >::value &&
+			!grb::is_object< IOType >::value,
+		void >::type * = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::FOLDR );
+		const RC ret = foldr< descr >(
+			internal::getVector(x),
+			internal::getVector(y),
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, y );
+		}
+		return ret;
+	}
+
+	template<
+		 Descriptor descr = descriptors::no_operation, class OP,
+		 typename IOType, typename MaskType, typename InputType, typename Coords
+	>
+	RC foldr(
+		const Vector< InputType, profile, Coords > &x,
+		const Vector< MaskType, profile, Coords > &m,
+		Vector< IOType, profile, Coords > &y,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_operator< OP >::value &&
+			!grb::is_object< InputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< IOType >::value,
+		void >::type * = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return foldr< descr >( x, y, op, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::FOLDR );
+		const RC ret = foldr< descr >(
+			internal::getVector(x),
+			internal::getVector(m),
+			internal::getVector(y),
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, m, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Monoid, typename IOType, typename InputType, typename Coords
+	>
+	RC foldr(
+		const Vector< InputType, profile, Coords > &x,
+		Vector< IOType, profile, Coords > &y,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_monoid< Monoid >::value &&
+			!grb::is_object< InputType >::value &&
+			!grb::is_object< IOType >::value,
+		void >::type * = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::FOLDR );
+		const RC ret = foldr< descr >(
+			internal::getVector(x), internal::getVector(y),
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename IOType, typename MaskType, typename InputType,
+		typename Coords
+	>
+	RC foldr(
+		const Vector< InputType, profile, Coords > &x,
+		const Vector< MaskType, profile, Coords > &m,
+		Vector< IOType, profile, Coords > &y,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_monoid< Monoid >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType >::value &&
+			!grb::is_object< IOType >::value,
+		void >::type * = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return foldr< descr >( x, y, monoid, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::FOLDR );
+		const RC ret = foldr< descr >(
+			internal::getVector(x), internal::getVector(m),
+			internal::getVector(y), monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, m, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename InputType, typename IOType, typename Coords
+	>
+	RC foldl(
+		IOType &x,
+		const Vector< InputType, profile, Coords > &y,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::FOLDL );
+		const RC ret = foldl< descr >(
+			x, internal::getVector(y), monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename InputType, typename IOType, typename MaskType,
+		typename Coords
+	>
+	RC foldl(
+		IOType &x,
+		const Vector< InputType, profile, Coords > &y,
+		const Vector< MaskType, profile, Coords > &mask,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return foldl< descr >( x, y, monoid, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::FOLDL );
+		const RC ret = foldl< descr >(
+			x, internal::getVector(y), internal::getVector(mask),
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( y, mask );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Op, typename IOType, typename InputType, typename Coords
+	>
+	RC foldl(
+		Vector< IOType, profile, Coords > &x,
+		const InputType beta,
+		const Op &op = Op(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType >::value &&
+			grb::is_operator< Op >::value,
+		void >::type * = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::FOLDL );
+		const RC ret = foldl< descr >( internal::getVector(x), beta, op, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Op,
+		typename IOType, typename MaskType, typename InputType, typename Coords
+	>
+	RC foldl(
+		Vector< IOType, profile, Coords > &x,
+		const Vector< MaskType, profile, Coords > &m,
+		const InputType beta,
+		const Op &op = Op(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType >::value &&
+			grb::is_operator< Op >::value,
+		void >::type * = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return foldl< descr >( x, beta, op, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::FOLDL );
+		const RC ret = foldl< descr >(
+			internal::getVector(x), internal::getVector(m),
+			beta, op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, m );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename IOType, typename InputType, typename Coords
+	>
+	RC foldl(
+		Vector< IOType, profile, Coords > &x,
+		const InputType beta,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType >::value &&
+			grb::is_monoid< Monoid >::value, void
+		>::type * = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::FOLDL );
+		const RC ret = foldl< descr >( internal::getVector(x), beta, monoid, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x );
+		}
+		return ret;
+	}
+
+	template<
+		 Descriptor descr = descriptors::no_operation, class Monoid,
+		 typename IOType, typename MaskType, typename InputType,
+		 typename Coords
+	>
+	RC foldl(
+		Vector< IOType, profile, Coords > &x,
+		const Vector< MaskType, profile, Coords > &m,
+		const InputType &beta,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return foldl< descr >( x, beta, monoid, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::FOLDL );
+		const RC ret = foldl< descr >(
+			internal::getVector(x), internal::getVector(m),
+			beta, monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, m );
+		}
+		return ret;
+	}
+
+	template <
+		Descriptor descr = descriptors::no_operation,
+		class Monoid, typename IOType, typename InputType,
+		typename Coords
+	>
+	RC foldl(
+		Vector< IOType, profile, Coords > &x,
+		const Vector< InputType, profile, Coords > &y,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_monoid< Monoid >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType >::value,
+		void >::type * = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::FOLDL );
+		const RC ret = foldl< descr >(
+			internal::getVector(x), internal::getVector(y),
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, y );
+		}
+		return ret;
+	}
+
+	template <
+		Descriptor descr = descriptors::no_operation, class OP,
+		typename IOType, typename MaskType, typename InputType,
+		typename Coords
+	>
+	RC foldl(
+		Vector< IOType, profile, Coords > &x,
+		const Vector< MaskType, profile, Coords > &m,
+		const Vector< InputType, profile, Coords > &y,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_operator< OP >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType >::value, void
+		>::type * = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return foldl< descr >( x, y, op, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::FOLDL );
+		const RC ret = foldl< descr >(
+			internal::getVector(x), internal::getVector(m),
+			internal::getVector(y), op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, m, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename IOType, typename MaskType, typename InputType,
+		typename Coords
+	>
+	RC foldl(
+		Vector< IOType, profile, Coords > &x,
+		const Vector< MaskType, profile, Coords > &m,
+		const Vector< InputType, profile, Coords > &y,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_monoid< Monoid >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType >::value,
+		void >::type * = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return foldl< descr >( x, y, monoid, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::FOLDL );
+		const RC ret = foldl< descr >(
+			internal::getVector(x),internal::getVector(m),
+			internal::getVector(y), monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, m, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class OP, typename IOType, typename InputType,
+		typename Coords
+	>
+	RC foldl(
+		Vector< IOType, profile, Coords > &x,
+		const Vector< InputType, profile, Coords > &y,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_operator< OP >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType >::value,
+		void >::type * = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::FOLDL );
+		const RC ret = foldl< descr >(
+			internal::getVector(x), internal::getVector(y),
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( x, y );
+		}
+		return ret;
+	}
+
+	template< typename Func, typename DataType, typename Coords >
+	RC eWiseLambda(
+		const Func f, const Vector< DataType, profile, Coords > &x
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISELAMBDA );
+		const RC ret = eWiseLambda( f, internal::getVector(x) );
+		if( ret == SUCCESS ) {
+			measurement.record( x );
+		}
+		return ret;
+	}
+
+	template<
+		typename Func,
+		typename DataType1, typename DataType2, typename Coords,
+		typename... Args
+	>
+	RC eWiseLambda(
+		const Func f,
+		const Vector< DataType1, profile, Coords > &x,
+		const Vector< DataType2, profile, Coords > &y,
+		Args const &... args
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISELAMBDA );
+		const RC ret = eWiseLambda( f, internal::getVector(x),
+			internal::getVector(y), internal::getVector(args)... );
+		if( ret == SUCCESS ) {
+			measurement.record( x, y, args... );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class OP,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const InputType1 alpha,
+		const InputType2 beta,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_operator< OP >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), alpha, beta,
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename OutputType,
+		typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const InputType1 alpha,
+		const InputType2 beta,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), alpha, beta,
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class OP,
+		typename OutputType, typename MaskType,
+		typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &mask,
+		const InputType1 alpha,
+		const InputType2 beta,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_operator< OP >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return eWiseApply< descr >( z, alpha, beta, op, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), internal::getVector(mask),
+			alpha, beta,
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, mask );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename OutputType, typename MaskType,
+		typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &mask,
+		const InputType1 alpha,
+		const InputType2 beta,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return eWiseApply< descr >( z, alpha, beta, monoid, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), internal::getVector(mask),
+			alpha, beta,
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, mask );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class OP,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< InputType1, profile, Coords > &x,
+		const InputType2 beta,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value
+			&& !grb::is_object< InputType1 >::value
+			&& !grb::is_object< InputType2 >::value
+			&& grb::is_operator< OP >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), internal::getVector(x), beta,
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class OP, typename OutputType,
+		typename InputType1, typename InputType2, typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const InputType1 alpha,
+		const Vector< InputType2, profile, Coords > &y,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value
+			&& grb::is_operator< OP >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), alpha, internal::getVector(y),
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename OutputType, typename MaskType,
+		typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &mask,
+		const Vector< InputType1, profile, Coords > &x,
+		const InputType2 beta,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return eWiseApply< descr >( z, x, beta, monoid, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), internal::getVector(mask),
+			internal::getVector(x), beta,
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, mask, x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class OP,
+		typename OutputType, typename MaskType, typename InputType1,
+		typename InputType2, typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &mask,
+		const Vector< InputType1, profile, Coords > &x,
+		const InputType2 beta,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_operator< OP >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return eWiseApply< descr >( z, x, beta, op, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), internal::getVector(mask),
+			internal::getVector(x), beta,
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, mask, x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename OutputType, typename MaskType,
+		typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &mask,
+		const InputType1 alpha,
+		const Vector< InputType2, profile, Coords > &y,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return eWiseApply< descr >( z, alpha, y, monoid, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), internal::getVector(mask),
+			alpha, internal::getVector(y),
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, mask, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class OP,
+		typename OutputType, typename MaskType, typename InputType1,
+		typename InputType2, typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &mask,
+		const InputType1 alpha,
+		const Vector< InputType2, profile, Coords > &y,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_operator< OP >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return eWiseApply< descr >( z, alpha, y, op, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), internal::getVector(mask),
+			alpha, internal::getVector(y),
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, mask, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class OP,
+		typename OutputType, typename MaskType,
+		typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &mask,
+		const Vector< InputType1, profile, Coords > &x,
+		const Vector< InputType2, profile, Coords > &y,
+		const OP &op = OP(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_operator< OP >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return eWiseApply< descr >( z, x, y, op, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), internal::getVector(mask),
+			internal::getVector(x), internal::getVector(y),
+			op, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, mask, x, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< InputType1, profile, Coords > &x,
+		const InputType2 beta,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z),
+			internal::getVector(x), beta,
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const InputType1 alpha,
+		const Vector< InputType2, profile, Coords > &y,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z),
+			alpha, internal::getVector(y),
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename OutputType, typename MaskType,
+		typename InputType1, typename InputType2, typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &mask,
+		const Vector< InputType1, profile, Coords > &x,
+		const Vector< InputType2, profile, Coords > &y,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return eWiseApply< descr >( z, x, y, monoid, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z), internal::getVector(mask),
+			internal::getVector(x), internal::getVector(y),
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, mask, x, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Monoid,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename Coords
+	>
+	RC eWiseApply(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< InputType1, profile, Coords > &x,
+		const Vector< InputType2, profile, Coords > &y,
+		const Monoid &monoid = Monoid(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_monoid< Monoid >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getVector(z),
+			internal::getVector(x), internal::getVector(y),
+			monoid, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, x, y );
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename MaskType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const Vector< InputType1, profile, Coords > &a,
+		const Vector< InputType2, profile, Coords > &x,
+		const Vector< InputType3, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< MaskType >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMulAdd< descr >( z, a, x, y, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z), internal::getVector(m),
+			internal::getVector(a), internal::getVector(x), internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, m, a, x, y
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename MaskType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const Vector< InputType1, profile, Coords > &a,
+		const Vector< InputType2, profile, Coords > &x,
+		const InputType3 gamma,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< MaskType >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMulAdd< descr >( z, a, x, gamma, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z), internal::getVector(m),
+			internal::getVector(a), internal::getVector(x), gamma,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, m, a, x
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const InputType1 alpha,
+		const Vector< InputType2, profile, Coords > &x,
+		const Vector< InputType3, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z), alpha,
+			internal::getVector(x), internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, x, y
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring, typename InputType1,
+		typename InputType2, typename InputType3, typename OutputType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< InputType1, profile, Coords > &a,
+		const InputType2 chi,
+		const Vector< InputType3, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z),
+			internal::getVector(a), chi, internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, a, y
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename MaskType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const InputType1 alpha,
+		const Vector< InputType2, profile, Coords > &x,
+		const Vector< InputType3, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< MaskType >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMulAdd< descr >( z, alpha, x, y, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z), internal::getVector(m),
+			alpha, internal::getVector(x), internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, m, x, y
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename MaskType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const Vector< InputType1, profile, Coords > &a,
+		const InputType2 chi,
+		const Vector< InputType3, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< MaskType >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMulAdd< descr >( z, a, chi, y, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z), internal::getVector(m),
+			internal::getVector(a), chi, internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, m, a, y
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename MaskType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const Vector< InputType1, profile, Coords > &a,
+		const InputType2 beta,
+		const InputType3 gamma,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< MaskType >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMulAdd< descr >( z, a, beta, gamma, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z), internal::getVector(m),
+			internal::getVector(a), beta,  gamma,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, m, a
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename MaskType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const InputType1 alpha,
+		const Vector< InputType2, profile, Coords > &x,
+		const InputType3 gamma,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< MaskType >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMulAdd< descr >( z, alpha, x, gamma, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z), internal::getVector(m),
+			alpha, internal::getVector(x), gamma,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, m, x
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename OutputType, typename MaskType,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const InputType1 alpha,
+		const InputType2 beta,
+		const Vector< InputType3, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< MaskType >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMulAdd< descr >( z, alpha, beta, y, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z), internal::getVector(m),
+			alpha, beta, internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, m, y
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename OutputType, typename MaskType, typename InputType1,
+		typename InputType2, typename InputType3, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const InputType1 alpha,
+		const InputType2 beta,
+		const InputType3 gamma,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMulAdd< descr >( z, alpha, beta, gamma, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z), internal::getVector(m),
+			alpha, beta, gamma,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, m
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< InputType1, profile, Coords > &a,
+		const Vector< InputType2, profile, Coords > &x,
+		const InputType3 gamma,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z),
+			internal::getVector(a), internal::getVector(x), gamma,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, a, x
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< InputType1, profile, Coords > &a,
+		const InputType2 beta,
+		const InputType3 gamma,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z),
+			internal::getVector(a), beta, gamma,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, a
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const InputType1 alpha,
+		const Vector< InputType2, profile, Coords > &x,
+		const InputType3 gamma,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		 void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z),
+			alpha, internal::getVector(x), gamma,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, x
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename InputType3, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const InputType1 alpha,
+		const InputType2 beta,
+		const Vector< InputType3, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z),
+			alpha, beta, internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, y
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename InputType3, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const InputType1 alpha,
+		const InputType2 beta,
+		const InputType3 gamma,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z),
+			alpha, beta, gamma,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z
+			);
+		}
+		return ret;
+	}
+
+	/** \warning This function is deprecated */
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename InputType3,
+		typename OutputType, typename Coords
+	>
+	RC eWiseMulAdd(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< InputType1, profile, Coords > &a,
+		const Vector< InputType2, profile, Coords > &x,
+		const Vector< InputType3, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMULADD );
+		const RC ret = eWiseMulAdd< descr >(
+			internal::getVector(z),
+			internal::getVector(a), internal::getVector(x), internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				2 * internal::profile::nonzeroes( z ), z, a, x, y
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename OutputType,
+		typename Coords
+	>
+	RC eWiseMul(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< InputType1, profile, Coords > &x,
+		const Vector< InputType2, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMUL );
+		const RC ret = eWiseMul< descr >(
+			internal::getVector(z), internal::getVector(x), internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, x, y );
+		}
+		return ret;
+	}
+
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename OutputType,
+		typename Coords
+	>
+	RC eWiseMul(
+		Vector< OutputType, profile, Coords > &z,
+		const InputType1 alpha,
+		const Vector< InputType2, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMUL );
+		const RC ret = eWiseMul< descr >(
+			internal::getVector(z),
+			alpha, internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename OutputType,
+		typename Coords
+	>
+	RC eWiseMul(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< InputType1, profile, Coords > &x,
+		const InputType2 beta,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMUL );
+		const RC ret = eWiseMul< descr >(
+			internal::getVector(z),
+			internal::getVector(x), beta,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename OutputType,
+		typename Coords
+	>
+	RC eWiseMul(
+		Vector< OutputType, profile, Coords > &z,
+		const InputType1 alpha,
+		const InputType2 beta,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMUL );
+		const RC ret = eWiseMul< descr >(
+			internal::getVector(z),
+			alpha, beta,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename OutputType,
+		typename MaskType, typename Coords
+	>
+	RC eWiseMul(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const Vector< InputType1, profile, Coords > &x,
+		const Vector< InputType2, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< MaskType >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMul< descr >( z, x, y, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMUL );
+		const RC ret = eWiseMul< descr >(
+			internal::getVector(z),
+			internal::getVector(m), internal::getVector(x), internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, m, x, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename OutputType,
+		typename MaskType, typename Coords
+	>
+	RC eWiseMul(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const InputType1 alpha,
+		const Vector< InputType2, profile, Coords > &y,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< MaskType >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMul< descr >( z, alpha, y, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMUL );
+		const RC ret = eWiseMul< descr >(
+			internal::getVector(z), internal::getVector(m),
+			alpha, internal::getVector(y),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, m, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename OutputType,
+		typename MaskType, typename Coords
+	>
+	RC eWiseMul(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const Vector< InputType1, profile, Coords > &x,
+		const InputType2 beta,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< MaskType >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMul< descr >( z, x, beta, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMUL );
+		const RC ret = eWiseMul< descr >(
+			internal::getVector(z), internal::getVector(m),
+			internal::getVector(x), beta,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, m, x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename InputType1, typename InputType2, typename OutputType,
+		typename MaskType, typename Coords
+	>
+	RC eWiseMul(
+		Vector< OutputType, profile, Coords > &z,
+		const Vector< MaskType, profile, Coords > &m,
+		const InputType1 alpha,
+		const InputType2 beta,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< MaskType >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(m) ) == 0 ) {
+			return eWiseMul< descr >( z, alpha, beta, ring, phase );
+		}
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEMUL );
+		const RC ret = eWiseMul< descr >(
+			internal::getVector(z), internal::getVector(m),
+			alpha, beta,
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( z, m );
+		}
+		return ret;
+	}
+
+} // end namespace grb
+
+#endif
+
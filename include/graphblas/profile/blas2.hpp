@@ -0,0 +1,672 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Implements the BLAS-2 API for the profile backend
+ */
+
+#ifndef _H_GRB_PROFILE_BLAS2
+#define _H_GRB_PROFILE_BLAS2
+
+#include <graphblas/matrix.hpp>
+
+#include <graphblas/profile/init.hpp>
+
+
+namespace grb {
+
+	template<
+		Descriptor descr = descriptors::no_operation, class Ring,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3, typename Coords
+	>
+	RC vxm(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType3, profile, Coords > &mask,
+		const Vector< InputType1, profile, Coords > &v,
+		const Matrix< InputType2, profile > &A,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return vxm< descr >( u, v, A, ring, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::VXM );
+		const RC ret = vxm< descr >(
+			internal::getVector(u), internal::getVector(mask),
+			internal::getVector(v), internal::getMatrix(A),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, mask, v, A
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class AdditiveMonoid, class MultiplicativeOperator,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3, typename Coords
+	>
+	RC vxm(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType3, profile, Coords > &mask,
+		const Vector< InputType1, profile, Coords > &v,
+		const Matrix< InputType2, profile > &A,
+		const AdditiveMonoid &add = AdditiveMonoid(),
+		const MultiplicativeOperator &mul = MultiplicativeOperator(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_monoid< AdditiveMonoid >::value &&
+			grb::is_operator< MultiplicativeOperator >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			!std::is_same< InputType2, void >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return vxm< descr >( u, v, A, add, mul, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::VXM );
+		const RC ret = vxm< descr >(
+			internal::getVector(u), internal::getVector(mask),
+			internal::getVector(v), internal::getMatrix(A),
+			add, mul, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, mask, v, A
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring,
+		typename IOType = typename Ring::D4,
+		typename InputType1 = typename Ring::D1,
+		typename InputType2 = typename Ring::D2,
+		typename Coords
+	>
+	RC vxm(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType1, profile, Coords > &v,
+		const Matrix< InputType2, profile > &A,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::VXM );
+		const RC ret = vxm< descr >(
+			internal::getVector(u),
+			internal::getVector(v), internal::getMatrix(A),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, v, A
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring,
+		typename IOType = typename Ring::D4,
+		typename InputType1 = typename Ring::D1,
+		typename InputType2 = typename Ring::D2,
+		typename InputType3 = bool,
+		typename Coords
+	>
+	RC mxv(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType3, profile, Coords > &mask,
+		const Matrix< InputType2, profile > &A,
+		const Vector< InputType1, profile, Coords > &v,
+		const Ring &ring,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(mask) ) == 0 ) {
+			return mxv< descr >( u, A, v, ring, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::MXV );
+		const RC ret = mxv< descr >(
+			internal::getVector(u), internal::getVector(mask),
+			internal::getMatrix(A), internal::getVector(v),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, mask, A, v
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		bool output_may_be_masked = true,
+		bool input_may_be_masked = true,
+		class Ring,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3, typename InputType4, typename Coords
+	>
+	RC mxv(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType3, profile, Coords > &mask,
+		const Matrix< InputType2, profile > &A,
+		const Vector< InputType1, profile, Coords > &v,
+		const Vector< InputType4, profile, Coords > &v_mask,
+		const Ring &ring,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			!grb::is_object< InputType4 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(v_mask) ) == 0 ) {
+			return mxv< descr >( u, mask, A, v, ring, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::MXV );
+		const RC ret = mxv< descr >(
+			internal::getVector(u), internal::getVector(mask),
+			internal::getMatrix(A), internal::getVector(v), internal::getVector(v_mask),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, mask, A, v, v_mask
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		bool output_may_be_masked = true,
+		bool input_may_be_masked = true,
+		class AdditiveMonoid, class MultiplicativeOperator,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3, typename InputType4, typename Coords
+	>
+	RC mxv(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType3, profile, Coords > &mask,
+		const Matrix< InputType2, profile > &A,
+		const Vector< InputType1, profile, Coords > &v,
+		const Vector< InputType4, profile, Coords > &v_mask,
+		const AdditiveMonoid &add = AdditiveMonoid(),
+		const MultiplicativeOperator &mul = MultiplicativeOperator(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_monoid< AdditiveMonoid >::value &&
+			grb::is_operator< MultiplicativeOperator >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			!grb::is_object< InputType4 >::value &&
+			!std::is_same< InputType2, void >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(v_mask) ) == 0 ) {
+			return mxv< descr >( u, mask, A, v, add, mul, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::MXV );
+		const RC ret = mxv< descr >(
+			internal::getVector(u), internal::getVector(mask),
+			internal::getMatrix(A), internal::getVector(v), internal::getVector(v_mask),
+			add, mul, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, mask, A, v, v_mask
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring,
+		typename IOType = typename Ring::D4,
+		typename InputType1 = typename Ring::D1,
+		typename InputType2 = typename Ring::D2,
+		typename Coords
+	>
+	RC mxv(
+		Vector< IOType, profile, Coords > &u,
+		const Matrix< InputType2, profile > &A,
+		const Vector< InputType1, profile, Coords > &v,
+		const Ring &ring,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::MXV );
+		const RC ret = mxv< descr >(
+			internal::getVector(u),
+			internal::getMatrix(A), internal::getVector(v),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, A, v
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class AdditiveMonoid, class MultiplicativeOperator,
+		typename IOType, typename InputType1, typename InputType2, typename Coords
+	>
+	RC mxv(
+		Vector< IOType, profile, Coords > &u,
+		const Matrix< InputType2, profile > &A,
+		const Vector< InputType1, profile, Coords > &v,
+		const AdditiveMonoid &add = AdditiveMonoid(),
+		const MultiplicativeOperator &mul = MultiplicativeOperator(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_monoid< AdditiveMonoid >::value &&
+			grb::is_operator< MultiplicativeOperator >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!std::is_same< InputType2, void >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::MXV );
+		const RC ret = mxv< descr >(
+			internal::getVector(u),
+			internal::getMatrix(A), internal::getVector(v),
+			add, mul, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, A, v
+			);
+		}
+		return ret;
+	}
+
+	/** \internal Uses a direct implementation. */
+	template<
+		typename Func, typename DataType
+	>
+	RC eWiseLambda(
+		const Func f,
+		const Matrix< DataType, profile > &A
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISELAMBDA );
+		const RC ret = eWiseLambda( f, internal::getMatrix(A) );
+		if( ret == SUCCESS ) {
+			measurement.record( A );
+		}
+		return ret;
+	}
+
+	/** \internal Uses a direct implementation. */
+	template<
+		typename Func,
+		typename DataType1, typename DataType2,
+		typename Coords, typename... Args
+	>
+	RC eWiseLambda(
+		const Func f,
+		const Matrix< DataType1, profile > &A,
+		const Vector< DataType2, profile, Coords > &x,
+		Args... args
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISELAMBDA );
+		const RC ret = eWiseLambda( f, internal::getMatrix(A),
+			internal::getVector(x), internal::getVector(args)... );
+		if( ret == SUCCESS ) {
+			measurement.record( A, x, args... );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		bool output_may_be_masked = true,
+		bool input_may_be_masked = true,
+		class Ring,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3, typename InputType4, typename Coords
+	>
+	RC vxm(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType3, profile, Coords > &mask,
+		const Vector< InputType1, profile, Coords > &v,
+		const Vector< InputType4, profile, Coords > &v_mask,
+		const Matrix< InputType2, profile > &A,
+		const Ring &ring = Ring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			!grb::is_object< InputType4 >::value &&
+			grb::is_semiring< Ring >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(v_mask) ) == 0 ) {
+			return vxm< descr >( u, mask, v, A, ring, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::VXM );
+		const RC ret = vxm< descr >(
+			internal::getVector(u), internal::getVector(mask),
+			internal::getVector(v), internal::getVector(v_mask), internal::getMatrix(A),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, mask, v, v_mask, A
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		bool output_may_be_masked = true,
+		bool input_may_be_masked = true,
+		class AdditiveMonoid, class MultiplicativeOperator,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3, typename InputType4, typename Coords
+	>
+	RC vxm(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType3, profile, Coords > &mask,
+		const Vector< InputType1, profile, Coords > &v,
+		const Vector< InputType4, profile, Coords > &v_mask,
+		const Matrix< InputType2, profile > &A,
+		const AdditiveMonoid &add = AdditiveMonoid(),
+		const MultiplicativeOperator &mul = MultiplicativeOperator(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_monoid< AdditiveMonoid >::value &&
+			grb::is_operator< MultiplicativeOperator >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< InputType3 >::value &&
+			!grb::is_object< InputType4 >::value &&
+			!std::is_same< InputType2, void >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( internal::getVector(v_mask) ) == 0 ) {
+			return vxm< descr >( u, mask, v, A, add, mul, phase );
+		}
+		internal::profile::Measurement measurement( internal::profile::VXM );
+		const RC ret = vxm< descr >(
+			internal::getVector(u), internal::getVector(mask),
+			internal::getVector(v), internal::getVector(v_mask), internal::getMatrix(A),
+			add, mul, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, mask, v, v_mask, A
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class AdditiveMonoid, class MultiplicativeOperator,
+		typename IOType, typename InputType1, typename InputType2, typename Coords
+	>
+	RC vxm(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType1, profile, Coords > &v,
+		const Matrix< InputType2, profile > &A,
+		const AdditiveMonoid &add = AdditiveMonoid(),
+		const MultiplicativeOperator &mul = MultiplicativeOperator(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_monoid< AdditiveMonoid >::value &&
+			grb::is_operator< MultiplicativeOperator >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!std::is_same< InputType2, void >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::VXM );
+		const RC ret = vxm< descr >(
+			internal::getVector(u),
+			internal::getVector(v), internal::getMatrix(A),
+			add, mul, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record(
+				internal::profile::multiplyFlops( A, v ), u, v, A
+			);
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType, typename RIT, typename CIT, typename NIT
+	>
+	RC triangularAnalysis(
+		TriangularSchedule &schedule,
+		const Matrix< InputType, profile, RIT, CIT, NIT > &T,
+		const Triangle triangle,
+		const Diagonal diagonal = NON_UNIT
+	) {
+		// the schedule is not an ALP container, hence the analysis is not recorded
+		return triangularAnalysis< descr >(
+			schedule, internal::getMatrix( T ), triangle, diagonal );
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring,
+		class Minus = operators::subtract< typename Ring::D4 >,
+		class Divide = operators::divide< typename Ring::D4 >,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC triangularSolve(
+		Vector< IOType, profile, Coords > &x,
+		const Matrix< InputType2, profile, RIT, CIT, NIT > &T,
+		const Vector< InputType1, profile, Coords > &b,
+		const TriangularSchedule &schedule,
+		const Ring &ring = Ring(),
+		const Minus &minus = Minus(),
+		const Divide &divide = Divide(),
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::TRIANGULAR_SOLVE );
+		const RC ret = triangularSolve< descr >(
+			internal::getVector(x), internal::getMatrix(T), internal::getVector(b),
+			schedule, ring, minus, divide
+		);
+		if( ret == SUCCESS ) {
+			measurement.record( 2 * internal::profile::nonzeroes( T ), x, T, b );
+		}
+		return ret;
+	}
+
+	/**
+	 * \internal
+	 * Composes the multiplication with the folds the epilogue translates to, so
+	 * that each of these operations is profiled separately.
+	 * \endinternal
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC vxm(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType3, profile, Coords > &mask,
+		const Vector< InputType1, profile, Coords > &v,
+		const Matrix< InputType2, profile, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		if( !internal::epilogueFits( epilogue, size( u ) ) ) {
+			return MISMATCH;
+		}
+		RC ret = vxm< descr >( u, mask, v, A, ring, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			ret = internal::foldEpilogue< descr >( u, mask, epilogue );
+		}
+		return ret;
+	}
+
+	/** \internal Delegates to the masked variant */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC vxm(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType1, profile, Coords > &v,
+		const Matrix< InputType2, profile, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		const Vector< bool, profile, Coords > empty_mask( 0 );
+		return vxm< descr >( u, empty_mask, v, A, ring, epilogue, phase );
+	}
+
+	/** \internal See the above #grb::vxm with an epilogue */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC mxv(
+		Vector< IOType, profile, Coords > &u,
+		const Vector< InputType3, profile, Coords > &mask,
+		const Matrix< InputType2, profile, RIT, CIT, NIT > &A,
+		const Vector< InputType1, profile, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		if( !internal::epilogueFits( epilogue, size( u ) ) ) {
+			return MISMATCH;
+		}
+		RC ret = mxv< descr >( u, mask, A, v, ring, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			ret = internal::foldEpilogue< descr >( u, mask, epilogue );
+		}
+		return ret;
+	}
+
+	/** \internal Delegates to the masked variant */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC mxv(
+		Vector< IOType, profile, Coords > &u,
+		const Matrix< InputType2, profile, RIT, CIT, NIT > &A,
+		const Vector< InputType1, profile, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		const Vector< bool, profile, Coords > empty_mask( 0 );
+		return mxv< descr >( u, empty_mask, A, v, ring, epilogue, phase );
+	}
+
+} // end namespace grb
+
+#endif
+
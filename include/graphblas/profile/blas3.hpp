@@ -0,0 +1,246 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Implements the BLAS-3 API for the profile backend
+ */
+
+#ifndef _H_GRB_PROFILE_BLAS3
+#define _H_GRB_PROFILE_BLAS3
+
+#include <graphblas/phase.hpp>
+#include <graphblas/matrix.hpp>
+
+#include <graphblas/profile/init.hpp>
+
+
+namespace grb {
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename RIT, typename CIT, typename NIT,
+		class MulMonoid
+	>
+	RC eWiseApply(
+		Matrix< OutputType, profile, RIT, CIT, NIT > &C,
+		const Matrix< InputType1, profile > &A,
+		const Matrix< InputType2, profile > &B,
+		const MulMonoid &mulmono,
+		const Phase phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_monoid< MulMonoid >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getMatrix( C ),
+			internal::getMatrix( A ), internal::getMatrix( B ),
+			mulmono, phase
+		);
+		if( ret == SUCCESS ) {
+			measurement.record( C, A, B );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = grb::descriptors::no_operation,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename RIT, typename CIT, typename NIT,
+		class Operator
+	>
+	RC eWiseApply(
+		Matrix< OutputType, profile, RIT, CIT, NIT > &C,
+		const Matrix< InputType1, profile, RIT, CIT, NIT > &A,
+		const Matrix< InputType2, profile, RIT, CIT, NIT > &B,
+		const Operator &mulOp,
+		const Phase phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_operator< Operator >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::EWISEAPPLY );
+		const RC ret = eWiseApply< descr >(
+			internal::getMatrix( C ),
+			internal::getMatrix( A ), internal::getMatrix( B ),
+			mulOp, phase
+		);
+		if( ret == SUCCESS ) {
+			measurement.record( C, A, B );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation, typename OutputType,
+		typename InputType1, typename InputType2,
+		typename RIT, typename CIT, typename NIT,
+		class Semiring
+	>
+	RC mxm(
+		Matrix< OutputType, profile, RIT, CIT, NIT > &C,
+		const Matrix< InputType1, profile, RIT, CIT, NIT > &A,
+		const Matrix< InputType2, profile, RIT, CIT, NIT > &B,
+		const Semiring &ring = Semiring(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_semiring< Semiring >::value, void
+		>::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::MXM );
+		const RC ret = mxm< descr >( internal::getMatrix( C ),
+			internal::getMatrix( A ), internal::getMatrix( B ),
+			ring, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( 2 * internal::profile::nonzeroes( C ), C, A, B );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = grb::descriptors::no_operation,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename RIT, typename CIT, typename NIT,
+		class Operator, class Monoid
+	>
+	RC mxm(
+		Matrix< OutputType, profile, RIT, CIT, NIT > &C,
+		const Matrix< InputType1, profile, RIT, CIT, NIT > &A,
+		const Matrix< InputType2, profile, RIT, CIT, NIT > &B,
+		const Monoid &addM,
+		const Operator &mulOp,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			grb::is_operator< Operator >::value &&
+			grb::is_monoid< Monoid >::value, void
+		>::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::MXM );
+		const RC ret = mxm< descr >(
+			internal::getMatrix( C ),
+			internal::getMatrix( A ), internal::getMatrix( B ),
+			addM, mulOp, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( 2 * internal::profile::nonzeroes( C ), C, A, B );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType1, typename InputType2, typename OutputType,
+		typename RIT, typename CIT, typename NIT,
+		typename Coords, class Operator
+	>
+	RC outer(
+		Matrix< OutputType, profile, RIT, CIT, NIT > &A,
+		const Vector< InputType1, profile, Coords > &u,
+		const Vector< InputType2, profile, Coords > &v,
+		const Operator &mul = Operator(),
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_operator< Operator >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value &&
+			!grb::is_object< OutputType >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::OUTER );
+		const RC ret = outer< descr >(
+			internal::getMatrix( A ),
+			internal::getVector( u ), internal::getVector( v ),
+			mul, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( A, u, v );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename InputType3, typename RIT, typename CIT, typename NIT,
+		typename Coords
+	>
+	RC zip(
+		Matrix< OutputType, profile, RIT, CIT, NIT > &A,
+		const Vector< InputType1, profile, Coords > &x,
+		const Vector< InputType2, profile, Coords > &y,
+		const Vector< InputType3, profile, Coords > &z,
+		const Phase &phase = EXECUTE
+	) {
+		internal::profile::Measurement measurement( internal::profile::ZIP );
+		const RC ret = zip< descr >(
+			internal::getMatrix( A ),
+			internal::getVector( x ), internal::getVector( y ),
+			internal::getVector( z ),
+			phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( A, x, y, z );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType1, typename InputType2,
+		typename RIT, typename CIT, typename NIT,
+		typename Coords
+	>
+	RC zip(
+		Matrix< void, profile, RIT, CIT, NIT > &A,
+		const Vector< InputType1, profile, Coords > &x,
+		const Vector< InputType2, profile, Coords > &y,
+		const Phase &phase = EXECUTE
+	) {
+		internal::profile::Measurement measurement( internal::profile::ZIP );
+		const RC ret = zip< descr >(
+			internal::getMatrix( A ),
+			internal::getVector( x ), internal::getVector( y ),
+			phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( A, x, y );
+		}
+		return ret;
+	}
+
+} // end namespace grb
+
+#endif
+
@@ -0,0 +1,386 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Provides the I/O primitives for the profile backend
+ */
+
+#include <graphblas/config.hpp>
+
+#include <graphblas/profile/init.hpp>
+
+
+namespace grb {
+
+	// input:
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType, typename fwd_iterator, typename Coords,
+		class Dup = operators::right_assign< InputType >
+	>
+	RC buildVector(
+		Vector< InputType, profile, Coords > &x,
+		fwd_iterator start, const fwd_iterator end,
+		const IOMode mode, const Dup &dup = Dup()
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::BUILD_VECTOR );
+		const RC ret = buildVector<descr>(
+			internal::getVector(x), start, end, mode, dup
+		);
+		if( ret == SUCCESS ) {
+			measurement.record( 0, x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType, typename fwd_iterator1, typename fwd_iterator2,
+		typename Coords, class Dup = operators::right_assign< InputType >
+	>
+	RC buildVector(
+		Vector< InputType, profile, Coords > &x,
+		fwd_iterator1 ind_start, const fwd_iterator1 ind_end,
+		fwd_iterator2 val_start, const fwd_iterator2 val_end,
+		const IOMode mode,
+		const Dup &dup = Dup()
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::BUILD_VECTOR );
+		const RC ret = buildVector< descr >(
+			internal::getVector(x), ind_start, ind_end, val_start, val_end, mode, dup
+		);
+		if( ret == SUCCESS ) {
+			measurement.record( 0, x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType, typename fwd_iterator
+	>
+	RC buildMatrixUnique(
+		Matrix< InputType, profile > &A,
+		fwd_iterator start,
+		const fwd_iterator end,
+		const IOMode mode
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::BUILD_MATRIX_UNIQUE );
+		const RC ret = buildMatrixUnique< descr >(
+			internal::getMatrix(A), start, end, mode
+		);
+		if( ret == SUCCESS ) {
+			measurement.record( 0, A );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename DataType,
+		typename T, typename Coords
+	>
+	RC setElement(
+		Vector< DataType, profile, Coords > &x,
+		const T val,
+		const size_t i,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< DataType >::value &&
+			!grb::is_object< T >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement(
+			internal::profile::SET_ELEMENT );
+		const RC ret = setElement< descr >(
+			internal::getVector( x ), val, i, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( 0 );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename DataType, typename Coords,
+		typename T
+	>
+	RC set(
+		Vector< DataType, profile, Coords > &x, const T val,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< DataType >::value &&
+			!grb::is_object< T >::value,
+		void >::type * const = nullptr
+	) {
+		internal::profile::Measurement measurement( internal::profile::SET );
+		const RC ret = set< descr >( internal::getVector( x ), val, phase );
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( 0, x );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename DataType, typename MaskType, typename T,
+		typename Coords
+	>
+	RC set(
+		Vector< DataType, profile, Coords > &x,
+		const Vector< MaskType, profile, Coords > &m,
+		const T val,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< DataType >::value &&
+			!grb::is_object< T >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( m ) == 0 ) { return set< descr >( x, val, phase ); }
+		internal::profile::Measurement measurement( internal::profile::SET );
+		const RC ret = set< descr >(
+			internal::getVector(x), internal::getVector(m),
+			val, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( 0, x, m );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename OutputType, typename MaskType, typename InputType,
+		typename Coords
+	>
+	RC set(
+		Vector< OutputType, profile, Coords > &x,
+		const Vector< MaskType, profile, Coords > &mask,
+		const Vector< InputType, profile, Coords > &y,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			!grb::is_object< OutputType >::value &&
+			!grb::is_object< MaskType >::value &&
+			!grb::is_object< InputType >::value,
+		void >::type * const = nullptr
+	) {
+		if( size( mask ) == 0 ) { return set< descr >( x, y, phase ); }
+		internal::profile::Measurement measurement( internal::profile::SET );
+		const RC ret = set< descr >(
+			internal::getVector(x),
+			internal::getVector(mask), internal::getVector(y),
+			phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( 0, x, mask, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename OutputType, typename InputType, typename Coords
+	>
+	RC set(
+		Vector< OutputType, profile, Coords > &x,
+		const Vector< InputType, profile, Coords > &y,
+		const Phase &phase = EXECUTE
+	) {
+		internal::profile::Measurement measurement( internal::profile::SET );
+		const RC ret = set< descr >(
+			internal::getVector(x), internal::getVector(y), phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( 0, x, y );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename OutputType, typename InputType,
+		typename RIT, typename CIT, typename NIT
+	>
+	RC set(
+		Matrix< OutputType, profile, RIT, CIT, NIT > &C,
+		const Matrix< InputType, profile, RIT, CIT, NIT > &A,
+		const Phase &phase = EXECUTE
+	) {
+		internal::profile::Measurement measurement( internal::profile::SET );
+		const RC ret = set< descr >(
+			internal::getMatrix( C ), internal::getMatrix( A ), phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( 0, C, A );
+		}
+		return ret;
+	}
+
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename OutputType, typename InputType1, typename InputType2,
+		typename RIT, typename CIT, typename NIT
+	>
+	RC set(
+		Matrix< OutputType, profile, RIT, CIT, NIT > &C,
+		const Matrix< InputType1, profile, RIT, CIT, NIT > &A,
+		const InputType2 &val,
+		const Phase &phase = EXECUTE
+	) {
+		internal::profile::Measurement measurement( internal::profile::SET );
+		const RC ret = set< descr >(
+			internal::getMatrix( C ), internal::getMatrix( A ),
+			val, phase
+		);
+		if( ret == SUCCESS && phase == EXECUTE ) {
+			measurement.record( 0, C, A );
+		}
+		return ret;
+	}
+
+	template< typename DataType, typename Coords >
+	RC clear( Vector< DataType, profile, Coords > &x ) {
+		internal::profile::Measurement measurement( internal::profile::CLEAR );
+		const RC ret = clear( internal::getVector( x ) );
+		if( ret == SUCCESS ) {
+			measurement.record( 0 );
+		}
+		return ret;
+	}
+
+	template< typename InputType, typename RIT, typename CIT, typename NIT >
+	RC clear( Matrix< InputType, profile, RIT, CIT, NIT > &A ) noexcept {
+		internal::profile::Measurement measurement( internal::profile::CLEAR );
+		const RC ret = clear( internal::getMatrix(A) );
+		if( ret == SUCCESS ) {
+			measurement.record( 0 );
+		}
+		return ret;
+	}
+
+	// getters:
+
+	template< typename DataType, typename Coords >
+	size_t size( const Vector< DataType, profile, Coords > &x ) {
+		return size (internal::getVector(x));
+	}
+
+	template< typename InputType >
+	size_t nrows( const Matrix< InputType, profile > &A ) noexcept {
+		return nrows(internal::getMatrix(A));
+	}
+
+	template< typename InputType >
+	size_t ncols( const Matrix< InputType, profile > &A ) noexcept {
+		return ncols(internal::getMatrix(A));
+	}
+
+	template< typename DataType, typename Coords >
+	size_t capacity( const Vector< DataType, profile, Coords > &x ) noexcept {
+		return capacity(internal::getVector( x ));
+	}
+
+	template< typename DataType >
+	size_t capacity( const Matrix< DataType, profile > &A ) noexcept {
+		return capacity(internal::getMatrix( A ));
+	}
+
+	template< typename DataType, typename Coords >
+	size_t nnz( const Vector< DataType, profile, Coords > &x ) noexcept {
+		return nnz( internal::getVector( x ) );
+	}
+
+	template< typename InputType >
+	size_t nnz( const Matrix< InputType, profile > &A ) noexcept {
+		return nnz(internal::getMatrix(A));
+	}
+
+	template< typename InputType, typename Coords >
+	uintptr_t getID( const Vector< InputType, profile, Coords > &x ) {
+		return getID(internal::getVector( x ));
+	}
+
+	template< typename InputType >
+	uintptr_t getID( const Matrix< InputType, profile > &A ) {
+		return getID(internal::getMatrix( A ));
+	}
+
+	// resizers:
+
+	template< typename InputType, typename Coords >
+	RC resize(
+		Vector< InputType, profile, Coords > &x,
+		const size_t new_nz
+	) noexcept {
+		internal::profile::Measurement measurement( internal::profile::RESIZE );
+		const RC ret = resize( internal::getVector( x ), new_nz );
+		if( ret == SUCCESS ) {
+			measurement.record( 0 );
+		}
+		return ret;
+	}
+
+	template< typename InputType >
+	RC resize(
+		Matrix< InputType, profile > &A,
+		const size_t new_nz
+	) noexcept {
+		internal::profile::Measurement measurement( internal::profile::RESIZE );
+		const RC ret = resize( internal::getMatrix(A), new_nz );
+		if( ret == SUCCESS ) {
+			measurement.record( 0 );
+		}
+		return ret;
+	}
+
+	// nonblocking I/O:
+
+	template<>
+	RC wait< profile >();
+
+	/** \internal Dispatch to base wait implementation */
+	template<
+		typename InputType, typename Coords,
+		typename ... Args
+	>
+	RC wait(
+		const Vector< InputType, profile, Coords > &x,
+		const Args &... args
+	) {
+		(void) x;
+		return wait( args... );
+	}
+
+	/** \internal Dispatch to base wait implementation */
+	template< typename InputType, typename... Args >
+	RC wait(
+		const Matrix< InputType, profile > &A,
+		const Args &... args
+	) {
+		(void) A;
+		return wait( args... );
+	}
+
+} // namespace grb
+
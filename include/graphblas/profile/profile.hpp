@@ -0,0 +1,385 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Provides mechanisms to time and count the work of primitives called by ALP
+ * programs.
+ */
+
+#ifndef _H_GRB_PROFILE_STATE
+#define _H_GRB_PROFILE_STATE
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <utility>
+#include <ostream>
+#include <algorithm>
+#include <type_traits>
+
+#include <time.h> //clock_gettime, CLOCK_MONOTONIC, struct timespec
+
+#include <graphblas/config.hpp>
+#include <graphblas/properties.hpp>
+#include <graphblas/base/vector.hpp>
+#include <graphblas/base/matrix.hpp>
+
+
+namespace grb {
+
+	namespace internal {
+
+		namespace profile {
+
+			/** \internal The primitives that are profiled. */
+			enum Primitive {
+				BUILD_VECTOR,
+				BUILD_MATRIX_UNIQUE,
+				SET_ELEMENT,
+				SET,
+				CLEAR,
+				RESIZE,
+				WAIT,
+				DOT,
+				ZIP,
+				UNZIP,
+				EWISEAPPLY,
+				EWISEMUL,
+				EWISEMULADD,
+				EWISELAMBDA,
+				FOLDL,
+				FOLDR,
+				MXV,
+				VXM,
+				TRIANGULAR_SOLVE,
+				MXM,
+				OUTER
+			};
+
+			/** \internal The number of profiled primitives. */
+			constexpr size_t numPrimitives = OUTER + 1;
+
+			/** \internal @returns The name of the given primitive. */
+			std::string toString( const enum Primitive primitive ) noexcept;
+
+			/**
+			 * \internal
+			 * The counters that are accumulated for calls to a primitive.
+			 *
+			 * All counts but #calls and #time are estimates that are derived from the
+			 * containers a call was given; see #Measurement.
+			 * \endinternal
+			 */
+			struct Counters {
+
+				/** \internal The number of successful calls. */
+				size_t calls;
+
+				/** \internal The accumulated wall-clock time, in nanoseconds. */
+				size_t time;
+
+				/** \internal The accumulated number of nonzeroes touched. */
+				size_t nonzeroes;
+
+				/** \internal The accumulated number of bytes touched. */
+				size_t bytes;
+
+				/** \internal The accumulated number of operator applications. */
+				size_t flops;
+
+				/** \internal Adds the counts of \a other to these counts. */
+				Counters & operator+=( const Counters &other ) noexcept {
+					calls += other.calls;
+					time += other.time;
+					nonzeroes += other.nonzeroes;
+					bytes += other.bytes;
+					flops += other.flops;
+					return *this;
+				}
+
+			};
+
+			/**
+			 * \internal
+			 * Collects the counters of all profiled calls, aggregated per primitive
+			 * and per call site.
+			 *
+			 * Thread-safe.
+			 * \endinternal
+			 */
+			class Profiler {
+
+				private:
+
+					/** \internal The key to aggregate counters by. */
+					typedef std::pair< enum Primitive, const void * > Key;
+
+					/** \internal Guards #counters. */
+					mutable std::mutex mutex;
+
+					/** \internal The aggregated counters. */
+					std::map< Key, Counters > counters;
+
+
+				public:
+
+					/**
+					 * \internal
+					 * Adds the counters of a single call.
+					 *
+					 * @param[in] primitive The primitive that was called.
+					 * @param[in] site      The address of the call site.
+					 * @param[in] call      The counters of the call.
+					 * \endinternal
+					 */
+					void record(
+						const enum Primitive primitive, const void * const site,
+						const Counters &call
+					);
+
+					/**
+					 * \internal
+					 * @returns The counters of the given primitive, summed over all call
+					 *          sites.
+					 * \endinternal
+					 */
+					Counters total( const enum Primitive primitive ) const;
+
+					/**
+					 * \internal
+					 * Prints a table of all counters to the given stream.
+					 *
+					 * The table holds one row per primitive and call site, followed by one
+					 * row per primitive with its totals. Call sites are resolved to the
+					 * nearest symbol if the executable exports one, and otherwise printed
+					 * as an offset into the binary that contains them.
+					 * \endinternal
+					 */
+					void report( std::ostream &out ) const;
+
+					/** \internal Resets all counters. */
+					void clear();
+
+			};
+
+			/** \internal The type of value stored in a container, as a byte count. */
+			template< typename T >
+			constexpr size_t valueSize() {
+				return std::is_void< T >::value ? 0 : sizeof(
+					typename std::conditional< std::is_void< T >::value, char, T >::type
+				);
+			}
+
+			/**
+			 * \internal
+			 * @returns The number of nonzeroes in \a x.
+			 *
+			 * For nonblocking underlying backends, this function returns the size of
+			 * \a x instead, since querying the nonzero count would force the
+			 * execution of any pending pipeline and thus alter what is measured.
+			 * \endinternal
+			 */
+			template< typename T, typename Coords >
+			size_t nonzeroes( const Vector< T, grb::profile, Coords > &x ) noexcept {
+				return Properties< grb::_GRB_WITH_PROFILE_USING >::isNonblockingExecution
+					? size( x )
+					: nnz( x );
+			}
+
+			/** \internal @returns The number of nonzeroes in \a A. */
+			template< typename T, typename RIT, typename CIT, typename NIT >
+			size_t nonzeroes(
+				const Matrix< T, grb::profile, RIT, CIT, NIT > &A
+			) noexcept {
+				return nnz( A );
+			}
+
+			/**
+			 * \internal
+			 * @returns The estimated number of bytes of \a x touched by a primitive.
+			 *
+			 * This assumes each nonzero is accessed once, together with its index if
+			 * \a x is sparse.
+			 * \endinternal
+			 */
+			template< typename T, typename Coords >
+			size_t footprint( const Vector< T, grb::profile, Coords > &x ) noexcept {
+				const size_t nz = nonzeroes( x );
+				const size_t index = nz < size( x ) ? sizeof( size_t ) : 0;
+				return nz * ( valueSize< T >() + index );
+			}
+
+			/**
+			 * \internal
+			 * @returns The estimated number of bytes of \a A touched by a primitive.
+			 *
+			 * This assumes each nonzero is accessed once in a single compressed
+			 * storage, together with the offset array of that storage.
+			 * \endinternal
+			 */
+			template< typename T, typename RIT, typename CIT, typename NIT >
+			size_t footprint(
+				const Matrix< T, grb::profile, RIT, CIT, NIT > &A
+			) noexcept {
+				return nonzeroes( A ) * ( valueSize< T >() + sizeof( CIT ) ) +
+					( nrows( A ) + 1 ) * sizeof( NIT );
+			}
+
+			/**
+			 * \internal
+			 * @returns The estimated number of additions and multiplications of a
+			 *          multiplication of \a A with \a v.
+			 *
+			 * Only those nonzeroes of \a A that meet a nonzero of \a v incur work;
+			 * this assumes the nonzeroes of \a v are uniformly distributed.
+			 * \endinternal
+			 */
+			template<
+				typename T, typename RIT, typename CIT, typename NIT,
+				typename U, typename Coords
+			>
+			size_t multiplyFlops(
+				const Matrix< T, grb::profile, RIT, CIT, NIT > &A,
+				const Vector< U, grb::profile, Coords > &v
+			) noexcept {
+				const size_t n = size( v );
+				if( n == 0 ) {
+					return 0;
+				}
+				return static_cast< size_t >(
+					2.0 * static_cast< double >( nonzeroes( A ) ) *
+					static_cast< double >( nonzeroes( v ) ) / static_cast< double >( n )
+				);
+			}
+
+			/**
+			 * \internal
+			 * Measures a single call to a primitive.
+			 *
+			 * A measurement starts at construction. Wrappers call #record after the
+			 * underlying primitive returned successfully, which stops the clock and
+			 * estimates the work from the containers passed to it. The measurement is
+			 * added to the global profiler at destruction. Calls that were not
+			 * recorded, such as failing ones or those in the resize phase, are not
+			 * profiled.
+			 *
+			 * The call site is the return address of the constructor, which is
+			 * defined out of line so that it cannot be inlined itself. Since the
+			 * primitive wrappers normally are inlined into user code, this yields
+			 * the address of the call to the primitive; otherwise, all calls to the
+			 * same wrapper instance share a single call site.
+			 *
+			 * \note For nonblocking underlying backends, time is attributed to the
+			 *       primitive that triggers the execution of a pipeline, rather than
+			 *       to the primitives that make up the pipeline.
+			 * \endinternal
+			 */
+			class Measurement {
+
+				private:
+
+					/** \internal The primitive that is measured. */
+					const enum Primitive primitive;
+
+					/** \internal The address of the call site. */
+					const void * site;
+
+					/** \internal The start time. */
+					struct timespec start;
+
+					/** \internal The counters of this call. */
+					Counters call;
+
+					/** \internal Whether #record was called. */
+					bool recorded;
+
+					/** \internal Stops the clock. */
+					void stop() noexcept;
+
+					/** \internal Base case of the container accounting. */
+					void account() noexcept {}
+
+					/** \internal Adds the work on \a first and \a rest to #call. */
+					template< typename Container, typename... Containers >
+					void account(
+						const Container &first, const Containers &... rest
+					) noexcept {
+						const size_t nz = nonzeroes( first );
+						call.nonzeroes += nz;
+						call.bytes += footprint( first );
+						call.flops = std::max( call.flops, nz );
+						account( rest... );
+					}
+
+
+				public:
+
+					/** \internal Starts measuring a call to \a primitive. */
+					Measurement( const enum Primitive primitive ) noexcept;
+
+					/** \internal Adds the measurement to the global profiler. */
+					~Measurement();
+
+					/**
+					 * \internal
+					 * Stops the clock and accounts for the given containers.
+					 *
+					 * The number of operator applications is estimated as the nonzero count
+					 * of the largest container.
+					 * \endinternal
+					 */
+					template<
+						typename Container, typename... Containers,
+						typename std::enable_if<
+							!std::is_arithmetic< Container >::value, void
+						>::type * = nullptr
+					>
+					void record(
+						const Container &first, const Containers &... rest
+					) noexcept {
+						stop();
+						account( first, rest... );
+					}
+
+					/**
+					 * \internal
+					 * Stops the clock and accounts for the given containers, with a
+					 * primitive-specific estimate of the number of operator applications.
+					 * \endinternal
+					 */
+					template< typename... Containers >
+					void record(
+						const size_t flops, const Containers &... containers
+					) noexcept {
+						stop();
+						account( containers... );
+						call.flops = flops;
+					}
+
+			};
+
+		} // end namespace grb::internal::profile
+
+	} // end namespace grb::internal
+
+} // end namespace grb
+
+#endif // end _H_GRB_PROFILE_STATE
+
@@ -0,0 +1,263 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Provides the vector container for the profile backend
+ */
+
+#ifndef _H_GRB_PROFILE_VECTOR
+#define _H_GRB_PROFILE_VECTOR
+
+#include <graphblas/config.hpp>
+#include <graphblas/base/pinnedvector.hpp>
+
+
+namespace grb {
+
+	template< typename T, typename RIT, typename CIT, typename NIT >
+	class Matrix< T, profile, RIT, CIT, NIT >;
+
+	namespace internal {
+
+		namespace profile {
+			typedef grb::internal::Coordinates<
+				grb::config::IMPLEMENTATION< grb::profile >::coordinatesBackend()
+			> Coordinates;
+		}
+
+		template< typename T >
+		Vector< T, _GRB_WITH_PROFILE_USING, typename profile::Coordinates > &
+		getVector(
+			Vector< T, grb::profile, typename profile::Coordinates > &
+		);
+
+		template< typename T >
+		const Vector< T, _GRB_WITH_PROFILE_USING, typename profile::Coordinates > &
+		getVector(
+			const Vector< T, grb::profile, typename profile::Coordinates > &x
+		);
+
+		template< typename T>
+		inline const T * getRaw(
+			const Vector<
+				T, grb::profile,
+				typename internal::profile::Coordinates
+			> &x
+		);
+
+		template< typename T>
+		inline T * getRaw(
+			Vector< T, grb::profile, typename internal::profile::Coordinates > &x
+		);
+
+	}
+
+	template< typename T >
+	class Vector< T, profile, internal::profile::Coordinates > {
+
+		template< typename A >
+		friend Vector<
+			A, _GRB_WITH_PROFILE_USING,
+			internal::profile::Coordinates
+		> & internal::getVector(
+			Vector< A, grb::profile, internal::profile::Coordinates > &
+		);
+
+		template< typename A >
+		friend const Vector<
+			A, _GRB_WITH_PROFILE_USING,
+			internal::profile::Coordinates
+		> & internal::getVector(
+			const Vector< A, grb::profile, internal::profile::Coordinates > &
+		);
+
+		friend class PinnedVector< T, profile >;
+
+
+		private:
+
+			/** \internal My own type */
+			typedef Vector< T, profile, internal::profile::Coordinates > SelfType;
+
+			/** \internal Simply use an underlying implementation */
+			typedef Vector<
+				T, grb::_GRB_WITH_PROFILE_USING,
+				internal::profile::Coordinates
+			> MyVectorType;
+
+			/** \internal Simply wrap around underlying backend */
+			MyVectorType vector;
+
+
+		public:
+
+			typedef typename MyVectorType::const_iterator const_iterator;
+
+			Vector( const size_t n ) : vector( n ) {
+#ifdef _DEBUG
+				std::cout << "Vector (profile) constructor\n";
+#endif
+			}
+
+			Vector() : Vector( 0 ) {
+#ifdef _DEBUG
+				std::cout << "Vector (profile) default constructor\n";
+#endif
+			}
+
+			Vector( const SelfType &x ) : vector( x.vector ) {
+#ifdef _DEBUG
+				std::cout << "Vector (profile) copy constructor\n";
+#endif
+			}
+
+			Vector( SelfType &&x ) noexcept {
+#ifdef _DEBUG
+				std::cout << "Vector (profile) move constructor\n";
+#endif
+				vector = std::move( x.vector );
+			}
+
+			Vector( const size_t n, const size_t nz ) : vector( n, nz ) {
+#ifdef _DEBUG
+				std::cout << "Vector (profile) capacity constructor\n";
+#endif
+			}
+
+			~Vector() {
+#ifdef _DEBUG
+				std::cout << "Vector (profile) destructor\n";
+#endif
+			}
+
+			SelfType & operator=( const SelfType &x ) {
+#ifdef _DEBUG
+				std::cout << "Vector (profile) copy assignment\n";
+#endif
+				vector = x.vector;
+				return *this;
+			}
+
+			SelfType & operator=( SelfType &&x ) noexcept {
+#ifdef _DEBUG
+				std::cout << "Vector (profile) move assignment\n";
+#endif
+				vector = std::move( x.vector );
+				return *this;
+			}
+
+			template< Backend spmd_backend = reference >
+			const_iterator cbegin(
+				const size_t s = 0, const size_t P = 1
+			) const {
+				return vector.cbegin( s, P );
+			}
+
+			template< Backend spmd_backend = reference >
+			const_iterator cend(
+				const size_t s = 0, const size_t P = 1
+			) const {
+				return vector.cend( s, P );
+			}
+
+			template< Backend spmd_backend = reference >
+			const_iterator begin(
+				const size_t s = 0, const size_t P = 1
+			) const {
+				return vector.begin( s, P );
+			}
+
+			template< Backend spmd_backend = reference >
+			const_iterator end(
+				const size_t s = 0, const size_t P = 1
+			) const {
+				return vector.end( s, P );
+			}
+
+			T & operator[]( const size_t i ) {
+				return vector[ i ];
+			}
+
+			T & operator[]( const size_t i ) const {
+				return vector[ i ];
+			}
+			/**
+			 * Non-standard data accessor for debug purposes.
+			 *
+			 * \warning Do not use this fucntion.
+			 *
+			 * The user promises to never write to this data when GraphBLAS can operate
+			 * on it. The user understands that data read out may be subject to incoming
+			 * changes caused by preceding GraphBLAS calls.
+			 *
+			 * \warning This function is only defined for the reference and profile backends--
+			 *          thus switching backends may cause your code to not compile.
+			 *
+			 * @return A const reference to the raw data this vector contains.
+			 *
+			 * \note This function is used internally for testing purposes.
+			 */
+			T * raw() const {
+				return vector.raw();
+			}
+
+	};
+
+	namespace internal {
+
+		template< typename T >
+		Vector<
+			T, _GRB_WITH_PROFILE_USING,
+			internal::profile::Coordinates
+		> & getVector(
+			Vector< T, grb::profile, internal::profile::Coordinates > &x
+		) {
+			return x.vector;
+		}
+
+		template< typename T >
+		const Vector<
+			T, _GRB_WITH_PROFILE_USING,
+			internal::profile::Coordinates
+		> & getVector(
+			const Vector< T, grb::profile, internal::profile::Coordinates > &x
+		) {
+			return x.vector;
+		}
+
+		template< typename T>
+		inline const T * getRaw(
+			const Vector< T, grb::profile, internal::profile::Coordinates > &x
+		) {
+			return getRaw(getVector<T>(x));
+		};
+
+		template< typename T>
+		inline T * getRaw(
+			Vector< T, grb::profile, internal::profile::Coordinates > &x
+		) {
+			return getRaw(getVector<T>(x));
+		};
+
+	}
+
+}
+
+#endif
+
@@ -26,6 +26,7 @@
 #include <iostream>
 
 #include <graphblas/base/alloc.hpp>
+#include <graphblas/utils/pool.hpp>
 
 #include "config.hpp"
 
@@ -42,6 +43,18 @@ namespace grb {
 			 *   -# numa_alloc_interleaved()
 			 * system calls.
 			 *
+			 * Memory allocated in #grb::config::ALLOC_MODE::LOCAL mode also uses
+			 * posix_memalign(), but is placed by first touch; see #firstTouch.
+			 *
+			 * Memory allocated in #grb::config::ALLOC_MODE::HUGEPAGE mode is mapped
+			 * via mmap() and backed by huge pages where possible. Areas smaller than
+			 * a huge page are allocated as aligned memory instead. If
+			 * #grb::utils::ContainerPool::hugePages holds, large aligned and
+			 * interleaved memory is allocated in this mode as well.
+			 *
+			 * Aligned, interleaved, and huge-page memory is taken from the
+			 * #grb::utils::ContainerPool.
+			 *
 			 * When one of these functions are not available a different allocation
 			 * mechanism must be selected.
 			 */
@@ -74,22 +87,45 @@ namespace grb {
 						}
 						// non-trivial case, first compute size
 						const size_t size = elements * sizeof( T );
-						// check if the region is supposed to be shared or not
-						if( mode == grb::config::ALLOC_MODE::INTERLEAVED ) {
+						// check if the region is supposed to be placed by first touch or not
+						if( mode == grb::config::ALLOC_MODE::ALIGNED ||
+							mode == grb::config::ALLOC_MODE::INTERLEAVED ||
+							mode == grb::config::ALLOC_MODE::HUGEPAGE
+						) {
 #ifdef _GRB_NO_LIBNUMA
-							return UNSUPPORTED;
-#else
+							if( mode == grb::config::ALLOC_MODE::INTERLEAVED ) {
+								return UNSUPPORTED;
+							}
+#endif
+							utils::ContainerPool &pool = utils::ContainerPool::instance();
+							// areas smaller than a huge page would only waste memory
+							utils::ContainerPool::Kind kind = utils::ContainerPool::ALIGNED;
+							if( size >= grb::config::MEMORY_POOL::hugePageSize() && (
+								mode == grb::config::ALLOC_MODE::HUGEPAGE || pool.hugePages()
+							) ) {
+								kind = utils::ContainerPool::HUGEPAGE;
+							} else if( mode == grb::config::ALLOC_MODE::INTERLEAVED ) {
+								kind = utils::ContainerPool::INTERLEAVED;
+							}
+#ifdef _DEBUG
+							if( mode == grb::config::ALLOC_MODE::HUGEPAGE &&
+								kind != utils::ContainerPool::HUGEPAGE
+							) {
+								std::cerr << "Info: a huge-page area of " << size << " bytes is "
+									<< "smaller than a huge page; allocating aligned memory "
+									<< "instead\n";
+							}
+#endif
 							// allocate
-							pointer = static_cast< T * >( numa_alloc_interleaved( size ) );
+							pointer = static_cast< T * >( pool.allocate( size, kind ) );
 							// check for error
-							if( pointer == NULL ) {
+							if( pointer == nullptr ) {
 								return OUTOFMEM;
 							}
 							// record appropriate deleter
-							deleter = utils::AutoDeleter< T >( pointer, size );
-#endif
-						} else if( mode == grb::config::ALLOC_MODE::ALIGNED ) {
-							// allocate
+							deleter = utils::AutoDeleter< T >( pointer, size, kind );
+						} else if( mode == grb::config::ALLOC_MODE::LOCAL ) {
+							// allocate without touching, hence bypassing the pool
 							void * new_pointer = NULL;
 							const int prc = posix_memalign(
 								&new_pointer, grb::config::CACHE_LINE_SIZE::value(), size );
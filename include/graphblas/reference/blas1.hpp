@@ -691,9 +691,8 @@ namespace grb {
 					sizeof( typename Coords::ArrayType ) +
 					MaskWordSize< descr, MaskType >::value;
 				const size_t fullLoop = masked
-					? 2 * sizeof( typename Coords::ArrayType ) * n +
-						sizeof( MaskType ) * nnz( mask )
-					: sizeof( typename Coords::ArrayType ) * n;
+					? 2 * Coords::arraySize( n ) + sizeof( MaskType ) * nnz( mask )
+					: Coords::arraySize( n );
 				const size_t vectorLoop = masked
 					? threeWs * nnz( to_fold )
 					: sizeof( typename Coords::StackType ) * nnz( to_fold );
@@ -798,17 +797,23 @@ namespace grb {
 					}
 				}
 			} else {
+				// sweep over the bitmap instead of the stack if there are many nonzeroes
+				const bool bitmap = coors.representation() == Coords::BITMAP;
+				const size_t loop_size = bitmap ? n : coors.nonzeroes();
 #ifdef _H_GRB_REFERENCE_OMP_BLAS1
 				#pragma omp parallel
 				{
 					size_t start, end;
-					config::OMP::localRange( start, end, 0, coors.nonzeroes() );
+					config::OMP::localRange( start, end, 0, loop_size );
 #else
 					const size_t start = 0;
-					const size_t end = n;
+					const size_t end = loop_size;
 #endif
 					for( size_t i = start; i < end; ++i ) {
-						const size_t index = coors.index( i );
+						if( bitmap && !coors.assigned( i ) ) {
+							continue;
+						}
+						const size_t index = bitmap ? i : coors.index( i );
 						if( left ) {
 							(void) foldl< descr >( x[ index ], scalar, op );
 						} else {
@@ -1218,8 +1223,10 @@ namespace grb {
 #endif
 							}, to_fold, fold_into );
 					}
-				} else if( !masked && nnz( to_fold ) == n ) {
-					// use sparsity structure of fold_into for this eWiseFold
+				} else if( !masked && !monoid && nnz( to_fold ) == n ) {
+					// use sparsity structure of fold_into for this eWiseFold. This does not
+					// apply to monoids, which should also assign the unassigned elements of
+					// fold_into
 					if( left ) {
 #ifdef _DEBUG
 						std::cout << "fold_from_vector_to_vector_generic: using eWiseLambda, "
@@ -1297,6 +1304,10 @@ namespace grb {
 					IOType * __restrict__ const fi_raw = internal::getRaw( fold_into );
 					auto &fi = internal::getCoordinates( fold_into );
 					const auto &tf = internal::getCoordinates( to_fold );
+					// sweep over the bitmap of to_fold instead of over its stack if it has
+					// many nonzeroes
+					const bool bitmap = tf.representation() != Coords::SPARSE;
+					const size_t loop_size = bitmap ? n : tf.nonzeroes();
 #ifdef _H_GRB_REFERENCE_OMP_BLAS1
  #ifdef _DEBUG
 					std::cout << "\tfold_from_vector_to_vector_generic, "
@@ -1305,13 +1316,16 @@ namespace grb {
 					#pragma omp parallel
 					{
 						size_t start, end;
-						config::OMP::localRange( start, end, 0, tf.nonzeroes() );
+						config::OMP::localRange( start, end, 0, loop_size );
 						internal::Coordinates< reference >::Update local_update =
 							fi.EMPTY_UPDATE();
 						const size_t maxAsyncAssigns = fi.maxAsyncAssigns();
 						size_t asyncAssigns = 0;
 						for( size_t k = start; k < end; ++k ) {
-							const size_t i = tf.index( k );
+							if( bitmap && !tf.assigned( k ) ) {
+								continue;
+							}
+							const size_t i = bitmap ? k : tf.index( k );
 							if( masked && !internal::getCoordinates( *m ).template mask< descr >(
 									i,
 									internal::getRaw( *m )
@@ -1376,8 +1390,11 @@ namespace grb {
 #ifdef _DEBUG
 					std::cout << "\tin sequential version...\n";
 #endif
-					for( size_t k = 0; k < tf.nonzeroes(); ++k ) {
-						const size_t i = tf.index( k );
+					for( size_t k = 0; k < loop_size; ++k ) {
+						if( bitmap && !tf.assigned( k ) ) {
+							continue;
+						}
+						const size_t i = bitmap ? k : tf.index( k );
 						if( masked && !internal::getCoordinates( *m ).template mask< descr >(
 								i,
 								internal::getRaw( *m )
@@ -9684,8 +9701,12 @@ namespace grb {
 	template< typename Func, typename DataType, typename Coords >
 	RC eWiseMap( const Func f, Vector< DataType, reference, Coords > &x ) {
 		const auto &coors = internal::getCoordinates( x );
-		if( coors.isDense() ) {
-			// vector is distributed sequentially, so just loop over it
+		const typename Coords::Representation representation =
+			coors.representation();
+		if( representation != Coords::SPARSE ) {
+			// vector is distributed sequentially, so just loop over it, skipping
+			// unassigned elements if it is not dense
+			const bool dense = representation == Coords::DENSE;
 #ifdef _H_GRB_REFERENCE_OMP_BLAS1
 			#pragma omp parallel
 			{
@@ -9696,6 +9717,9 @@ namespace grb {
 				const size_t end = coors.size();
 #endif
 				for( size_t i = start; i < end; ++i ) {
+					if( !dense && !coors.assigned( i ) ) {
+						continue;
+					}
 					// apply the lambda
 					DataType &xval = internal::getRaw( x )[ i ];
 					xval = f( xval );
@@ -9768,8 +9792,12 @@ namespace grb {
 		std::cout << "Info: entering eWiseLambda function on vectors.\n";
 #endif
 		const auto &coors = internal::getCoordinates( x );
-		if( coors.isDense() ) {
-			// vector is distributed sequentially, so just loop over it
+		const typename Coords::Representation representation =
+			coors.representation();
+		if( representation != Coords::SPARSE ) {
+			// vector is distributed sequentially, so just loop over it, skipping
+			// unassigned elements if it is not dense
+			const bool dense = representation == Coords::DENSE;
 #ifdef _H_GRB_REFERENCE_OMP_BLAS1
 			#pragma omp parallel
 			{
@@ -9780,6 +9808,9 @@ namespace grb {
 				const size_t end = coors.size();
 #endif
 				for( size_t i = start; i < end; ++i ) {
+					if( !dense && !coors.assigned( i ) ) {
+						continue;
+					}
 					// apply the lambda
 					f( i );
 				}
@@ -28,6 +28,7 @@
 #define _H_GRB_REFERENCE_BLAS2
 
 #include <limits>
+#include <vector>
 #include <algorithm>
 #include <type_traits>
 
@@ -41,6 +42,7 @@
 #include "coordinates.hpp"
 #include "forward.hpp"
 #include "matrix.hpp"
+#include "numa.hpp"
 #include "vector.hpp"
 
 #ifdef _DEBUG
@@ -158,8 +160,117 @@ namespace grb {
 				}
 
 		};
+
+		/**
+		 * \internal
+		 * Applies an epilogue to individual output elements during an SpMV.
+		 *
+		 * Each specialisation is constructed from the corresponding epilogue in
+		 * #grb::epilogues, and defines a member function <tt>apply( x, i )</tt>
+		 * that applies the epilogue to the output element \a x at index \a i.
+		 * \endinternal
+		 */
+		template< class Epilogue >
+		class EpilogueKernel;
+
+		/** \internal Specialisation for the empty epilogue. */
+		template<>
+		class EpilogueKernel< epilogues::None > {
+
+			public:
+
+				EpilogueKernel( const epilogues::None & ) {}
+
+				template< typename IOType >
+				inline void apply( IOType &, const size_t ) const {}
+
+		};
+
+		/** \internal Specialisation for folding in a scalar. */
+		template< typename T, class OP >
+		class EpilogueKernel< epilogues::Scalar< T, OP > > {
+
+			private:
+
+				const epilogues::Scalar< T, OP > &epilogue;
+
+
+			public:
+
+				EpilogueKernel( const epilogues::Scalar< T, OP > &_epilogue ) :
+					epilogue( _epilogue )
+				{}
+
+				template< typename IOType >
+				inline void apply( IOType &x, const size_t ) const {
+					(void) foldl( x, epilogue.value(), epilogue.op() );
+				}
+
+		};
+
+		/** \internal Specialisation for a sequence of epilogues. */
+		template< class First, class Second >
+		class EpilogueKernel< epilogues::Sequence< First, Second > > {
+
+			private:
+
+				const EpilogueKernel< First > first;
+
+				const EpilogueKernel< Second > second;
+
+
+			public:
+
+				EpilogueKernel( const epilogues::Sequence< First, Second > &epilogue ) :
+					first( epilogue.first() ), second( epilogue.second() )
+				{}
+
+				template< typename IOType >
+				inline void apply( IOType &x, const size_t i ) const {
+					first.apply( x, i );
+					second.apply( x, i );
+				}
+
+		};
 #endif
 
+		/**
+		 * \internal Specialisation for folding in the elements of a vector.
+		 * Output elements for which the vector has no element remain unmodified.
+		 */
+		template< typename T, typename Coords, class OP >
+		class EpilogueKernel<
+			epilogues::Elementwise< Vector< T, reference, Coords >, OP >
+		> {
+
+			private:
+
+				const Coords &coordinates;
+
+				const T * __restrict__ const values;
+
+				const OP op;
+
+
+			public:
+
+				EpilogueKernel(
+					const epilogues::Elementwise< Vector< T, reference, Coords >, OP > &epilogue
+				) :
+					coordinates( internal::getCoordinates( epilogue.vector() ) ),
+					values( internal::getRaw( epilogue.vector() ) ),
+					op( epilogue.op() )
+				{}
+
+				template< typename IOType >
+				inline void apply( IOType &x, const size_t i ) const {
+					if( coordinates.assigned( i ) ) {
+						(void) foldl( x, values[ i ], op );
+					}
+				}
+
+		};
+
 		/**
 		 * \internal This is the specialisation where the SpMV is guaranteed to have
 		 * been called using a pure semiring. The below-defined apply hence does
@@ -274,6 +385,9 @@ namespace grb {
 		 * For the latter three functions, an \a std::function must be given with
 		 * exactly the signature <tt>size_t f(size_t index)</tt>.
 		 *
+		 * @param[in] epilogue The epilogue kernel to apply to the output element
+		 *                     once it is final.
+		 *
 		 * The value for \a rc shall only be modified if the call to this function
 		 * did not succeed.
 		 *
@@ -290,7 +404,8 @@ namespace grb {
 			typename IOType, typename InputType1, typename InputType2,
 			typename InputType3, typename InputType4,
 			typename Coords,
-			typename RowColType, typename NonzeroType
+			typename RowColType, typename NonzeroType,
+			class Epilogue
 		>
 		inline void vxm_inner_kernel_gather(
 			RC &rc,
@@ -316,7 +431,8 @@ namespace grb {
 			const Multiplication &mul,
 			const std::function< size_t( size_t ) > &src_local_to_global,
 			const std::function< size_t( size_t ) > &src_global_to_local,
-			const std::function< size_t( size_t ) > &dst_local_to_global
+			const std::function< size_t( size_t ) > &dst_local_to_global,
+			const Epilogue &epilogue
 		) {
 			constexpr bool add_identity = descr & descriptors::add_identity;
 			constexpr bool dense_hint = descr & descriptors::dense;
@@ -356,6 +472,7 @@ namespace grb {
 					assigned( destination_index ) &&
 				destination_element != add.template getIdentity< IOType >()
 			) {
+				epilogue.apply( destination_element, destination_index );
 				return;
 			}
 
@@ -565,6 +682,13 @@ namespace grb {
 #endif
 				}
 			}
+
+			// the output element is now final, so apply any epilogue
+			if( dense_hint ||
+				internal::getCoordinates( destination_vector ).assigned( destination_index )
+			) {
+				epilogue.apply( destination_element, destination_index );
+			}
 		}
 
 		/**
@@ -768,6 +892,49 @@ namespace grb {
 			}
 		}
 
+		/**
+		 * Applies an epilogue to all output elements of an SpMV that are selected
+		 * by the output mask. This is used whenever the output elements are not
+		 * final until all inner kernels have completed, i.e., whenever a
+		 * scattering kernel was used.
+		 */
+		template<
+			Descriptor descr, bool masked,
+			typename IOType, typename InputType3,
+			typename Coords, class Epilogue
+		>
+		void vxm_epilogue_pass(
+			Vector< IOType, reference, Coords > &u,
+			const Vector< InputType3, reference, Coords > &mask,
+			const EpilogueKernel< Epilogue > &epilogue
+		) {
+			const auto &coordinates = internal::getCoordinates( u );
+			const InputType3 * __restrict__ const z = internal::getRaw( mask );
+			IOType * __restrict__ const y = internal::getRaw( u );
+			const size_t nz = coordinates.nonzeroes();
+#ifdef _H_GRB_REFERENCE_OMP_BLAS2
+			#pragma omp parallel
+			{
+				size_t start, end;
+				config::OMP::localRange( start, end, 0, nz );
+#else
+				const size_t start = 0;
+				const size_t end = nz;
+#endif
+				for( size_t k = start; k < end; ++k ) {
+					const size_t i = coordinates.index( k );
+					if( masked && !internal::getCoordinates( mask ).template
+						mask< descr >( i, z )
+					) {
+						continue;
+					}
+					epilogue.apply( y[ i ], i );
+				}
+#ifdef _H_GRB_REFERENCE_OMP_BLAS2
+			}
+#endif
+		}
+
 		/**
 		 * Sparse matrix--vector multiplication \f$ u = vA \f$.
 		 *
@@ -865,7 +1032,8 @@ namespace grb {
 			typename IOType, typename InputType1, typename InputType2,
 			typename InputType3, typename InputType4,
 			typename RIT, typename CIT, typename NIT,
-			typename Coords
+			typename Coords,
+			class Epilogue = epilogues::None
 		>
 		RC vxm_generic(
 			Vector< IOType, reference, Coords > &u,
@@ -879,7 +1047,8 @@ namespace grb {
 			const std::function< size_t( size_t ) > &row_l2g,
 			const std::function< size_t( size_t ) > &row_g2l,
 			const std::function< size_t( size_t ) > &col_l2g,
-			const std::function< size_t( size_t ) > &col_g2l
+			const std::function< size_t( size_t ) > &col_g2l,
+			const Epilogue &epilogue = Epilogue()
 		) {
 			// type sanity checking
 			NO_CAST_ASSERT( ( descr > internal::MAX_DESCRIPTOR_VALUE ||
@@ -985,6 +1154,15 @@ namespace grb {
 				}
 			}
 
+			// check epilogue
+			if( !internal::epilogueFits( epilogue, m ) ) {
+#ifdef _DEBUG
+				std::cout << "Mismatch of epilogue operand size versus output size ( "
+					<< m << " )\n";
+#endif
+				return MISMATCH;
+			}
+
 			// handle resize phase
 			if( phase == RESIZE ) {
 				return SUCCESS;
@@ -996,6 +1174,7 @@ namespace grb {
 			const InputType3 * __restrict__ const z = internal::getRaw( mask );
 			const InputType4 * __restrict__ const vm = internal::getRaw( v_mask );
 			IOType * __restrict__ const y = internal::getRaw( u );
+			const EpilogueKernel< Epilogue > kernel_epilogue( epilogue );
 
 			// first handle trivial cases
 			if( internal::getCoordinates( v ).nonzeroes() == 0 ||
@@ -1026,6 +1205,9 @@ namespace grb {
 						}
 					}
 				}
+				if( Epilogue::active ) {
+					vxm_epilogue_pass< descr, masked >( u, mask, kernel_epilogue );
+				}
 #ifdef _DEBUG
 				std::cout << s << ": trivial operation requested; exiting without any ops. "
 					<< "Input nonzeroes: " << internal::getCoordinates( v ).nonzeroes()
@@ -1080,11 +1262,25 @@ namespace grb {
 			}
 #endif
 
+			// whether the scattering kernels should sweep over all input indices
+			// rather than over the stack of the effective input mask. This is the case
+			// whenever the latter has sufficiently many nonzeroes, even if the dense
+			// descriptor was not given.
+			const bool input_sweep = dense_hint ||
+				eim.representation() != Coords::SPARSE;
+
 			// global return code. This will be updated by each thread from within a
 			// critical section.
 			RC global_rc = SUCCESS;
 
+			// whether a scattering kernel was used, in which case output elements
+			// are only final after all kernel calls have completed
+			bool scattered = false;
+
 #ifdef _H_GRB_REFERENCE_OMP_BLAS2
+			// copies of the input vector on each NUMA node, for the gathering kernels
+			internal::InputReplicas< InputType1 > replicas;
+
 			#pragma omp parallel
 			{
 				internal::Coordinates< reference >::Update local_update =
@@ -1135,7 +1331,8 @@ namespace grb {
 						#pragma omp single
 						{
 #endif
-							if( !input_masked && (dense_hint || nnz( v ) == ncols( A )) ) {
+							scattered = true;
+							if( !input_masked && input_sweep ) {
 								// start u=vA^T using CCS
 #ifdef _DEBUG
 								std::cout << s << ": in full CCS variant (scatter)\n";
@@ -1217,6 +1414,16 @@ namespace grb {
 						// end u=vA^T using CCS
 					} else {
 						// start u=vA^T using CRS
+#ifdef _H_GRB_REFERENCE_OMP_BLAS2
+						// the gathering kernels read the input vector from the local NUMA
+						// node, if replicated
+						const InputType1 * __restrict__ const x_local = replicas.replicate(
+							x, internal::getCoordinates( v ).size(),
+							internal::getCoordinates( v ).representation() != Coords::SPARSE
+						);
+#else
+						const InputType1 * __restrict__ const x_local = x;
+#endif
 						// matrix = &(A.CRS);
 						// TODO internal issue #193
 						if( !masked || (descr & descriptors::invert_mask) ) {
@@ -1239,10 +1446,11 @@ namespace grb {
 #ifdef _H_GRB_REFERENCE_OMP_BLAS2
 									local_update, asyncAssigns,
 #endif
-									u, y[ i ], i, v, x,
+									u, y[ i ], i, v, x_local,
 									nrows( A ), internal::getCRS( A ), nnz( A ),
 									mask, z, v_mask, vm,
-									add, mul, row_l2g, col_l2g, col_g2l
+									add, mul, row_l2g, col_l2g, col_g2l,
+									kernel_epilogue
 								);
 #ifdef _H_GRB_REFERENCE_OMP_BLAS2
 								if( asyncAssigns == maxAsyncAssigns ) {
@@ -1285,10 +1493,11 @@ namespace grb {
 #ifdef _H_GRB_REFERENCE_OMP_BLAS2
 									local_update, asyncAssigns,
 #endif
-									u, y[ i ], i, v, x,
+									u, y[ i ], i, v, x_local,
 									nrows( A ), internal::getCRS( A ), nnz( A ),
 									mask, z, v_mask, vm,
-									add, mul, row_l2g, col_l2g, col_g2l
+									add, mul, row_l2g, col_l2g, col_g2l,
+									kernel_epilogue
 								);
 #ifdef _H_GRB_REFERENCE_OMP_BLAS2
 								if( asyncAssigns == maxAsyncAssigns ) {
@@ -1340,8 +1549,9 @@ namespace grb {
 						#pragma omp single
 						{
 #endif
+							scattered = true;
 							// start u=vA using CRS, sequential implementation only
-							if( !dense_hint && nnz( v ) < nrows( A ) ) {
+							if( !input_sweep ) {
 #ifdef _DEBUG
 								std::cout << "\t looping over nonzeroes of the input vector or mask "
 									<< "(whichever has fewer nonzeroes), calling scatter for each\n";
@@ -1421,6 +1631,16 @@ namespace grb {
 						// end u=vA using CRS
 					} else {
 						// start u=vA using CCS
+#ifdef _H_GRB_REFERENCE_OMP_BLAS2
+						// the gathering kernels read the input vector from the local NUMA
+						// node, if replicated
+						const InputType1 * __restrict__ const x_local = replicas.replicate(
+							x, internal::getCoordinates( v ).size(),
+							internal::getCoordinates( v ).representation() != Coords::SPARSE
+						);
+#else
+						const InputType1 * __restrict__ const x_local = x;
+#endif
 						assert( !crs_only );
 #ifdef _DEBUG
 						std::cout << s << ": in column-major vector times matrix variant (u=vA)\n"
@@ -1449,11 +1669,12 @@ namespace grb {
 									local_update, asyncAssigns,
 #endif
 									u, y[ j ], j,
-									v, x,
+									v, x_local,
 									nrows( A ), internal::getCCS( A ), nnz( A ),
 									mask, z, v_mask, vm,
 									add, mul,
-									row_l2g, row_g2l, col_l2g
+									row_l2g, row_g2l, col_l2g,
+									kernel_epilogue
 								);
 #ifdef _H_GRB_REFERENCE_OMP_BLAS2
 								if( asyncAssigns == maxAsyncAssigns ) {
@@ -1486,10 +1707,11 @@ namespace grb {
 #ifdef _H_GRB_REFERENCE_OMP_BLAS2
 									local_update, asyncAssigns,
 #endif
-									u, y[ j ], j, v, x,
+									u, y[ j ], j, v, x_local,
 									nrows( A ), internal::getCCS( A ), nnz( A ),
 									mask, z, v_mask, vm,
-									add, mul, row_l2g, row_g2l, col_l2g
+									add, mul, row_l2g, row_g2l, col_l2g,
+									kernel_epilogue
 								);
 #ifdef _H_GRB_REFERENCE_OMP_BLAS2
 								if( asyncAssigns == maxAsyncAssigns ) {
@@ -1516,6 +1738,11 @@ namespace grb {
 			} // end pragma omp parallel
 #endif
 
+			// with scattering kernels, the epilogue requires a separate pass
+			if( Epilogue::active && scattered && global_rc == SUCCESS ) {
+				vxm_epilogue_pass< descr, masked >( u, mask, kernel_epilogue );
+			}
+
 			assert( internal::getCoordinates( u ).nonzeroes() <= m );
 
 #ifdef _DEBUG
@@ -2214,6 +2441,207 @@ namespace grb {
 		}
 	}
 
+	/**
+	 * \parblock
+	 * \par Performance semantics
+	 * Equal to those of #grb::vxm without an epilogue, plus the costs of
+	 * applying the epilogue to each selected output element. Whenever the
+	 * multiplication proceeds by gathering contributions for each output
+	 * element, the epilogue is applied to an output element right after it is
+	 * computed, and hence incurs no additional data movement beyond that of any
+	 * vector operands of the epilogue. Otherwise, the epilogue is applied in a
+	 * single additional pass over the output vector, which may be cheaper than
+	 * the equivalent sequence of calls to #grb::foldl.
+	 * \endparblock
+	 *
+	 * \internal Delegates to vxm_generic.
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC vxm(
+		Vector< IOType, reference, Coords > &u,
+		const Vector< InputType3, reference, Coords > &mask,
+		const Vector< InputType1, reference, Coords > &v,
+		const Matrix< InputType2, reference, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		constexpr bool left_sided = true;
+		const Vector< bool, reference, Coords > empty_mask( 0 );
+		if( size( mask ) > 0 ) {
+			return internal::vxm_generic<
+				descr, true, false, left_sided, true, Ring::template One
+			>(
+				u, mask, v, empty_mask, A,
+				ring.getAdditiveMonoid(), ring.getMultiplicativeOperator(),
+				phase,
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				epilogue );
+		} else {
+			return internal::vxm_generic<
+				descr, false, false, left_sided, true, Ring::template One
+			>(
+				u, mask, v, empty_mask, A,
+				ring.getAdditiveMonoid(), ring.getMultiplicativeOperator(),
+				phase,
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				epilogue );
+		}
+	}
+
+	/** \internal Delegates to the masked variant */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC vxm(
+		Vector< IOType, reference, Coords > &u,
+		const Vector< InputType1, reference, Coords > &v,
+		const Matrix< InputType2, reference, RIT, CIT, NIT > &A,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		const Vector< bool, reference, Coords > empty_mask( 0 );
+		return vxm< descr >( u, empty_mask, v, A, ring, epilogue, phase );
+	}
+
+	/**
+	 * \parblock
+	 * \par Performance semantics
+	 * Equal to those of #grb::vxm with an epilogue.
+	 * \endparblock
+	 *
+	 * \internal Delegates to vxm_generic.
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename InputType3,
+		typename RIT, typename CIT, typename NIT,
+		typename Coords
+	>
+	RC mxv(
+		Vector< IOType, reference, Coords > &u,
+		const Vector< InputType3, reference, Coords > &mask,
+		const Matrix< InputType2, reference, RIT, CIT, NIT > &A,
+		const Vector< InputType1, reference, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		constexpr Descriptor new_descr = descr ^ descriptors::transpose_matrix;
+		constexpr bool left_sided = false;
+		const Vector< bool, reference, Coords > empty_mask( 0 );
+		if( size( mask ) > 0 ) {
+			return internal::vxm_generic<
+				new_descr, true, false, left_sided, true, Ring::template One
+			>(
+				u, mask, v, empty_mask, A,
+				ring.getAdditiveMonoid(), ring.getMultiplicativeOperator(),
+				phase,
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				epilogue );
+		} else {
+			return internal::vxm_generic<
+				new_descr, false, false, left_sided, true, Ring::template One
+			>(
+				u, mask, v, empty_mask, A,
+				ring.getAdditiveMonoid(), ring.getMultiplicativeOperator(),
+				phase,
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				[]( const size_t i ) {
+					return i;
+				},
+				epilogue );
+		}
+	}
+
+	/** \internal Delegates to the masked variant */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring, class Epilogue,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC mxv(
+		Vector< IOType, reference, Coords > &u,
+		const Matrix< InputType2, reference, RIT, CIT, NIT > &A,
+		const Vector< InputType1, reference, Coords > &v,
+		const Ring &ring,
+		const Epilogue &epilogue,
+		const Phase &phase = EXECUTE,
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			grb::is_epilogue< Epilogue >::value, void
+		>::type * const = nullptr
+	) {
+		const Vector< bool, reference, Coords > empty_mask( 0 );
+		return mxv< descr >( u, empty_mask, A, v, ring, epilogue, phase );
+	}
+
 	namespace internal {
 
 #ifndef _H_GRB_REFERENCE_OMP_BLAS2
@@ -2846,6 +3274,382 @@ namespace grb {
 		return eWiseLambda( f, A, args... );
 	}
 
+	namespace internal {
+
+#ifndef _H_GRB_REFERENCE_OMP_BLAS2
+		/**
+		 * \internal Computes a level-set schedule for a sparse triangular solve.
+		 *
+		 * The analysis is sequential and completes in \f$ \Theta( n + nz ) \f$ time.
+		 * The given \a schedule is only modified on success.
+		 *
+		 * @param[out] schedule The level-set schedule.
+		 * @param[in]  storage  The row-major storage of the triangular matrix.
+		 * @param[in]  n        The size of the square matrix.
+		 * @param[in]  triangle Which triangle to analyse.
+		 * @param[in]  diagonal Whether the diagonal is stored or implied.
+		 */
+		template< typename D, typename IND, typename SIZE >
+		RC triangular_analysis_generic(
+			TriangularSchedule &schedule,
+			const Compressed_Storage< D, IND, SIZE > &storage,
+			const size_t n,
+			const Triangle triangle, const Diagonal diagonal
+		) {
+			const bool lower = triangle == LOWER;
+			std::vector< size_t > level, level_start, rows, diagonal_offsets;
+			try {
+				level.resize( n );
+				rows.resize( n );
+				if( diagonal == NON_UNIT ) {
+					diagonal_offsets.resize( n );
+				}
+			} catch( const std::bad_alloc & ) {
+				return OUTOFMEM;
+			}
+
+			// a row depends on rows with lower (upper) indices only in the lower
+			// (upper) triangular case, so a single sweep suffices to derive levels
+			size_t num_levels = 0;
+			for( size_t k = 0; k < n; ++k ) {
+				const size_t i = lower ? k : n - k - 1;
+				size_t my_level = 0;
+				bool has_diagonal = false;
+				for(
+					size_t nz = storage.col_start[ i ];
+					nz < static_cast< size_t >( storage.col_start[ i + 1 ] );
+					++nz
+				) {
+					const size_t j = storage.row_index[ nz ];
+					if( j == i ) {
+						if( diagonal == NON_UNIT ) {
+							diagonal_offsets[ i ] = nz;
+						}
+						has_diagonal = true;
+					} else if( lower ? j < i : j > i ) {
+						my_level = std::max( my_level, level[ j ] + 1 );
+					}
+				}
+				if( diagonal == NON_UNIT && !has_diagonal ) {
+#ifdef _DEBUG
+					std::cerr << "\t row " << i << " has no diagonal entry\n";
+#endif
+					return ILLEGAL;
+				}
+				level[ i ] = my_level;
+				num_levels = std::max( num_levels, my_level + 1 );
+			}
+
+			// bucket the rows per level using a counting sort, which retains the
+			// natural row order within each level
+			try {
+				level_start.resize( num_levels + 1, 0 );
+			} catch( const std::bad_alloc & ) {
+				return OUTOFMEM;
+			}
+			for( size_t i = 0; i < n; ++i ) {
+				(void) ++( level_start[ level[ i ] + 1 ] );
+			}
+			for( size_t l = 0; l < num_levels; ++l ) {
+				level_start[ l + 1 ] += level_start[ l ];
+			}
+			assert( level_start[ num_levels ] == n );
+			for( size_t i = 0; i < n; ++i ) {
+				rows[ level_start[ level[ i ] ]++ ] = i;
+			}
+			// the above shifted level_start by one position; undo
+			for( size_t l = num_levels; l > 0; --l ) {
+				level_start[ l ] = level_start[ l - 1 ];
+			}
+			level_start[ 0 ] = 0;
+
+			// commit
+			schedule.n = n;
+			schedule.triangle = triangle;
+			schedule.diagonal = diagonal;
+			std::swap( schedule.level_start, level_start );
+			std::swap( schedule.rows, rows );
+			std::swap( schedule.diagonal_offsets, diagonal_offsets );
+			return SUCCESS;
+		}
+#endif
+
+#ifndef _H_GRB_REFERENCE_OMP_BLAS2
+		/**
+		 * \internal Marks all entries of a vector with generic coordinates as
+		 *           assigned, one by one.
+		 */
+		template< typename Coords >
+		void triangular_solve_densify( Coords &coors ) {
+			const size_t n = coors.size();
+			for( size_t i = 0; i < n; ++i ) {
+				(void) coors.assign( i );
+			}
+		}
+#endif
+
+		/**
+		 * \internal Marks all entries of a vector with this backend's coordinates
+		 *           as assigned.
+		 */
+		inline void triangular_solve_densify( Coordinates< reference > &coors ) {
+			coors.assignAll();
+		}
+
+		/**
+		 * \internal Copies the right-hand side \a b of a triangular solve into the
+		 *           output vector \a x, substituting zeroes for missing entries. On
+		 *           output, \a x is dense. The vectors may be the same container.
+		 */
+		template<
+			class Ring,
+			typename IOType, typename InputType,
+			typename Coords
+		>
+		void triangular_solve_init(
+			Vector< IOType, reference, Coords > &x,
+			const Vector< InputType, reference, Coords > &b,
+			const Ring &ring
+		) {
+			IOType * __restrict__ const raw_x = internal::getRaw( x );
+			const InputType * __restrict__ const raw_b = internal::getRaw( b );
+			const auto &b_coors = internal::getCoordinates( b );
+			const size_t n = b_coors.size();
+			const bool b_dense = b_coors.isDense();
+			const bool in_place = reinterpret_cast< const void * >( raw_x ) ==
+				reinterpret_cast< const void * >( raw_b );
+			if( !in_place || !b_dense ) {
+				const IOType zero = ring.template getZero< IOType >();
+#ifdef _H_GRB_REFERENCE_OMP_BLAS2
+				#pragma omp parallel
+				{
+					size_t start, end;
+					config::OMP::localRange( start, end, 0, n );
+#else
+					const size_t start = 0;
+					const size_t end = n;
+#endif
+					for( size_t i = start; i < end; ++i ) {
+						if( b_dense || b_coors.assigned( i ) ) {
+							if( !in_place ) {
+								raw_x[ i ] = static_cast< IOType >( raw_b[ i ] );
+							}
+						} else {
+							raw_x[ i ] = zero;
+						}
+					}
+#ifdef _H_GRB_REFERENCE_OMP_BLAS2
+				}
+#endif
+			}
+			if( !internal::getCoordinates( x ).isDense() ) {
+				triangular_solve_densify( internal::getCoordinates( x ) );
+			}
+		}
+
+		/**
+		 * \internal Performs an in-place triangular solve on the dense vector \a x
+		 *           following a given level-set schedule.
+		 *
+		 * In the shared-memory parallel backend, the rows of each level are
+		 * distributed over the threads, with a barrier between levels.
+		 */
+		template<
+			class Ring, class Minus, class Divide,
+			typename IOType, typename InputType, typename IND, typename SIZE,
+			typename Coords
+		>
+		void triangular_solve_generic(
+			Vector< IOType, reference, Coords > &x,
+			const Compressed_Storage< InputType, IND, SIZE > &storage,
+			const TriangularSchedule &schedule,
+			const Ring &ring, const Minus &minus, const Divide &divide
+		) {
+			typedef typename Ring::D1 MatrixType;
+			typedef typename Ring::D3 ProductType;
+			typedef typename Ring::D4 SumType;
+
+			IOType * __restrict__ const raw = internal::getRaw( x );
+			const bool lower = schedule.triangle == LOWER;
+			const bool unit = schedule.diagonal == UNIT;
+			const size_t num_levels = schedule.levels();
+			const size_t * const level_start = schedule.level_start.data();
+			const size_t * const rows = schedule.rows.data();
+			const size_t * const diagonal = schedule.diagonal_offsets.data();
+			const MatrixType one = ring.template getOne< MatrixType >();
+
+#ifdef _H_GRB_REFERENCE_OMP_BLAS2
+			#pragma omp parallel
+			{
+#endif
+				for( size_t l = 0; l < num_levels; ++l ) {
+#ifdef _H_GRB_REFERENCE_OMP_BLAS2
+					// levels are often narrow, hence distribute single rows
+					size_t start, end;
+					config::OMP::localRange(
+						start, end, level_start[ l ], level_start[ l + 1 ], 1 );
+#else
+					const size_t start = level_start[ l ];
+					const size_t end = level_start[ l + 1 ];
+#endif
+					for( size_t k = start; k < end; ++k ) {
+						const size_t i = rows[ k ];
+						SumType sum = ring.template getZero< SumType >();
+						for(
+							size_t nz = storage.col_start[ i ];
+							nz < static_cast< size_t >( storage.col_start[ i + 1 ] );
+							++nz
+						) {
+							const size_t j = storage.row_index[ nz ];
+							if( lower ? j < i : j > i ) {
+								ProductType product;
+								(void) grb::apply( product, storage.getValue( nz, one ), raw[ j ],
+									ring.getMultiplicativeOperator() );
+								(void) grb::foldl( sum, product, ring.getAdditiveOperator() );
+							}
+						}
+						if( unit ) {
+							(void) grb::foldl( raw[ i ], sum, minus );
+						} else {
+							IOType residual;
+							(void) grb::apply( residual, raw[ i ], sum, minus );
+							(void) grb::apply( raw[ i ], residual,
+								storage.getValue( diagonal[ i ], one ), divide );
+						}
+					}
+#ifdef _H_GRB_REFERENCE_OMP_BLAS2
+					#pragma omp barrier
+#endif
+				}
+#ifdef _H_GRB_REFERENCE_OMP_BLAS2
+			}
+#endif
+		}
+
+	} // end namespace grb::internal
+
+	/**
+	 * Analyses a square matrix for use with #grb::triangularSolve.
+	 *
+	 * \parblock
+	 * \par Performance semantics
+	 *   -# This call takes \f$ \Theta( n + nz ) \f$ work, where \f$ nz \f$ is the
+	 *      number of nonzeroes in \a T. The analysis is sequential.
+	 *   -# This call allocates \f$ \Theta( n ) \f$ bytes of dynamic memory, which
+	 *      are retained by \a schedule.
+	 *   -# This call moves \f$ \Theta( n + nz ) \f$ bytes of data.
+	 * \endparblock
+	 *
+	 * \note With #grb::descriptors::transpose_matrix, the column-major storage of
+	 *       \a T is used, which hence may not be combined with
+	 *       #grb::descriptors::force_row_major.
+	 *
+	 * @see grb::triangularAnalysis for the user-level specification.
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		typename InputType, typename RIT, typename CIT, typename NIT
+	>
+	RC triangularAnalysis(
+		TriangularSchedule &schedule,
+		const Matrix< InputType, reference, RIT, CIT, NIT > &T,
+		const Triangle triangle,
+		const Diagonal diagonal = NON_UNIT
+	) {
+		static_assert( !( (descr & descriptors::transpose_matrix) &&
+				(descr & descriptors::force_row_major) ),
+			"grb::triangularAnalysis: cannot analyse the transpose of a matrix when "
+			"forced to use its row-major storage only" );
+		const size_t n = nrows( T );
+		if( n != ncols( T ) ) {
+			return MISMATCH;
+		}
+		RC ret = SUCCESS;
+		if( descr & descriptors::transpose_matrix ) {
+			ret = internal::triangular_analysis_generic(
+				schedule, internal::getCCS( T ), n, triangle, diagonal );
+		} else {
+			ret = internal::triangular_analysis_generic(
+				schedule, internal::getCRS( T ), n, triangle, diagonal );
+		}
+		if( ret == SUCCESS ) {
+			schedule.nz = nnz( T );
+			schedule.transposed = descr & descriptors::transpose_matrix;
+		}
+		return ret;
+	}
+
+	/**
+	 * Solves a sparse triangular system using a level-set schedule.
+	 *
+	 * \parblock
+	 * \par Performance semantics
+	 *   -# This call takes \f$ \Theta( n + nz ) \f$ work, where \f$ nz \f$ is the
+	 *      number of nonzeroes in \a T.
+	 *   -# For the reference_omp backend, the critical path length is
+	 *      \f$ \mathcal{O}( L + nz / T ) \f$, where \f$ L \f$ is the number of
+	 *      levels in \a schedule and \f$ T \f$ the number of threads, assuming
+	 *      that each level is balanced. Each level incurs one thread barrier.
+	 *   -# This call does not allocate dynamic memory.
+	 *   -# This call moves \f$ \Theta( n + nz ) \f$ bytes of data.
+	 * \endparblock
+	 *
+	 * @see grb::triangularSolve for the user-level specification.
+	 */
+	template<
+		Descriptor descr = descriptors::no_operation,
+		class Ring,
+		class Minus = operators::subtract< typename Ring::D4 >,
+		class Divide = operators::divide< typename Ring::D4 >,
+		typename IOType, typename InputType1, typename InputType2,
+		typename Coords, typename RIT, typename CIT, typename NIT
+	>
+	RC triangularSolve(
+		Vector< IOType, reference, Coords > &x,
+		const Matrix< InputType2, reference, RIT, CIT, NIT > &T,
+		const Vector< InputType1, reference, Coords > &b,
+		const TriangularSchedule &schedule,
+		const Ring &ring = Ring(),
+		const Minus &minus = Minus(),
+		const Divide &divide = Divide(),
+		const typename std::enable_if<
+			grb::is_semiring< Ring >::value &&
+			!grb::is_object< IOType >::value &&
+			!grb::is_object< InputType1 >::value &&
+			!grb::is_object< InputType2 >::value,
+		void >::type * const = nullptr
+	) {
+		static_assert( !std::is_same< IOType, void >::value &&
+				!std::is_same< InputType1, void >::value,
+			"grb::triangularSolve: vectors must have non-void element types" );
+		constexpr bool transposed = descr & descriptors::transpose_matrix;
+		const size_t n = size( x );
+		if( size( b ) != n || nrows( T ) != n || ncols( T ) != n ||
+			schedule.size() != n || schedule.nz != nnz( T )
+		) {
+			return MISMATCH;
+		}
+		if( schedule.transposed != transposed ) {
+			return ILLEGAL;
+		}
+		if( (descr & descriptors::dense) && nnz( b ) < n ) {
+			return ILLEGAL;
+		}
+		if( n == 0 ) {
+			return SUCCESS;
+		}
+
+		internal::triangular_solve_init( x, b, ring );
+		if( transposed ) {
+			internal::triangular_solve_generic(
+				x, internal::getCCS( T ), schedule, ring, minus, divide );
+		} else {
+			internal::triangular_solve_generic(
+				x, internal::getCRS( T ), schedule, ring, minus, divide );
+		}
+		return SUCCESS;
+	}
+
 	/** @} */
 
 } // namespace grb
@@ -1303,6 +1303,211 @@ namespace grb {
 		);
 	}
 
+	namespace internal {
+
+		/**
+		 * \internal Multiplies a sparse matrix in compressed storage with a dense
+		 *           block of \a nrhs right-hand sides, accumulating the result into
+		 *           a dense output block.
+		 *
+		 * Each nonzero of the sparse matrix is loaded once, multiplied with
+		 * \a alpha, and applied to all right-hand sides before the next nonzero
+		 * is loaded.
+		 *
+		 * @tparam row_major Whether \a B and \a C are stored row-major. If not,
+		 *                   they are stored column-major.
+		 * @tparam scatter   If <tt>false</tt>, the \a i-th compressed row of
+		 *                   \a storage contributes to the \a i-th row of \a C. If
+		 *                   <tt>true</tt>, the \a i-th compressed row instead reads
+		 *                   from the \a i-th row of \a B, thus multiplying with the
+		 *                   transpose of the stored matrix.
+		 *
+		 * In the shared-memory parallel backend, the gather variant distributes
+		 * the compressed rows over the threads, while the scatter variant
+		 * distributes the right-hand sides so that no two threads write to the
+		 * same element of \a C.
+		 *
+		 * The matrix argument is unused beyond selecting the backend; \a storage
+		 * must be one of its compressed storages, with \a m compressed rows.
+		 */
+		template<
+			bool row_major, bool scatter,
+			class Ring,
+			typename OutputType, typename InputType1, typename InputType2,
+			typename ScalarType,
+			typename IND, typename SIZE, typename RIT, typename CIT, typename NIT
+		>
+		void spmm_generic(
+			OutputType * __restrict__ const C, const size_t ldc,
+			const Matrix< InputType2, reference, RIT, CIT, NIT > &,
+			const Compressed_Storage< InputType2, IND, SIZE > &storage,
+			const size_t m,
+			const InputType1 * __restrict__ const B, const size_t ldb,
+			const size_t nrhs,
+			const ScalarType &alpha,
+			const Ring &ring
+		) {
+			typedef typename Ring::D1 MatrixType;
+			typedef typename Ring::D3 ProductType;
+			const MatrixType one = ring.template getOne< MatrixType >();
+			// element (i, r) of a dense block with leading dimension ld
+			const size_t b_row_stride = row_major ? ldb : 1;
+			const size_t b_col_stride = row_major ? 1 : ldb;
+			const size_t c_row_stride = row_major ? ldc : 1;
+			const size_t c_col_stride = row_major ? 1 : ldc;
+
+#ifdef _H_GRB_REFERENCE_OMP_BLAS3
+			#pragma omp parallel
+			{
+				size_t row_start = 0, row_end = m;
+				size_t rhs_start = 0, rhs_end = nrhs;
+				if( scatter ) {
+					config::OMP::localRange( rhs_start, rhs_end, 0, nrhs, 1 );
+				} else {
+					config::OMP::localRange( row_start, row_end, 0, m );
+				}
+#else
+				const size_t row_start = 0, row_end = m;
+				const size_t rhs_start = 0, rhs_end = nrhs;
+#endif
+				for( size_t i = row_start; i < row_end; ++i ) {
+					for(
+						size_t k = storage.col_start[ i ];
+						k < static_cast< size_t >( storage.col_start[ i + 1 ] );
+						++k
+					) {
+						const size_t j = storage.row_index[ k ];
+						const size_t in = scatter ? i : j;
+						const size_t out = scatter ? j : i;
+						MatrixType a;
+						(void) grb::apply( a, alpha, storage.getValue( k, one ),
+							ring.getMultiplicativeOperator() );
+						const InputType1 * __restrict__ const b_row = B + in * b_row_stride;
+						OutputType * __restrict__ const c_row = C + out * c_row_stride;
+						for( size_t r = rhs_start; r < rhs_end; ++r ) {
+							ProductType product;
+							(void) grb::apply( product, a, b_row[ r * b_col_stride ],
+								ring.getMultiplicativeOperator() );
+							(void) grb::foldl( c_row[ r * c_col_stride ], product,
+								ring.getAdditiveOperator() );
+						}
+					}
+				}
+#ifdef _H_GRB_REFERENCE_OMP_BLAS3
+			}
+#endif
+		}
+
+		/**
+		 * \internal Sparse matrix times dense block multiplication.
+		 *
+		 * Computes \f$ C = C + \alpha AB \f$ or, with
+		 * #grb::descriptors::transpose_matrix, \f$ C = C + \alpha A^TB \f$, where
+		 * \a B and \a C are dense blocks of \a nrhs columns each, stored in raw
+		 * memory. Addition and multiplication are those of the given \a ring.
+		 *
+		 * @param[in,out] C   The output block of \f$ m \f$ rows, where \f$ m \f$
+		 *                    is the number of rows of \f$ A \f$ or, if transposed,
+		 *                    of \f$ A^T \f$.
+		 * @param[in] ldc     The leading dimension of \a C.
+		 * @param[in] A       The sparse input matrix.
+		 * @param[in] B       The input block, whose number of rows must equal the
+		 *                    number of columns of \f$ A \f$ (or of \f$ A^T \f$).
+		 * @param[in] ldb     The leading dimension of \a B.
+		 * @param[in] nrhs    The number of columns of \a B and \a C.
+		 * @param[in] row_major Whether \a B and \a C are row-major (<tt>true</tt>)
+		 *                    or column-major (<tt>false</tt>).
+		 * @param[in] alpha   The scalar \f$ \alpha \f$, which multiplies every
+		 *                    nonzero of \a A as it is loaded.
+		 * @param[in] ring    The semiring under which to compute.
+		 *
+		 * @returns #grb::ILLEGAL if a leading dimension is too small for the
+		 *                        given block sizes, or if a required block is
+		 *                        <tt>nullptr</tt>.
+		 * @returns #grb::SUCCESS otherwise.
+		 *
+		 * When #grb::descriptors::transpose_matrix is given, the column-major
+		 * storage of \a A is used, unless #grb::descriptors::force_row_major is
+		 * also given; in the latter case, the row-major storage is used in a
+		 * scatter fashion.
+		 *
+		 * \parblock
+		 * \par Performance semantics
+		 *   -# This call takes \f$ \Theta( nz \cdot nrhs ) \f$ work, where
+		 *      \f$ nz \f$ is the number of nonzeroes in \a A.
+		 *   -# Each nonzero of \a A is loaded exactly once.
+		 *   -# This call does not allocate dynamic memory.
+		 * \endparblock
+		 */
+		template<
+			Descriptor descr = descriptors::no_operation,
+			class Ring,
+			typename OutputType, typename InputType1, typename InputType2,
+			typename ScalarType,
+			typename RIT, typename CIT, typename NIT
+		>
+		RC spmm(
+			OutputType * const C, const size_t ldc,
+			const Matrix< InputType2, reference, RIT, CIT, NIT > &A,
+			const InputType1 * const B, const size_t ldb,
+			const size_t nrhs,
+			const bool row_major,
+			const ScalarType &alpha,
+			const Ring &ring = Ring(),
+			const typename std::enable_if<
+				grb::is_semiring< Ring >::value &&
+				!grb::is_object< OutputType >::value &&
+				!grb::is_object< InputType1 >::value &&
+				!grb::is_object< InputType2 >::value &&
+				!grb::is_object< ScalarType >::value,
+			void >::type * const = nullptr
+		) {
+			constexpr bool transposed = descr & descriptors::transpose_matrix;
+			constexpr bool scatter = transposed &&
+				(descr & descriptors::force_row_major);
+			const size_t m = transposed ? ncols( A ) : nrows( A );
+			const size_t k = transposed ? nrows( A ) : ncols( A );
+			if( m == 0 || nrhs == 0 ) {
+				return SUCCESS;
+			}
+			if( C == nullptr || ( k > 0 && B == nullptr ) ) {
+				return ILLEGAL;
+			}
+			if( ldc < ( row_major ? nrhs : m ) || ldb < ( row_major ? nrhs : k ) ) {
+				return ILLEGAL;
+			}
+			if( nnz( A ) == 0 ) {
+				return SUCCESS;
+			}
+
+			if( row_major ) {
+				if( scatter ) {
+					spmm_generic< true, true >( C, ldc, A, getCRS( A ), k, B, ldb, nrhs,
+						alpha, ring );
+				} else if( transposed ) {
+					spmm_generic< true, false >( C, ldc, A, getCCS( A ), m, B, ldb, nrhs,
+						alpha, ring );
+				} else {
+					spmm_generic< true, false >( C, ldc, A, getCRS( A ), m, B, ldb, nrhs,
+						alpha, ring );
+				}
+			} else {
+				if( scatter ) {
+					spmm_generic< false, true >( C, ldc, A, getCRS( A ), k, B, ldb, nrhs,
+						alpha, ring );
+				} else if( transposed ) {
+					spmm_generic< false, false >( C, ldc, A, getCCS( A ), m, B, ldb, nrhs,
+						alpha, ring );
+				} else {
+					spmm_generic< false, false >( C, ldc, A, getCRS( A ), m, B, ldb, nrhs,
+						alpha, ring );
+				}
+			}
+			return SUCCESS;
+		}
+
+	} // end namespace grb::internal
+
 } // namespace grb
 
 #undef NO_CAST_ASSERT
@@ -57,7 +57,35 @@ namespace grb {
 			ALIGNED,
 
 			/** Allocation via <tt>numa_alloc_interleaved</tt>. */
-			INTERLEAVED
+			INTERLEAVED,
+
+			/**
+			 * Allocation via <tt>posix_memalign</tt>, where the memory area is left
+			 * untouched so that its pages are placed on the NUMA node of the thread
+			 * that first writes to them.
+			 *
+			 * Containers allocated in this mode are first-touched using the same
+			 * #grb::config::OMP::localRange partitioning that compute kernels later
+			 * use.
+			 */
+			LOCAL,
+
+			/**
+			 * Allocation of memory areas that are aligned to, and backed by, huge
+			 * pages; see #grb::utils::ContainerPool::HUGEPAGE. This reduces TLB
+			 * misses when accessing large containers randomly, such as the input
+			 * vector of an SpMV.
+			 *
+			 * Memory areas smaller than #grb::config::MEMORY_POOL::hugePageSize()
+			 * are allocated as in #ALIGNED mode instead, also when this mode is
+			 * requested explicitly, since each would otherwise occupy a full huge
+			 * page.
+			 *
+			 * Large #ALIGNED and #INTERLEAVED areas are allocated in this mode as well
+			 * if the <tt>GRB_HUGE_PAGES</tt> environment variable is set to a nonzero
+			 * value; see #grb::utils::ContainerPool::hugePages.
+			 */
+			HUGEPAGE
 
 		};
 
@@ -120,6 +148,51 @@ namespace grb {
 
 		};
 
+		/**
+		 * Default settings that decide how the reference and reference_omp backends
+		 * traverse the nonzeroes of a vector.
+		 *
+		 * A vector is traversed via the stack of its assigned indices while it is
+		 * very sparse. Once at least one in #bitmapRatio() elements is assigned, the
+		 * vector instead is traversed by a sequential sweep over its bitmap of
+		 * assigned elements, and once all elements are assigned, by a sweep that
+		 * does not inspect the bitmap at all. Kernels make this choice at run-time,
+		 * meaning that dense fast paths are taken even if #grb::descriptors::dense
+		 * was not given.
+		 *
+		 * \note The defaults may be overridden by specialisation.
+		 *
+		 * \internal
+		 * \warning This class should only be used by the reference or reference_omp
+		 *          backends.
+		 * \endinternal
+		 *
+		 * \ingroup reference
+		 */
+		template< Backend backend >
+		class VECTOR_REPRESENTATION {
+
+			// guard against unintended use
+			static_assert( backend == reference || backend == reference_omp,
+				"Instantiating for non-reference backend" );
+
+			public:
+
+				/**
+				 * A vector of size \f$ n \f$ with \f$ k \f$ nonzeroes is traversed via its
+				 * bitmap when \f$ k \cdot \mathit{bitmapRatio} \geq n \f$.
+				 *
+				 * A stack traversal touches about one cache line per nonzero, while a
+				 * bitmap sweep streams through all \f$ n \f$ elements; the default
+				 * reflects that the latter also reaps the benefits of hardware
+				 * prefetching.
+				 */
+				static constexpr size_t bitmapRatio() {
+					return 16;
+				}
+
+		};
+
 		/**
 		 * This class collects configuration parameters that are specific to the
 		 * #grb::reference backend. It details both configurations that could
@@ -267,10 +340,18 @@ namespace grb {
 				/**
 				 * For the reference_omp backend, a shared memory-segment should use
 				 * interleaved alloc so that any thread has uniform access on average.
+				 *
+				 * If <tt>_GRB_NUMA_FIRST_TOUCH</tt> is defined, shared memory segments
+				 * instead are placed by first touch, so that each thread accesses the
+				 * parts of containers it processes from its local NUMA node.
 				 */
 				static constexpr ALLOC_MODE sharedAllocMode() {
+#ifdef _GRB_NUMA_FIRST_TOUCH
+					return ALLOC_MODE::LOCAL;
+#else
 					// return ALLOC_MODE::ALIGNED; //DBG
 					return ALLOC_MODE::INTERLEAVED;
+#endif
 				}
 
 				/**
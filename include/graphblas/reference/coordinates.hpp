@@ -25,9 +25,11 @@
 
 #include <stddef.h> //size_t
 
+#include <algorithm> //std::min
 #include <stdexcept> //std::runtime_error
 
 #include <assert.h>
+#include <stdint.h> //uint64_t
 #include <string.h> //memcpy
 
 #include <graphblas/backends.hpp>
@@ -45,6 +47,10 @@
  #include <set>
 #endif
 
+#if defined _GRB_COMPACT_COORDINATES && defined _GRB_WITH_LPF
+ #error "Compact coordinates are not supported by the BSP1D and hybrid backends"
+#endif
+
 
 namespace grb {
 
@@ -55,6 +61,14 @@ namespace grb {
 		 * coordinates. Its use is internal via, e.g., grb::Vector< T, reference, C >.
 		 * All functions needed to rebuild or update sparsity information are
 		 * encapsulated here.
+		 *
+		 * By default, whether a coordinate is assigned is recorded using one byte
+		 * per coordinate. If _GRB_COMPACT_COORDINATES is defined, this information
+		 * is instead bit-packed into 64-bit words, which reduces the metadata of a
+		 * sparse vector from five to four and one eighth bytes per element. Bulk
+		 * operations such as #clear, #clearRange, and #rebuild then proceed one
+		 * word at a time, while concurrent calls to #asyncAssign use atomic
+		 * updates on the words they touch.
 		 */
 		template<>
 		class Coordinates< reference > {
@@ -67,14 +81,37 @@ namespace grb {
 				/** Local update type for use with #asyncAssign and #joinAssign. */
 				typedef StackType * Update;
 
+#ifdef _GRB_COMPACT_COORDINATES
+				/** The type of the words that store which coordinates are assigned. */
+				typedef uint64_t ArrayType;
+#else
 				/** The type of elements #saveFromArray returns. */
 				typedef bool ArrayType;
+#endif
+
+				/**
+				 * The ways in which the nonzeroes of a coordinate set may be traversed.
+				 *
+				 * @see #representation
+				 */
+				enum Representation {
+
+					/** Loop over the stack of assigned indices. */
+					SPARSE,
+
+					/** Loop over all indices and skip those that are not assigned. */
+					BITMAP,
+
+					/** Loop over all indices, which are all assigned. */
+					DENSE
+
+				};
 
 
 			private:
 
 				/** Pointer to the underlying indexing array. */
-				bool * __restrict__ _assigned;
+				ArrayType * __restrict__ _assigned;
 
 				/**
 				 * Stack of assigned coordinates.
@@ -97,6 +134,246 @@ namespace grb {
 				/** Per-thread capacity for parallel stack updates. */
 				size_t _buf;
 
+#ifdef _GRB_COMPACT_COORDINATES
+				/** The number of coordinates stored in an element of #_assigned. */
+				static constexpr size_t coordinatesPerWord = 8 * sizeof( ArrayType );
+#else
+				/** The number of coordinates stored in an element of #_assigned. */
+				static constexpr size_t coordinatesPerWord = 1;
+#endif
+
+				/**
+				 * The number of coordinates that share a cache line of #_assigned. Any
+				 * parallel loop that writes to #_assigned must partition its range into
+				 * blocks of this size, as to prevent concurrent writes to the same word.
+				 */
+				static constexpr size_t assignedBlockSize() {
+					return config::CACHE_LINE_SIZE::value() / sizeof( ArrayType ) *
+						coordinatesPerWord;
+				}
+
+#ifdef _GRB_COMPACT_COORDINATES
+				/**
+				 * @returns A word in which the bits that correspond to the coordinates
+				 *          \a first up to and including \a last are set. Both must map
+				 *          to the same word.
+				 */
+				static inline ArrayType wordMask(
+					const size_t first, const size_t last
+				) noexcept {
+					assert( first <= last );
+					assert( first / coordinatesPerWord == last / coordinatesPerWord );
+					constexpr ArrayType ones = ~static_cast< ArrayType >( 0 );
+					return ( ones << ( first % coordinatesPerWord ) ) &
+						( ones >> ( coordinatesPerWord - 1 - last % coordinatesPerWord ) );
+				}
+#endif
+
+				/** @returns Whether coordinate \a i is set in #_assigned. */
+				inline bool getAssigned( const size_t i ) const noexcept {
+#ifdef _GRB_COMPACT_COORDINATES
+					return ( _assigned[ i / coordinatesPerWord ] &
+						wordMask( i, i ) ) != 0;
+#else
+					return _assigned[ i ];
+#endif
+				}
+
+				/** Sets coordinate \a i in #_assigned. This function is not thread safe. */
+				inline void setAssigned( const size_t i ) noexcept {
+#ifdef _GRB_COMPACT_COORDINATES
+					_assigned[ i / coordinatesPerWord ] |= wordMask( i, i );
+#else
+					_assigned[ i ] = true;
+#endif
+				}
+
+				/** Unsets coordinate \a i in #_assigned. This function is not thread safe. */
+				inline void unsetAssigned( const size_t i ) noexcept {
+#ifdef _GRB_COMPACT_COORDINATES
+					_assigned[ i / coordinatesPerWord ] &= ~wordMask( i, i );
+#else
+					_assigned[ i ] = false;
+#endif
+				}
+
+				/**
+				 * Sets coordinate \a i in #_assigned. Concurrent calls are thread safe as
+				 * long as they are made with different \a i.
+				 *
+				 * @returns Whether coordinate \a i was already set.
+				 */
+				inline bool setAssignedAsync( const size_t i ) noexcept {
+#ifdef _GRB_COMPACT_COORDINATES
+					ArrayType * const word = _assigned + i / coordinatesPerWord;
+					const ArrayType mask = wordMask( i, i );
+					if( __atomic_load_n( word, __ATOMIC_RELAXED ) & mask ) {
+						return true;
+					}
+					return ( __atomic_fetch_or( word, mask, __ATOMIC_RELAXED ) & mask ) != 0;
+#else
+					if( _assigned[ i ] ) {
+						return true;
+					}
+					_assigned[ i ] = true;
+					return false;
+#endif
+				}
+
+				/**
+				 * Unsets coordinate \a i in #_assigned. Concurrent calls are thread safe
+				 * as long as they are made with different \a i.
+				 */
+				inline void unsetAssignedAsync( const size_t i ) noexcept {
+#ifdef _GRB_COMPACT_COORDINATES
+					(void) __atomic_fetch_and( _assigned + i / coordinatesPerWord,
+						~wordMask( i, i ), __ATOMIC_RELAXED );
+#else
+					_assigned[ i ] = false;
+#endif
+				}
+
+				/**
+				 * @returns How many coordinates in the range \a start to \a end are set in
+				 *          #_assigned.
+				 */
+				inline size_t countAssigned(
+					const size_t start, const size_t end
+				) const noexcept {
+					size_t ret = 0;
+#ifdef _GRB_COMPACT_COORDINATES
+					for( size_t i = start; i < end; ) {
+						const size_t w = i / coordinatesPerWord;
+						const size_t last = std::min( ( w + 1 ) * coordinatesPerWord, end ) - 1;
+						ret += __builtin_popcountll( _assigned[ w ] & wordMask( i, last ) );
+						i = last + 1;
+					}
+#else
+					for( size_t i = start; i < end; ++i ) {
+						if( _assigned[ i ] ) {
+							(void) ++ret;
+						}
+					}
+#endif
+					return ret;
+				}
+
+				/**
+				 * Unsets all coordinates in the range \a start to \a end in #_assigned.
+				 *
+				 * @tparam count Whether to count the coordinates that were set. If
+				 *               <tt>false</tt>, #_assigned may be uninitialised.
+				 *
+				 * Concurrent calls are thread safe as long as their ranges are separated
+				 * by multiples of #assignedBlockSize.
+				 *
+				 * @returns How many coordinates were set before the call, if \a count.
+				 */
+				template< bool count >
+				inline size_t clearAssigned( const size_t start, const size_t end ) noexcept {
+					size_t ret = 0;
+#ifdef _GRB_COMPACT_COORDINATES
+					for( size_t i = start; i < end; ) {
+						const size_t w = i / coordinatesPerWord;
+						const size_t last = std::min( ( w + 1 ) * coordinatesPerWord, end ) - 1;
+						const ArrayType mask = wordMask( i, last );
+						if( count ) {
+							ret += __builtin_popcountll( _assigned[ w ] & mask );
+						}
+						if( !count && mask == ~static_cast< ArrayType >( 0 ) ) {
+							_assigned[ w ] = 0;
+						} else {
+							_assigned[ w ] &= ~mask;
+						}
+						i = last + 1;
+					}
+#else
+					for( size_t i = start; i < end; ++i ) {
+						if( !count ) {
+							_assigned[ i ] = false;
+						} else if( _assigned[ i ] ) {
+							(void) ++ret;
+							_assigned[ i ] = false;
+						}
+					}
+#endif
+					return ret;
+				}
+
+				/**
+				 * Sets all coordinates in the range \a start to \a end in #_assigned.
+				 *
+				 * Concurrent calls are thread safe as long as their ranges are separated
+				 * by multiples of #assignedBlockSize.
+				 */
+				inline void fillAssigned( const size_t start, const size_t end ) noexcept {
+#ifdef _GRB_COMPACT_COORDINATES
+					for( size_t i = start; i < end; ) {
+						const size_t w = i / coordinatesPerWord;
+						const size_t last = std::min( ( w + 1 ) * coordinatesPerWord, end ) - 1;
+						_assigned[ w ] |= wordMask( i, last );
+						i = last + 1;
+					}
+#else
+					for( size_t i = start; i < end; ++i ) {
+						_assigned[ i ] = true;
+					}
+#endif
+				}
+
+				/**
+				 * Writes the coordinates in the range \a start to \a end that are set in
+				 * #_assigned to #_stack, in increasing order, starting at position \a k.
+				 *
+				 * @returns The position in #_stack after the last written coordinate.
+				 */
+				inline size_t stackAssigned(
+					const size_t start, const size_t end, size_t k
+				) noexcept {
+#ifdef _GRB_COMPACT_COORDINATES
+					for( size_t i = start; i < end; ) {
+						const size_t w = i / coordinatesPerWord;
+						const size_t last = std::min( ( w + 1 ) * coordinatesPerWord, end ) - 1;
+						ArrayType bits = _assigned[ w ] & wordMask( i, last );
+						while( bits ) {
+							_stack[ k++ ] = w * coordinatesPerWord + __builtin_ctzll( bits );
+							bits &= bits - 1;
+						}
+						i = last + 1;
+					}
+#else
+					for( size_t i = start; i < end; ++i ) {
+						if( _assigned[ i ] ) {
+							_stack[ k++ ] = i;
+						}
+					}
+#endif
+					return k;
+				}
+
+#ifdef _H_GRB_REFERENCE_OMP_COORDINATES
+				/**
+				 * Computes the part of the range \a start to \a end the calling thread
+				 * should process when writing to #_assigned.
+				 *
+				 * The local ranges are separated by multiples of #assignedBlockSize, so
+				 * that no two threads write to the same word of #_assigned.
+				 */
+				static inline void localAssignedRange(
+					size_t &local_start, size_t &local_end,
+					const size_t start, const size_t end
+				) noexcept {
+					config::OMP::localRange( local_start, local_end,
+						start - start % assignedBlockSize(), end, assignedBlockSize() );
+					if( local_start < start ) {
+						local_start = start;
+					}
+					if( local_end < local_start ) {
+						local_end = local_start;
+					}
+				}
+#endif
+
 				/**
 				 * Increments the number of nonzeroes in the current thread-local stack.
 				 *
@@ -154,7 +431,13 @@ namespace grb {
 					if( dim == 0 ) {
 						return 0;
 					}
+#ifdef _GRB_COMPACT_COORDINATES
+					// one word for a partially filled last word, and one to allow for
+					// alignment
+					return ( dim / coordinatesPerWord + 2 ) * sizeof( ArrayType );
+#else
 					return ( dim + 1 ) * sizeof( ArrayType );
+#endif
 				}
 
 				/**
@@ -351,9 +634,22 @@ namespace grb {
 						return;
 					}
 
+#ifdef _GRB_COMPACT_COORDINATES
+					// _assigned may have alignment issues, as does _stack below
+					{
+						char * arr_raw = static_cast< char * >( arr );
+						constexpr const size_t size = sizeof( ArrayType );
+						const size_t mod = reinterpret_cast< uintptr_t >( arr_raw ) % size;
+						if( mod != 0 ) {
+							arr_raw += size - mod;
+						}
+						_assigned = reinterpret_cast< ArrayType * >( arr_raw );
+					}
+#else
 					// _assigned has no alignment issues, take directly from input buffer
 					assert( reinterpret_cast< uintptr_t >( _assigned ) % sizeof( bool ) == 0 );
 					_assigned = static_cast< bool * >( arr );
+#endif
 					// ...but _stack does have potential alignment issues:
 					char * buf_raw = static_cast< char * >( buf );
 					constexpr const size_t size = sizeof( StackType );
@@ -381,14 +677,12 @@ namespace grb {
 						#pragma omp parallel
 						{
 							size_t start, end;
-							config::OMP::localRange( start, end, 0, dim );
+							localAssignedRange( start, end, 0, dim );
 #else
 							const size_t start = 0;
 							const size_t end = dim;
 #endif
-							for( size_t i = start; i < end; ++i ) {
-								_assigned[ i ] = false;
-							}
+							(void) clearAssigned< false >( start, end );
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
 						}
 #endif
@@ -493,7 +787,7 @@ namespace grb {
 						counts = _buffer;
 #endif
 						size_t start, end;
-						config::OMP::localRange( start, end, 0, _cap );
+						config::OMP::localRange( start, end, 0, _cap, assignedBlockSize() );
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
 						assert( start <= end );
 						assert( end <= _cap );
@@ -503,11 +797,7 @@ namespace grb {
 							<< start << "--" << end << "\n";
 #endif
 						// do recount interleaved with stack re-construction
-						for( size_t i = start; i < end; ++i ) {
-							if( _assigned[ i ] ) {
-								(void)++local_count;
-							}
-						}
+						local_count = countAssigned( start, end );
 						counts[ s ] = local_count;
 #ifdef _DEBUG
  #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
@@ -541,11 +831,7 @@ namespace grb {
 						#pragma omp barrier
 #endif
 						local_count = ( s == 0 ) ? 0 : counts[ s - 1 ];
-						for( size_t i = start; i < end; ++i ) {
-							if( _assigned[ i ] ) {
-								_stack[ local_count++ ] = i;
-							}
-						}
+						local_count = stackAssigned( start, end, local_count );
 						assert( local_count == counts[ s ] );
 #ifdef _DEBUG
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
@@ -610,7 +896,7 @@ namespace grb {
 							indices.insert( _stack[ k ] );
 						}
 						for( size_t i = 0; i < _cap; ++i ) {
-							if( _assigned[ i ] ) {
+							if( getAssigned( i ) ) {
 								assert( indices.find( i ) != indices.end() );
 							}
 						}
@@ -633,11 +919,11 @@ namespace grb {
  #endif
 							{
 								std::cout << "\tProcessing global stack element " << k << " which has index " << i << "."
-									<< " _assigned[ index ] = " << _assigned[ i ] << " and value[ index ] will be set to " << packed_in[ k ] << ".\n";
+									<< " _assigned[ index ] = " << getAssigned( i ) << " and value[ index ] will be set to " << packed_in[ k ] << ".\n";
 							}
 #endif
 							assert( i < _cap );
-							_assigned[ i ] = true;
+							(void) setAssignedAsync( i );
 							array_out[ i ] = packed_in[ k ];
 						}
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
@@ -681,7 +967,7 @@ namespace grb {
 							indices.insert( _stack[ k ] );
 						}
 						for( size_t i = 0; i < _cap; ++i ) {
-							if( _assigned[ i ] ) {
+							if( getAssigned( i ) ) {
 								assert( indices.find( i ) != indices.end() );
 							}
 						}
@@ -700,7 +986,7 @@ namespace grb {
 						for( size_t k = start; k < end; ++k ) {
 							const size_t i = _stack[ k ];
 							assert( i < _cap );
-							_assigned[ i ] = true;
+							(void) setAssignedAsync( i );
 						}
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
 					}
@@ -925,16 +1211,14 @@ namespace grb {
 #endif
 								size_t start, end;
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
-								config::OMP::localRange( start, end, 0, offset );
+								localAssignedRange( start, end, 0, offset );
 #else
 								start = 0;
 								end = offset;
 #endif
-								for( size_t i = start; i < end; ++i ) {
-									_assigned[ i ] = 0;
-								}
+								(void) clearAssigned< false >( start, end );
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
-								config::OMP::localRange(
+								localAssignedRange(
 									start, end,
 									offset + localSparsity.size(), _cap
 								);
@@ -942,9 +1226,7 @@ namespace grb {
 								start = offset + localSparsity.size();
 								end = _cap;
 #endif
-								for( size_t i = start; i < end; ++i ) {
-									_assigned[ i ] = 0;
-								}
+								(void) clearAssigned< false >( start, end );
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
 								config::OMP::localRange( start, end, 0, localSparsity._cap );
  #ifndef NDEBUG
@@ -955,7 +1237,7 @@ namespace grb {
 								end = localSparsity._cap;
 #endif
 								for( size_t i = start; i < end; ++i ) {
-									assert( _assigned[ i + offset ] );
+									assert( getAssigned( i + offset ) );
 									_stack[ i ] = i + offset;
 								}
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
@@ -989,16 +1271,14 @@ namespace grb {
 #endif
 							size_t start, end;
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
-							config::OMP::localRange( start, end, 0, offset );
+							localAssignedRange( start, end, 0, offset );
 #else
 							start = 0;
 							end = offset;
 #endif
-							for( size_t i = start; i < end; ++i ) {
-								_assigned[ i ] = 0;
-							}
+							(void) clearAssigned< false >( start, end );
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
-							config::OMP::localRange(
+							localAssignedRange(
 								start, end,
 								offset + localSparsity.size(), _cap
 							);
@@ -1006,9 +1286,7 @@ namespace grb {
 							start = offset + localSparsity.size();
 							end = _cap;
 #endif
-							for( size_t i = start; i < end; ++i ) {
-								_assigned[ i ] = 0;
-							}
+							(void) clearAssigned< false >( start, end );
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
 						}
 #endif
@@ -1030,7 +1308,7 @@ namespace grb {
 							size_t k = start;
 							while( k < end ) {
 								const StackType i = _stack[ k ];
-								if( _assigned[ i ] ) {
+								if( getAssigned( i ) ) {
 									// this nonzero is only valid if it is in the range of the
 									// localCoordinates
 									if( i >= offset && i < offset + localSparsity.size() ) {
@@ -1039,7 +1317,7 @@ namespace grb {
 										continue;
 									} else {
 										// now an invalid nonzero
-										_assigned[ i ] = false;
+										unsetAssignedAsync( i );
 									}
 								}
 								// this nonzero has become invalid, ignore it
@@ -1075,7 +1353,7 @@ namespace grb {
 						<< "exit...";
 					for( size_t i = 0; i < _n; ++i ) {
 						assert( _stack[ i ] < _cap );
-						assert( _assigned[ _stack[ i ] ] );
+						assert( getAssigned( _stack[ i ] ) );
 						assert( _stack[ i ] == localSparsity.index( i ) + offset );
 					}
 					std::cout << "done\n";
@@ -1100,8 +1378,8 @@ namespace grb {
 					if( _n == _cap ) {
 						return true;
 					}
-					if( !_assigned[ i ] ) {
-						_assigned[ i ] = true;
+					if( !getAssigned( i ) ) {
+						setAssigned( i );
 						const size_t newSize = _n + 1;
 						assert( _n <= _cap );
 						assert( newSize <= _cap );
@@ -1138,13 +1416,13 @@ namespace grb {
 							#pragma omp parallel
 							{
 								size_t start, end;
-								config::OMP::localRange( start, end, 0, _n );
+								localAssignedRange( start, end, 0, _n );
 #else
 								const size_t start = 0;
 								const size_t end = _n;
 #endif
+								fillAssigned( start, end );
 								for( size_t i = start; i < end; ++i ) {
-									_assigned[ i ] = true;
 									_stack[ i ] = i;
 								}
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
@@ -1229,8 +1507,7 @@ namespace grb {
 						return true;
 					}
 					// otherwise, check sparsity
-					if( !_assigned[ i ] ) {
-						_assigned[ i ] = true;
+					if( !setAssignedAsync( i ) ) {
 						const size_t localPos = incrementUpdate( localUpdate );
 						assert( localPos - 1 < maxAsyncAssigns() );
 						assert( localUpdate[ 0 ] <= maxAsyncAssigns() );
@@ -1461,8 +1738,8 @@ namespace grb {
 #endif
 					const size_t index = x._stack[ i ];
 					assert( index < _cap );
-					assert( x._assigned[ index ] == true );
-					_assigned[ index ] = true;
+					assert( x.getAssigned( index ) );
+					(void) setAssignedAsync( index );
 					_stack[ i ] = index;
 					return index;
 				}
@@ -1502,7 +1779,11 @@ namespace grb {
 				 * This function may be called on instances with any (other) state.
 				 */
 				inline void clear() noexcept {
-					if( _n == _cap ) {
+					// with compact coordinates, clearing all of #_assigned one word at a
+					// time is cheaper once the nonzeroes would touch as many cache lines
+					if( _n == _cap || (
+						coordinatesPerWord > 1 && _n >= _cap / assignedBlockSize()
+					) ) {
 #ifndef NDEBUG
 						if( _assigned == nullptr && _cap > 0 ) {
 							const bool dense_coordinates_may_not_call_clear = false;
@@ -1513,14 +1794,12 @@ namespace grb {
 						#pragma omp parallel
 						{
 							size_t start, end;
-							config::OMP::localRange( start, end, 0, _cap );
+							localAssignedRange( start, end, 0, _cap );
 #else
 							const size_t start = 0;
 							const size_t end = _cap;
 #endif
-							for( size_t i = start; i < end; ++i ) {
-								_assigned[ i ] = false;
-							}
+							(void) clearAssigned< false >( start, end );
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
 						}
 #endif
@@ -1529,7 +1808,7 @@ namespace grb {
 						if( _n < config::OMP::minLoopSize() ) {
 #endif
 							for( size_t k = 0; k < _n; ++k ) {
-								_assigned[ _stack[ k ] ] = false;
+								unsetAssigned( _stack[ k ] );
 							}
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
 						} else {
@@ -1537,7 +1816,7 @@ namespace grb {
 							// on the un-orderedness of the _stack
 							#pragma omp parallel for schedule( dynamic, config::CACHE_LINE_SIZE::value() )
 							for( size_t k = 0; k < _n; ++k ) {
-								_assigned[ _stack[ k ] ] = false;
+								unsetAssignedAsync( _stack[ k ] );
 							}
 						}
 #endif
@@ -1579,21 +1858,11 @@ namespace grb {
 						// static schedule during sparse matrix--vector multiplication in
 						// reference/blas2.hpp
 						size_t loop_start, loop_end;
-						config::OMP::localRange( loop_start, loop_end, start, end );
-#else
-						const size_t loop_start = start;
-						const size_t loop_end = end;
-#endif
-						for( size_t i = loop_start; i < loop_end; ++i ) {
-							if( _assigned[ i ] ) {
-#ifdef _H_GRB_REFERENCE_OMP_COORDINATES
-								(void) ++local_removed;
+						localAssignedRange( loop_start, loop_end, start, end );
+						local_removed = clearAssigned< true >( loop_start, loop_end );
 #else
-								(void) ++removed;
+						removed = clearAssigned< true >( start, end );
 #endif
-								_assigned[ i ] = false;
-							}
-						}
 #ifdef _H_GRB_REFERENCE_OMP_COORDINATES
 						#pragma omp critical
 						{
@@ -1621,6 +1890,30 @@ namespace grb {
 					return _n == _cap;
 				}
 
+				/**
+				 * @returns The cheapest way to traverse the nonzeroes of this coordinate
+				 *          set, as decided by its current number of nonzeroes.
+				 *
+				 * The #BITMAP traversal visits nonzeroes in increasing order of their
+				 * indices, while the #SPARSE traversal visits them in the order they
+				 * were assigned.
+				 *
+				 * @see config::VECTOR_REPRESENTATION
+				 *
+				 * This function may only be called on instances with valid state.
+				 */
+				inline Representation representation() const noexcept {
+					if( _n == _cap ) {
+						return DENSE;
+					}
+					if( _n * config::VECTOR_REPRESENTATION< reference >::bitmapRatio() >=
+						_cap
+					) {
+						return BITMAP;
+					}
+					return SPARSE;
+				}
+
 				/**
 				 * @returns The size (dimension) of the coordinate set.
 				 * This function may be called on instances with any state.
@@ -1643,7 +1936,7 @@ namespace grb {
 				 */
 				inline bool assigned( const size_t i ) const noexcept {
 					assert( i < _cap );
-					return _n == _cap || _assigned[ i ];
+					return _n == _cap || getAssigned( i );
 				}
 
 				/**
@@ -1659,7 +1952,7 @@ namespace grb {
 				 */
 				inline void prefetch_assigned( const size_t i ) const noexcept {
 					assert( i < _cap + config::PREFETCHING< reference >::distance() );
-					__builtin_prefetch( _assigned + i );
+					__builtin_prefetch( _assigned + i / coordinatesPerWord );
 				}
 
 				/**
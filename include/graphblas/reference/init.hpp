@@ -28,6 +28,7 @@
 
 #include <graphblas/base/init.hpp>
 #include <graphblas/utils/DMapper.hpp>
+#include <graphblas/utils/pool.hpp>
 
 
 namespace grb {
@@ -74,7 +75,8 @@ namespace grb {
 		 *
 		 * @param[in] n The desired number of elements of type \a D.
 		 *
-		 * This implementation uses recursive doubling.
+		 * This implementation uses recursive doubling. Buffers are taken from and
+		 * returned to the #grb::utils::ContainerPool.
 		 *
 		 * @returns true  if the requested size is available.
 		 * @returns false if allocation for the requested buffers size has failed.
@@ -85,10 +87,13 @@ namespace grb {
 			const size_t targetSize = n * sizeof( D );
 			if( reference_bufsize < targetSize ) {
 				size_t newSize = std::max( 2 * reference_bufsize, targetSize );
+				utils::ContainerPool &pool = utils::ContainerPool::instance();
 				if( reference_bufsize > 0 ) {
-					delete[] reference_buffer;
+					pool.release( reference_buffer, reference_bufsize,
+						utils::ContainerPool::ALIGNED );
 				}
-				reference_buffer = new( std::nothrow ) char[ newSize ];
+				reference_buffer = static_cast< char * >(
+					pool.allocate( newSize, utils::ContainerPool::ALIGNED ) );
 				if( reference_buffer == nullptr ) {
 					reference_bufsize = 0;
 					return false;
@@ -31,6 +31,7 @@
 #include <utility>
 #include <iterator>
 #include <cmath>
+#include <cstring> // std::memcpy
 
 #include <assert.h>
 
@@ -50,6 +51,7 @@
 
 #include "NonzeroWrapper.hpp"
 #include "forward.hpp"
+#include "numa.hpp"
 
 
 namespace grb {
@@ -1527,6 +1529,9 @@ namespace grb {
 #ifdef _H_GRB_REFERENCE_OMP_MATRIX
 				}
 #endif
+				// the offset arrays hold one more element than their dimension
+				CRS.col_start[ m ] = 0;
+				CCS.col_start[ n ] = 0;
 			}
 
 			/** @see Matrix::clear */
@@ -1853,8 +1858,88 @@ namespace grb {
 					std::cerr << "cannot populate the CCS" << std::endl;
 #endif
 					clear();
+					return ret;
+				}
+				// the above wrote nonzeroes in input order, from whichever thread
+				// processed them; move them to where the compute kernels need them
+				if( config::IMPLEMENTATION<>::sharedAllocMode() ==
+					config::ALLOC_MODE::LOCAL
+				) {
+					// placement is an optimisation only: on failure, the matrix remains
+					// valid in its current memory areas
+					if( placeStorage( CRS, m, _deleter[ 2 ], _deleter[ 3 ] ) != SUCCESS ||
+						placeStorage( CCS, n, _deleter[ 4 ], _deleter[ 5 ] ) != SUCCESS
+					) {
+#ifdef _DEBUG
+						std::cerr << "could not place the CRS and CCS by first touch\n";
+#endif
+					}
+				}
+				return SUCCESS;
+			}
+
+			/**
+			 * Moves the nonzeroes of a given CRS or CCS into newly allocated arrays,
+			 * which are first-touched by the threads that process them in the compute
+			 * kernels, i.e., following #config::OMP::localRange over the \a major
+			 * dimension.
+			 *
+			 * This function should only be called for matrices that reside in
+			 * #config::ALLOC_MODE::LOCAL memory. On error, \a storage is unmodified.
+			 *
+			 * @param[in,out] storage        The CRS or CCS to place.
+			 * @param[in]     major          The size of the major dimension of
+			 *                               \a storage.
+			 * @param[in,out] values_deleter The deleter of the value array.
+			 * @param[in,out] index_deleter  The deleter of the index array.
+			 */
+			template< typename Storage >
+			RC placeStorage(
+				Storage &storage, const size_t major,
+				utils::AutoDeleter< char > &values_deleter,
+				utils::AutoDeleter< char > &index_deleter
+			) {
+				assert( nz > 0 );
+				assert( cap >= nz );
+				size_t sizes[ 2 ];
+				storage.getAllocSize( &( sizes[ 0 ] ), cap );
+				char * alloc[ 2 ] = { nullptr, nullptr };
+				utils::AutoDeleter< char > new_deleter[ 2 ];
+				const RC ret = utils::alloc(
+					"grb::Matrix< T, reference >::placeStorage",
+					"for NUMA-local placement",
+					alloc[ 0 ], sizes[ 0 ], true, new_deleter[ 0 ],
+					alloc[ 1 ], sizes[ 1 ], true, new_deleter[ 1 ]
+				);
+				if( ret != SUCCESS ) {
+					return ret;
 				}
-				return ret;
+				void * old[ 2 ];
+				storage.getPointers( old );
+				const size_t value_size = sizes[ 0 ] / cap;
+				const size_t index_size = sizes[ 1 ] / cap;
+				const NonzeroIndexType * const offsets = storage.getOffsets();
+				#pragma omp parallel
+				{
+					size_t start, end;
+					config::OMP::localRange( start, end, 0, major );
+					const size_t lo = offsets[ start ];
+					const size_t hi = offsets[ end ];
+					if( lo < hi && value_size > 0 ) {
+						(void) std::memcpy( alloc[ 0 ] + lo * value_size,
+							static_cast< const char * >( old[ 0 ] ) + lo * value_size,
+							(hi - lo) * value_size );
+					}
+					if( lo < hi ) {
+						(void) std::memcpy( alloc[ 1 ] + lo * index_size,
+							static_cast< const char * >( old[ 1 ] ) + lo * index_size,
+							(hi - lo) * index_size );
+					}
+				}
+				storage.replace( alloc[ 0 ], alloc[ 1 ] );
+				values_deleter = new_deleter[ 0 ];
+				index_deleter = new_deleter[ 1 ];
+				return SUCCESS;
 			}
 #endif
 
@@ -0,0 +1,278 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Utilities for placing the shared containers of the reference_omp backend on
+ * the NUMA nodes of the threads that process them. For internal use only.
+ *
+ * These utilities only take effect if <tt>_GRB_NUMA_FIRST_TOUCH</tt> is
+ * defined, in which case #grb::config::ALLOC_MODE::LOCAL is the shared
+ * allocation mode of the reference_omp backend. The replication of input
+ * vectors additionally must be requested at run time; see
+ * #grb::internal::replicationRequested.
+ */
+
+#ifndef _H_GRB_REFERENCE_NUMA
+#define _H_GRB_REFERENCE_NUMA
+
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+
+#include <assert.h>
+#include <unistd.h>
+
+#if defined _GRB_NUMA_FIRST_TOUCH && !defined _GRB_NO_LIBNUMA
+ #include <numa.h>
+ #include <sched.h>
+#endif
+
+#include <graphblas/config.hpp>
+#include <graphblas/utils/autodeleter.hpp>
+
+
+namespace grb {
+
+	namespace internal {
+
+		/** @returns The size of a memory page, in bytes. */
+		inline size_t pageSize() {
+			static const size_t size = static_cast< size_t >( sysconf( _SC_PAGESIZE ) );
+			return size;
+		}
+
+#ifdef _GRB_WITH_OMP
+		/**
+		 * Writes to every memory page of \a array so that each page is placed on
+		 * the NUMA node of the thread that, according to
+		 * #grb::config::OMP::localRange, is responsible for the elements it holds.
+		 *
+		 * Must be called from outside of a parallel region, on memory that was not
+		 * yet written to. The contents of \a array are undefined on output.
+		 *
+		 * @param[in] array The array to place.
+		 * @param[in] n     The number of elements in \a array.
+		 */
+		template< typename T >
+		void firstTouch( T * const array, const size_t n ) {
+			if( array == nullptr || n == 0 ) {
+				return;
+			}
+			const size_t page = pageSize();
+			#pragma omp parallel
+			{
+				size_t start, end;
+				config::OMP::localRange( start, end, 0, n );
+				volatile char * const bytes = reinterpret_cast< char * >( array );
+				const size_t lo = start * sizeof( T );
+				const size_t hi = end * sizeof( T );
+				for( size_t k = lo; k < hi; k = (k / page + 1) * page ) {
+					bytes[ k ] = 0;
+				}
+			}
+		}
+#endif
+
+		/**
+		 * @returns Whether the gathering kernels of vxm and mxv should read a copy
+		 *          of their input vector from the NUMA node of the calling thread;
+		 *          see #InputReplicas.
+		 *
+		 * This placement mode is opt-in, since refreshing the copies costs a pass
+		 * over the input vector per NUMA node on every call. It is requested by
+		 * setting the <tt>GRB_NUMA_REPLICATE</tt> environment variable to a nonzero
+		 * value, which is read once.
+		 */
+		inline bool replicationRequested() {
+			static const bool requested = [] () {
+				const char * const contents = getenv( "GRB_NUMA_REPLICATE" );
+				return contents != nullptr && strtol( contents, nullptr, 10 ) != 0;
+			}();
+			return requested;
+		}
+
+#if defined _GRB_NUMA_FIRST_TOUCH && !defined _GRB_NO_LIBNUMA
+		/**
+		 * The per-node memory areas that hold the copies made by #InputReplicas.
+		 *
+		 * Areas are retained across calls and only grow, so that repeated
+		 * multiplications with inputs of the same size allocate only once.
+		 */
+		class ReplicaAreas {
+
+			private:
+
+				/** The area on each node; a <tt>nullptr</tt> if absent. */
+				std::vector< void * > _areas;
+
+				/** The size of each area, in bytes. */
+				std::vector< size_t > _sizes;
+
+				/** Frees the areas on destruction. */
+				std::vector< utils::AutoDeleter< char > > _deleters;
+
+				ReplicaAreas() {}
+
+
+			public:
+
+				/** @returns The process-wide instance. */
+				static ReplicaAreas & instance() {
+					static ReplicaAreas areas;
+					return areas;
+				}
+
+				/**
+				 * @returns An area of at least \a size bytes on the given \a node, or a
+				 *          <tt>nullptr</tt> if it could not be allocated.
+				 *
+				 * Any previous contents are lost if the area must grow. Not thread-safe.
+				 */
+				void * get( const int node, const size_t size ) {
+					assert( node >= 0 );
+					const size_t index = static_cast< size_t >( node );
+					if( index >= _areas.size() ) {
+						_areas.resize( index + 1, nullptr );
+						_sizes.resize( index + 1, 0 );
+						_deleters.resize( index + 1 );
+					}
+					if( _sizes[ index ] < size ) {
+						_deleters[ index ].clear();
+						_areas[ index ] = nullptr;
+						_sizes[ index ] = 0;
+						void * const area = numa_alloc_onnode( size, node );
+						if( area != nullptr ) {
+							_areas[ index ] = area;
+							_sizes[ index ] = size;
+							_deleters[ index ] = utils::AutoDeleter< char >(
+								static_cast< char * >( area ), size );
+						}
+					}
+					return _areas[ index ];
+				}
+
+		};
+#endif
+
+		/**
+		 * Keeps a copy of a read-only input array on every NUMA node, so that the
+		 * gathering kernels of the reference_omp backend need not read their input
+		 * vector from remote memory.
+		 *
+		 * Replication only takes place if <tt>_GRB_NUMA_FIRST_TOUCH</tt> is defined,
+		 * it is requested at run time (see #replicationRequested), libnuma is
+		 * available, the system has more than one NUMA node, and the input is at
+		 * least #minReplicationSize() bytes. In all other cases, #replicate simply
+		 * returns its input.
+		 *
+		 * The copies reside in #ReplicaAreas, which are retained across calls. Their
+		 * contents, however, are refreshed on every call to #replicate: vectors may
+		 * be written through raw pointers the backend cannot track, such as those
+		 * of vectors wrapped around user memory, so that a copy cannot be known to
+		 * be current otherwise.
+		 *
+		 * \note The node of a thread is determined by the CPU it runs on when
+		 *       calling #replicate. Threads should hence be pinned, e.g., by setting
+		 *       <tt>OMP_PROC_BIND</tt>.
+		 */
+		template< typename T >
+		class InputReplicas {
+
+			private:
+
+				/** Per-node copies of the input array; a <tt>nullptr</tt> if absent. */
+				std::vector< T * > _replicas;
+
+
+			public:
+
+				/**
+				 * Smaller inputs are not replicated since they tend to be cached
+				 * effectively regardless of where they reside.
+				 */
+				static constexpr size_t minReplicationSize() {
+					return 1 << 20;
+				}
+
+				/**
+				 * Returns the copy of \a source on the NUMA node of the calling thread.
+				 *
+				 * If replication is enabled, this function must be called by all threads
+				 * of the current parallel region, each with the same arguments. It then
+				 * synchronises all threads of that region, and returns \a source on any
+				 * thread for which no copy could be made.
+				 *
+				 * @param[in] source The input array.
+				 * @param[in] n      The number of elements in \a source.
+				 * @param[in] dense  Whether the kernel will read most of \a source;
+				 *                   if not, replication does not pay off.
+				 */
+				const T * replicate(
+					const T * const source, const size_t n, const bool dense
+				) {
+#if defined _GRB_NUMA_FIRST_TOUCH && !defined _GRB_NO_LIBNUMA && \
+	defined _GRB_WITH_OMP
+					const size_t size = n * sizeof( T );
+					if( !dense || size < minReplicationSize() || !replicationRequested() ||
+						numa_available() < 0 || numa_num_configured_nodes() < 2
+					) {
+						return source;
+					}
+					#pragma omp single
+					{
+						ReplicaAreas &areas = ReplicaAreas::instance();
+						const int nodes = numa_max_node() + 1;
+						_replicas.assign( nodes, nullptr );
+						for( int node = 0; node < nodes; ++node ) {
+							_replicas[ node ] = static_cast< T * >( areas.get( node, size ) );
+						}
+					}
+					// numa_alloc_onnode binds pages, so any thread may fill any replica
+					size_t start, end;
+					config::OMP::localRange( start, end, 0, n );
+					for( T * const replica : _replicas ) {
+						if( replica != nullptr && start < end ) {
+							(void) std::memcpy( replica + start, source + start,
+								(end - start) * sizeof( T ) );
+						}
+					}
+					#pragma omp barrier
+					const int cpu = sched_getcpu();
+					const int node = cpu < 0 ? -1 : numa_node_of_cpu( cpu );
+					if( node < 0 || static_cast< size_t >( node ) >= _replicas.size() ||
+						_replicas[ node ] == nullptr
+					) {
+						return source;
+					}
+					return _replicas[ node ];
+#else
+					(void) n;
+					(void) dense;
+					return source;
+#endif
+				}
+
+		};
+
+	} // end namespace ``grb::internal''
+
+} // end namespace grb
+
+#endif // end ``_H_GRB_REFERENCE_NUMA''
+
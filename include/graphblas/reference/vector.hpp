@@ -52,6 +52,7 @@
 
 #include "compressed_storage.hpp"
 #include "coordinates.hpp"
+#include "numa.hpp"
 #include "spmd.hpp"
 
 #define NO_CAST_ASSERT( x, y, z )                                              \
@@ -425,6 +426,15 @@ namespace grb {
 					"allocation" );
 			}
 
+#ifdef _H_GRB_REFERENCE_OMP_VECTOR
+			// place the values on the NUMA nodes of the threads that process them
+			if( config::IMPLEMENTATION<>::sharedAllocMode() ==
+				config::ALLOC_MODE::LOCAL
+			) {
+				internal::firstTouch( _raw, cap_in );
+			}
+#endif
+
 			// assign _id
 			assert( assigned != nullptr );
 			if( id_in == nullptr ) {
@@ -0,0 +1,394 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Defines #grb::Replay, which records a sequence of ALP primitives once and
+ * re-executes it any number of times, after whole-program optimisation.
+ */
+
+#ifndef _H_GRB_REPLAY
+#define _H_GRB_REPLAY
+
+#include <set>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <assert.h>
+
+#include <graphblas/rc.hpp>
+
+
+namespace grb {
+
+	/**
+	 * Records a sequence of ALP primitives, called stages, together with the
+	 * containers and scalars every stage reads and writes, and re-executes the
+	 * recorded sequence on demand.
+	 *
+	 * Programs that repeatedly execute the same sequence of primitives on fresh
+	 * data may record that sequence once. Every re-execution then operates on the
+	 * current contents of the recorded containers, so that new inputs are passed
+	 * by updating the input containers before calling #execute.
+	 *
+	 * Since the full sequence is known, #optimise may apply optimisations that
+	 * a backend cannot apply while primitives are called one at a time:
+	 *  1. stages that do not contribute to any of the given outputs are
+	 *     eliminated, as are thus all writes to dead temporaries;
+	 *  2. the remaining stages are reordered, subject to their dependences, such
+	 *     that stages of type #FUSABLE form runs that are as long as possible,
+	 *     and such that a stage preferably follows the stage that produced its
+	 *     input.
+	 * With the nonblocking backend, every run of #FUSABLE stages then may be
+	 * fused into a single pipeline by its lazy evaluation, since no #BARRIER
+	 * stage forces the execution of the pipeline half-way.
+	 *
+	 * Dependences are derived from the addresses that stages declare to read and
+	 * write, in the same way as the hyperdags backend derives its HyperDAG from
+	 * the containers that primitives read and write. This class does not
+	 * inspect the stages themselves, which may be any callable returning an
+	 * #grb::RC.
+	 */
+	class Replay {
+
+		public:
+
+			/** The type of a recorded stage. */
+			typedef std::function< RC() > Stage;
+
+			/** Whether a stage may be fused with its neighbours. */
+			enum StageType {
+
+				/**
+				 * A stage that backends may defer and fuse with neighbouring fusable
+				 * stages, such as element-wise BLAS1 primitives and most BLAS2
+				 * primitives with vector outputs.
+				 */
+				FUSABLE,
+
+				/**
+				 * A stage that forces the execution of any deferred stages, such as
+				 * primitives with scalar outputs, BLAS3 primitives, or I/O.
+				 */
+				BARRIER
+
+			};
+
+
+		private:
+
+			/** The recorded stages. */
+			std::vector< Stage > stages;
+
+			/** The type of every recorded stage. */
+			std::vector< StageType > types;
+
+			/** The addresses every recorded stage reads. */
+			std::vector< std::vector< const void * > > sources;
+
+			/** The addresses every recorded stage writes. */
+			std::vector< std::vector< const void * > > destinations;
+
+			/**
+			 * The order in which #execute calls the stages, if #optimised; otherwise
+			 * all stages are called in the order they were recorded.
+			 */
+			std::vector< size_t > schedule;
+
+			/** Whether #schedule is valid. */
+			bool optimised;
+
+			/** @returns Whether the stage \a i is of type #FUSABLE. */
+			bool fusable( const size_t i ) const noexcept {
+				return types[ i ] == FUSABLE;
+			}
+
+
+		public:
+
+			/** Creates an empty recording. */
+			Replay() : optimised( false ) {}
+
+			/**
+			 * Records a stage.
+			 *
+			 * @param[in] type         The type of the stage.
+			 * @param[in] stage        The callable that executes the stage. It is
+			 *                         called every time #execute is, and typically
+			 *                         captures the containers it operates on by
+			 *                         reference.
+			 * @param[in] reads        The addresses of all containers and scalars
+			 *                         that \a stage reads.
+			 * @param[in] writes       The addresses of all containers and scalars
+			 *                         that \a stage writes.
+			 *
+			 * As with the sources recorded by the hyperdags backend, a container
+			 * that is written only partially, such as the output of a masked
+			 * primitive, of an in-place primitive like #grb::foldl, or of a
+			 * primitive with an accumulator, must be passed in both \a reads and
+			 * \a writes.
+			 *
+			 * Recording a stage invalidates any previous call to #optimise.
+			 *
+			 * @returns #grb::SUCCESS  When the stage was recorded.
+			 * @returns #grb::OUTOFMEM When the stage could not be recorded due to an
+			 *                         out-of-memory condition, in which case this
+			 *                         recording is unchanged.
+			 */
+			RC record(
+				const StageType type, const Stage &stage,
+				const std::vector< const void * > &reads,
+				const std::vector< const void * > &writes
+			) {
+				Stage stageCopy;
+				std::vector< const void * > readsCopy, writesCopy;
+				try {
+					stages.reserve( stages.size() + 1 );
+					types.reserve( types.size() + 1 );
+					sources.reserve( sources.size() + 1 );
+					destinations.reserve( destinations.size() + 1 );
+					stageCopy = stage;
+					readsCopy = reads;
+					writesCopy = writes;
+				} catch( ... ) {
+					return OUTOFMEM;
+				}
+				// capacities suffice, hence the below do not allocate
+				stages.push_back( std::move( stageCopy ) );
+				types.push_back( type );
+				sources.push_back( std::move( readsCopy ) );
+				destinations.push_back( std::move( writesCopy ) );
+				optimised = false;
+				return SUCCESS;
+			}
+
+			/**
+			 * Optimises the recorded stages for the given outputs.
+			 *
+			 * @param[in] outputs The addresses of the containers and scalars whose
+			 *                    values must be computed by #execute. The values of
+			 *                    all other containers and scalars written by the
+			 *                    recorded stages are undefined after #execute.
+			 *
+			 * Stages that write to none of the given outputs, nor to any container or
+			 * scalar that is (transitively) read by a stage that does, are
+			 * eliminated. Stages that declare no writes at all are never eliminated.
+			 * The remaining stages are reordered as described in the class
+			 * documentation.
+			 *
+			 * Performance is log-linear in the total number of reads and writes the
+			 * recorded stages declare.
+			 *
+			 * @returns #grb::SUCCESS  When the recording was optimised.
+			 * @returns #grb::OUTOFMEM When the recording could not be optimised due to
+			 *                         an out-of-memory condition, in which case
+			 *                         #execute calls all stages in the order they
+			 *                         were recorded.
+			 */
+			RC optimise( const std::vector< const void * > &outputs ) {
+				optimised = false;
+				const size_t n = stages.size();
+				try {
+					// eliminate dead stages, from the last stage backwards
+					std::vector< bool > live( n, false );
+					std::unordered_set< const void * > needed( outputs.begin(),
+						outputs.end() );
+					for( size_t k = n; k > 0; --k ) {
+						const size_t i = k - 1;
+						live[ i ] = destinations[ i ].empty();
+						for( const void * const dst : destinations[ i ] ) {
+							if( needed.find( dst ) != needed.end() ) {
+								live[ i ] = true;
+							}
+						}
+						if( !live[ i ] ) {
+							continue;
+						}
+						for( const void * const dst : destinations[ i ] ) {
+							(void) needed.erase( dst );
+						}
+						needed.insert( sources[ i ].begin(), sources[ i ].end() );
+					}
+
+					// derive the read-after-write, write-after-read, and
+					// write-after-write dependences between live stages
+					std::vector< std::vector< size_t > > successors( n );
+					std::vector< size_t > predecessors( n, 0 );
+					std::unordered_map< const void *, size_t > lastWriter;
+					std::unordered_map< const void *, std::vector< size_t > > readers;
+					const auto addEdge = [ &successors, &predecessors ](
+						const size_t from, const size_t to
+					) {
+						if( from != to ) {
+							successors[ from ].push_back( to );
+							(void) ++predecessors[ to ];
+						}
+					};
+					for( size_t i = 0; i < n; ++i ) {
+						if( !live[ i ] ) {
+							continue;
+						}
+						for( const void * const src : sources[ i ] ) {
+							const auto it = lastWriter.find( src );
+							if( it != lastWriter.end() ) {
+								addEdge( it->second, i );
+							}
+							readers[ src ].push_back( i );
+						}
+						for( const void * const dst : destinations[ i ] ) {
+							const auto it = lastWriter.find( dst );
+							if( it != lastWriter.end() ) {
+								addEdge( it->second, i );
+							}
+							std::vector< size_t > &previous = readers[ dst ];
+							for( const size_t reader : previous ) {
+								addEdge( reader, i );
+							}
+							previous.clear();
+							lastWriter[ dst ] = i;
+						}
+					}
+
+					// list scheduling that prefers fusable stages, and among those
+					// prefers consumers of the stage that was scheduled last
+					std::set< size_t > readyFusable, readyBarrier, consumers;
+					for( size_t i = 0; i < n; ++i ) {
+						if( live[ i ] && predecessors[ i ] == 0 ) {
+							(void) ( fusable( i ) ? readyFusable : readyBarrier ).insert( i );
+						}
+					}
+					std::vector< size_t > order;
+					while( !readyFusable.empty() || !readyBarrier.empty() ) {
+						size_t next;
+						if( !consumers.empty() ) {
+							next = *consumers.begin();
+						} else if( !readyFusable.empty() ) {
+							next = *readyFusable.begin();
+						} else {
+							next = *readyBarrier.begin();
+						}
+						(void) readyFusable.erase( next );
+						(void) readyBarrier.erase( next );
+						consumers.clear();
+						order.push_back( next );
+						for( const size_t successor : successors[ next ] ) {
+							assert( predecessors[ successor ] > 0 );
+							if( --predecessors[ successor ] > 0 ) {
+								continue;
+							}
+							if( fusable( successor ) ) {
+								(void) readyFusable.insert( successor );
+								(void) consumers.insert( successor );
+							} else {
+								(void) readyBarrier.insert( successor );
+							}
+						}
+					}
+					schedule = std::move( order );
+				} catch( ... ) {
+					return OUTOFMEM;
+				}
+				optimised = true;
+				return SUCCESS;
+			}
+
+			/**
+			 * Executes the recording.
+			 *
+			 * Calls the stages as scheduled by the last call to #optimise, or, if
+			 * the recording was not optimised, calls all stages in the order they
+			 * were recorded.
+			 *
+			 * @returns #grb::SUCCESS When all stages returned #grb::SUCCESS.
+			 * @returns The error code of the first stage that did not return
+			 *          #grb::SUCCESS, in which case no subsequent stages are called.
+			 */
+			RC execute() const {
+				if( optimised ) {
+					for( const size_t i : schedule ) {
+						const RC ret = stages[ i ]();
+						if( ret != SUCCESS ) {
+							return ret;
+						}
+					}
+				} else {
+					for( const Stage &stage : stages ) {
+						const RC ret = stage();
+						if( ret != SUCCESS ) {
+							return ret;
+						}
+					}
+				}
+				return SUCCESS;
+			}
+
+			/** @returns The number of recorded stages. */
+			size_t numStages() const noexcept {
+				return stages.size();
+			}
+
+			/** @returns The number of stages that #execute calls. */
+			size_t numScheduled() const noexcept {
+				return optimised ? schedule.size() : stages.size();
+			}
+
+			/**
+			 * @returns The number of maximal runs of consecutive #FUSABLE stages that
+			 *          #execute calls.
+			 */
+			size_t numFusedGroups() const noexcept {
+				size_t ret = 0;
+				bool inGroup = false;
+				for( size_t k = 0; k < numScheduled(); ++k ) {
+					const size_t i = optimised ? schedule[ k ] : k;
+					if( fusable( i ) && !inGroup ) {
+						(void) ++ret;
+					}
+					inGroup = fusable( i );
+				}
+				return ret;
+			}
+
+			/**
+			 * @returns The index, in the order of recording, of the \a k-th stage
+			 *          that #execute calls.
+			 */
+			size_t scheduled( const size_t k ) const noexcept {
+				assert( k < numScheduled() );
+				return optimised ? schedule[ k ] : k;
+			}
+
+			/** Removes all recorded stages. */
+			void clear() noexcept {
+				stages.clear();
+				types.clear();
+				sources.clear();
+				destinations.clear();
+				schedule.clear();
+				optimised = false;
+			}
+
+	}; // end class ``grb::Replay''
+
+} // end namespace grb
+
+#endif // end ``_H_GRB_REPLAY''
+
@@ -35,6 +35,9 @@
 #ifdef _GRB_WITH_NONBLOCKING
  #include "graphblas/nonblocking/spmd.hpp"
 #endif
+#ifdef _GRB_WITH_PROFILE
+ #include <graphblas/profile/spmd.hpp>
+#endif
 #ifdef _GRB_WITH_LPF
  #include "graphblas/bsp1d/spmd.hpp"
 #endif
@@ -0,0 +1,160 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Defines the types used to specify and schedule sparse triangular solves.
+ *
+ * @see grb::triangularAnalysis
+ * @see grb::triangularSolve
+ */
+
+#ifndef _H_GRB_TRIANGULAR
+#define _H_GRB_TRIANGULAR
+
+#include <vector>
+#include <cstddef>
+
+
+namespace grb {
+
+	/**
+	 * Which triangle of a square matrix a triangular solve operates on.
+	 *
+	 * Nonzeroes outside of the selected triangle are ignored.
+	 */
+	enum Triangle {
+
+		/** The diagonal and all nonzeroes \f$ a_{ij} \f$ with \f$ j < i \f$. */
+		LOWER = 0,
+
+		/** The diagonal and all nonzeroes \f$ a_{ij} \f$ with \f$ j > i \f$. */
+		UPPER
+
+	};
+
+	/**
+	 * How the diagonal of a triangular matrix is to be interpreted.
+	 */
+	enum Diagonal {
+
+		/**
+		 * The diagonal is stored explicitly. Every row must contain a diagonal
+		 * nonzero.
+		 */
+		NON_UNIT = 0,
+
+		/**
+		 * The diagonal is implicitly all ones. Any stored diagonal nonzeroes are
+		 * ignored.
+		 */
+		UNIT
+
+	};
+
+	/**
+	 * The result of the analysis phase of a sparse triangular solve.
+	 *
+	 * An instance is produced by #grb::triangularAnalysis, and may be passed to
+	 * any number of subsequent calls to #grb::triangularSolve that use the same
+	 * matrix. The analysis partitions the rows of the matrix into \em levels:
+	 * all rows in the same level depend only on rows of preceding levels, and
+	 * hence may be solved for concurrently.
+	 *
+	 * A default-constructed instance is empty and may not be used with
+	 * #grb::triangularSolve.
+	 *
+	 * \note If the matrix the analysis was performed on is modified, the
+	 *       schedule must be recomputed.
+	 */
+	class TriangularSchedule {
+
+		public:
+
+			/** Constructs an empty schedule. */
+			TriangularSchedule() :
+				n( 0 ), nz( 0 ), triangle( LOWER ), diagonal( NON_UNIT ),
+				transposed( false )
+			{}
+
+			/** @returns The number of rows the schedule was computed for. */
+			size_t size() const noexcept {
+				return n;
+			}
+
+			/**
+			 * @returns The number of levels; a lower bound on the number of
+			 *          synchronisations a parallel solve requires.
+			 */
+			size_t levels() const noexcept {
+				return level_start.size() == 0 ? 0 : level_start.size() - 1;
+			}
+
+			/** @returns Which triangle the schedule was computed for. */
+			Triangle getTriangle() const noexcept {
+				return triangle;
+			}
+
+			/** @returns Which type of diagonal the schedule was computed for. */
+			Diagonal getDiagonal() const noexcept {
+				return diagonal;
+			}
+
+			/**
+			 * \internal
+			 * The below are set by backend implementations of
+			 * #grb::triangularAnalysis and read by #grb::triangularSolve.
+			 * \endinternal
+			 */
+
+			/** \internal The matrix size. */
+			size_t n;
+
+			/** \internal The number of nonzeroes of the analysed matrix. */
+			size_t nz;
+
+			/** \internal The triangle the schedule corresponds to. */
+			Triangle triangle;
+
+			/** \internal The diagonal type the schedule corresponds to. */
+			Diagonal diagonal;
+
+			/** \internal Whether the schedule is for the transposed matrix. */
+			bool transposed;
+
+			/**
+			 * \internal Offsets into #rows at which each level starts. Has size
+			 *           #levels() + 1.
+			 */
+			std::vector< size_t > level_start;
+
+			/** \internal The row indices, ordered by level. Has size #n. */
+			std::vector< size_t > rows;
+
+			/**
+			 * \internal For each row, the offset of its diagonal nonzero. Empty when
+			 *           #diagonal equals #grb::UNIT.
+			 */
+			std::vector< size_t > diagonal_offsets;
+
+	};
+
+} // end namespace grb
+
+#endif // end ``_H_GRB_TRIANGULAR''
+
@@ -111,6 +111,26 @@ namespace grb {
 		static const constexpr bool value = false;
 	};
 
+	/**
+	 * Used to inspect whether a given type is an ALP epilogue.
+	 *
+	 * @tparam T The type to inspect.
+	 *
+	 * @see grb::epilogues
+	 *
+	 * \ingroup typeTraits
+	 */
+	template< typename T >
+	struct is_epilogue {
+
+		/**
+		 * Whether \a T is an ALP epilogue.
+		 *
+		 * \internal Base case: an arbitrary type is not an ALP epilogue.
+		 */
+		static const constexpr bool value = false;
+	};
+
 	/**
 	 * Used to inspect whether a given type is an ALP/GraphBLAS object.
 	 *
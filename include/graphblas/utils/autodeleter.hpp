@@ -34,6 +34,7 @@
 #include <memory>
 
 #include "graphblas/config.hpp"
+#include "graphblas/utils/pool.hpp"
 
 namespace grb {
 
@@ -72,6 +73,30 @@ namespace grb {
 #endif
 			};
 
+			/** Returns a memory area to the #grb::utils::ContainerPool. */
+			template< typename T >
+			class PoolReleaser {
+
+				private:
+
+					/** The size of the memory area, in bytes. */
+					size_t size;
+
+					/** The kind of the memory area. */
+					ContainerPool::Kind kind;
+
+				public:
+
+					PoolReleaser( const size_t size_in, const ContainerPool::Kind kind_in ) :
+						size( size_in ), kind( kind_in )
+					{}
+
+					void operator()( T * const pointer ) {
+						ContainerPool::instance().release( pointer, size, kind );
+					}
+
+			};
+
 		} // namespace internal
 
 	} // namespace utils
@@ -139,6 +164,21 @@ namespace grb {
 #endif
 			};
 
+			/**
+			 * Constructs a new AutoDeleter from a pointer that was allocated via
+			 * #grb::utils::ContainerPool::allocate. When this instance and all
+			 * instances copied from this one are destroyed, the pointer will be
+			 * released to the pool.
+			 *
+			 * @throws std::bad_alloc If the system cannot allocate enough memory.
+			 */
+			AutoDeleter(
+				T * const pointer, const size_t size, const ContainerPool::Kind kind
+			) {
+				_shPtr = std::shared_ptr< T >( pointer,
+					internal::PoolReleaser< T >( size, kind ) );
+			}
+
 			/**
 			 * Copies an \a other AutoDeleter. The underlying pointer will only be freed
 			 * if at least this new AutoDeleter and the \a other AutoDeleter are
@@ -0,0 +1,222 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Defines the pool that recycles the memory areas of ALP containers.
+ */
+
+#ifndef _H_GRB_UTILS_POOL
+#define _H_GRB_UTILS_POOL
+
+#include <mutex>
+#include <vector>
+
+#include <stddef.h>
+
+
+namespace grb {
+
+	namespace utils {
+
+		/**
+		 * A thread-safe pool of memory areas for ALP containers.
+		 *
+		 * Algorithms that repeatedly construct and destroy temporary containers,
+		 * or services that run many small queries, otherwise pay for a system call
+		 * and for page faults every time a container is constructed. Instead, the
+		 * pool keeps released memory areas on free lists, one for each size class,
+		 * and hands them out again on subsequent allocations of a similar size.
+		 *
+		 * Size classes are spaced four per power of two, so that at most a quarter
+		 * of any memory area is wasted. The pool retains at most
+		 * #grb::config::MEMORY_POOL::maxRetained() bytes that are not in use; it
+		 * never recycles areas larger than that.
+		 *
+		 * The pool is used by all backends that allocate via the reference
+		 * allocator. Memory areas allocated for first-touch placement bypass the
+		 * pool, since recycled areas have been touched already. If
+		 * #grb::config::MEMORY_POOL::enabled() does not hold, the pool does not
+		 * retain any memory areas but still collects statistics.
+		 *
+		 * There is one pool per process, which is never destroyed, so that
+		 * containers with static storage duration may safely release their memory
+		 * at program exit.
+		 */
+		class ContainerPool {
+
+			public:
+
+				/** The kinds of memory areas the pool manages. */
+				enum Kind {
+
+					/** Memory allocated via <tt>posix_memalign</tt>. */
+					ALIGNED = 0,
+
+					/** Memory allocated via <tt>numa_alloc_interleaved</tt>. */
+					INTERLEAVED = 1,
+
+					/**
+					 * Memory mapped in multiples of
+					 * #grb::config::MEMORY_POOL::hugePageSize(), backed by huge pages if
+					 * possible.
+					 *
+					 * Explicit huge pages are requested via <tt>MAP_HUGETLB</tt> first. If
+					 * none are available, the area is aligned to a huge page boundary and
+					 * transparent huge pages are requested via <tt>madvise</tt>. If those
+					 * are disabled as well, the area is backed by regular pages.
+					 */
+					HUGEPAGE = 2
+
+				};
+
+				/** Usage statistics of the pool. */
+				struct Statistics {
+
+					/** The number of allocations served from a free list. */
+					size_t hits;
+
+					/** The number of allocations that required a system call. */
+					size_t misses;
+
+					/** The number of released areas returned to the system. */
+					size_t evictions;
+
+					/** The number of bytes currently in use. */
+					size_t inUse;
+
+					/** The maximum number of bytes that were in use at any time. */
+					size_t peak;
+
+					/** The number of bytes retained on free lists. */
+					size_t retained;
+
+				};
+
+				/** @returns The pool of this process. */
+				static ContainerPool & instance();
+
+				/**
+				 * Whether large memory areas are backed by huge pages.
+				 *
+				 * If this holds, the reference allocator requests areas of at least
+				 * #grb::config::MEMORY_POOL::hugePageSize() bytes that would otherwise
+				 * be of the #Kind::ALIGNED or #Kind::INTERLEAVED kind as the
+				 * #Kind::HUGEPAGE kind instead. This trades the uniform access of
+				 * interleaved memory for fewer TLB misses.
+				 *
+				 * This holds if the <tt>GRB_HUGE_PAGES</tt> environment variable is set
+				 * to a nonzero integer when the pool is first used.
+				 *
+				 * \note This is a single process-wide setting that applies to all
+				 *       classes of containers alike; huge pages cannot be selected for,
+				 *       e.g., matrices but not for vectors.
+				 */
+				bool hugePages() const noexcept {
+					return _hugePages;
+				}
+
+				/**
+				 * Allocates a memory area of at least \a size bytes.
+				 *
+				 * The area is aligned to a cache line or, for the #Kind::HUGEPAGE kind,
+				 * to a huge page.
+				 *
+				 * @param[in] size The requested size, in bytes. Must be larger than zero.
+				 * @param[in] kind The kind of memory requested.
+				 *
+				 * @returns A pointer to the memory area, or <tt>nullptr</tt> if the
+				 *          system is out of memory.
+				 *
+				 * \warning The #Kind::INTERLEAVED kind may only be requested if libnuma
+				 *          is available.
+				 */
+				void * allocate( const size_t size, const Kind kind );
+
+				/**
+				 * Releases a memory area obtained from #allocate.
+				 *
+				 * @param[in] pointer The memory area. If <tt>nullptr</tt>, this function
+				 *                    has no effect.
+				 * @param[in] size    The size passed to #allocate.
+				 * @param[in] kind    The kind passed to #allocate.
+				 */
+				void release( void * const pointer, const size_t size, const Kind kind )
+					noexcept;
+
+				/** @returns The current statistics of this pool. */
+				Statistics statistics() const;
+
+				/**
+				 * Resets the hit, miss, and eviction counters to zero, and the peak
+				 * usage to the current usage.
+				 */
+				void resetStatistics();
+
+				/** Returns all memory retained by this pool to the system. */
+				void clear();
+
+
+			private:
+
+				/** Guards all fields below. */
+				mutable std::mutex _mutex;
+
+				/** The free lists, indexed by kind and by size class. */
+				std::vector< std::vector< void * > > _free[ 3 ];
+
+				/** The statistics of this pool. */
+				Statistics _stats;
+
+				/** Whether large memory areas are backed by huge pages. */
+				const bool _hugePages;
+
+				/** Use #instance to retrieve the pool. */
+				ContainerPool();
+
+				/** The pool may not be copied. */
+				ContainerPool( const ContainerPool & ) = delete;
+
+				/**
+				 * Computes the size class of a requested size.
+				 *
+				 * @param[in]  size  The requested size, in bytes.
+				 * @param[out] index The index of the size class. Will be the number of
+				 *                   size classes if the request exceeds the largest
+				 *                   class.
+				 *
+				 * @returns The size of the class, in bytes.
+				 */
+				static size_t sizeClass( const size_t size, size_t &index );
+
+				/** Allocates a memory area from the system. */
+				static void * systemAlloc( const size_t size, const Kind kind );
+
+				/** Returns a memory area to the system. */
+				static void systemFree(
+					void * const pointer, const size_t size, const Kind kind
+				) noexcept;
+
+		};
+
+	} // end namespace ``grb::utils''
+
+} // end namespace grb
+
+#endif // end ``_H_GRB_UTILS_POOL''
+
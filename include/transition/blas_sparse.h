@@ -166,7 +166,28 @@ int BLAS_dusmm(
 	const int nrhs,
 	const double alpha, const blas_sparse_matrix A,
 	const double * B, const int ldb,
-	const double * C, const int ldc
+	double * C, const int ldc
+);
+
+/**
+ * Sparse triangular solve.
+ *
+ * This function computes one of
+ *  - \f$ x \to \alpha T^{-1} x \f$
+ *  - \f$ x \to \alpha T^{-T} x \f$
+ *
+ * See the SparseBLAS paper for the full specification.
+ *
+ * \internal This implementation does not support matrix properties, and
+ * instead deduces whether \a T is lower or upper triangular from its nonzero
+ * structure. If \a T stores no diagonal nonzeroes, its diagonal is taken to
+ * be all ones. The level-set analysis required for the solve is cached with
+ * \a T and reused by subsequent calls.
+ */
+int BLAS_dussv(
+	const enum blas_trans_type transt,
+	const double alpha, const blas_sparse_matrix T,
+	double * const x, const int incx
 );
 
 /**
@@ -97,6 +97,10 @@ void spblas_dcsrgemv(
  * @param[in] ldc       Leading dimension of \a c. If in row-major format, this
  *                      should be \f$ n \f$. If in column-major format, this
  *                      should be \f$ m \f$.
+ *
+ * As is conventional for this interface, zero-based indexing implies that
+ * \f$ B \f$ and \f$ C \f$ are stored row-major, while one-based indexing
+ * implies column-major storage. Only general matrices ('G') are supported.
  */
 void spblas_dcsrmm(
 	const char * transa,
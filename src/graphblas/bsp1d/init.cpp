@@ -28,12 +28,38 @@
 #include <graphblas/init.hpp>
 
 
+#include <sstream>
+
+#include <stdlib.h> //getenv
+
 #include <graphblas/bsp/config.hpp>
 #include <graphblas/utils/ThreadLocalStorage.hpp>
 #include <graphblas/bsp1d/init.hpp>
 
 grb::utils::ThreadLocalStorage< grb::internal::BSP1D_Data > grb::internal::grb_BSP1D;
 
+/**
+ * Parses the environment variable \a name into \a value, if it is set.
+ *
+ * @returns Whether \a value was overwritten.
+ */
+template< typename T >
+static bool parseEnvironment( const char * const name, T &value ) {
+	const char * const contents = getenv( name );
+	if( contents == nullptr ) {
+		return false;
+	}
+	std::stringstream cppstr( contents );
+	T read;
+	if( !( cppstr >> read ) || !cppstr.eof() ) {
+		std::cerr << "Warning: could not parse contents of the " << name << " "
+			<< "environment variable; ignoring it instead.\n";
+		return false;
+	}
+	value = read;
+	return true;
+}
+
 template<>
 grb::RC grb::init< grb::BSP1D >(
 	const size_t s, const size_t P, const lpf_t ctx
@@ -52,12 +78,21 @@ grb::RC grb::init< grb::BSP1D >(
 #ifdef _DEBUG
 	std::cout << s << ": initializing thread-local store..." << std::endl;
 #endif
-	return data.initialize( ctx,
+	const grb::RC ret = data.initialize( ctx,
 		static_cast< lpf_pid_t >(s),
 		static_cast< lpf_pid_t >(P),
 		grb::config::LPF::regs(),
 		grb::config::LPF::maxh()
 	);
+	// the environment may override the chunk size used during matrix ingestion
+	if( ret == grb::SUCCESS &&
+		parseEnvironment( "GRB_BSP1D_BUILD_CHUNK_SIZE", data.build_chunk_size ) &&
+		s == 0
+	) {
+		std::cerr << "\t buildMatrixUnique reads at most " << data.build_chunk_size
+			<< " nonzeroes per round\n";
+	}
+	return ret;
 }
 
 template<>
@@ -128,6 +163,8 @@ grb::RC grb::internal::BSP1D_Data::initialize(
 	lpf_maxh = 0;
 	buffer_size = 0;
 	destroyed = false;
+	build_chunk_size =
+		grb::config::IMPLEMENTATION< grb::BSP1D >::buildMatrixChunkSize();
 	payload_size = 0;
 	tag_size = 0;
 	max_msgs = 0;
@@ -20,6 +20,8 @@
  * @date 1st of February, 2022
  */
 
+#include <cstdint>
+
 #include <graphblas/hyperdags/hyperdags.hpp>
 
 std::string grb::internal::hyperdags::toString(
@@ -380,6 +382,10 @@ std::string grb::internal::hyperdags::toString(
 		case GETID_MATRIX:
 			return "getID( matrix )";
 
+		case TRIANGULARSOLVE_VECTOR_MATRIX_VECTOR_RING:
+			return "triangularSolve( vector, matrix, vector, schedule, semiring, "
+				"operator, operator )";
+
 	}
 	assert( false );
 	return "unknown operation";
@@ -421,8 +427,8 @@ grb::internal::hyperdags::SourceVertexGenerator::create(
 
 size_t grb::internal::hyperdags::SourceVertexGenerator::size() const {
 	size_t ret = 0;
-	for( auto &pair : nextID ) {
-		ret += pair.second;
+	for( const size_t &count : nextID ) {
+		ret += count;
 	}
 	return ret;
 }
@@ -499,17 +505,18 @@ grb::internal::hyperdags::OperationVertexGenerator::create(
 
 size_t grb::internal::hyperdags::OperationVertexGenerator::size() const {
 	size_t ret = 0;
-	for( auto &pair : nextID ) {
-		ret += pair.second;
+	for( const size_t &count : nextID ) {
+		ret += count;
 	}
 	return ret;
 }
 
 grb::internal::hyperdags::DHypergraph::DHypergraph() noexcept :
-	num_vertices( 0 ), num_pins( 0 )
+	num_vertices( 0 ), num_hyperedges( 0 ), num_pins( 0 ), offsets( 1, 0 )
 {}
 
-size_t grb::internal::hyperdags::DHypergraph::createVertex() noexcept {
+size_t grb::internal::hyperdags::DHypergraph::createVertex() {
+	is_source.push_back( false );
 	return num_vertices++;
 }
 
@@ -518,28 +525,78 @@ size_t grb::internal::hyperdags::DHypergraph::numVertices() const noexcept {
 }
 
 size_t grb::internal::hyperdags::DHypergraph::numHyperedges() const noexcept {
-	return hyperedges.size();
+	return num_hyperedges;
 }
 
 size_t grb::internal::hyperdags::DHypergraph::numPins() const noexcept {
 	return num_pins;
 }
 
+bool grb::internal::hyperdags::DHypergraph::hasHyperedge(
+	const size_t vertex
+) const noexcept {
+	assert( vertex < num_vertices );
+	return is_source[ vertex ];
+}
+
+size_t grb::internal::hyperdags::DHypergraph::bufferedWords() const noexcept {
+	return 3 * sources.size() + destinations.size();
+}
+
 void grb::internal::hyperdags::DHypergraph::render(
 	std::ostream &out
 ) const {
+	// group the records by source vertex, in order of increasing source ID
+	std::vector< size_t > order( sources.size() );
+	for( size_t i = 0; i < order.size(); ++i ) {
+		order[ i ] = i;
+	}
+	std::stable_sort( order.begin(), order.end(),
+		[ this ]( const size_t a, const size_t b ) {
+			return sources[ a ] < sources[ b ];
+		}
+	);
 	size_t net_num = 0;
-	for( const auto &pair : hyperedges ) {
-		out << net_num << " " << pair.first << "\n";
-		const std::set< size_t > &net = pair.second;
+	std::vector< size_t > net;
+	for( size_t i = 0; i < order.size(); ) {
+		const size_t source = sources[ order[ i ] ];
+		net.clear();
+		for( ; i < order.size() && sources[ order[ i ] ] == source; ++i ) {
+			net.insert( net.end(),
+				destinations.begin() + offsets[ order[ i ] ],
+				destinations.begin() + offsets[ order[ i ] + 1 ]
+			);
+		}
+		std::sort( net.begin(), net.end() );
+		out << net_num << " " << source << "\n";
 		for( const auto &id : net ) {
 			out << net_num << " " << id << "\n";
 		}
 		(void) ++net_num;
 	}
+	assert( net_num == num_hyperedges );
 	out << std::flush;
 }
 
+/** Writes a single word of a binary HyperDAG stream. */
+static void writeWord( std::ostream &out, const uint64_t word ) {
+	out.write( reinterpret_cast< const char * >( &word ), sizeof( uint64_t ) );
+}
+
+void grb::internal::hyperdags::DHypergraph::flush( std::ostream &out ) {
+	for( size_t i = 0; i < sources.size(); ++i ) {
+		writeWord( out, HYPEREDGE_RECORD );
+		writeWord( out, sources[ i ] );
+		writeWord( out, offsets[ i + 1 ] - offsets[ i ] );
+		for( size_t k = offsets[ i ]; k < offsets[ i + 1 ]; ++k ) {
+			writeWord( out, destinations[ k ] );
+		}
+	}
+	sources.clear();
+	offsets.resize( 1 );
+	destinations.clear();
+}
+
 grb::internal::hyperdags::HyperDAG::HyperDAG(
 	grb::internal::hyperdags::DHypergraph _hypergraph,
 	const std::vector< grb::internal::hyperdags::SourceVertex > &_srcVec,
@@ -634,7 +691,209 @@ grb::internal::hyperdags::HyperDAG::outputsEnd() const {
 	return outputVertices.cend();
 }
 
-grb::internal::hyperdags::HyperDAGGenerator::HyperDAGGenerator() noexcept {}
+constexpr size_t grb::internal::hyperdags::FineHyperDAGGenerator::none;
+
+constexpr size_t grb::internal::hyperdags::FineHyperDAGGenerator::source;
+
+grb::internal::hyperdags::FineHyperDAGGenerator::FineHyperDAGGenerator()
+	noexcept : enabled( false ), blockSize( 1 ),
+	sampleThreshold( std::numeric_limits< uint64_t >::max() )
+{}
+
+void grb::internal::hyperdags::FineHyperDAGGenerator::enable(
+	const size_t _blockSize, const double sample
+) {
+	assert( _blockSize > 0 );
+	assert( sample > 0 && sample <= 1 );
+	enabled = true;
+	blockSize = _blockSize;
+	sampleThreshold = sample >= 1
+		? std::numeric_limits< uint64_t >::max()
+		: static_cast< uint64_t >(
+			sample * static_cast< double >( std::numeric_limits< uint64_t >::max() )
+		);
+	hypergraph = DHypergraph();
+	types.clear();
+	elements.clear();
+	tiles.clear();
+}
+
+bool grb::internal::hyperdags::FineHyperDAGGenerator::isEnabled()
+	const noexcept
+{
+	return enabled;
+}
+
+size_t grb::internal::hyperdags::FineHyperDAGGenerator::createVertex(
+	const size_t type
+) {
+	types.push_back( type );
+	return hypergraph.createVertex();
+}
+
+size_t grb::internal::hyperdags::FineHyperDAGGenerator::numBlocks(
+	const size_t n
+) const noexcept {
+	return ( n + blockSize - 1 ) / blockSize;
+}
+
+bool grb::internal::hyperdags::FineHyperDAGGenerator::isSampled(
+	const size_t i, const size_t j
+) const noexcept {
+	if( sampleThreshold == std::numeric_limits< uint64_t >::max() ) {
+		return true;
+	}
+	// splitmix64 finaliser over the tile coordinates
+	uint64_t hash = static_cast< uint64_t >( i ) * 0x9E3779B97F4A7C15ULL +
+		static_cast< uint64_t >( j );
+	hash = ( hash ^ ( hash >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+	hash = ( hash ^ ( hash >> 27 ) ) * 0x94D049BB133111EBULL;
+	hash = hash ^ ( hash >> 31 );
+	return hash <= sampleThreshold;
+}
+
+size_t grb::internal::hyperdags::FineHyperDAGGenerator::getTile(
+	std::unordered_map< uint64_t, size_t > &matrix,
+	const size_t i, const size_t j, const size_t n
+) {
+	const uint64_t key = static_cast< uint64_t >( i ) * numBlocks( n ) + j;
+	const auto it = matrix.find( key );
+	if( it != matrix.end() ) {
+		return it->second;
+	}
+	const size_t vertex = createVertex( source );
+	matrix[ key ] = vertex;
+	return vertex;
+}
+
+void grb::internal::hyperdags::FineHyperDAGGenerator::commit() {
+	std::sort( pins.begin(), pins.end() );
+	std::vector< size_t > destinations;
+	for( size_t k = 0; k < pins.size(); ) {
+		const size_t from = pins[ k ].first;
+		destinations.clear();
+		for( ; k < pins.size() && pins[ k ].first == from; ++k ) {
+			destinations.push_back( pins[ k ].second );
+		}
+		hypergraph.appendHyperedge( from, destinations.begin(), destinations.end() );
+	}
+	pins.clear();
+}
+
+bool grb::internal::hyperdags::FineHyperDAGGenerator::isMultiplication(
+	const grb::internal::hyperdags::OperationVertexType type
+) noexcept {
+	switch( type ) {
+
+		case VXM_VECTOR_VECTOR_VECTOR_MATRIX:
+		case VXM_VECTOR_VECTOR_VECTOR_MATRIX_ADD_MUL:
+		case VXM_VECTOR_VECTOR_MATRIX_RING:
+		case VXM_GENERIC_VECTOR_VECTOR_VECTOR_VECTOR_MATRIX_ADD_MUL:
+		case VXM_VECTOR_VECTOR_VECTOR_VECTOR_MATRIX_ADD_MUL:
+		case VXM_VECTOR_VECTOR_MATRIX_ADD_MUL:
+		case MXV_VECTOR_VECTOR_MATRIX_VECTOR_RING:
+		case MXV_VECTOR_VECTOR_MATRIX_VECTOR_VECTOR_R:
+		case MXV_VECTOR_VECTOR_MATRIX_VECTOR_VECTOR_A:
+		case MXV_VECTOR_MATRIX_VECTOR_RING:
+		case MXV_VECTOR_MATRIX_VECTOR_ADD_MUL:
+			return true;
+
+		default:
+			return false;
+
+	}
+}
+
+bool grb::internal::hyperdags::FineHyperDAGGenerator::isInitialisation(
+	const grb::internal::hyperdags::OperationVertexType type
+) noexcept {
+	switch( type ) {
+
+		case BUILD_VECTOR:
+		case BUILD_VECTOR_WITH_VALUES:
+		case SET_USING_VALUE:
+		case SET_USING_MASK_AND_SCALAR:
+			return true;
+
+		default:
+			return false;
+
+	}
+}
+
+void grb::internal::hyperdags::FineHyperDAGGenerator::addVector(
+	const uintptr_t id, const size_t n
+) {
+	if( enabled && n > 0 ) {
+		elements[ id ].assign( numBlocks( n ), none );
+	}
+}
+
+void grb::internal::hyperdags::FineHyperDAGGenerator::copyVector(
+	const uintptr_t from, const uintptr_t to
+) {
+	if( !enabled ) {
+		return;
+	}
+	const auto it = elements.find( from );
+	if( it != elements.end() ) {
+		elements[ to ] = it->second;
+	}
+}
+
+void grb::internal::hyperdags::FineHyperDAGGenerator::removeContainer(
+	const uintptr_t id
+) {
+	if( enabled ) {
+		(void) elements.erase( id );
+		(void) tiles.erase( id );
+	}
+}
+
+void grb::internal::hyperdags::FineHyperDAGGenerator::setElement(
+	const uintptr_t id, const size_t i
+) {
+	if( !enabled ) {
+		return;
+	}
+	const auto it = elements.find( id );
+	if( it != elements.end() ) {
+		assert( i / blockSize < it->second.size() );
+		it->second[ i / blockSize ] = createVertex( source );
+	}
+}
+
+grb::internal::hyperdags::HyperDAG
+grb::internal::hyperdags::FineHyperDAGGenerator::finalize() const {
+	std::vector< grb::internal::hyperdags::SourceVertex > sourceVec;
+	std::vector< grb::internal::hyperdags::OperationVertex > operationVec;
+	std::vector< grb::internal::hyperdags::OutputVertex > outputVec;
+	grb::internal::hyperdags::SourceVertexGenerator sourceGen;
+	grb::internal::hyperdags::OperationVertexGenerator operationGen;
+	grb::internal::hyperdags::OutputVertexGenerator outputGen;
+	for( size_t id = 0; id < types.size(); ++id ) {
+		if( types[ id ] == source ) {
+			sourceVec.push_back( sourceGen.create( CONTAINER, id ) );
+		} else if( hypergraph.hasHyperedge( id ) ) {
+			operationVec.push_back( operationGen.create(
+				static_cast< grb::internal::hyperdags::OperationVertexType >(
+					types[ id ] ),
+				id
+			) );
+		} else {
+			outputVec.push_back( outputGen.create( id ) );
+		}
+	}
+	grb::internal::hyperdags::HyperDAG ret(
+		hypergraph,
+		sourceVec, operationVec, outputVec
+	);
+	return ret;
+}
+
+grb::internal::hyperdags::HyperDAGGenerator::HyperDAGGenerator() noexcept :
+	streamLimit( 0 )
+{}
 
 void grb::internal::hyperdags::HyperDAGGenerator::addContainer(
 	const uintptr_t id
@@ -749,15 +1008,19 @@ grb::internal::hyperdags::HyperDAGGenerator::finalize() const {
 		<< operationOrOutputVertices.size()
 		<< "output vertices\n";
 #endif
+	assert( !isStreaming() );
 	std::vector< grb::internal::hyperdags::OutputVertex > outputVec;
 
-	// generate outputVertices
+	// generate outputVertices, in order of increasing global ID
 	{
-		grb::internal::hyperdags::OutputVertexGenerator outputGen;
+		std::vector< size_t > outputs;
 		for( const auto &pair : operationOrOutputVertices ) {
-			grb::internal::hyperdags::OutputVertex toAdd =
-				outputGen.create( pair.second.first );
-			outputVec.push_back( toAdd );
+			outputs.push_back( pair.second.first );
+		}
+		std::sort( outputs.begin(), outputs.end() );
+		grb::internal::hyperdags::OutputVertexGenerator outputGen;
+		for( const size_t &global_id : outputs ) {
+			outputVec.push_back( outputGen.create( global_id ) );
 		}
 	}
 
@@ -771,3 +1034,94 @@ grb::internal::hyperdags::HyperDAGGenerator::finalize() const {
 	return ret;
 }
 
+bool grb::internal::hyperdags::HyperDAGGenerator::streamTo(
+	const std::string &path, const size_t limit
+) {
+	if( stream.is_open() ) {
+		stream.close();
+	}
+	stream.open( path, std::ios::out | std::ios::binary | std::ios::trunc );
+	if( !stream.is_open() ) {
+		return false;
+	}
+	hypergraph = DHypergraph();
+	sourceVec.clear();
+	operationVec.clear();
+	sourceVerticesP.clear();
+	sourceVerticesC.clear();
+	operationVertices.clear();
+	operationOrOutputVertices.clear();
+	sourceGen = SourceVertexGenerator();
+	operationGen = OperationVertexGenerator();
+	streamLimit = limit;
+	stream.write( streamMagic, sizeof( streamMagic ) );
+	return stream.good();
+}
+
+bool grb::internal::hyperdags::HyperDAGGenerator::isStreaming() const noexcept {
+	return stream.is_open();
+}
+
+grb::internal::hyperdags::FineHyperDAGGenerator &
+grb::internal::hyperdags::HyperDAGGenerator::fineGrained() noexcept {
+	return fine;
+}
+
+void grb::internal::hyperdags::HyperDAGGenerator::writeVertex(
+	const enum grb::internal::hyperdags::VertexType kind, const size_t type,
+	const size_t local_id, const size_t global_id
+) {
+	writeWord( stream, VERTEX_RECORD );
+	writeWord( stream, kind );
+	writeWord( stream, type );
+	writeWord( stream, local_id );
+	writeWord( stream, global_id );
+}
+
+void grb::internal::hyperdags::HyperDAGGenerator::flush() {
+	if( !stream.is_open() ) {
+		return;
+	}
+	for( const auto &vertex : sourceVec ) {
+		writeVertex( SOURCE, vertex.getType(), vertex.getLocalID(),
+			vertex.getGlobalID() );
+	}
+	sourceVec.clear();
+	for( const auto &vertex : operationVec ) {
+		writeVertex( OPERATION, vertex.getType(), vertex.getLocalID(),
+			vertex.getGlobalID() );
+	}
+	operationVec.clear();
+	hypergraph.flush( stream );
+}
+
+void grb::internal::hyperdags::HyperDAGGenerator::flushIfFull() {
+	if( stream.is_open() && 5 * ( sourceVec.size() + operationVec.size() ) +
+		hypergraph.bufferedWords() >= streamLimit
+	) {
+		flush();
+	}
+}
+
+bool grb::internal::hyperdags::HyperDAGGenerator::closeStream() {
+	assert( isStreaming() );
+	flush();
+	std::vector< size_t > outputs;
+	for( const auto &pair : operationOrOutputVertices ) {
+		outputs.push_back( pair.second.first );
+	}
+	std::sort( outputs.begin(), outputs.end() );
+	grb::internal::hyperdags::OutputVertexGenerator outputGen;
+	for( const size_t &global_id : outputs ) {
+		const grb::internal::hyperdags::OutputVertex vertex =
+			outputGen.create( global_id );
+		writeVertex( OUTPUT, vertex.getType(), vertex.getLocalID(),
+			vertex.getGlobalID() );
+	}
+	writeWord( stream, END_RECORD );
+	writeWord( stream, hypergraph.numVertices() );
+	writeWord( stream, hypergraph.numHyperedges() );
+	writeWord( stream, hypergraph.numPins() );
+	stream.close();
+	return !stream.fail();
+}
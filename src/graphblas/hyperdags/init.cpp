@@ -20,7 +20,14 @@
  * @date 31st of January, 2022
  */
 
+#include <set>
+#include <string>
+#include <sstream>
+
+#include <stdlib.h> //getenv
+
 #include <graphblas/init.hpp>
+#include <graphblas/config.hpp>
 
 #include <graphblas/hyperdags/hyperdags.hpp>
 
@@ -39,11 +46,78 @@ namespace grb {
 
 }
 
+/**
+ * Parses the environment variable \a name into \a value, if it is set.
+ *
+ * @returns Whether \a value was overwritten.
+ */
+template< typename T >
+static bool parseEnvironment( const char * const name, T &value ) {
+	const char * const contents = getenv( name );
+	if( contents == nullptr ) {
+		return false;
+	}
+	std::stringstream cppstr( contents );
+	T read;
+	if( !( cppstr >> read ) ) {
+		std::cerr << "Warning: could not parse contents of the " << name << " "
+			<< "environment variable; ignoring it instead.\n";
+		return false;
+	}
+	value = read;
+	return true;
+}
+
 template<>
 grb::RC grb::init< grb::hyperdags >(
 	const size_t s, const size_t P, void * const
 ) {
 	std::cerr << "Info: grb::init (hyperdags) called.\n";
+	// if the environment variable GRB_HYPERDAGS_OUTPUT is set, the HyperDAG is
+	// streamed to the file it names in a binary format, instead of being kept in
+	// memory and dumped to stdout at finalisation
+	const char * const path = getenv( "GRB_HYPERDAGS_OUTPUT" );
+	if( path != nullptr ) {
+		size_t limit = grb::config::IMPLEMENTATION< grb::hyperdags >::
+			streamBufferWords();
+		(void) parseEnvironment( "GRB_HYPERDAGS_STREAM_BUFFER", limit );
+		if( grb::internal::hyperdags::generator.streamTo( path, limit ) ) {
+			std::cerr << "\t streaming HyperDAG to " << path << "\n";
+		} else {
+			std::cerr << "\t could not open " << path << ", HyperDAG will be "
+				<< "dumped to stdout instead\n";
+		}
+	}
+	// if GRB_HYPERDAGS_GRAIN is set to fine, a fine-grained HyperDAG is dumped to
+	// stdout at finalisation instead of the coarse-grained one
+	std::string grain = "coarse";
+	(void) parseEnvironment( "GRB_HYPERDAGS_GRAIN", grain );
+	if( grain == "fine" ) {
+		size_t blockSize = 1;
+		double sample = 1.0;
+		if( parseEnvironment( "GRB_HYPERDAGS_BLOCK_SIZE", blockSize ) &&
+			blockSize == 0
+		) {
+			std::cerr << "Warning: GRB_HYPERDAGS_BLOCK_SIZE must be positive; "
+				<< "using a block size of one instead.\n";
+			blockSize = 1;
+		}
+		if( parseEnvironment( "GRB_HYPERDAGS_SAMPLE", sample ) &&
+			!( sample > 0.0 && sample <= 1.0 )
+		) {
+			std::cerr << "Warning: GRB_HYPERDAGS_SAMPLE must be in (0, 1]; "
+				<< "sampling all matrix tiles instead.\n";
+			sample = 1.0;
+		}
+		grb::internal::hyperdags::generator.fineGrained().enable( blockSize,
+			sample );
+		std::cerr << "\t generating a fine-grained HyperDAG with block size "
+			<< blockSize << " and sample rate " << sample << "\n";
+	} else if( grain != "coarse" ) {
+		std::cerr << "Warning: unknown value " << grain << " of the "
+			<< "GRB_HYPERDAGS_GRAIN environment variable; generating a coarse-"
+			<< "grained HyperDAG instead.\n";
+	}
 	return grb::init< grb::_GRB_WITH_HYPERDAGS_USING >( s, P, nullptr );
 }
 
@@ -64,15 +138,11 @@ static size_t out2int( const grb::internal::hyperdags::OutputVertexType type ) {
 	return ret;
 }
 
-template<>
-grb::RC grb::finalize< grb::hyperdags >() {
-	std::cerr << "Info: grb::finalize (hyperdags) called.\n";
-	std::cerr << "\t dumping HyperDAG to stdout" << std::endl;
-	const grb::internal::hyperdags::HyperDAG &hyperdag =
-		grb::internal::hyperdags::generator.finalize();
-	const grb::internal::hyperdags::DHypergraph &hypergraph =
-		hyperdag.get();
-	std::ostream &ostream = std::cout;
+/** Prints a HyperDAG in the MatrixMarket format. */
+static void print(
+	const grb::internal::hyperdags::HyperDAG &hyperdag, std::ostream &ostream
+) {
+	const grb::internal::hyperdags::DHypergraph &hypergraph = hyperdag.get();
 	ostream << "%%MatrixMarket weighted-matrix coordinate pattern general\n";
 	// print source vertex types as comments
 	{
@@ -153,7 +223,30 @@ grb::RC grb::finalize< grb::hyperdags >() {
 	}
 	// print HyperDAG structure
 	hypergraph.render( ostream );
-	// done
-	return grb::finalize< grb::_GRB_WITH_HYPERDAGS_USING >();
 }
 
+template<>
+grb::RC grb::finalize< grb::hyperdags >() {
+	std::cerr << "Info: grb::finalize (hyperdags) called.\n";
+	grb::internal::hyperdags::FineHyperDAGGenerator &fine =
+		grb::internal::hyperdags::generator.fineGrained();
+	if( fine.isEnabled() ) {
+		std::cerr << "\t dumping fine-grained HyperDAG to stdout" << std::endl;
+		print( fine.finalize(), std::cout );
+	}
+	if( grb::internal::hyperdags::generator.isStreaming() ) {
+		std::cerr << "\t closing HyperDAG stream" << std::endl;
+		const bool written = grb::internal::hyperdags::generator.closeStream();
+		const grb::RC ret = grb::finalize< grb::_GRB_WITH_HYPERDAGS_USING >();
+		if( !written ) {
+			std::cerr << "\t error while writing the HyperDAG stream" << std::endl;
+			return grb::PANIC;
+		}
+		return ret;
+	}
+	if( !fine.isEnabled() ) {
+		std::cerr << "\t dumping HyperDAG to stdout" << std::endl;
+		print( grb::internal::hyperdags::generator.finalize(), std::cout );
+	}
+	return grb::finalize< grb::_GRB_WITH_HYPERDAGS_USING >();
+}
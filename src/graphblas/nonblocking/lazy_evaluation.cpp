@@ -393,21 +393,30 @@ grb::RC LazyEvaluation::addeWiseLambdaStage(
 			continue;
 		}
 
+		bool shared_data_found = false;
+		bool pipeline_executed = false;
+
 		// processes all output vectors of eWiseLambda
 		for(
 			std::vector< const void *>::iterator it = all_vectors_ptr.begin();
-			it != all_vectors_ptr.end(); ++it
+			it != all_vectors_ptr.end() && !pipeline_executed; ++it
 		) {
 			if( (*pt).accessesInputVector( *it ) ) {
 				if( ( *pt ).overwritesVXMInputVectors( *it ) ) {
-					( *pt ).execution();
+					ret = ret ? ret : ( *pt ).execution();
+					pipeline_executed = true;
 				} else {
-				shared_data_pipelines.push_back( pt );
+					shared_data_found = true;
 				}
 			} else if( (*pt).accessesOutputVector( *it ) ) {
-				shared_data_pipelines.push_back( pt );
+				shared_data_found = true;
 			}
 		}
+
+		// a pipeline that shares several vectors must only be merged once
+		if( !pipeline_executed && shared_data_found ) {
+			shared_data_pipelines.push_back( pt );
+		}
 	}
 
 #ifdef _DEBUG
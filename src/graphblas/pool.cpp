@@ -0,0 +1,263 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Implements the pool that recycles the memory areas of ALP containers.
+ */
+
+#include <algorithm>
+
+#include <assert.h>
+#include <stdint.h> //uintptr_t
+#include <stdlib.h> //posix_memalign, free, getenv, strtol
+#include <sys/mman.h> //mmap, munmap, madvise
+
+#ifndef _GRB_NO_LIBNUMA
+ #include <numa.h> //numa_alloc_interleaved, numa_free
+#endif
+
+#include "graphblas/base/config.hpp"
+#include "graphblas/utils/pool.hpp"
+
+
+using grb::utils::ContainerPool;
+
+/** The smallest size class, as a 2-log of bytes. */
+static constexpr size_t minClassLog = 6;
+
+/** The number of size classes per power of two. */
+static constexpr size_t classesPerLog = 4;
+
+/** @returns The 2-log of \a x, rounded down; \a x must be positive. */
+static size_t floorLog2( size_t x ) {
+	size_t ret = 0;
+	while( x >>= 1 ) {
+		(void) ++ret;
+	}
+	return ret;
+}
+
+/** @returns The number of size classes. */
+static size_t numClasses() {
+	const size_t maxLog = floorLog2( grb::config::MEMORY_POOL::maxRetained() );
+	return maxLog < minClassLog ? 0 : (maxLog - minClassLog) * classesPerLog + 1;
+}
+
+/** @returns Whether the environment requests huge pages for large areas. */
+static bool hugePagesRequested() {
+	const char * const contents = getenv( "GRB_HUGE_PAGES" );
+	return contents != nullptr && strtol( contents, nullptr, 10 ) != 0;
+}
+
+ContainerPool & ContainerPool::instance() {
+	// never destroyed, so that containers with static storage duration may still
+	// release their memory at program exit
+	static ContainerPool * const pool = new ContainerPool();
+	return *pool;
+}
+
+ContainerPool::ContainerPool() :
+	_stats{ 0, 0, 0, 0, 0, 0 }, _hugePages( hugePagesRequested() )
+{
+	_free[ ALIGNED ].resize( numClasses() );
+	_free[ INTERLEAVED ].resize( numClasses() );
+	_free[ HUGEPAGE ].resize( numClasses() );
+}
+
+size_t ContainerPool::sizeClass( const size_t size, size_t &index ) {
+	const size_t request = std::max( size, static_cast< size_t >( 1 ) << minClassLog );
+	const size_t log = floorLog2( request );
+	const size_t base = static_cast< size_t >( 1 ) << log;
+	const size_t step = std::max( base / classesPerLog, static_cast< size_t >( 1 ) );
+	const size_t classSize = ((request + step - 1) / step) * step;
+	index = (log - minClassLog) * classesPerLog + (classSize - base) / step;
+	if( index >= numClasses() || classSize > grb::config::MEMORY_POOL::maxRetained() ) {
+		index = numClasses();
+		return size;
+	}
+	return classSize;
+}
+
+/** @returns The length of the mapping that backs a huge-page area. */
+static size_t hugePageLength( const size_t size ) {
+	const size_t page = grb::config::MEMORY_POOL::hugePageSize();
+	return ((size + page - 1) / page) * page;
+}
+
+/**
+ * Maps a memory area of \a size bytes that is aligned to a huge page, and
+ * requests it be backed by huge pages.
+ *
+ * @returns A pointer to the memory area, or <tt>nullptr</tt> on failure.
+ */
+static void * hugePageAlloc( const size_t size ) {
+	const size_t page = grb::config::MEMORY_POOL::hugePageSize();
+	const size_t length = hugePageLength( size );
+#ifdef MAP_HUGETLB
+	// explicit huge pages only succeed if the system has reserved some
+	void * const pointer = mmap( nullptr, length, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+	if( pointer != MAP_FAILED ) {
+		return pointer;
+	}
+#endif
+	// otherwise, over-allocate so that an aligned area of the requested length
+	// may be cut out, and return the remainder to the system
+	char * const raw = static_cast< char * >( mmap( nullptr, length + page,
+		PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 ) );
+	if( static_cast< void * >( raw ) == MAP_FAILED ) {
+		return nullptr;
+	}
+	const size_t offset = reinterpret_cast< uintptr_t >( raw ) % page;
+	char * const aligned = offset == 0 ? raw : raw + (page - offset);
+	if( aligned > raw ) {
+		(void) munmap( raw, aligned - raw );
+	}
+	if( aligned + length < raw + length + page ) {
+		(void) munmap( aligned + length, (raw + length + page) - (aligned + length) );
+	}
+#ifdef MADV_HUGEPAGE
+	// only a hint: failure leaves the area backed by regular pages
+	(void) madvise( aligned, length, MADV_HUGEPAGE );
+#endif
+	return aligned;
+}
+
+void * ContainerPool::systemAlloc( const size_t size, const Kind kind ) {
+	if( kind == INTERLEAVED ) {
+#ifdef _GRB_NO_LIBNUMA
+		assert( false );
+		return nullptr;
+#else
+		return numa_alloc_interleaved( size );
+#endif
+	}
+	if( kind == HUGEPAGE ) {
+		return hugePageAlloc( size );
+	}
+	assert( kind == ALIGNED );
+	void * pointer = nullptr;
+	if( posix_memalign( &pointer, grb::config::CACHE_LINE_SIZE::value(), size )
+		!= 0
+	) {
+		return nullptr;
+	}
+	return pointer;
+}
+
+void ContainerPool::systemFree(
+	void * const pointer, const size_t size, const Kind kind
+) noexcept {
+	if( kind == INTERLEAVED ) {
+#ifndef _GRB_NO_LIBNUMA
+		numa_free( pointer, size );
+#else
+		(void) size;
+#endif
+	} else if( kind == HUGEPAGE ) {
+		(void) munmap( pointer, hugePageLength( size ) );
+	} else {
+		free( pointer );
+	}
+}
+
+void * ContainerPool::allocate( const size_t size, const Kind kind ) {
+	assert( size > 0 );
+	size_t index;
+	const size_t classSize = sizeClass( size, index );
+	{
+		std::lock_guard< std::mutex > lock( _mutex );
+		if( index < _free[ kind ].size() && !_free[ kind ][ index ].empty() ) {
+			void * const pointer = _free[ kind ][ index ].back();
+			_free[ kind ][ index ].pop_back();
+			_stats.retained -= classSize;
+			_stats.inUse += classSize;
+			_stats.peak = std::max( _stats.peak, _stats.inUse );
+			(void) ++_stats.hits;
+			return pointer;
+		}
+	}
+	void * const pointer = systemAlloc( classSize, kind );
+	if( pointer != nullptr ) {
+		std::lock_guard< std::mutex > lock( _mutex );
+		_stats.inUse += classSize;
+		_stats.peak = std::max( _stats.peak, _stats.inUse );
+		(void) ++_stats.misses;
+	}
+	return pointer;
+}
+
+void ContainerPool::release(
+	void * const pointer, const size_t size, const Kind kind
+) noexcept {
+	if( pointer == nullptr ) {
+		return;
+	}
+	size_t index;
+	const size_t classSize = sizeClass( size, index );
+	{
+		std::lock_guard< std::mutex > lock( _mutex );
+		assert( _stats.inUse >= classSize );
+		_stats.inUse -= classSize;
+		if( grb::config::MEMORY_POOL::enabled() && index < _free[ kind ].size() &&
+			_stats.retained + classSize <= grb::config::MEMORY_POOL::maxRetained()
+		) {
+			try {
+				_free[ kind ][ index ].push_back( pointer );
+				_stats.retained += classSize;
+				return;
+			} catch( ... ) {
+				// could not record the area, so fall through to free it
+			}
+		}
+		(void) ++_stats.evictions;
+	}
+	systemFree( pointer, classSize, kind );
+}
+
+ContainerPool::Statistics ContainerPool::statistics() const {
+	std::lock_guard< std::mutex > lock( _mutex );
+	return _stats;
+}
+
+void ContainerPool::resetStatistics() {
+	std::lock_guard< std::mutex > lock( _mutex );
+	_stats.hits = _stats.misses = _stats.evictions = 0;
+	_stats.peak = _stats.inUse;
+}
+
+void ContainerPool::clear() {
+	std::lock_guard< std::mutex > lock( _mutex );
+	for( size_t kind = 0; kind < 3; ++kind ) {
+		for( size_t index = 0; index < _free[ kind ].size(); ++index ) {
+			// all areas in a free list have the size of its class
+			const size_t log = minClassLog + index / classesPerLog;
+			const size_t base = static_cast< size_t >( 1 ) << log;
+			const size_t classSize = base + (index % classesPerLog) *
+				std::max( base / classesPerLog, static_cast< size_t >( 1 ) );
+			for( void * const pointer : _free[ kind ][ index ] ) {
+				systemFree( pointer, classSize, static_cast< Kind >( kind ) );
+				_stats.retained -= classSize;
+			}
+			_free[ kind ][ index ].clear();
+		}
+	}
+	assert( _stats.retained == 0 );
+}
+
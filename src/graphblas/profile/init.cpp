@@ -0,0 +1,71 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <iostream>
+
+#include <stdlib.h> //getenv
+
+#include <graphblas/init.hpp>
+
+#include <graphblas/profile/profile.hpp>
+
+
+namespace grb {
+
+	namespace internal {
+
+		namespace profile {
+
+			Profiler profiler;
+
+		}
+
+	}
+
+}
+
+template<>
+grb::RC grb::init< grb::profile >(
+	const size_t s, const size_t P, void * const
+) {
+	std::cerr << "Info: grb::init (profile) called.\n";
+	grb::internal::profile::profiler.clear();
+	return grb::init< grb::_GRB_WITH_PROFILE_USING >( s, P, nullptr );
+}
+
+template<>
+grb::RC grb::finalize< grb::profile >() {
+	std::cerr << "Info: grb::finalize (profile) called.\n";
+	const char * const path = getenv( "GRB_PROFILE_OUTPUT" );
+	if( path != nullptr ) {
+		std::ofstream file( path );
+		if( file.is_open() ) {
+			std::cerr << "\t writing profile to " << path << std::endl;
+			grb::internal::profile::profiler.report( file );
+		} else {
+			std::cerr << "\t could not open " << path << ", "
+				<< "dumping profile to stdout" << std::endl;
+			grb::internal::profile::profiler.report( std::cout );
+		}
+	} else {
+		std::cerr << "\t dumping profile to stdout" << std::endl;
+		grb::internal::profile::profiler.report( std::cout );
+	}
+	return grb::finalize< grb::_GRB_WITH_PROFILE_USING >();
+}
+
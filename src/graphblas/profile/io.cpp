@@ -0,0 +1,38 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <graphblas.hpp>
+
+
+namespace grb {
+
+	/**
+	 * \internal Delegates to the underlying backend, which may execute any
+	 *           pending computations.
+	 */
+	template<>
+	RC wait< profile >() {
+		internal::profile::Measurement measurement( internal::profile::WAIT );
+		const RC ret = wait< _GRB_WITH_PROFILE_USING >();
+		if( ret == SUCCESS ) {
+			measurement.record( 0 );
+		}
+		return ret;
+	}
+
+}
+
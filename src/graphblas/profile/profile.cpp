@@ -0,0 +1,254 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include <assert.h>
+#include <dlfcn.h> //dladdr
+#include <stdlib.h> //free
+#include <cxxabi.h> //abi::__cxa_demangle
+
+#include <graphblas/init.hpp>
+
+
+using grb::internal::profile::Counters;
+using grb::internal::profile::Profiler;
+using grb::internal::profile::Measurement;
+
+std::string grb::internal::profile::toString(
+	const enum Primitive primitive
+) noexcept {
+	switch( primitive ) {
+
+		case BUILD_VECTOR:
+			return "buildVector";
+
+		case BUILD_MATRIX_UNIQUE:
+			return "buildMatrixUnique";
+
+		case SET_ELEMENT:
+			return "setElement";
+
+		case SET:
+			return "set";
+
+		case CLEAR:
+			return "clear";
+
+		case RESIZE:
+			return "resize";
+
+		case WAIT:
+			return "wait";
+
+		case DOT:
+			return "dot";
+
+		case ZIP:
+			return "zip";
+
+		case UNZIP:
+			return "unzip";
+
+		case EWISEAPPLY:
+			return "eWiseApply";
+
+		case EWISEMUL:
+			return "eWiseMul";
+
+		case EWISEMULADD:
+			return "eWiseMulAdd";
+
+		case EWISELAMBDA:
+			return "eWiseLambda";
+
+		case FOLDL:
+			return "foldl";
+
+		case FOLDR:
+			return "foldr";
+
+		case MXV:
+			return "mxv";
+
+		case VXM:
+			return "vxm";
+
+		case TRIANGULAR_SOLVE:
+			return "triangularSolve";
+
+		case MXM:
+			return "mxm";
+
+		case OUTER:
+			return "outer";
+
+	}
+	assert( false );
+	return "unidentified primitive";
+}
+
+/**
+ * Resolves a call site to the nearest exported symbol, or else to an offset
+ * into the binary that contains it, as accepted by <tt>addr2line</tt>.
+ */
+static std::string resolve( const void * const site ) {
+	std::ostringstream ret;
+	Dl_info info;
+	if( site == nullptr || dladdr( site, &info ) == 0 ) {
+		ret << site;
+		return ret.str();
+	}
+	const char * const address = static_cast< const char * >( site );
+	if( info.dli_sname != nullptr && info.dli_saddr != nullptr ) {
+		int status = -1;
+		char * const demangled = abi::__cxa_demangle( info.dli_sname, nullptr,
+			nullptr, &status );
+		ret << ( status == 0 ? demangled : info.dli_sname ) << "+0x" << std::hex
+			<< ( address - static_cast< const char * >( info.dli_saddr ) );
+		free( demangled );
+	} else {
+		ret << ( info.dli_fname == nullptr ? "?" : info.dli_fname ) << "+0x"
+			<< std::hex << ( address - static_cast< const char * >( info.dli_fbase ) );
+	}
+	return ret.str();
+}
+
+/** Prints a single row of a profile report. */
+static void printRow(
+	std::ostream &out, const std::string &primitive, const Counters &counters,
+	const std::string &site
+) {
+	const double ms = counters.time / 1e6;
+	const double seconds = counters.time / 1e9;
+	out << std::left << std::setw( 18 ) << primitive << std::right
+		<< std::setw( 10 ) << counters.calls
+		<< std::setw( 14 ) << std::fixed << std::setprecision( 3 ) << ms
+		<< std::setw( 16 ) << counters.nonzeroes
+		<< std::setw( 16 ) << counters.bytes
+		<< std::setw( 16 ) << counters.flops
+		<< std::setw( 10 ) << std::setprecision( 2 )
+		<< ( seconds > 0 ? counters.bytes / seconds / 1e9 : 0.0 )
+		<< std::setw( 10 )
+		<< ( seconds > 0 ? counters.flops / seconds / 1e9 : 0.0 )
+		<< "  " << site << "\n";
+}
+
+void Profiler::record(
+	const enum Primitive primitive, const void * const site,
+	const Counters &call
+) {
+	std::lock_guard< std::mutex > lock( mutex );
+	const Key key( primitive, site );
+	const auto it = counters.find( key );
+	if( it == counters.end() ) {
+		(void) counters.insert( std::make_pair( key, call ) );
+	} else {
+		it->second += call;
+	}
+}
+
+Counters Profiler::total( const enum Primitive primitive ) const {
+	std::lock_guard< std::mutex > lock( mutex );
+	Counters ret = { 0, 0, 0, 0, 0 };
+	for( const auto &pair : counters ) {
+		if( pair.first.first == primitive ) {
+			ret += pair.second;
+		}
+	}
+	return ret;
+}
+
+void Profiler::report( std::ostream &out ) const {
+	std::lock_guard< std::mutex > lock( mutex );
+	// per call site, in order of decreasing time
+	std::vector< std::pair< Key, Counters > > sites( counters.begin(),
+		counters.end() );
+	std::sort( sites.begin(), sites.end(),
+		[]( const std::pair< Key, Counters > &a,
+			const std::pair< Key, Counters > &b
+		) {
+			return a.second.time > b.second.time;
+		}
+	);
+	const std::ios_base::fmtflags flags = out.flags();
+	const std::streamsize precision = out.precision();
+	out << std::left << std::setw( 18 ) << "primitive" << std::right
+		<< std::setw( 10 ) << "calls" << std::setw( 14 ) << "time (ms)"
+		<< std::setw( 16 ) << "nonzeroes" << std::setw( 16 ) << "bytes"
+		<< std::setw( 16 ) << "flops" << std::setw( 10 ) << "GB/s"
+		<< std::setw( 10 ) << "Gflop/s" << "  call site\n";
+	for( const auto &site : sites ) {
+		printRow( out, toString( site.first.first ), site.second,
+			resolve( site.first.second ) );
+	}
+	// per primitive
+	std::vector< Counters > totals( numPrimitives, Counters{ 0, 0, 0, 0, 0 } );
+	for( const auto &site : sites ) {
+		totals[ site.first.first ] += site.second;
+	}
+	for( size_t i = 0; i < numPrimitives; ++i ) {
+		if( totals[ i ].calls > 0 ) {
+			printRow( out, toString( static_cast< enum Primitive >( i ) ),
+				totals[ i ], "(all call sites)" );
+		}
+	}
+	out.flags( flags );
+	out.precision( precision );
+}
+
+void Profiler::clear() {
+	std::lock_guard< std::mutex > lock( mutex );
+	counters.clear();
+}
+
+Measurement::Measurement( const enum Primitive _primitive ) noexcept :
+	primitive( _primitive ), site( __builtin_return_address( 0 ) ),
+	call{ 1, 0, 0, 0, 0 }, recorded( false )
+{
+	const int rc = clock_gettime( CLOCK_MONOTONIC, &start );
+#ifdef NDEBUG
+	(void) rc;
+#else
+	assert( rc == 0 );
+#endif
+}
+
+Measurement::~Measurement() {
+	if( recorded ) {
+		try {
+			profiler.record( primitive, site, call );
+		} catch( ... ) {
+			// profiling must not alter the outcome of the primitive
+		}
+	}
+}
+
+void Measurement::stop() noexcept {
+	struct timespec stop;
+	const int rc = clock_gettime( CLOCK_MONOTONIC, &stop );
+#ifdef NDEBUG
+	(void) rc;
+#else
+	assert( rc == 0 );
+#endif
+	call.time = static_cast< size_t >( stop.tv_sec - start.tv_sec ) * 1000000000 +
+		stop.tv_nsec - start.tv_nsec;
+	recorded = true;
+}
+
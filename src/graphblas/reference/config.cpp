@@ -27,6 +27,12 @@ std::string grb::config::toString( const ALLOC_MODE mode ) {
 	if( mode == ALLOC_MODE::INTERLEAVED ) {
 		return "interleaved";
 	}
+	if( mode == ALLOC_MODE::LOCAL ) {
+		return "local";
+	}
+	if( mode == ALLOC_MODE::HUGEPAGE ) {
+		return "hugepage";
+	}
 	assert( false );
 	std::cerr << "Warning: unknown memory allocation mode passed to "
 				 "grb::config::toString."
@@ -67,7 +67,8 @@ template<>
 grb::RC grb::finalize< grb::reference >() {
 	std::cerr << "Info: grb::finalize (reference) called.\n";
 	if( internal::reference_bufsize > 0 ) {
-		delete[] internal::reference_buffer;
+		grb::utils::ContainerPool::instance().release( internal::reference_buffer,
+			internal::reference_bufsize, grb::utils::ContainerPool::ALIGNED );
 		internal::reference_bufsize = 0;
 	}
 	return grb::SUCCESS;
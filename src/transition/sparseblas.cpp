@@ -19,6 +19,7 @@
 
 #include <limits>
 #include <vector>
+#include <algorithm>
 #include <iterator>
 #include <iostream>
 #include <stdexcept>
@@ -332,16 +333,25 @@ namespace sparseblas {
 
 			typename grb::Matrix< T >::const_iterator start, end;
 
+			/**
+			 * \internal Cached triangular solve schedule. Only valid when
+			 *           #analysed is <tt>true</tt>.
+			 */
+			grb::TriangularSchedule schedule;
+
+			/** \internal Whether #schedule corresponds to #A. */
+			bool analysed;
+
 			SparseMatrix( const int _m, const int _n ) :
 				m( _m ), n( _n ),
-				finalized( false ), A( nullptr )
+				finalized( false ), A( nullptr ), analysed( false )
 			{
 				ingest = new MatrixUC< T >();
 			}
 
 			SparseMatrix( grb::Matrix< T > &X ) :
 				m( grb::nrows( X ) ), n( grb::ncols( X ) ),
-				finalized( true ), ingest( nullptr ), A( &X )
+				finalized( true ), ingest( nullptr ), A( &X ), analysed( false )
 			{}
 
 			~SparseMatrix() {
@@ -403,6 +413,89 @@ namespace sparseblas {
 		return static_cast< SparseMatrix< double >* >( A );
 	}
 
+	/**
+	 * \internal Deduces the triangle and diagonal type of a given finalised
+	 *           matrix, and caches the corresponding level-set schedule.
+	 *
+	 * @returns grb::SUCCESS if the schedule is available for the requested
+	 *          transposition.
+	 * @returns grb::ILLEGAL if the matrix is neither lower nor upper triangular,
+	 *          or if only part of its diagonal is stored.
+	 */
+	template< typename T >
+	grb::RC analyseTriangular( SparseMatrix< T > &matrix, const bool transposed ) {
+		assert( matrix.finalized );
+		if( matrix.analysed && matrix.schedule.transposed == transposed ) {
+			return grb::SUCCESS;
+		}
+		bool has_lower = false, has_upper = false;
+		size_t diagonal_count = 0;
+		for( const auto &triple : *(matrix.A) ) {
+			const size_t i = triple.first.first;
+			const size_t j = triple.first.second;
+			if( i == j ) {
+				(void) ++diagonal_count;
+			} else if( j < i ) {
+				has_lower = true;
+			} else {
+				has_upper = true;
+			}
+		}
+		if( has_lower && has_upper ) {
+			return grb::ILLEGAL;
+		}
+		const size_t n = matrix.m;
+		if( diagonal_count != 0 && diagonal_count != n ) {
+			return grb::ILLEGAL;
+		}
+		// the transpose of a lower triangular matrix is upper triangular
+		const grb::Triangle triangle = has_upper == transposed
+			? grb::LOWER
+			: grb::UPPER;
+		const grb::Diagonal diagonal = diagonal_count == 0
+			? grb::UNIT
+			: grb::NON_UNIT;
+		grb::RC rc = grb::SUCCESS;
+		if( transposed ) {
+			rc = grb::triangularAnalysis< grb::descriptors::transpose_matrix >(
+				matrix.schedule, *(matrix.A), triangle, diagonal );
+		} else {
+			rc = grb::triangularAnalysis(
+				matrix.schedule, *(matrix.A), triangle, diagonal );
+		}
+		matrix.analysed = rc == grb::SUCCESS;
+		return rc;
+	}
+
+	/**
+	 * \internal Scales a dense block of \a rows by \a cols elements with
+	 *           leading dimension \a ld in-place. A zero \a factor overwrites
+	 *           the block with zeroes, regardless of its previous contents.
+	 */
+	template< typename T >
+	void scaleDense(
+		const bool row_major,
+		const size_t rows, const size_t cols,
+		T * const X, const size_t ld,
+		const T factor
+	) {
+		if( factor == static_cast< T >( 1 ) ) {
+			return;
+		}
+		const size_t outer = row_major ? rows : cols;
+		const size_t inner = row_major ? cols : rows;
+		for( size_t i = 0; i < outer; ++i ) {
+			T * const line = X + i * ld;
+			if( factor == static_cast< T >( 0 ) ) {
+				std::fill( line, line + inner, factor );
+			} else {
+				for( size_t j = 0; j < inner; ++j ) {
+					line[ j ] *= factor;
+				}
+			}
+		}
+	}
+
 	/**
 	 * \internal Internal buffer used for output matrix containers.
 	 */
@@ -701,6 +794,7 @@ extern "C" {
 	int EXTBLAS_dusm_clear( blas_sparse_matrix A ) {
 		auto matrix = sparseblas::getDoubleMatrix( A );
 		assert( matrix->finalized );
+		matrix->analysed = false;
 		const grb::RC rc = grb::clear( *(matrix->A) );
 		if( rc != grb::SUCCESS ) {
 			return 10;
@@ -787,6 +881,63 @@ extern "C" {
 		return 0;
 	}
 
+	int BLAS_dussv(
+		const enum blas_trans_type transt,
+		const double alpha, const blas_sparse_matrix T,
+		double * const x, const int incx
+	) {
+		grb::Semiring<
+			grb::operators::add< double >, grb::operators::mul< double >,
+			grb::identities::zero, grb::identities::one
+		> ring;
+		auto matrix = sparseblas::getDoubleMatrix( T );
+		if( incx != 1 ) {
+			// TODO: requires ALP views
+			std::cerr << "Strided input and/or output vectors are not supported.\n";
+			return 255;
+		}
+		if( !(matrix->finalized) ) {
+			std::cerr << "Input matrix was not yet finalised; see BLAS_duscr_end.\n";
+			return 100;
+		}
+		if( matrix->m != matrix->n ) {
+			std::cerr << "Triangular solves require a square matrix.\n";
+			return 150;
+		}
+		const bool transposed = transt != blas_no_trans;
+		grb::RC rc = sparseblas::analyseTriangular( *matrix, transposed );
+		if( rc != grb::SUCCESS ) {
+			std::cerr << "Could not analyse the input matrix as a triangular matrix: "
+				<< grb::toString( rc ) << ".\n";
+			return 150;
+		}
+		grb::Vector< double > vector = grb::internal::template
+			wrapRawVector< double >( matrix->n, x );
+		if( transposed ) {
+			rc = grb::triangularSolve<
+				grb::descriptors::dense |
+				grb::descriptors::transpose_matrix
+			>( vector, *(matrix->A), vector, matrix->schedule, ring );
+		} else {
+			rc = grb::triangularSolve< grb::descriptors::dense >(
+				vector, *(matrix->A), vector, matrix->schedule, ring );
+		}
+		if( rc != grb::SUCCESS ) {
+			std::cerr << "ALP/GraphBLAS returns error during triangular solve: "
+				<< grb::toString( rc ) << ".\n";
+			return 200;
+		}
+		if( alpha != 1.0 ) {
+			rc = grb::foldl< grb::descriptors::dense >(
+				vector, alpha, ring.getMultiplicativeOperator() );
+			if( rc != grb::SUCCESS ) {
+				std::cerr << "Error during post-scaling during triangular solve\n";
+				return 250;
+			}
+		}
+		return 0;
+	}
+
 	void spblas_dcsrgemv(
 		const char * transa,
 		const int * m_p,
@@ -877,22 +1028,39 @@ extern "C" {
 		const int nrhs,
 		const double alpha, const blas_sparse_matrix A,
 		const double * B, const int ldb,
-		const double * C, const int ldc
+		double * C, const int ldc
 	) {
-		(void) order;
-		(void) transa;
-		(void) nrhs;
-		(void) alpha;
-		(void) A;
-		(void) B;
-		(void) ldb;
-		(void) C;
-		(void) ldc;
-		// TODO requires dense ALP and mixed sparse/dense ALP operations
-		std::cerr << "BLAS_dusmm (sparse matrix times dense matrix) has not yet "
-			<< "been implemented.\n";
-		assert( false );
-		return 255;
+		grb::Semiring<
+			grb::operators::add< double >, grb::operators::mul< double >,
+			grb::identities::zero, grb::identities::one
+		> ring;
+		auto matrix = sparseblas::getDoubleMatrix( A );
+		if( !(matrix->finalized) ) {
+			std::cerr << "Input matrix was not yet finalised; see BLAS_duscr_end.\n";
+			return 100;
+		}
+		if( nrhs < 0 || ldb < 0 || ldc < 0 ) {
+			std::cerr << "Negative block dimensions during SpMM\n";
+			return 10;
+		}
+		if( alpha == 0.0 ) {
+			return 0;
+		}
+		const bool row_major = order == blas_rowmajor;
+		grb::RC rc = grb::SUCCESS;
+		if( transa == blas_no_trans ) {
+			rc = grb::internal::spmm( C, ldc, *(matrix->A), B, ldb, nrhs, row_major,
+				alpha, ring );
+		} else {
+			rc = grb::internal::spmm< grb::descriptors::transpose_matrix >(
+				C, ldc, *(matrix->A), B, ldb, nrhs, row_major, alpha, ring );
+		}
+		if( rc != grb::SUCCESS ) {
+			std::cerr << "ALP/GraphBLAS returns error during SpMM: "
+				<< grb::toString( rc ) << ".\n";
+			return 200;
+		}
+		return 0;
 	}
 
 	void spblas_dcsrmm(
@@ -910,7 +1078,6 @@ extern "C" {
 		assert( n != NULL );
 		assert( k != NULL );
 		assert( alpha != NULL );
-		// not sure yet what constraints if any on matdescra
 		if( *m > 0 && *k > 0 ) {
 			assert( pntrb != NULL );
 			assert( pntre != NULL );
@@ -921,15 +1088,87 @@ extern "C" {
 		assert( beta != NULL );
 		assert( c != NULL );
 		assert( ldc != NULL );
-		(void) transa;
-		(void) m; (void) n; (void) k;
-		(void) alpha;
-		(void) matdescra; (void) val; (void) indx; (void) pntrb; (void) pntre;
-		(void) b; (void) ldb;
-		(void) beta;
-		(void) c; (void) ldc;
-		// requires dense ALP and mixed sparse/dense operations
-		assert( false );
+
+		// declare algebraic structures
+		grb::Semiring<
+			grb::operators::add< double >, grb::operators::mul< double >,
+			grb::identities::zero, grb::identities::one
+		> ring;
+
+		// only general matrices are supported
+		if( matdescra != NULL && matdescra[0] != 'G' ) {
+			std::cerr << "spblas_dcsrmm: only general matrices are supported\n";
+			assert( false );
+			return;
+		}
+		const bool one_based = matdescra != NULL && matdescra[3] == 'F';
+		const bool row_major = !one_based;
+		const bool transposed = transa[0] != 'N';
+		const size_t rows = transposed ? *k : *m;
+
+		// C = beta * C, where beta equal to zero overwrites C
+		sparseblas::scaleDense( row_major, rows, *n, c, *ldc, *beta );
+		if( *alpha == 0.0 || *m == 0 || *k == 0 ) {
+			return;
+		}
+
+		// retrieve a zero-based CRS of A, which requires a copy unless the input
+		// already is zero-based with contiguous rows starting at offset zero
+		const int base = pntrb[ 0 ];
+		std::vector< int > ia, ja;
+		std::vector< double > a;
+		const int * ia_p = pntrb;
+		const int * ja_p = indx;
+		const double * a_p = val;
+		if( one_based || base != 0 || pntre != pntrb + 1 ) {
+			const int offset = one_based ? 1 : 0;
+			size_t nz = 0;
+			for( int i = 0; i < *m; ++i ) {
+				nz += pntre[ i ] - pntrb[ i ];
+			}
+			try {
+				ia.resize( *m + 1 );
+				ja.resize( nz );
+				a.resize( nz );
+			} catch( const std::bad_alloc & ) {
+				std::cerr << "spblas_dcsrmm: out of memory\n";
+				assert( false );
+				return;
+			}
+			ia[ 0 ] = 0;
+			for( int i = 0; i < *m; ++i ) {
+				const int row_nz = pntre[ i ] - pntrb[ i ];
+				for( int l = 0; l < row_nz; ++l ) {
+					ja[ ia[ i ] + l ] = indx[ pntrb[ i ] - base + l ] - offset;
+					a[ ia[ i ] + l ] = val[ pntrb[ i ] - base + l ];
+				}
+				ia[ i + 1 ] = ia[ i ] + row_nz;
+			}
+			ia_p = ia.data();
+			ja_p = ja.data();
+			a_p = a.data();
+		}
+		const grb::Matrix< double, grb::config::default_backend, int, int, int > A =
+			grb::internal::wrapCRSMatrix( a_p, ja_p, ia_p, *m, *k );
+
+		// C = C + alpha * A * B, where alpha scales every nonzero of A as it is
+		// loaded
+		grb::RC rc = grb::SUCCESS;
+		if( transposed ) {
+			rc = grb::internal::spmm<
+				grb::descriptors::transpose_matrix |
+				grb::descriptors::force_row_major
+			>( c, *ldc, A, b, *ldb, *n, row_major, *alpha, ring );
+		} else {
+			rc = grb::internal::spmm< grb::descriptors::force_row_major >(
+				c, *ldc, A, b, *ldb, *n, row_major, *alpha, ring );
+		}
+		if( rc != grb::SUCCESS ) {
+			std::cerr << "ALP/GraphBLAS returns error during SpMM: "
+				<< grb::toString( rc ) << ".\n";
+			assert( false );
+			return;
+		}
 	}
 
 	int EXTBLAS_dusmsv(
@@ -1061,6 +1300,7 @@ extern "C" {
 		}
 
 		grb::RC rc = grb::SUCCESS;
+		matC->analysed = false;
 		if( alpha != 1.0 ) {
 			/*const grb::RC rc = grb::foldl( *(matC->A), 1.0 / alpha,
 				ring.getMultiplicativeOperator() );
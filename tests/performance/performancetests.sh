@@ -18,7 +18,7 @@
 
 #Usage: $0 (DATASET) (EXPERIMENT)
 #Note that all arguments are optional. They select a subset of performance tests only.
-#EXPERIMENT can be one of PAGERANK, KNN, LABEL, KERNEL, or SCALING.
+#EXPERIMENT can be one of PAGERANK, KNN, LABEL, TRIANGLES, KERNEL, SCALING, or PRIMITIVES.
 #DATASET can be one of facebook_combined cit-HepTh com-amazon.ungraph com-youtube.ungraph cit-Patents com-orkut.ungraph
 
 #Example (run everything): $0
@@ -27,6 +27,8 @@
 #Example (run pagerank experiment on facebook_combined): $0 facebook_combined PAGERANK
 #Example (run k-NN experiment on facebook_combined): $0 facebook_combined KNN
 #Example (run all non-kernel experiments on given dataset): $0 facebook_combined
+#Example (run SpMV on a generated R-MAT graph instead of on files): GENERATED_DATASETS=yes $0 rmat:20:16 SPMV
+#Example (run primitive microbenchmarks only, against a stored baseline): PRIMITIVES_BASELINE=baseline.csv $0 PRIMITIVES
 
 TESTS_ROOT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )"/../ &> /dev/null && pwd )"
 source ${TESTS_ROOT_DIR}/parse_env.sh
@@ -59,6 +61,9 @@ if [[ "${DATASETTORUN}" == "KERNEL" ]]; then
 elif [[ "${DATASETTORUN}" == "SCALING" ]]; then
 	EXPTYPE=${DATASETTORUN}
 	unset DATASETTORUN
+elif [[ "${DATASETTORUN}" == "PRIMITIVES" ]]; then
+	EXPTYPE=${DATASETTORUN}
+	unset DATASETTORUN
 else
 	echo "Info: selected dataset ${DATASETTORUN}"
 fi
@@ -76,6 +81,27 @@ KNN6SOLS=(238 526 4189 1 181 1 1268035)
 #the following datasets are used for benchmarking SpMV, SpMSpV, and SpMSpM
 MULTIPLICATION_DATASETS=(west0497.mtx fidap037.mtx cavity17.mtx s3rmt3m3.mtx bloweybq.mtx bcsstk17.mtx Pres_Poisson.mtx gyro_m.mtx memplus.mtx lhr34.mtx bcsstk32.mtx vanbody.mtx s3dkt3m2.mtx G2_circuit.mtx Stanford.mtx coPapersCiteseer.mtx bundle_adj.mtx Stanford_Berkeley.mtx apache2.mtx Emilia_923.mtx ldoor.mtx ecology2.mtx Serena.mtx cage14.mtx G3_circuit.mtx wikipedia-20051105.mtx wikipedia-20061104.mtx Freescale1.mtx wikipedia-20070206.mtx Queen_4147.mtx cage15.mtx adaptive.mtx rgg_n_2_24_s0.mtx uk-2002.mtx road_usa.mtx MOLIERE_2016.mtx europe_osm.mtx twitter.mtx com-Friendster.mtx)
 
+#if GENERATED_DATASETS=yes, the following generated matrices replace the above
+#datasets for benchmarking SpMV, SpMSpV, and SpMSpM; see tests/utils/graph_generators.hpp
+GENERATED_MULTIPLICATION_DATASETS=(stencil2d:1024 stencil3d:128 er:1048576:16 rmat:20:16 rmat:22:16)
+if [ "x${GENERATED_DATASETS}" == "xyes" ]; then
+	echo "Info: using generated datasets for the multiplication kernels"
+	MULTIPLICATION_DATASETS=(${GENERATED_MULTIPLICATION_DATASETS[@]})
+fi
+
+#the following generated matrices of increasing size and density are used for
+#the microbenchmarks of all primitives; see tests/performance/primitives.cpp
+PRIMITIVES_DATASETS=(stencil2d:256 stencil2d:1024 stencil3d:128 er:1048576:4 er:1048576:32 rmat:18:16 rmat:20:16)
+
+#the CSV file with baseline times of the primitive microbenchmarks, if any;
+#the times of every run are written to TEST_OUT_DIR, and may serve as one
+if [ -z "${PRIMITIVES_BASELINE}" ]; then
+	PRIMITIVES_BASELINE=-
+elif [ ! -f "${PRIMITIVES_BASELINE}" ]; then
+	echo "Error: PRIMITIVES_BASELINE was set, but ${PRIMITIVES_BASELINE} does not exist"
+	exit 255;
+fi
+
 #which command to use to run a GraphBLAS program
 LPF=yes
 if [ -z "${LPFRUN}" ]; then
@@ -288,7 +314,12 @@ runMultiplicationKernels()
 	local parseMode=$4
 	local i=$5
 
-	# the check for the matrices existence is assumed to have already passed
+	# the check for the matrices existence is assumed to have already passed;
+	# generator specifications contain a colon and are passed as-is
+	local input=${INPUT_DIR}/${dataSet}
+	if [[ "${dataSet}" == *:* ]]; then
+		input=${dataSet}
+	fi
 
 	if [ -z "$EXPTYPE" ] || [ "$EXPTYPE" == "SPMV" ]; then
 
@@ -296,7 +327,7 @@ runMultiplicationKernels()
 		# spmv
 		echo ">>>      [ ]           [x]       Testing spmv using ${dataSet} dataset, $backend backend."
 		echo
-		$runner ${TEST_BIN_DIR}/driver_spmv_${backend} ${INPUT_DIR}/${dataSet} ${parseMode} &> ${TEST_OUT_DIR}/driver_spmv_${backend}_${dataSet}
+		$runner ${TEST_BIN_DIR}/driver_spmv_${backend} ${input} ${parseMode} &> ${TEST_OUT_DIR}/driver_spmv_${backend}_${dataSet}
 		head -1 ${TEST_OUT_DIR}/driver_spmv_${backend}_${dataSet}
 		if grep -q "Test OK" ${TEST_OUT_DIR}/driver_spmv_${backend}_${dataSet}; then
 			printf "Test OK\n\n"
@@ -307,6 +338,22 @@ runMultiplicationKernels()
 		egrep 'Avg|Std' ${TEST_OUT_DIR}/driver_spmv_${backend}_${dataSet} >> ${TEST_OUT_DIR}/benchmarks
 		echo >> ${TEST_OUT_DIR}/benchmarks
 
+		# spmv, with container arrays backed by huge pages
+		if [ "$backend" = "reference" ] || [ "$backend" = "reference_omp" ] || [ "$backend" = "nonblocking" ]; then
+			echo ">>>      [ ]           [x]       Testing spmv with huge pages using ${dataSet} dataset, $backend backend."
+			echo
+			GRB_HUGE_PAGES=1 $runner ${TEST_BIN_DIR}/driver_spmv_${backend} ${input} ${parseMode} &> ${TEST_OUT_DIR}/driver_spmv_hugepages_${backend}_${dataSet}
+			head -1 ${TEST_OUT_DIR}/driver_spmv_hugepages_${backend}_${dataSet}
+			if grep -q "Test OK" ${TEST_OUT_DIR}/driver_spmv_hugepages_${backend}_${dataSet}; then
+				printf "Test OK\n\n"
+			else
+				printf "Test FAILED\n\n"
+			fi
+			echo "$backend spmv with huge pages using the ${dataSet} dataset" >> ${TEST_OUT_DIR}/benchmarks
+			egrep 'Avg|Std' ${TEST_OUT_DIR}/driver_spmv_hugepages_${backend}_${dataSet} >> ${TEST_OUT_DIR}/benchmarks
+			echo >> ${TEST_OUT_DIR}/benchmarks
+		fi
+
 	fi
 
 	if [ -z "$EXPTYPE" ] || [ "$EXPTYPE" == "SPMSPV" ]; then
@@ -315,7 +362,7 @@ runMultiplicationKernels()
 		# spmspv
 		echo ">>>      [ ]           [x]       Testing spmspv using ${dataSet} dataset, $backend backend."
 		echo
-		$runner ${TEST_BIN_DIR}/driver_spmspv_${backend} ${INPUT_DIR}/${dataSet} ${parseMode} &> ${TEST_OUT_DIR}/driver_spmspv_${backend}_${dataSet}
+		$runner ${TEST_BIN_DIR}/driver_spmspv_${backend} ${input} ${parseMode} &> ${TEST_OUT_DIR}/driver_spmspv_${backend}_${dataSet}
 		head -1 ${TEST_OUT_DIR}/driver_spmspv_${backend}_${dataSet}
 		if grep -q "Test OK" ${TEST_OUT_DIR}/driver_spmspv_${backend}_${dataSet}; then
 			printf "Test OK\n\n"
@@ -341,7 +388,7 @@ runMultiplicationKernels()
 			echo "Tests DISABLED: by default, long-running sparse matrix--sparse matrix multiplications are disabled (skipping dataset ${dataSet})."
 			echo " "
 		else
-			$runner ${TEST_BIN_DIR}/driver_spmspm_${backend} ${INPUT_DIR}/${dataSet} ${INPUT_DIR}/${dataSet} ${parseMode} &> ${TEST_OUT_DIR}/driver_spmspm_${backend}_${dataSet}
+			$runner ${TEST_BIN_DIR}/driver_spmspm_${backend} ${input} ${input} ${parseMode} &> ${TEST_OUT_DIR}/driver_spmspm_${backend}_${dataSet}
 			head -1 ${TEST_OUT_DIR}/driver_spmspm_${backend}_${dataSet}
 			if grep -q "Test OK" ${TEST_OUT_DIR}/driver_spmspm_${backend}_${dataSet}; then
 				printf "Test OK\n\n"
@@ -355,6 +402,46 @@ runMultiplicationKernels()
 	fi
 }
 
+runPrimitivesBenchmarks()
+{
+	local runner=$1
+	local backend=$2
+	local dataSet=$3
+	local T=$4
+
+	# thread counts are swept by powers of two for shared-memory parallel
+	# backends, while all other backends use their standard configuration
+	local threads=(${T})
+	if [ "$backend" = "reference_omp" ] || [ "$backend" = "nonblocking" ]; then
+		threads=()
+		for ((t=1;t<T;t*=2)); do
+			threads+=(${t})
+		done
+		threads+=(${T})
+	fi
+
+	for t in ${threads[@]}; do
+		local log=${TEST_OUT_DIR}/driver_primitives_${backend}_${dataSet}_${t}
+		echo ">>>      [ ]           [x]       Testing all primitives using ${dataSet} dataset,"
+		echo "                                 ${backend} backend, ${t} thread(s)."
+		echo
+		if [ "$backend" = "reference_omp" ] || [ "$backend" = "nonblocking" ]; then
+			OMP_NUM_THREADS=${t} $runner ${TEST_BIN_DIR}/driver_primitives_${backend} ${dataSet} 0 5 ${PRIMITIVES_BASELINE} 0.2 ${log}.csv &> ${log}
+		else
+			$runner ${TEST_BIN_DIR}/driver_primitives_${backend} ${dataSet} 0 5 ${PRIMITIVES_BASELINE} 0.2 ${log}.csv &> ${log}
+		fi
+		head -1 ${log}
+		if grep -q "Test OK" ${log}; then
+			printf "Test OK\n\n"
+		else
+			printf "Test FAILED\n\n"
+		fi
+		echo "$backend primitives using the ${dataSet} dataset, ${t} thread(s)" >> ${TEST_OUT_DIR}/benchmarks
+		sed -n '/^primitive/,/^Test/p' ${log} >> ${TEST_OUT_DIR}/benchmarks
+		echo >> ${TEST_OUT_DIR}/benchmarks
+	done
+}
+
 # end helper functions
 
 if [ -z "$EXPTYPE" ] || ! [ "$EXPTYPE" == "KERNEL" ]; then
@@ -420,6 +507,18 @@ if [ -z "$EXPTYPE" ] || ! [ "$EXPTYPE" == "KERNEL" ]; then
 			runScalingTest "$runner" "${BACKEND}"
 		fi
 
+		# microbenchmarks of all primitives
+		if [[ -z $DATASETTORUN && ( -z "$EXPTYPE" || "$EXPTYPE" == "PRIMITIVES" ) ]]; then
+			if [ ! -f ${TEST_BIN_DIR}/driver_primitives_${BACKEND} ]; then
+				echo "Info: primitive microbenchmarks are not available for the ${BACKEND} backend"
+				echo " "
+			else
+				for dataSet in ${PRIMITIVES_DATASETS[@]}; do
+					runPrimitivesBenchmarks "$runner" "${BACKEND}" "${dataSet}" "${T}"
+				done
+			fi
+		fi
+
 		for ((i=0;i<${#DATASETS[@]};++i));
 		do
 			if [ "$BACKEND" = "hyperdags" ] && [ "$i" -gt "0" ]; then
@@ -475,6 +574,16 @@ if [ -z "$EXPTYPE" ] || ! [ "$EXPTYPE" == "KERNEL" ]; then
 				runOtherBenchMarkTests "$runner" "$BACKEND" "$DATASET" "$PARSE_MODE" 0 "simple_pagerank"
 
 			fi
+			if [ -z "$EXPTYPE" ] || [ "$EXPTYPE" == "TRIANGLES" ]; then
+
+				# ---------------------------------------------------------------------
+				# triangle counting
+				runOtherBenchMarkTests "$runner" "$BACKEND" "$DATASET" "$PARSE_MODE" 0 "triangle_count"
+				echo "$BACKEND triangle_count throughput using the ${DATASET} dataset" >> ${TEST_OUT_DIR}/benchmarks
+				grep 'Edges per second' ${TEST_OUT_DIR}/driver_triangle_count_${BACKEND}_${DATASET} >> ${TEST_OUT_DIR}/benchmarks
+				echo >> ${TEST_OUT_DIR}/benchmarks
+
+			fi
 		done
 
 		for ((i=0;i<${#MULTIPLICATION_DATASETS[@]};++i));
@@ -493,8 +602,8 @@ if [ -z "$EXPTYPE" ] || ! [ "$EXPTYPE" == "KERNEL" ]; then
 			DATASET=${MULTIPLICATION_DATASETS[i]}
 			PARSE_MODE=direct
 
-			# test for file
-			if [ ! -f ${INPUT_DIR}/${DATASET} ]; then
+			# test for file, unless generated
+			if [[ "${DATASET}" != *:* ]] && [ ! -f ${INPUT_DIR}/${DATASET} ]; then
 				echo ">>>      [ ]           [x]       Test multiplication kernels using ${DATASET} dataset,"
 				echo "                                 ${BACKEND} backend."
 				echo "Tests DISABLED: dataset/${DATASET} not found. Provide the dataset to enable performance tests with it."
@@ -0,0 +1,517 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Microbenchmarks every BLAS1, BLAS2, and BLAS3 primitive, including masked and
+ * descriptor variants, on vectors of the size of, and on, a generated matrix.
+ *
+ * For every primitive, reports the best time per call over all outer
+ * repetitions, together with the effective bandwidth and floating-point rate
+ * derived from estimates of the bytes and operations the primitive requires
+ * at minimum. Bandwidths are reported relative to that of the STREAM-like
+ * axpy kernel of bench_kernels.c, as measured on the same user processes and
+ * threads.
+ *
+ * If a baseline file is given, times are compared to those recorded in that
+ * file for the same primitive, matrix, and number of processes and threads.
+ * Primitives that are slower than the baseline by more than a given tolerance
+ * are reported as regressions. Since timings vary between runs and systems,
+ * regressions do not make this benchmark fail. The baseline file is never
+ * written to; rather, the measured times may be written to a separate output
+ * file in the same format, which may then serve as a baseline for later runs.
+ *
+ * The backends that build on LPF do not implement mxm, and hence skip it.
+ */
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+
+#include <inttypes.h>
+
+#include <graphblas/utils/Timer.hpp>
+
+#include <graphblas.hpp>
+
+#include <utils/graph_generators.hpp>
+
+#include "bench_kernels.h" // for bench_kernels_axpy
+
+
+using namespace grb;
+
+/** The maximum number of benchmarked primitives. */
+static constexpr size_t max_results = 32;
+
+struct input {
+	char matrix[ 1024 ];
+	size_t inner;
+	size_t outer;
+};
+
+struct result {
+	char name[ 48 ];
+	double time;
+	double bytes;
+	double flops;
+};
+
+struct output {
+	int error_code;
+	size_t n;
+	size_t nz;
+	size_t processes;
+	size_t threads;
+	double baseline;
+	size_t count;
+	struct result results[ max_results ];
+};
+
+/**
+ * Times \a call, and returns the best time per call in \a best.
+ *
+ * Calls \a call once to warm up, and to deduce the number of inner repetitions
+ * if \a in requests it. Every timing is the maximum over all user processes.
+ */
+template< typename Call >
+static RC bestTime( const struct input &in, const Call &call, double &best ) {
+	grb::utils::Timer timer;
+	timer.reset();
+	RC rc = call();
+	rc = rc ? rc : wait();
+	double single = timer.time();
+	rc = rc ? rc : collectives<>::allreduce( single, operators::max< double >() );
+	const size_t inner = in.inner > 0
+		? in.inner
+		: static_cast< size_t >( 100.0 / std::max( single, 1e-6 ) ) + 1;
+	best = std::numeric_limits< double >::infinity();
+	for( size_t k = 0; rc == SUCCESS && k < in.outer; ++k ) {
+		timer.reset();
+		for( size_t i = 0; rc == SUCCESS && i < inner; ++i ) {
+			rc = call();
+		}
+		rc = rc ? rc : wait();
+		double time = timer.time() / static_cast< double >( inner );
+		rc = rc ? rc : collectives<>::allreduce( time, operators::max< double >() );
+		best = std::min( best, time );
+	}
+	return rc;
+}
+
+/** Times \a call, and records the result under \a name. */
+template< typename Call >
+static RC measure(
+	const struct input &in, struct output &out,
+	const char * const name, const double bytes, const double flops,
+	const Call &call
+) {
+	if( out.count == max_results ) {
+		return ILLEGAL;
+	}
+	double best;
+	const RC rc = bestTime( in, call, best );
+	if( rc != SUCCESS ) {
+		if( spmd<>::pid() == 0 ) {
+			std::cerr << "Failure: benchmark of " << name << " did not succeed ("
+				<< toString( rc ) << ")." << std::endl;
+		}
+		return rc;
+	}
+	struct result &res = out.results[ out.count++ ];
+	(void) strncpy( res.name, name, sizeof( res.name ) - 1 );
+	res.name[ sizeof( res.name ) - 1 ] = '\0';
+	res.time = best;
+	res.bytes = bytes;
+	res.flops = flops;
+	return SUCCESS;
+}
+
+void grbProgram( const struct input &data_in, struct output &out ) {
+	const size_t s = spmd<>::pid();
+	const size_t P = spmd<>::nprocs();
+	out.error_code = 0;
+	out.count = 0;
+	out.processes = P;
+#ifdef _GRB_WITH_OMP
+	out.threads = config::OMP::threads();
+#else
+	out.threads = 1;
+#endif
+
+	// generate the matrix
+	grb::utils::GraphGenerator generator;
+	if( !generator.parse( data_in.matrix ) ) {
+		std::cerr << s << ": " << data_in.matrix << " is not a valid generator "
+			<< "specification." << std::endl;
+		out.error_code = 10;
+		return;
+	}
+	const size_t n = generator.size();
+	std::vector< size_t > I, J;
+	std::vector< double > V;
+	Matrix< double > A( n, n ), B( n, n ), C( n, n );
+	RC rc = generator.generate( I, J, V );
+	rc = rc ? rc : buildMatrixUnique( A, I.data(), J.data(), V.data(), I.size(),
+		PARALLEL );
+	if( rc != SUCCESS ) {
+		std::cerr << s << ": generating the matrix failed (" << toString( rc )
+			<< ")." << std::endl;
+		out.error_code = 20;
+		return;
+	}
+	const size_t nz = nnz( A );
+	out.n = n;
+	out.nz = nz;
+
+	// the STREAM-like baseline
+	{
+		const size_t local_n = grb::utils::compute_parallel_num_nonzeroes( n );
+		std::vector< double > a( local_n ), x( local_n, 1.0 ), y( local_n, 2.0 );
+		double best;
+		rc = bestTime( data_in, [ &a, &x, &y, local_n ]() {
+				bench_kernels_axpy( a.data(), 2.0, x.data(), y.data(), local_n );
+				return SUCCESS;
+			}, best );
+		if( rc != SUCCESS ) {
+			out.error_code = 30;
+			return;
+		}
+		out.baseline = 3.0 * sizeof( double ) * n / best / 1e6;
+	}
+
+	// initialise containers
+	const Semiring<
+		operators::add< double >, operators::mul< double >,
+		identities::zero, identities::one
+	> ring;
+	const Monoid< operators::add< double >, identities::zero > plusM;
+	const operators::add< double > plus;
+	Vector< double > x( n ), y( n ), z( n );
+	Vector< bool > mask( n );
+	rc = set( x, 1.0 );
+	rc = rc ? rc : set( y, 2.0 );
+	rc = rc ? rc : set( z, 0.0 );
+	for( size_t i = 0; rc == SUCCESS && i < n; i += 2 ) {
+		rc = setElement( mask, true, i );
+	}
+#ifndef _GRB_WITH_LPF
+	rc = rc ? rc : mxm( C, A, A, ring, RESIZE );
+#endif
+	rc = rc ? rc : wait();
+	if( rc != SUCCESS ) {
+		std::cerr << s << ": initialisation failed (" << toString( rc ) << ")."
+			<< std::endl;
+		out.error_code = 40;
+		return;
+	}
+	double alpha = 0.0;
+
+	// minimum bytes moved, assuming compressed row storage of A
+	const double vec = static_cast< double >( n ) * sizeof( double );
+	const double half = vec / 2.0;
+	const double bits = static_cast< double >( n ) * sizeof( bool );
+	const double crs = static_cast< double >( nz ) *
+		( sizeof( double ) + sizeof( config::ColIndexType ) ) +
+		static_cast< double >( n + 1 ) * sizeof( config::NonzeroIndexType );
+	const double build = static_cast< double >( nz ) *
+		( 2 * sizeof( size_t ) + sizeof( double ) ) + crs;
+#ifndef _GRB_WITH_LPF
+	const double products = 2.0 * static_cast< double >( nz ) *
+		static_cast< double >( nz ) / static_cast< double >( n );
+#endif
+
+	// BLAS1
+	rc = measure( data_in, out, "set (scalar)", vec, 0,
+		[ &y ]() { return set( y, 2.0 ); } );
+	rc = rc ? rc : measure( data_in, out, "set (vector)", 2 * vec, 0,
+		[ &z, &x ]() { return set( z, x ); } );
+	rc = rc ? rc : measure( data_in, out, "set (masked)",
+		bits + 2 * half, 0,
+		[ &z, &mask, &x ]() { return set( z, mask, x ); } );
+	rc = rc ? rc : measure( data_in, out, "set (use_index)", 2 * vec, 0,
+		[ &z, &x ]() { return set< descriptors::use_index >( z, x ); } );
+	rc = rc ? rc : measure( data_in, out, "eWiseApply", 3 * vec, n,
+		[ &z, &x, &y, &plus ]() { return eWiseApply( z, x, y, plus ); } );
+	rc = rc ? rc : measure( data_in, out, "eWiseApply (dense)", 3 * vec, n,
+		[ &z, &x, &y, &plus ]() {
+			return eWiseApply< descriptors::dense >( z, x, y, plus );
+		} );
+	rc = rc ? rc : measure( data_in, out, "eWiseApply (masked)",
+		bits + 3 * half, n / 2,
+		[ &z, &mask, &x, &y, &plus ]() {
+			return eWiseApply( z, mask, x, y, plus );
+		} );
+	rc = rc ? rc : measure( data_in, out, "eWiseMulAdd", 3 * vec, 2 * n,
+		[ &z, &x, &y, &ring ]() { return eWiseMulAdd( z, 2.0, x, y, ring ); } );
+	rc = rc ? rc : measure( data_in, out, "foldl (vector)", 3 * vec, n,
+		[ &z, &x, &plus ]() { return foldl( z, x, plus ); } );
+	rc = rc ? rc : measure( data_in, out, "foldl (masked)",
+		bits + 3 * half, n / 2,
+		[ &z, &mask, &x, &plus ]() { return foldl( z, mask, x, plus ); } );
+	rc = rc ? rc : measure( data_in, out, "foldl (scalar)", vec, n,
+		[ &alpha, &x, &plusM ]() { alpha = 0.0; return foldl( alpha, x, plusM ); } );
+	rc = rc ? rc : measure( data_in, out, "dot", 2 * vec, 2 * n,
+		[ &alpha, &x, &y, &ring ]() { alpha = 0.0; return dot( alpha, x, y, ring ); } );
+
+	// BLAS2
+	rc = rc ? rc : measure( data_in, out, "mxv", crs + 2 * vec, 2 * nz,
+		[ &y, &A, &x, &ring ]() { return mxv( y, A, x, ring ); } );
+	rc = rc ? rc : measure( data_in, out, "mxv (masked)",
+		bits + crs / 2 + vec + half, nz,
+		[ &y, &mask, &A, &x, &ring ]() { return mxv( y, mask, A, x, ring ); } );
+	rc = rc ? rc : measure( data_in, out, "mxv (transpose_matrix)",
+		crs + 2 * vec, 2 * nz,
+		[ &y, &A, &x, &ring ]() {
+			return mxv< descriptors::transpose_matrix >( y, A, x, ring );
+		} );
+	rc = rc ? rc : measure( data_in, out, "mxv (dense)", crs + 2 * vec, 2 * nz,
+		[ &y, &A, &x, &ring ]() {
+			return mxv< descriptors::dense >( y, A, x, ring );
+		} );
+	rc = rc ? rc : measure( data_in, out, "vxm", crs + 2 * vec, 2 * nz,
+		[ &y, &x, &A, &ring ]() { return vxm( y, x, A, ring ); } );
+	rc = rc ? rc : measure( data_in, out, "vxm (masked)",
+		bits + crs / 2 + vec + half, nz,
+		[ &y, &mask, &x, &A, &ring ]() { return vxm( y, mask, x, A, ring ); } );
+
+	// BLAS3
+#ifndef _GRB_WITH_LPF
+	rc = rc ? rc : measure( data_in, out, "mxm", 3 * crs, products,
+		[ &C, &A, &ring ]() { return mxm( C, A, A, ring ); } );
+#endif
+
+	// I/O
+	rc = rc ? rc : measure( data_in, out, "buildMatrixUnique", build, 0,
+		[ &B, &I, &J, &V ]() {
+			return buildMatrixUnique( B, I.data(), J.data(), V.data(), I.size(),
+				PARALLEL );
+		} );
+
+	if( rc == SUCCESS && nnz( B ) != nz ) {
+		std::cerr << s << ": unexpected output of buildMatrixUnique." << std::endl;
+		rc = FAILED;
+	}
+#ifndef _GRB_WITH_LPF
+	if( rc == SUCCESS && nnz( C ) == 0 ) {
+		std::cerr << s << ": unexpected output of mxm." << std::endl;
+		rc = FAILED;
+	}
+#endif
+	if( rc != SUCCESS ) {
+		out.error_code = 50;
+	}
+}
+
+/** A key that identifies a benchmark in a baseline file. */
+static std::string key(
+	const struct input &in, const struct output &out, const char * const name
+) {
+	std::ostringstream oss;
+	oss << name << "," << in.matrix << "," << out.processes << ","
+		<< out.threads;
+	return oss.str();
+}
+
+int main( int argc, char ** argv ) {
+	// sanity check
+	if( argc < 2 || argc > 7 ) {
+		std::cout << "Usage: " << argv[ 0 ] << " <matrix> (inner iterations) "
+			<< "(outer iterations) (baseline file) (tolerance) (output file)\n";
+		std::cout << "<matrix> is a mandatory generator specification, one of "
+			<< "rmat:scale[:edgefactor[:seed]], er:n[:degree[:seed]], "
+			<< "stencil2d:nx[:ny], or stencil3d:nx[:ny:nz]. All vectors have the "
+			<< "size of the generated matrix.\n";
+		std::cout << "(inner iterations) is optional, the default is "
+			<< grb::config::BENCHMARKING::inner() << ". "
+			<< "If set to zero, the program will select a number of iterations "
+			<< "approximately required to take at least 100 ms. per primitive.\n";
+		std::cout << "(outer iterations) is optional, the default is "
+			<< grb::config::BENCHMARKING::outer() << ". "
+			<< "This value must be strictly larger than 0.\n";
+		std::cout << "(baseline file) is optional. If given, times are compared to "
+			<< "those recorded in this existing CSV file. If set to -, no "
+			<< "comparison is made.\n";
+		std::cout << "(tolerance) is optional, the default is 0.2. A primitive "
+			<< "that takes more than (1 + tolerance) times its baseline time is "
+			<< "reported as a regression.\n";
+		std::cout << "(output file) is optional. If given, the measured times are "
+			<< "written to this CSV file, in the format of a baseline file."
+			<< std::endl;
+		return 0;
+	}
+	std::cout << "Test executable: " << argv[ 0 ] << std::endl;
+#ifndef NDEBUG
+	std::cerr << "Warning: this benchmark utility was **not** compiled with the "
+		<< "NDEBUG macro defined(!)\n";
+#endif
+
+	// the input struct
+	struct input in;
+	(void) strncpy( in.matrix, argv[ 1 ], 1023 );
+	in.matrix[ 1023 ] = '\0';
+	in.inner = grb::config::BENCHMARKING::inner();
+	in.outer = grb::config::BENCHMARKING::outer();
+	char * end = nullptr;
+	if( argc >= 3 ) {
+		in.inner = strtoumax( argv[ 2 ], &end, 10 );
+		if( argv[ 2 ] == end ) {
+			std::cerr << "Could not parse argument " << argv[ 2 ] << " "
+				<< "for number of inner experiment repititions." << std::endl;
+			return 2;
+		}
+	}
+	if( argc >= 4 ) {
+		in.outer = strtoumax( argv[ 3 ], &end, 10 );
+		if( argv[ 3 ] == end || in.outer == 0 ) {
+			std::cerr << "Could not parse argument " << argv[ 3 ] << " "
+				<< "for number of outer experiment repititions." << std::endl;
+			return 4;
+		}
+	}
+	std::string baselineFile = argc >= 5 ? argv[ 4 ] : "";
+	if( baselineFile == "-" ) {
+		baselineFile.clear();
+	}
+	double tolerance = 0.2;
+	if( argc >= 6 ) {
+		tolerance = strtod( argv[ 5 ], &end );
+		if( argv[ 5 ] == end || tolerance < 0 ) {
+			std::cerr << "Could not parse argument " << argv[ 5 ] << " "
+				<< "for the tolerance." << std::endl;
+			return 5;
+		}
+	}
+	const std::string outputFile = argc >= 7 ? argv[ 6 ] : "";
+
+	// read the baseline
+	std::vector< std::pair< std::string, double > > baseline;
+	if( !baselineFile.empty() ) {
+		std::ifstream file( baselineFile );
+		if( !file ) {
+			std::cerr << "Could not read baseline file " << baselineFile << std::endl;
+			return 7;
+		}
+		std::string line;
+		while( std::getline( file, line ) ) {
+			// the key consists of the first four fields, followed by the time
+			size_t pos = 0;
+			for( size_t k = 0; k < 4 && pos != std::string::npos; ++k ) {
+				pos = line.find( ',', pos == 0 ? 0 : pos + 1 );
+			}
+			if( pos == std::string::npos || line.compare( 0, 10, "primitive," ) == 0 ) {
+				continue;
+			}
+			baseline.push_back( std::make_pair( line.substr( 0, pos ),
+				strtod( line.c_str() + pos + 1, nullptr ) ) );
+		}
+	}
+
+	// launch benchmark
+	struct output out;
+	grb::Launcher< AUTOMATIC > launcher;
+	const RC rc = launcher.exec( &grbProgram, in, out, true );
+	if( rc != SUCCESS ) {
+		std::cerr << "launcher.exec returns with non-SUCCESS error code "
+			<< grb::toString( rc ) << std::endl;
+		return 6;
+	}
+	if( out.error_code != 0 ) {
+		std::cerr << std::flush;
+		std::cout << "Error code is " << out.error_code << ".\n";
+		std::cout << "Test FAILED\n" << std::endl;
+		return out.error_code;
+	}
+
+	// report, and compare against the baseline
+	std::cout << "Matrix " << in.matrix << " of size " << out.n << " with "
+		<< out.nz << " nonzeroes, using " << out.processes << " process(es) and "
+		<< out.threads << " thread(s) each.\n";
+	std::cout << "Baseline bandwidth of axpy (bench_kernels): " << out.baseline
+		<< " GB/s.\n";
+	std::cout << std::left << std::setw( 28 ) << "primitive" << std::right
+		<< std::setw( 14 ) << "time (ms)" << std::setw( 10 ) << "GB/s"
+		<< std::setw( 10 ) << "GFLOP/s" << std::setw( 12 ) << "% baseline"
+		<< std::setw( 14 ) << "vs. baseline" << "\n";
+	size_t regressions = 0, missing = 0;
+	std::ostringstream results;
+	for( size_t k = 0; k < out.count; ++k ) {
+		const struct result &res = out.results[ k ];
+		const double gbs = res.bytes / res.time / 1e6;
+		const double gflops = res.flops / res.time / 1e6;
+		std::cout << std::left << std::setw( 28 ) << res.name << std::right
+			<< std::scientific << std::setprecision( 4 ) << std::setw( 14 )
+			<< res.time << std::fixed << std::setprecision( 2 ) << std::setw( 10 )
+			<< gbs << std::setw( 10 ) << gflops << std::setw( 12 )
+			<< 100.0 * gbs / out.baseline;
+		const std::string id = key( in, out, res.name );
+		bool found = false;
+		for( const auto &entry : baseline ) {
+			if( entry.first == id ) {
+				found = true;
+				const double ratio = res.time / entry.second;
+				std::cout << std::setw( 13 ) << 100.0 * ratio << "%";
+				if( ratio > 1.0 + tolerance ) {
+					std::cout << "  REGRESSION";
+					(void) ++regressions;
+				}
+				break;
+			}
+		}
+		if( !found && !baselineFile.empty() ) {
+			(void) ++missing;
+		}
+		results << std::setprecision( 17 ) << std::defaultfloat << id << ","
+			<< res.time << "," << gbs << "," << gflops << "\n";
+		std::cout << std::defaultfloat << "\n";
+	}
+
+	// record the measured times
+	if( !outputFile.empty() ) {
+		std::ofstream file( outputFile );
+		file << "primitive,matrix,processes,threads,time_ms,gbs,gflops\n"
+			<< results.str();
+		if( !file ) {
+			std::cerr << "Could not write to output file " << outputFile
+				<< std::endl;
+			std::cout << "Test FAILED\n" << std::endl;
+			return 8;
+		}
+		std::cout << "Info: wrote the measured times to " << outputFile << ".\n";
+	}
+
+	if( missing > 0 ) {
+		std::cout << "Info: " << missing << " primitive(s) have no entry in "
+			<< "baseline file " << baselineFile << ".\n";
+	}
+	if( regressions > 0 ) {
+		std::cout << "Warning: " << regressions << " primitive(s) regressed by "
+			<< "more than " << 100.0 * tolerance << "% versus the baseline.\n";
+	}
+	std::cout << "Test OK\n" << std::endl;
+	return 0;
+}
+
@@ -20,6 +20,7 @@
  * @date May, 2022
  */
 
+#include <memory>
 #include <exception>
 #include <iostream>
 #include <vector>
@@ -31,6 +32,8 @@
 
 #include <graphblas.hpp>
 
+#include <utils/graph_generators.hpp>
+
 
 using namespace grb;
 
@@ -72,28 +75,36 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 	// assume successful run
 	out.error_code = 0;
 
-	// create local parser
-	grb::utils::MatrixFileReader< double,
-		std::conditional< (sizeof(grb::config::RowIndexType) >
-				sizeof(grb::config::ColIndexType)),
-			grb::config::RowIndexType,
-			grb::config::ColIndexType
-		>::type
-	> parserL( data_in.filenameL, data_in.direct );
+	// select generators, if the inputs name them instead of files
+	grb::utils::GraphGenerator generatorL, generatorR;
+	const bool generatedL = generatorL.parse( data_in.filenameL );
+	const bool generatedR = generatorR.parse( data_in.filenameR );
 
-	grb::utils::MatrixFileReader< double,
+	// otherwise, create local parsers
+	typedef grb::utils::MatrixFileReader< double,
 		std::conditional< (sizeof(grb::config::RowIndexType) >
 				sizeof(grb::config::ColIndexType)),
 			grb::config::RowIndexType,
 			grb::config::ColIndexType
 		>::type
-	> parserR( data_in.filenameR, data_in.direct );
-
-	assert( parserL.n() == parserR.m() );
+	> Parser;
+	std::unique_ptr< Parser > parserL, parserR;
+	if( !generatedL ) {
+		parserL.reset( new Parser( data_in.filenameL, data_in.direct ) );
+	}
+	if( !generatedR ) {
+		parserR.reset( new Parser( data_in.filenameR, data_in.direct ) );
+	}
 
-	const size_t l = parserL.m();
-	const size_t m = parserL.n();
-	const size_t n = parserR.n();
+	const size_t l = generatedL ? generatorL.size() : parserL->m();
+	const size_t m = generatedL ? generatorL.size() : parserL->n();
+	const size_t n = generatedR ? generatorR.size() : parserR->n();
+	if( m != ( generatedR ? generatorR.size() : parserR->m() ) ) {
+		std::cerr << "Failure: the inner dimensions of the left- and right-hand "
+			<< "matrices do not match." << std::endl;
+		out.error_code = ILLEGAL;
+		return;
+	}
 
 	out.times.io = timer.time();
 	timer.reset();
@@ -101,11 +112,13 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 	// load into GraphBLAS
 	Matrix< double > A( l, m ), B( m, n );
 	{
-		RC rc = buildMatrixUnique(
-			A,
-			parserL.begin( SEQUENTIAL ), parserL.end( SEQUENTIAL ),
-			SEQUENTIAL
-		);
+		RC rc = generatedL
+			? generatorL.generate( A )
+			: buildMatrixUnique(
+				A,
+				parserL->begin( SEQUENTIAL ), parserL->end( SEQUENTIAL ),
+				SEQUENTIAL
+			);
 		/* Once internal issue #342 is resolved this can be re-enabled
 		const RC rc = buildMatrixUnique( A,
 			parser.begin( PARALLEL ), parser.end( PARALLEL),
@@ -118,11 +131,13 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 			return;
 		}
 
-		rc = buildMatrixUnique(
-			B,
-			parserR.begin( SEQUENTIAL ), parserR.end( SEQUENTIAL ),
-			SEQUENTIAL
-		);
+		rc = generatedR
+			? generatorR.generate( B )
+			: buildMatrixUnique(
+				B,
+				parserR->begin( SEQUENTIAL ), parserR->end( SEQUENTIAL ),
+				SEQUENTIAL
+			);
 
 		if( rc != SUCCESS ) {
 			std::cerr << "Failure: call to buildMatrixUnique did not succeed for the "
@@ -136,8 +151,8 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 	try {
 		const size_t global_nnzL = nnz( A );
 		const size_t global_nnzR = nnz( B );
-		const size_t parser_nnzL = parserL.nz();
-		const size_t parser_nnzR = parserR.nz();
+		const size_t parser_nnzL = generatedL ? global_nnzL : parserL->nz();
+		const size_t parser_nnzR = generatedR ? global_nnzR : parserR->nz();
 		if( global_nnzL != parser_nnzL ) {
 			std::cerr << "Left matrix Failure: global nnz (" << global_nnzL << ") "
 				<< "does not equal parser nnz (" << parser_nnzL << ")." << std::endl;
@@ -285,6 +300,9 @@ int main( int argc, char ** argv ) {
 		std::cout << "<datasetL>, <datasetR>, and <direct/indirect> are mandatory arguments.\n";
 		std::cout << "<datasetL> is the left matrix of the multiplication and "
 			<< "<datasetR> is the right matrix \n";
+		std::cout << "Either dataset may also be a generator, one of "
+			<< "rmat:scale[:edgefactor[:seed]], er:n[:degree[:seed]], "
+			<< "stencil2d:nx[:ny], or stencil3d:nx[:ny:nz].\n";
 		std::cout << "(inner iterations) is optional, the default is "
 			<< grb::config::BENCHMARKING::inner() << ". "
 			<< "If set to zero, the program will select a number of iterations "
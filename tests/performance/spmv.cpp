@@ -20,6 +20,7 @@
  * @date May, 2022
  */
 
+#include <memory>
 #include <exception>
 #include <iostream>
 #include <vector>
@@ -31,6 +32,8 @@
 
 #include <graphblas.hpp>
 
+#include <utils/graph_generators.hpp>
+
 
 using namespace grb;
 
@@ -66,31 +69,48 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 	// assume successful run
 	out.error_code = 0;
 
-	// create local parser
-	grb::utils::MatrixFileReader< double,
+	// select a generator, if the input names one instead of a file
+	grb::utils::GraphGenerator generator;
+	const bool generated = generator.parse( data_in.filename );
+	size_t m = generator.size();
+	size_t n = generator.size();
+
+	// otherwise, create local parser
+	typedef grb::utils::MatrixFileReader< double,
 		std::conditional< (sizeof( grb::config::RowIndexType) >
 				sizeof(grb::config::ColIndexType )),
 			grb::config::RowIndexType,
 			grb::config::ColIndexType
 		>::type
-	> parser( data_in.filename, data_in.direct );
-	const size_t m = parser.m();
-	const size_t n = parser.n();
+	> Parser;
+	std::unique_ptr< Parser > parser;
+	if( !generated ) {
+		parser.reset( new Parser( data_in.filename, data_in.direct ) );
+		m = parser->m();
+		n = parser->n();
+	}
 
 	out.times.io = timer.time();
 	timer.reset();
 
 	// load into GraphBLAS
 	Matrix< double > A( m, n );
-	{
+	if( generated ) {
+		const RC rc = generator.generate( A );
+		if( rc != SUCCESS ) {
+			std::cerr << "Failure: call to generate did not succeed "
+				<< "(" << toString( rc ) << ")." << std::endl;
+			return;
+		}
+	} else {
 		const RC rc = buildMatrixUnique(
 			A,
-			parser.begin( SEQUENTIAL ), parser.end( SEQUENTIAL ),
+			parser->begin( SEQUENTIAL ), parser->end( SEQUENTIAL ),
 			SEQUENTIAL
 		);
 		/* Once internal issue #342 is resolved this can be re-enabled
 		const RC rc = buildMatrixUnique( A,
-			parser.begin( PARALLEL ), parser.end( PARALLEL),
+			parser->begin( PARALLEL ), parser->end( PARALLEL),
 			PARALLEL
 		);*/
 		if( rc != SUCCESS ) {
@@ -101,18 +121,25 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 	}
 
 	// check number of nonzeroes
-	try {
-		const size_t global_nnz = nnz( A );
-		const size_t parser_nnz = parser.nz();
-		if( global_nnz != parser_nnz ) {
-			std::cerr << "Failure: global nnz (" << global_nnz << ") does not equal "
-				<< "parser nnz (" << parser_nnz << ")." << std::endl;
-			return;
+	if( generated ) {
+		if( s == 0 ) {
+			std::cout << "Info: generated a matrix of size " << m << " with "
+				<< nnz( A ) << " nonzeroes.\n";
+		}
+	} else {
+		try {
+			const size_t global_nnz = nnz( A );
+			const size_t parser_nnz = parser->nz();
+			if( global_nnz != parser_nnz ) {
+				std::cerr << "Failure: global nnz (" << global_nnz << ") does not equal "
+					<< "parser nnz (" << parser_nnz << ")." << std::endl;
+				return;
+			}
+		} catch( const std::runtime_error & ) {
+			std::cout << "Info: nonzero check skipped as the number of nonzeroes "
+				<< "cannot be derived from the matrix file header. The "
+				<< "grb::Matrix reports " << nnz( A ) << " nonzeroes.\n";
 		}
-	} catch( const std::runtime_error & ) {
-		std::cout << "Info: nonzero check skipped as the number of nonzeroes "
-			<< "cannot be derived from the matrix file header. The "
-			<< "grb::Matrix reports " << nnz( A ) << " nonzeroes.\n";
 	}
 
 	RC rc = SUCCESS;
@@ -226,6 +253,9 @@ int main( int argc, char ** argv ) {
 		std::cout << "Usage: " << argv[ 0 ] << " <dataset> <direct/indirect> "
 			<< "(inner iterations) (outer iterations) (verification <truth-file>)\n";
 		std::cout << "<dataset> and <direct/indirect> are mandatory arguments.\n";
+		std::cout << "<dataset> is either a matrix file or a generator, one of "
+			<< "rmat:scale[:edgefactor[:seed]], er:n[:degree[:seed]], "
+			<< "stencil2d:nx[:ny], or stencil3d:nx[:ny:nz].\n";
 		std::cout << "(inner iterations) is optional, the default is "
 			<< grb::config::BENCHMARKING::inner() << ". "
 			<< "If set to zero, the program will select a number of iterations "
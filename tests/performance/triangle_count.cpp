@@ -0,0 +1,325 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Benchmarks triangle counting, and reports the throughput in input edges
+ * (nonzeroes) per second.
+ */
+
+#include <memory>
+#include <exception>
+#include <iostream>
+#include <vector>
+
+#include <inttypes.h>
+
+#include <graphblas/utils/Timer.hpp>
+#include <graphblas/utils/parser.hpp>
+#include <graphblas/algorithms/triangle_count.hpp>
+
+#include <graphblas.hpp>
+
+#include <utils/graph_generators.hpp>
+
+
+using namespace grb;
+
+struct input {
+	char filename[ 1024 ];
+	bool direct;
+	size_t rep;
+};
+
+struct output {
+	int error_code;
+	size_t rep;
+	grb::utils::TimerResults times;
+	size_t triangles;
+	size_t edges;
+};
+
+void grbProgram( const struct input &data_in, struct output &out ) {
+	// get user process ID
+	const size_t s = spmd<>::pid();
+	assert( s < spmd<>::nprocs() );
+
+	// get input n
+	grb::utils::Timer timer;
+	timer.reset();
+
+	// sanity checks on input
+	if( data_in.filename[ 0 ] == '\0' ) {
+		std::cerr << s << ": no file name given as input." << std::endl;
+		out.error_code = ILLEGAL;
+		return;
+	}
+
+	// assume successful run
+	out.error_code = 0;
+
+	// select a generator, if the input names one instead of a file
+	grb::utils::GraphGenerator generator;
+	const bool generated = generator.parse( data_in.filename );
+	size_t n = generator.size();
+
+	// otherwise, create local parser
+	typedef grb::utils::MatrixFileReader< double,
+		std::conditional< (sizeof( grb::config::RowIndexType) >
+				sizeof(grb::config::ColIndexType )),
+			grb::config::RowIndexType,
+			grb::config::ColIndexType
+		>::type
+	> Parser;
+	std::unique_ptr< Parser > parser;
+	if( !generated ) {
+		parser.reset( new Parser( data_in.filename, data_in.direct ) );
+		if( parser->m() != parser->n() ) {
+			std::cerr << "Failure: the input matrix is not square." << std::endl;
+			out.error_code = 5;
+			return;
+		}
+		n = parser->n();
+	}
+
+	out.times.io = timer.time();
+	timer.reset();
+
+	// load into GraphBLAS
+	Matrix< double > A( n, n );
+	if( generated ) {
+		const RC rc = generator.generate( A );
+		if( rc != SUCCESS ) {
+			std::cerr << "Failure: call to generate did not succeed "
+				<< "(" << toString( rc ) << ")." << std::endl;
+			out.error_code = 10;
+			return;
+		}
+	} else {
+		const RC rc = buildMatrixUnique(
+			A,
+			parser->begin( SEQUENTIAL ), parser->end( SEQUENTIAL ),
+			SEQUENTIAL
+		);
+		if( rc != SUCCESS ) {
+			std::cerr << "Failure: call to buildMatrixUnique did not succeed "
+				<< "(" << toString( rc ) << ")." << std::endl;
+			out.error_code = 10;
+			return;
+		}
+	}
+	out.edges = nnz( A );
+	if( s == 0 ) {
+		std::cout << "Info: input graph has " << n << " vertices and "
+			<< out.edges << " nonzeroes.\n";
+	}
+
+	RC rc = SUCCESS;
+
+	// by default, copy input requested repetitions to output repititions performed
+	out.rep = data_in.rep;
+
+	// time a single call
+	{
+		grb::utils::Timer subtimer;
+		subtimer.reset();
+
+		rc = grb::algorithms::triangle_count( out.triangles, A );
+
+		double single_time = subtimer.time();
+		if( rc != SUCCESS ) {
+			std::cerr << "Failure: call to triangle_count did not succeed ("
+				<< toString( rc ) << ")." << std::endl;
+			out.error_code = 20;
+		}
+		if( rc == SUCCESS ) {
+			rc = collectives<>::reduce( single_time, 0, operators::max< double >() );
+		}
+		if( rc != SUCCESS ) {
+			out.error_code = 25;
+		}
+		out.times.useful = single_time;
+		const size_t recommended_inner_repetitions =
+			static_cast< size_t >( 100.0 / single_time ) + 1;
+		if( rc == SUCCESS && out.rep == 0 ) {
+			if( s == 0 ) {
+				std::cout << "Info: cold triangle count completed"
+					<< ". Time taken was " << single_time << " ms. "
+					<< "Deduced inner repetitions parameter of " << out.rep << " "
+					<< "to take 100 ms. or more per inner benchmark.\n";
+				out.rep = recommended_inner_repetitions;
+			}
+			return;
+		}
+	}
+
+	// that was the preamble
+	out.times.preamble = timer.time();
+
+	// now do benchmark
+	double time_taken;
+	timer.reset();
+	for( size_t i = 0; i < out.rep && rc == SUCCESS; ++i ) {
+		rc = grb::algorithms::triangle_count( out.triangles, A );
+	}
+	time_taken = timer.time();
+	if( rc == SUCCESS ) {
+		out.times.useful = time_taken / static_cast< double >( out.rep );
+	}
+	// print timing at root process
+	if( grb::spmd<>::pid() == 0 ) {
+		std::cout << "Time taken for a " << out.rep << " "
+			<< "triangle_count calls (hot start): " << out.times.useful << ". "
+			<< "Error code is " << out.error_code << std::endl;
+	}
+
+	// start postamble
+	timer.reset();
+
+	// set error code
+	if( rc != SUCCESS ) {
+		std::cerr << "Benchmark run returned error: " << toString( rc ) << "\n";
+		out.error_code = 35;
+		return;
+	}
+
+	// finish timing
+	time_taken = timer.time();
+	out.times.postamble = time_taken;
+
+	// done
+	return;
+}
+
+int main( int argc, char ** argv ) {
+	// sanity check
+	if( argc < 3 || argc > 5 ) {
+		std::cout << "Usage: " << argv[ 0 ] << " <dataset> <direct/indirect> "
+			<< "(inner iterations) (outer iterations)\n";
+		std::cout << "<dataset> and <direct/indirect> are mandatory arguments.\n";
+		std::cout << "<dataset> is either a matrix file or a generator, one of "
+			<< "rmat:scale[:edgefactor[:seed]], er:n[:degree[:seed]], "
+			<< "stencil2d:nx[:ny], or stencil3d:nx[:ny:nz]. Every nonzero of the "
+			<< "input is taken as an undirected edge.\n";
+		std::cout << "(inner iterations) is optional, the default is "
+			<< grb::config::BENCHMARKING::inner() << ". "
+			<< "If set to zero, the program will select a number of iterations "
+			<< "approximately required to take at least one second to complete.\n";
+		std::cout << "(outer iterations) is optional, the default is "
+			<< grb::config::BENCHMARKING::outer() << ". "
+			<< "This value must be strictly larger than 0." << std::endl;
+		return 0;
+	}
+	std::cout << "Test executable: " << argv[ 0 ] << std::endl;
+#ifndef NDEBUG
+	std::cerr << "Warning: this benchmark utility was **not** compiled with the "
+		<< "NDEBUG macro defined(!)\n";
+#endif
+
+	// the input struct
+	struct input in;
+
+	// get file name
+	(void) strncpy( in.filename, argv[ 1 ], 1023 );
+	in.filename[ 1023 ] = '\0';
+
+	// get direct or indirect addressing
+	if( strncmp( argv[ 2 ], "direct", 6 ) == 0 ) {
+		in.direct = true;
+	} else {
+		in.direct = false;
+	}
+
+	// get inner number of iterations
+	in.rep = grb::config::BENCHMARKING::inner();
+	char * end = nullptr;
+	if( argc >= 4 ) {
+		in.rep = strtoumax( argv[ 3 ], &end, 10 );
+		if( argv[ 3 ] == end ) {
+			std::cerr << "Could not parse argument " << argv[ 3 ] << " "
+				<< "for number of inner experiment repititions." << std::endl;
+			return 2;
+		}
+	}
+
+	// get outer number of iterations
+	size_t outer = grb::config::BENCHMARKING::outer();
+	if( argc >= 5 ) {
+		outer = strtoumax( argv[ 4 ], &end, 10 );
+		if( argv[ 4 ] == end ) {
+			std::cerr << "Could not parse argument " << argv[ 4 ] << " "
+				<< "for number of outer experiment repititions." << std::endl;
+			return 4;
+		}
+	}
+
+	std::cout << "Executable called with parameters " << in.filename << ", "
+		<< "inner repititions = " << in.rep << ", and outer reptitions = " << outer
+		<< std::endl;
+
+	// the output struct
+	struct output out;
+
+	// set standard exit code
+	grb::RC rc = SUCCESS;
+
+	// launch estimator (if requested)
+	if( in.rep == 0 ) {
+		grb::Launcher< AUTOMATIC > launcher;
+		rc = launcher.exec( &grbProgram, in, out, true );
+		if( rc == SUCCESS ) {
+			in.rep = out.rep;
+		}
+		if( rc != SUCCESS ) {
+			std::cerr << "launcher.exec returns with non-SUCCESS error code "
+				<< (int)rc << std::endl;
+			return 6;
+		}
+	}
+
+	// launch benchmark
+	if( rc == SUCCESS ) {
+		grb::Benchmarker< AUTOMATIC > benchmarker;
+		rc = benchmarker.exec( &grbProgram, in, out, 1, outer, true );
+	}
+	if( rc != SUCCESS ) {
+		std::cerr << "benchmarker.exec returns with non-SUCCESS error code "
+			<< grb::toString( rc ) << std::endl;
+		return 8;
+	}
+
+	std::cout << "Error code is " << out.error_code << ".\n";
+	if( out.error_code == 0 ) {
+		std::cout << "Number of triangles: " << out.triangles << "\n";
+		if( out.times.useful > 0 ) {
+			std::cout << "Edges per second: "
+				<< static_cast< double >( out.edges ) / out.times.useful * 1e3
+				<< "\n";
+		}
+	}
+
+	if( out.error_code != 0 ) {
+		std::cerr << std::flush;
+		std::cerr << "Test FAILED\n";
+	} else {
+		std::cout << "Test OK\n";
+	}
+	std::cout << std::endl;
+
+	// done
+	return out.error_code;
+}
+
@@ -0,0 +1,298 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests top-k all-pairs cosine similarity on random query and corpus matrices,
+ * also when given as transposed matrices, and on a pattern matrix against
+ * itself, verified by brute force.
+ */
+
+#include <cmath>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+
+#include <graphblas/algorithms/cosine_similarity.hpp>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+using namespace grb::algorithms;
+
+typedef Semiring<
+	operators::add< double >, operators::mul< double >,
+	identities::zero, identities::one
+> Ring;
+
+/** A simple deterministic pseudo-random number in [0, 1). */
+static double next( size_t &state ) {
+	state = (state * 1103515245 + 12345) % 2147483648UL;
+	return static_cast< double >( state ) / 2147483648.0;
+}
+
+/** A dense row-major matrix with \a m rows, for verification. */
+typedef std::vector< std::vector< double > > Dense;
+
+/** Generates a random sparse matrix, stored both densely and as triples. */
+static Dense generate(
+	const size_t m, const size_t f, const double density, size_t &state,
+	std::vector< size_t > &I, std::vector< size_t > &J, std::vector< double > &V,
+	const bool binary
+) {
+	Dense dense( m, std::vector< double >( f, 0.0 ) );
+	for( size_t i = 0; i < m; ++i ) {
+		for( size_t j = 0; j < f; ++j ) {
+			if( next( state ) < density ) {
+				dense[ i ][ j ] = binary ? 1.0 : 0.1 + next( state );
+				I.push_back( i ); J.push_back( j ); V.push_back( dense[ i ][ j ] );
+			}
+		}
+	}
+	return dense;
+}
+
+/** Computes the expected top-k similarities of every row of \a Q. */
+static std::vector< std::vector< std::pair< double, size_t > > > expected(
+	const Dense &Q, const Dense &C, const size_t k
+) {
+	std::vector< std::vector< std::pair< double, size_t > > > result( Q.size() );
+	for( size_t i = 0; i < Q.size(); ++i ) {
+		double qq = 0.0;
+		for( const double &q : Q[ i ] ) {
+			qq += q * q;
+		}
+		for( size_t j = 0; j < C.size(); ++j ) {
+			double qc = 0.0, cc = 0.0;
+			for( size_t f = 0; f < C[ j ].size(); ++f ) {
+				qc += Q[ i ][ f ] * C[ j ][ f ];
+				cc += C[ j ][ f ] * C[ j ][ f ];
+			}
+			if( qc != 0.0 ) {
+				result[ i ].push_back( std::make_pair(
+					qc / (std::sqrt( qq ) * std::sqrt( cc )), j ) );
+			}
+		}
+		std::sort( result[ i ].begin(), result[ i ].end(),
+			[]( const std::pair< double, size_t > &a,
+				const std::pair< double, size_t > &b
+			) {
+				return a.first > b.first || (a.first == b.first && a.second < b.second);
+			}
+		);
+		if( result[ i ].size() > k ) {
+			result[ i ].resize( k );
+		}
+	}
+	return result;
+}
+
+/** Compares the output \a S against the expected similarities. */
+static int check(
+	const char * const name,
+	const Matrix< double > &S,
+	const std::vector< std::vector< std::pair< double, size_t > > > &expect
+) {
+	std::vector< std::vector< std::pair< double, size_t > > > rows( expect.size() );
+	for( const auto &triple : S ) {
+		rows[ triple.first.first ].push_back( std::make_pair( triple.second,
+			triple.first.second ) );
+	}
+	for( size_t i = 0; i < expect.size(); ++i ) {
+		if( rows[ i ].size() != expect[ i ].size() ) {
+			std::cerr << "\t " << name << ": row " << i << " has " << rows[ i ].size()
+				<< " entries, expected " << expect[ i ].size() << "\n";
+			return 1;
+		}
+		std::sort( rows[ i ].begin(), rows[ i ].end(),
+			[]( const std::pair< double, size_t > &a,
+				const std::pair< double, size_t > &b
+			) {
+				return a.second < b.second;
+			}
+		);
+		for( const auto &pair : expect[ i ] ) {
+			const auto it = std::lower_bound( rows[ i ].begin(), rows[ i ].end(),
+				pair,
+				[]( const std::pair< double, size_t > &a,
+					const std::pair< double, size_t > &b
+				) {
+					return a.second < b.second;
+				}
+			);
+			if( it == rows[ i ].end() || it->second != pair.second ) {
+				std::cerr << "\t " << name << ": row " << i << " lacks column "
+					<< pair.second << "\n";
+				return 2;
+			}
+			if( std::fabs( it->first - pair.first ) > 1e-12 ) {
+				std::cerr << "\t " << name << ": entry ( " << i << ", " << pair.second
+					<< " ) is " << it->first << ", expected " << pair.first << "\n";
+				return 3;
+			}
+		}
+	}
+	return 0;
+}
+
+void grbProgram( const void *, const size_t in_size, int &error ) {
+	error = 0;
+	if( in_size != 0 ) {
+		std::cerr << "Unit tests called with unexpected input\n";
+		error = 1;
+		return;
+	}
+	size_t state = 29;
+
+	// random queries against a random corpus, for several k
+	{
+		const size_t nq = 120, nc = 200, f = 40;
+		std::vector< size_t > I, J;
+		std::vector< double > V;
+		const Dense denseQ = generate( nq, f, 0.1, state, I, J, V, false );
+		Matrix< double > Q( nq, f ), C( nc, f ), S( nq, nc );
+		Matrix< double > QT( f, nq ), CT( f, nc );
+		RC rc = buildMatrixUnique( Q, I.data(), J.data(), V.data(), V.size(),
+			SEQUENTIAL );
+		rc = rc ? rc : buildMatrixUnique( QT, J.data(), I.data(), V.data(),
+			V.size(), SEQUENTIAL );
+		I.clear(); J.clear(); V.clear();
+		const Dense denseC = generate( nc, f, 0.1, state, I, J, V, false );
+		rc = rc ? rc : buildMatrixUnique( C, I.data(), J.data(), V.data(),
+			V.size(), SEQUENTIAL );
+		rc = rc ? rc : buildMatrixUnique( CT, J.data(), I.data(), V.data(),
+			V.size(), SEQUENTIAL );
+		if( rc != SUCCESS ) {
+			std::cerr << "\t initialisation FAILED\n";
+			error = 5;
+			return;
+		}
+		for( const size_t k : { 1, 5, 1000 } ) {
+			rc = all_pairs_cosine_similarity( S, Q, C, k, Ring() );
+			if( rc != SUCCESS ) {
+				std::cerr << "\t random matrices, k = " << k << ": "
+					<< "all_pairs_cosine_similarity returns " << toString( rc ) << "\n";
+				error = 10;
+				return;
+			}
+			error = check( "random matrices", S, expected( denseQ, denseC, k ) );
+			if( error ) {
+				error += 10;
+				return;
+			}
+		}
+
+		// the same matrices, with their feature vectors as columns
+		rc = all_pairs_cosine_similarity< descriptors::transpose_matrix >( S, QT,
+			CT, 5, Ring() );
+		if( rc != SUCCESS ) {
+			std::cerr << "\t transposed matrices: all_pairs_cosine_similarity "
+				<< "returns " << toString( rc ) << "\n";
+			error = 15;
+			return;
+		}
+		error = check( "transposed matrices", S, expected( denseQ, denseC, 5 ) );
+		if( error ) {
+			error += 15;
+			return;
+		}
+
+		// illegal and mismatching arguments
+		Matrix< double > wrong( nq, nc + 1 ), features( nc, f + 1 );
+		rc = all_pairs_cosine_similarity( S, Q, C, 0, Ring() );
+		if( rc != ILLEGAL ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected ILLEGAL\n";
+			error = 20;
+			return;
+		}
+		rc = all_pairs_cosine_similarity( wrong, Q, C, 1, Ring() );
+		if( rc != MISMATCH ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected MISMATCH\n";
+			error = 21;
+			return;
+		}
+		rc = all_pairs_cosine_similarity( S, Q, features, 1, Ring() );
+		if( rc != MISMATCH ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected MISMATCH\n";
+			error = 22;
+			return;
+		}
+		rc = all_pairs_cosine_similarity< descriptors::transpose_matrix >( S, Q,
+			C, 1, Ring() );
+		if( rc != MISMATCH ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected MISMATCH\n";
+			error = 23;
+			return;
+		}
+	}
+
+	// all pairs of a binary feature matrix, which has many tied similarities
+	{
+		const size_t n = 150, f = 30;
+		std::vector< size_t > I, J;
+		std::vector< double > V;
+		const Dense dense = generate( n, f, 0.15, state, I, J, V, true );
+		Matrix< void > A( n, f );
+		Matrix< double > S( n, n );
+		RC rc = buildMatrixUnique( A, I.data(), J.data(), I.size(), SEQUENTIAL );
+		if( rc != SUCCESS ) {
+			std::cerr << "\t initialisation FAILED\n";
+			error = 30;
+			return;
+		}
+		rc = all_pairs_cosine_similarity( S, A, A, 4, Ring() );
+		if( rc != SUCCESS ) {
+			std::cerr << "\t binary matrix: all_pairs_cosine_similarity returns "
+				<< toString( rc ) << "\n";
+			error = 31;
+			return;
+		}
+		error = check( "binary matrix", S, expected( dense, dense, 4 ) );
+		if( error ) {
+			error += 40;
+			return;
+		}
+	}
+}
+
+int main( int argc, char ** argv ) {
+	(void)argc;
+	std::cout << "Functional test executable: " << argv[ 0 ] << "\n";
+
+	int error;
+	grb::Launcher< AUTOMATIC > launcher;
+	if( launcher.exec( &grbProgram, nullptr, 0, error ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	return error;
+}
+
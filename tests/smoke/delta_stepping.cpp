@@ -0,0 +1,270 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests delta-stepping single-source shortest paths on a weighted grid and on
+ * a random directed graph, for a range of bucket widths, against the
+ * distances computed by Dijkstra's algorithm.
+ */
+
+#include <queue>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <functional>
+
+#include <graphblas/algorithms/delta_stepping.hpp>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+using namespace grb::algorithms;
+
+/** A simple deterministic pseudo-random number in [0, 1). */
+static double next( size_t &state ) {
+	state = (state * 1103515245 + 12345) % 2147483648UL;
+	return static_cast< double >( state ) / 2147483648.0;
+}
+
+/** Computes the distances from \a source using Dijkstra's algorithm. */
+template< typename IOType >
+static std::vector< IOType > dijkstra(
+	const size_t n,
+	const std::vector< size_t > &I,
+	const std::vector< size_t > &J,
+	const std::vector< IOType > &V,
+	const size_t source
+) {
+	std::vector< std::vector< std::pair< size_t, IOType > > > out( n );
+	for( size_t k = 0; k < V.size(); ++k ) {
+		out[ I[ k ] ].push_back( std::make_pair( J[ k ], V[ k ] ) );
+	}
+	std::vector< IOType > distances( n,
+		grb::identities::infinity< IOType >::value() );
+	typedef std::pair< IOType, size_t > Entry;
+	std::priority_queue< Entry, std::vector< Entry >, std::greater< Entry > >
+		queue;
+	distances[ source ] = 0;
+	queue.push( std::make_pair( static_cast< IOType >( 0 ), source ) );
+	while( !queue.empty() ) {
+		const Entry top = queue.top();
+		queue.pop();
+		if( top.first > distances[ top.second ] ) {
+			continue;
+		}
+		for( const auto &edge : out[ top.second ] ) {
+			if( top.first + edge.second < distances[ edge.first ] ) {
+				distances[ edge.first ] = top.first + edge.second;
+				queue.push( std::make_pair( distances[ edge.first ], edge.first ) );
+			}
+		}
+	}
+	return distances;
+}
+
+/** Runs delta-stepping on the given graph and compares against Dijkstra. */
+template< typename IOType >
+static int check(
+	const char * const name,
+	const size_t n,
+	const std::vector< size_t > &I,
+	const std::vector< size_t > &J,
+	const std::vector< IOType > &V,
+	const size_t source,
+	const std::vector< IOType > &deltas
+) {
+	Matrix< IOType > A( n, n ), light( n, n ), heavy( n, n );
+	RC rc = buildMatrixUnique( A, I.data(), J.data(), V.data(), V.size(),
+		SEQUENTIAL );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t " << name << ": initialisation FAILED\n";
+		return 1;
+	}
+	const std::vector< IOType > expected = dijkstra( n, I, J, V, source );
+
+	Vector< IOType > distances( n ), pending( n ), frontier( n ), request( n );
+	Vector< bool > settled( n ), selection( n );
+	for( const IOType &delta : deltas ) {
+		rc = delta_stepping( distances, A, source, delta, light, heavy,
+			pending, frontier, request, settled, selection );
+		if( rc != SUCCESS ) {
+			std::cerr << "\t " << name << ", delta " << delta << ": delta_stepping "
+				<< "returns " << toString( rc ) << "\n";
+			return 2;
+		}
+		if( nnz( distances ) != n ) {
+			std::cerr << "\t " << name << ", delta " << delta << ": distances are "
+				<< "not dense\n";
+			return 3;
+		}
+		for( const auto &pair : distances ) {
+			const IOType expect = expected[ pair.first ];
+			const bool match = std::numeric_limits< IOType >::is_integer ||
+					expect == grb::identities::infinity< IOType >::value()
+				? pair.second == expect
+				: std::fabs( pair.second - expect ) <= 1e-9 * expect;
+			if( !match ) {
+				std::cerr << "\t " << name << ", delta " << delta << ": vertex "
+					<< pair.first << " has distance " << pair.second << ", expected "
+					<< expect << "\n";
+				return 4;
+			}
+		}
+	}
+	return 0;
+}
+
+void grbProgram( const void *, const size_t in_size, int &error ) {
+	error = 0;
+	if( in_size != 0 ) {
+		std::cerr << "Unit tests called with unexpected input\n";
+		error = 1;
+		return;
+	}
+
+	// a 20-by-20 undirected grid with integer weights, so that many paths have
+	// equal length
+	{
+		const size_t side = 20;
+		const size_t n = side * side;
+		size_t state = 7;
+		std::vector< size_t > I, J;
+		std::vector< size_t > V;
+		for( size_t i = 0; i < side; ++i ) {
+			for( size_t j = 0; j < side; ++j ) {
+				const size_t v = i * side + j;
+				if( j + 1 < side ) {
+					const size_t w = 1 + static_cast< size_t >( 4 * next( state ) );
+					I.push_back( v ); J.push_back( v + 1 ); V.push_back( w );
+					I.push_back( v + 1 ); J.push_back( v ); V.push_back( w );
+				}
+				if( i + 1 < side ) {
+					const size_t w = 1 + static_cast< size_t >( 4 * next( state ) );
+					I.push_back( v ); J.push_back( v + side ); V.push_back( w );
+					I.push_back( v + side ); J.push_back( v ); V.push_back( w );
+				}
+			}
+		}
+		error = check< size_t >( "grid", n, I, J, V, 0, { 1, 2, 3, 8, 1000 } );
+		if( error ) {
+			error += 10;
+			return;
+		}
+	}
+
+	// a random directed graph with real weights and zero-weight edges, of which
+	// not all vertices are reachable from the source
+	{
+		const size_t n = 300;
+		size_t state = 17;
+		std::vector< size_t > I, J;
+		std::vector< double > V;
+		for( size_t i = 0; i < n; ++i ) {
+			for( size_t j = 0; j < n; ++j ) {
+				if( i != j && j % 50 != 49 && next( state ) < 0.02 ) {
+					const double r = next( state );
+					I.push_back( i ); J.push_back( j );
+					V.push_back( r < 0.05 ? 0.0 : 10.0 * r );
+				}
+			}
+		}
+		error = check< double >( "random graph", n, I, J, V, 3,
+			{ 0.1, 0.5, 2.5, 1e6 } );
+		if( error ) {
+			error += 20;
+			return;
+		}
+
+		// illegal and mismatching arguments
+		Matrix< double > A( n, n ), light( n, n ), heavy( n, n );
+		Matrix< double > rectangular( n, n + 1 );
+		Vector< double > distances( n ), pending( n ), frontier( n ), request( n );
+		Vector< double > wrong( n + 1 );
+		Vector< bool > settled( n ), selection( n );
+		RC rc = delta_stepping( distances, rectangular, 0, 1.0, light, heavy,
+			pending, frontier, request, settled, selection );
+		if( rc != ILLEGAL ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected ILLEGAL\n";
+			error = 30;
+			return;
+		}
+		rc = delta_stepping( wrong, A, 0, 1.0, light, heavy,
+			pending, frontier, request, settled, selection );
+		if( rc != MISMATCH ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected MISMATCH\n";
+			error = 31;
+			return;
+		}
+		rc = delta_stepping( distances, A, n, 1.0, light, heavy,
+			pending, frontier, request, settled, selection );
+		if( rc != ILLEGAL ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected ILLEGAL\n";
+			error = 32;
+			return;
+		}
+		rc = delta_stepping( distances, A, 0, 0.0, light, heavy,
+			pending, frontier, request, settled, selection );
+		if( rc != ILLEGAL ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected ILLEGAL\n";
+			error = 33;
+			return;
+		}
+
+		// a negative edge weight
+		const size_t i = 0, j = 1;
+		const double w = -1.0;
+		rc = buildMatrixUnique( A, &i, &j, &w, 1, SEQUENTIAL );
+		rc = rc ? rc : delta_stepping( distances, A, 0, 1.0, light, heavy,
+			pending, frontier, request, settled, selection );
+		if( rc != ILLEGAL ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected ILLEGAL\n";
+			error = 34;
+			return;
+		}
+	}
+}
+
+int main( int argc, char ** argv ) {
+	(void)argc;
+	std::cout << "Functional test executable: " << argv[ 0 ] << "\n";
+
+	int error;
+	grb::Launcher< AUTOMATIC > launcher;
+	if( launcher.exec( &grbProgram, nullptr, 0, error ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	return error;
+}
+
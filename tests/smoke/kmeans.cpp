@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include <cmath>
+#include <vector>
 #include <iostream>
 #include <utility>
 
@@ -34,6 +36,110 @@ static const size_t I_X[ 34 ] = { 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1
 static const size_t J_X[ 34 ] = { 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16, 16 };
 static const double V_X[ 34 ] = { -2, 8, -1, 8, 0, 8, -1, 9, 0, 9, 0, 10, 6, 5, 7, 5, 8, 5, 6, 4, 7, 4, 0, 3, -1, 3, 0, 2, -1, 2, 0, 0, -2, 0 };
 
+// the initial centroids are points 0, 6, and 15
+static const size_t I_K[ 6 ] = { 0, 0, 1, 1, 2, 2 };
+static const size_t J_K[ 6 ] = { 0, 1, 0, 1, 0, 1 };
+static const double V_K[ 6 ] = { -2, 8, 6, 5, 0, 0 };
+
+// the expected cluster of every point
+static const size_t expected_clusters[ 17 ] = { 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2 };
+
+/**
+ * Runs k-means from the fixed initial centroids on the points of \a X. Any
+ * points beyond the first 17 must be empty.
+ */
+static grb::RC cluster(
+	std::vector< std::pair< size_t, double > > &result,
+	const grb::Matrix< double > &X
+) {
+	const size_t n = grb::ncols( X );
+	grb::Matrix< double > K( 3, 2 );
+	grb::Vector< std::pair< size_t, double > > classes_and_centroids( n );
+	grb::RC ret = grb::buildMatrixUnique( K, I_K, J_K, V_K, 6, SEQUENTIAL );
+	ret = ret ? ret : grb::algorithms::kmeans_iteration( K,
+		classes_and_centroids, X );
+	if( ret != SUCCESS ) {
+		return ret;
+	}
+	result.assign( 17, std::make_pair( 3, 0.0 ) );
+	for( const auto &pair : classes_and_centroids ) {
+		if( pair.first >= 17 ) {
+			std::cerr << "\t empty point " << pair.first << " was clustered\n";
+			return FAILED;
+		}
+		result[ pair.first ] = pair.second;
+	}
+	for( size_t i = 0; i < 17; ++i ) {
+		if( result[ i ].first != expected_clusters[ i ] ) {
+			std::cerr << "\t point " << i << " is in cluster " << result[ i ].first
+				<< ", expected " << expected_clusters[ i ] << "\n";
+			return FAILED;
+		}
+	}
+	return SUCCESS;
+}
+
+/**
+ * Clusters points with many features, so that the dense fast path splits
+ * both the points and the centroids in several tiles, and compares the
+ * squared distances against those of the generic sparse path. All values are
+ * small integers, so that both paths compute exact distances.
+ */
+static grb::RC tiled() {
+	const size_t n = 37;
+	const size_t m = 512;
+	const size_t k = 11;
+
+	// the initial centroids are the first k points
+	std::vector< size_t > I, J, I_C, J_C;
+	std::vector< double > V, V_C;
+	for( size_t p = 0; p < n; ++p ) {
+		for( size_t f = 0; f < m; ++f ) {
+			I.push_back( f );
+			J.push_back( p );
+			V.push_back( static_cast< double >( (3 * p + 7 * f + p * f) % 11 ) );
+			if( p < k ) {
+				I_C.push_back( p );
+				J_C.push_back( f );
+				V_C.push_back( V.back() );
+			}
+		}
+	}
+
+	std::vector< double > distances[ 2 ];
+	for( size_t empty = 0; empty < 2; ++empty ) {
+		grb::Matrix< double > X( m, n + empty ), K( k, m );
+		grb::Vector< std::pair< size_t, double > > classes_and_centroids(
+			n + empty );
+		grb::RC ret = grb::buildMatrixUnique( X, I.data(), J.data(), V.data(),
+			V.size(), SEQUENTIAL );
+		ret = ret ? ret : grb::buildMatrixUnique( K, I_C.data(), J_C.data(),
+			V_C.data(), V_C.size(), SEQUENTIAL );
+		ret = ret ? ret : grb::algorithms::kmeans_iteration( K,
+			classes_and_centroids, X );
+		if( ret != SUCCESS ) {
+			return ret;
+		}
+		distances[ empty ].assign( n, -1.0 );
+		for( const auto &pair : classes_and_centroids ) {
+			if( pair.first >= n ) {
+				std::cerr << "\t empty point " << pair.first << " was clustered\n";
+				return FAILED;
+			}
+			distances[ empty ][ pair.first ] = pair.second.second;
+		}
+	}
+	for( size_t p = 0; p < n; ++p ) {
+		if( distances[ 0 ][ p ] != distances[ 1 ][ p ] ) {
+			std::cerr << "\t point " << p << " has squared distance "
+				<< distances[ 0 ][ p ] << " on the tiled dense path, and "
+				<< distances[ 1 ][ p ] << " on the sparse path\n";
+			return FAILED;
+		}
+	}
+	return SUCCESS;
+}
+
 // graphblas program
 void grbProgram( const void *, const size_t in_size, grb::RC &ret ) {
 	if( in_size != 0 ) {
@@ -63,6 +169,41 @@ void grbProgram( const void *, const size_t in_size, grb::RC &ret ) {
 		std::cout << "\tpoint " << pair.first << "\tcluster " << pair.second.first << "\tsquared distance " << pair.second.second << "\n";
 	}
 #endif
+
+	if( ret != SUCCESS ) {
+		return;
+	}
+
+	// with fixed initial centroids, the dense points take the dense fast path,
+	// while adding an empty point forces the generic sparse path; both must
+	// agree on the clustering
+	std::vector< std::pair< size_t, double > > dense, sparse;
+	ret = cluster( dense, X );
+	if( ret != SUCCESS ) {
+		std::cerr << "\t clustering dense points FAILED\n";
+		return;
+	}
+	grb::Matrix< double > Y( m, n + 1 );
+	ERR( ret, grb::buildMatrixUnique( Y, I_X, J_X, V_X, nelts_X, SEQUENTIAL ) );
+	ret = ret ? ret : cluster( sparse, Y );
+	if( ret != SUCCESS ) {
+		std::cerr << "\t clustering sparse points FAILED\n";
+		return;
+	}
+	for( size_t i = 0; i < n; ++i ) {
+		if( std::fabs( dense[ i ].second - sparse[ i ].second ) > 1e-12 ) {
+			std::cerr << "\t point " << i << " has squared distance "
+				<< dense[ i ].second << " on the dense path, and "
+				<< sparse[ i ].second << " on the sparse path\n";
+			ret = FAILED;
+			return;
+		}
+	}
+
+	ret = tiled();
+	if( ret != SUCCESS ) {
+		std::cerr << "\t clustering points with many features FAILED\n";
+	}
 }
 
 int main( int argc, char ** argv ) {
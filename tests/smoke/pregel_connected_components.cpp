@@ -27,6 +27,10 @@
 
 #include <graphblas.hpp>
 
+#ifndef PREGEL_MODE
+ #define PREGEL_MODE BULK_SYNCHRONOUS
+#endif
+
 
 using namespace grb;
 using namespace algorithms;
@@ -98,7 +102,7 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 	if( out.rep == 0 ) {
 		timer.reset();
 	        rc = grb::algorithms::pregel::ConnectedComponents< size_t >::execute(
-			pregel, cc, pregel.num_vertices() );
+			pregel, cc, pregel.num_vertices(), nullptr, grb::interfaces::PREGEL_MODE );
 		double single_time = timer.time();
 		if( rc != SUCCESS ) {
 			std::cerr << "Failure: call to Pregel ConnectedAlgorithms did not succeed "
@@ -144,7 +148,8 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 					grb::algorithms::pregel::ConnectedComponents< size_t >::Data(),
 					in_msgs, out_msgs,
 					out.iterations,
-					out_buffer
+					out_buffer,
+					0, grb::interfaces::PREGEL_MODE
 				);
 			}
 		}
@@ -176,6 +181,26 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 		return;
 	}
 
+	// other execution modes must find the same components as the default mode
+	if( grb::interfaces::PREGEL_MODE != grb::interfaces::BULK_SYNCHRONOUS ) {
+		grb::Vector< size_t > reference( n );
+		bool equal = true;
+		rc = grb::algorithms::pregel::ConnectedComponents< size_t >::execute(
+			pregel, reference );
+		rc = rc ? rc : grb::dot( equal, cc, reference,
+			grb::Monoid<
+				grb::operators::logical_and< bool >, grb::identities::logical_true
+			>(),
+			grb::operators::equal< size_t, size_t, bool >()
+		);
+		if( rc != SUCCESS || !equal ) {
+			std::cerr << "Connected components differ from those computed in the "
+				<< "bulk-synchronous mode." << std::endl;
+			out.error_code = 40;
+			return;
+		}
+	}
+
 	// output
 	out.pinnedVector = PinnedVector< size_t >( cc, SEQUENTIAL );
 
@@ -32,6 +32,10 @@
  #error "PR_CONVERGENCE_MODE must be defined and read either true or false"
 #endif
 
+#ifndef PREGEL_MODE
+ #define PREGEL_MODE BULK_SYNCHRONOUS
+#endif
+
 
 using namespace grb;
 using namespace algorithms;
@@ -120,7 +124,8 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 				pr_prog, pr, pr_data,
 				in_msgs, out_msgs,
 				out.iterations,
-				out_buffer
+				out_buffer,
+				0, grb::interfaces::PREGEL_MODE
 		        );
 		double single_time = timer.time();
 		if( rc != SUCCESS ) {
@@ -154,7 +159,8 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 			rc = grb::set( pr, 0 );
 			if( rc == SUCCESS ) {
 				rc = algorithms::pregel::PageRank< double, PR_CONVERGENCE_MODE >::execute(
-						pregel, pr, out.iterations, pr_data
+						pregel, pr, out.iterations, pr_data,
+						0, grb::interfaces::PREGEL_MODE
 					);
 			}
 		}
@@ -186,6 +192,32 @@ void grbProgram( const struct input &data_in, struct output &out ) {
 		return;
 	}
 
+	// other execution modes must converge to the same scores as the default
+	// mode, up to a small multiple of the convergence tolerance
+	if( rc == SUCCESS &&
+		grb::interfaces::PREGEL_MODE != grb::interfaces::BULK_SYNCHRONOUS
+	) {
+		grb::Vector< double > reference( n );
+		size_t reference_rounds = 0;
+		double max_diff = 0;
+		rc = grb::set( reference, 0 );
+		rc = rc ? rc : algorithms::pregel::PageRank<
+				double, PR_CONVERGENCE_MODE
+			>::execute( pregel, reference, reference_rounds, pr_data );
+		rc = rc ? rc : grb::dot( max_diff, pr, reference,
+			grb::Monoid<
+				grb::operators::max< double >, grb::identities::negative_infinity
+			>(),
+			grb::operators::abs_diff< double >()
+		);
+		if( rc != SUCCESS || max_diff > 10 * pr_data.tolerance ) {
+			std::cerr << "Scores differ by up to " << max_diff << " from those "
+				<< "computed in the bulk-synchronous mode." << std::endl;
+			out.error_code = 40;
+			return;
+		}
+	}
+
 	// output
 	out.pinnedVector = PinnedVector< double >( pr, SEQUENTIAL );
 
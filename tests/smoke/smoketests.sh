@@ -212,6 +212,18 @@ for BACKEND in ${BACKENDS[@]}; do
 			fi
 			echo " "
 
+			echo ">>>      [x]           [ ]       Tests the bucket-queue K-core decomposition variant on the"
+			echo "                                 dataset EPA.mtx, verified against the same ground truth as"
+			echo "                                 the default variant."
+			echo "Functional test executable: ${TEST_BIN_DIR}/kcore_decomposition_bucketed_${BACKEND}"
+			if [ -f ${INPUT_DIR}/EPA.mtx ]; then
+				$runner ${TEST_BIN_DIR}/kcore_decomposition_bucketed_${BACKEND} ${INPUT_DIR}/EPA.mtx direct 1 1 verification ${OUTPUT_VERIFICATION_DIR}/kcore_decomposition_eda_ref &> ${TEST_OUT_DIR}/kcore_decomposition_bucketed_${BACKEND}_EPA_${P}_${T}.log
+				grep 'Test OK' ${TEST_OUT_DIR}/kcore_decomposition_bucketed_${BACKEND}_EPA_${P}_${T}.log || printf 'Test FAILED.\n'
+			else
+				echo "Test DISABLED; dataset not found. Provide EPA.mtx in the ./datasets/ directory to enable."
+			fi
+			echo " "
+
 			TESTNAME=rndHermit256
 			if [ -f ${TEST_DATA_DIR}/${TESTNAME}.mtx ]; then
 				n=$(grep -v '^%' ${TEST_DATA_DIR}/${TESTNAME}.mtx | head -1 | awk '{print $1}' )
@@ -268,6 +280,37 @@ for BACKEND in ${BACKENDS[@]}; do
 			fi
 			echo " "
 
+			echo ">>>      [x]           [ ]       Testing batched Sparse Neural Network inference on a small"
+			echo "                                 generated network, verified against single inference."
+			$runner ${TEST_BIN_DIR}/sparse_nn_batch_inference_${BACKEND} &> ${TEST_OUT_DIR}/sparse_nn_batch_inference_${BACKEND}_${P}_${T}.log
+			head -1 ${TEST_OUT_DIR}/sparse_nn_batch_inference_${BACKEND}_${P}_${T}.log
+			grep 'Test OK' ${TEST_OUT_DIR}/sparse_nn_batch_inference_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+			echo " "
+
+			echo ">>>      [x]           [ ]       Testing triangle counting and local clustering coefficients"
+			echo "                                 on generated graphs, verified against closed-form and"
+			echo "                                 brute-force results."
+			$runner ${TEST_BIN_DIR}/triangle_count_${BACKEND} &> ${TEST_OUT_DIR}/triangle_count_${BACKEND}_${P}_${T}.log
+			head -1 ${TEST_OUT_DIR}/triangle_count_${BACKEND}_${P}_${T}.log
+			grep 'Test OK' ${TEST_OUT_DIR}/triangle_count_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+			echo " "
+
+			echo ">>>      [x]           [ ]       Testing delta-stepping single-source shortest paths on"
+			echo "                                 generated weighted graphs for a range of bucket widths,"
+			echo "                                 verified against Dijkstra's algorithm."
+			$runner ${TEST_BIN_DIR}/delta_stepping_${BACKEND} &> ${TEST_OUT_DIR}/delta_stepping_${BACKEND}_${P}_${T}.log
+			head -1 ${TEST_OUT_DIR}/delta_stepping_${BACKEND}_${P}_${T}.log
+			grep 'Test OK' ${TEST_OUT_DIR}/delta_stepping_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+			echo " "
+
+			echo ">>>      [x]           [ ]       Testing top-k all-pairs cosine similarity on generated"
+			echo "                                 real-valued and binary feature matrices, verified"
+			echo "                                 against brute-force results."
+			$runner ${TEST_BIN_DIR}/all_pairs_cosine_similarity_${BACKEND} &> ${TEST_OUT_DIR}/all_pairs_cosine_similarity_${BACKEND}_${P}_${T}.log
+			head -1 ${TEST_OUT_DIR}/all_pairs_cosine_similarity_${BACKEND}_${P}_${T}.log
+			grep 'Test OK' ${TEST_OUT_DIR}/all_pairs_cosine_similarity_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+			echo " "
+
 			for ((i=0;i<${#LABELTEST_SIZES[@]};++i));
 			do
 				LABELTEST_SIZE=${LABELTEST_SIZES[i]}
@@ -320,6 +363,22 @@ for BACKEND in ${BACKENDS[@]}; do
 			fi
 			echo " "
 
+			echo ">>>      [x]           [ ]       Testing the Pregel PageRank-like algorithm using a global"
+			echo "                                 stopping criterion in the asynchronous mode. Verifies against"
+			echo "                                 the bulk-synchronous mode."
+			if [ -f ${INPUT_DIR}/west0497.mtx ]; then
+				$runner ${TEST_BIN_DIR}/pregel_pagerank_global_async_${BACKEND} ${INPUT_DIR}/west0497.mtx direct 1 1 &> ${TEST_OUT_DIR}/pregel_pagerank_global_async_west0497_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/pregel_pagerank_global_async_west0497_${BACKEND}_${P}_${T}.log
+				if ! grep -q 'Test OK' ${TEST_OUT_DIR}/pregel_pagerank_global_async_west0497_${BACKEND}_${P}_${T}.log; then
+					echo "Test FAILED"
+				else
+					echo "Test OK"
+				fi
+			else
+				echo "Test DISABLED: west0497.mtx was not found. To enable, please provide ${INPUT_DIR}/west0497.mtx"
+			fi
+			echo " "
+
 			echo ">>>      [x]           [ ]       Testing the Pregel connected components algorithm. Verifies"
 			echo "                                 using a simple regression test in number of rounds required."
 			if [ -f ${INPUT_DIR}/west0497.mtx ]; then
@@ -338,6 +397,36 @@ for BACKEND in ${BACKENDS[@]}; do
 			fi
 			echo " "
 
+			echo ">>>      [x]           [ ]       Testing the Pregel connected components algorithm in the sparse"
+			echo "                                 active-set mode. Verifies against the bulk-synchronous mode."
+			if [ -f ${INPUT_DIR}/west0497.mtx ]; then
+				$runner ${TEST_BIN_DIR}/pregel_connected_components_sparse_${BACKEND} ${INPUT_DIR}/west0497.mtx direct 1 1 &> ${TEST_OUT_DIR}/pregel_connected_components_sparse_west0497_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/pregel_connected_components_sparse_west0497_${BACKEND}_${P}_${T}.log
+				if ! grep -q 'Test OK' ${TEST_OUT_DIR}/pregel_connected_components_sparse_west0497_${BACKEND}_${P}_${T}.log; then
+					echo "Test FAILED"
+				else
+					echo "Test OK"
+				fi
+			else
+				echo "Test DISABLED: west0497.mtx was not found. To enable, please provide ${INPUT_DIR}/west0497.mtx"
+			fi
+			echo " "
+
+			echo ">>>      [x]           [ ]       Testing the Pregel connected components algorithm in the"
+			echo "                                 asynchronous mode. Verifies against the bulk-synchronous mode."
+			if [ -f ${INPUT_DIR}/west0497.mtx ]; then
+				$runner ${TEST_BIN_DIR}/pregel_connected_components_async_${BACKEND} ${INPUT_DIR}/west0497.mtx direct 1 1 &> ${TEST_OUT_DIR}/pregel_connected_components_async_west0497_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/pregel_connected_components_async_west0497_${BACKEND}_${P}_${T}.log
+				if ! grep -q 'Test OK' ${TEST_OUT_DIR}/pregel_connected_components_async_west0497_${BACKEND}_${P}_${T}.log; then
+					echo "Test FAILED"
+				else
+					echo "Test OK"
+				fi
+			else
+				echo "Test DISABLED: west0497.mtx was not found. To enable, please provide ${INPUT_DIR}/west0497.mtx"
+			fi
+			echo " "
+
 			if [ "$BACKEND" = "bsp1d" ] || [ "$BACKEND" = "hybrid" ]; then
 				echo "Additional standardised smoke tests not yet supported for the ${BACKEND} backend"
 				echo
@@ -0,0 +1,214 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests batched sparse neural network inference by comparing every row of its
+ * output against that of single inference on the corresponding input row.
+ */
+
+#include <cmath>
+#include <vector>
+#include <iostream>
+
+#include <graphblas/algorithms/sparse_nn_single_inference.hpp>
+#include <graphblas/algorithms/sparse_nn_batch_inference.hpp>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+using namespace grb::algorithms;
+
+static const size_t neurons = 64;
+static const size_t num_layers = 6;
+static const size_t batch = 24;
+static const double bias = -0.3;
+static const double threshold = 32;
+
+/** A simple deterministic pseudo-random number in [0, 1). */
+static double next( size_t &state ) {
+	state = (state * 1103515245 + 12345) % 2147483648UL;
+	return static_cast< double >( state ) / 2147483648.0;
+}
+
+/** Compares a row of a batch against a single inference result. */
+static bool compare(
+	const std::vector< double > &batch_row, const Vector< double > &single
+) {
+	std::vector< double > expect( neurons, 0.0 );
+	for( const auto &pair : single ) {
+		expect[ pair.first ] = pair.second;
+	}
+	for( size_t j = 0; j < neurons; ++j ) {
+		if( std::fabs( batch_row[ j ] - expect[ j ] ) >
+			1e-10 * (1.0 + std::fabs( expect[ j ] ))
+		) {
+			std::cerr << "\t feature " << j << " is " << batch_row[ j ]
+				<< ", expected " << expect[ j ] << "\n";
+			return false;
+		}
+	}
+	return true;
+}
+
+void grbProgram( const void *, const size_t in_size, int &error ) {
+	error = 0;
+	if( in_size != 0 ) {
+		std::cerr << "Unit tests called with unexpected input\n";
+		error = 1;
+		return;
+	}
+
+	// generate the network
+	size_t state = 17;
+	std::vector< Matrix< double > > layers;
+	std::vector< double > biases( num_layers, bias );
+	RC rc = SUCCESS;
+	for( size_t l = 0; rc == SUCCESS && l < num_layers; ++l ) {
+		std::vector< size_t > I, J;
+		std::vector< double > V;
+		for( size_t i = 0; i < neurons; ++i ) {
+			for( size_t j = 0; j < neurons; ++j ) {
+				if( next( state ) < 0.1 ) {
+					I.push_back( i ); J.push_back( j );
+					V.push_back( 2.0 * next( state ) - 0.5 );
+				}
+			}
+		}
+		layers.emplace_back( neurons, neurons );
+		rc = resize( layers.back(), V.size() );
+		rc = rc ? rc : buildMatrixUnique( layers.back(), I.data(), J.data(),
+			V.data(), V.size(), SEQUENTIAL );
+	}
+
+	// generate the input batch, where every fifth row is empty
+	std::vector< std::vector< double > > input( batch );
+	std::vector< size_t > I, J;
+	std::vector< double > V;
+	for( size_t b = 0; b < batch; ++b ) {
+		input[ b ].resize( neurons, 0.0 );
+		if( b % 5 == 0 ) {
+			continue;
+		}
+		for( size_t j = 0; j < neurons; ++j ) {
+			if( next( state ) < 0.3 ) {
+				input[ b ][ j ] = 1.0;
+				I.push_back( b ); J.push_back( j ); V.push_back( 1.0 );
+			}
+		}
+	}
+	Matrix< double > in( batch, neurons ), out( batch, neurons ),
+		temp( batch, neurons );
+	rc = rc ? rc : resize( in, V.size() );
+	rc = rc ? rc : buildMatrixUnique( in, I.data(), J.data(), V.data(),
+		V.size(), SEQUENTIAL );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t initialisation FAILED\n";
+		error = 5;
+		return;
+	}
+
+	for( const bool thresholded : { false, true } ) {
+		if( thresholded ) {
+			rc = sparse_nn_batch_inference( out, in, layers, biases, threshold,
+				temp );
+		} else {
+			rc = sparse_nn_batch_inference( out, in, layers, biases, temp );
+		}
+		if( rc != SUCCESS ) {
+			std::cerr << "\t batch inference returned " << toString( rc ) << "\n";
+			error = 10;
+			return;
+		}
+		std::vector< std::vector< double > > result( batch,
+			std::vector< double >( neurons, 0.0 ) );
+		size_t zeroes = 0;
+		for( const auto &triple : out ) {
+			result[ triple.first.first ][ triple.first.second ] = triple.second;
+			if( triple.second == 0 ) {
+				(void) ++zeroes;
+			}
+		}
+		if( zeroes > 0 ) {
+			std::cerr << "\t batch output contains " << zeroes << " explicit zeroes\n";
+			error = 15;
+			return;
+		}
+
+		Vector< double > single_in( neurons ), single_out( neurons ),
+			single_temp( neurons );
+		for( size_t b = 0; b < batch; ++b ) {
+			rc = clear( single_in );
+			for( size_t j = 0; rc == SUCCESS && j < neurons; ++j ) {
+				if( input[ b ][ j ] != 0 ) {
+					rc = setElement( single_in, input[ b ][ j ], j );
+				}
+			}
+			if( thresholded ) {
+				rc = rc ? rc : sparse_nn_single_inference( single_out, single_in,
+					layers, biases, threshold, single_temp );
+			} else {
+				rc = rc ? rc : sparse_nn_single_inference( single_out, single_in,
+					layers, biases, single_temp );
+			}
+			if( rc != SUCCESS ) {
+				std::cerr << "\t single inference returned " << toString( rc ) << "\n";
+				error = 20;
+				return;
+			}
+			if( !compare( result[ b ], single_out ) ) {
+				std::cerr << "\t mismatch at batch row " << b << " ("
+					<< (thresholded ? "" : "not ") << "thresholded)\n";
+				error = 25;
+				return;
+			}
+		}
+	}
+
+	// mismatching batch sizes
+	Matrix< double > wrong( batch + 1, neurons );
+	rc = sparse_nn_batch_inference( wrong, in, layers, biases, temp );
+	if( rc != MISMATCH ) {
+		std::cerr << "\t unexpected return code " << toString( rc )
+			<< ", expected MISMATCH\n";
+		error = 30;
+	}
+}
+
+int main( int argc, char ** argv ) {
+	(void)argc;
+	std::cout << "Functional test executable: " << argv[ 0 ] << "\n";
+
+	int error;
+	grb::Launcher< AUTOMATIC > launcher;
+	if( launcher.exec( &grbProgram, nullptr, 0, error ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
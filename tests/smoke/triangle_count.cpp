@@ -0,0 +1,241 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests triangle counting and local clustering coefficients on a complete
+ * graph, on a wheel graph, and on a random graph verified by brute force.
+ */
+
+#include <cmath>
+#include <vector>
+#include <iostream>
+
+#include <graphblas/algorithms/triangle_count.hpp>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+using namespace grb::algorithms;
+
+/** A simple deterministic pseudo-random number in [0, 1). */
+static double next( size_t &state ) {
+	state = (state * 1103515245 + 12345) % 2147483648UL;
+	return static_cast< double >( state ) / 2147483648.0;
+}
+
+/** Runs both algorithms on \a A and compares against the expected output. */
+template< typename NZType >
+static int check(
+	const char * const name,
+	const Matrix< NZType > &A,
+	const size_t expected_count,
+	const std::vector< double > &expected_coefficients
+) {
+	const size_t n = nrows( A );
+	size_t count = 0;
+	RC rc = triangle_count( count, A );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t " << name << ": triangle_count returns "
+			<< toString( rc ) << "\n";
+		return 1;
+	}
+	if( count != expected_count ) {
+		std::cerr << "\t " << name << ": counted " << count << " triangles, "
+			<< "expected " << expected_count << "\n";
+		return 2;
+	}
+
+	Vector< double > coefficients( n );
+	rc = clustering_coefficient( coefficients, A );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t " << name << ": clustering_coefficient returns "
+			<< toString( rc ) << "\n";
+		return 3;
+	}
+	if( nnz( coefficients ) != n ) {
+		std::cerr << "\t " << name << ": clustering coefficients are not dense\n";
+		return 4;
+	}
+	for( const auto &pair : coefficients ) {
+		const double expect = expected_coefficients[ pair.first ];
+		if( std::fabs( pair.second - expect ) > 1e-12 ) {
+			std::cerr << "\t " << name << ": vertex " << pair.first << " has "
+				<< "clustering coefficient " << pair.second << ", expected "
+				<< expect << "\n";
+			return 5;
+		}
+	}
+	return 0;
+}
+
+void grbProgram( const void *, const size_t in_size, int &error ) {
+	error = 0;
+	if( in_size != 0 ) {
+		std::cerr << "Unit tests called with unexpected input\n";
+		error = 1;
+		return;
+	}
+
+	// the complete graph on 12 vertices, as a symmetric pattern matrix
+	{
+		const size_t n = 12;
+		std::vector< size_t > I, J;
+		for( size_t i = 0; i < n; ++i ) {
+			for( size_t j = 0; j < n; ++j ) {
+				if( i != j ) {
+					I.push_back( i ); J.push_back( j );
+				}
+			}
+		}
+		Matrix< void > A( n, n );
+		RC rc = buildMatrixUnique( A, I.data(), J.data(), I.size(), SEQUENTIAL );
+		if( rc != SUCCESS ) {
+			std::cerr << "\t initialisation FAILED\n";
+			error = 5;
+			return;
+		}
+		error = check( "complete graph", A, n * (n - 1) * (n - 2) / 6,
+			std::vector< double >( n, 1.0 ) );
+		if( error ) {
+			error += 10;
+			return;
+		}
+	}
+
+	// a wheel with hub 0 and a rim of 20 vertices, where every edge is stored
+	// in one direction only, and with self-loops that must be ignored
+	{
+		const size_t rim = 20;
+		const size_t n = rim + 1;
+		std::vector< size_t > I, J;
+		std::vector< double > V;
+		for( size_t i = 1; i <= rim; ++i ) {
+			I.push_back( 0 ); J.push_back( i ); V.push_back( 1.0 );
+			I.push_back( i ); J.push_back( i % rim + 1 ); V.push_back( 2.0 );
+			I.push_back( i ); J.push_back( i ); V.push_back( 3.0 );
+		}
+		Matrix< double > A( n, n );
+		RC rc = buildMatrixUnique( A, I.data(), J.data(), V.data(), V.size(),
+			SEQUENTIAL );
+		if( rc != SUCCESS ) {
+			std::cerr << "\t initialisation FAILED\n";
+			error = 25;
+			return;
+		}
+		std::vector< double > expected( n, 2.0 / 3.0 );
+		expected[ 0 ] = 2.0 / static_cast< double >( rim - 1 );
+		error = check( "wheel graph", A, rim, expected );
+		if( error ) {
+			error += 30;
+			return;
+		}
+	}
+
+	// a random undirected graph, verified by brute force
+	{
+		const size_t n = 150;
+		size_t state = 17;
+		std::vector< std::vector< char > > adjacency( n,
+			std::vector< char >( n, 0 ) );
+		std::vector< size_t > I, J;
+		for( size_t i = 0; i < n; ++i ) {
+			for( size_t j = i + 1; j < n; ++j ) {
+				if( next( state ) < (i < 10 ? 0.5 : 0.08) ) {
+					adjacency[ i ][ j ] = adjacency[ j ][ i ] = 1;
+					I.push_back( i ); J.push_back( j );
+					I.push_back( j ); J.push_back( i );
+				}
+			}
+		}
+		size_t count = 0;
+		std::vector< double > expected( n, 0.0 );
+		for( size_t i = 0; i < n; ++i ) {
+			size_t degree = 0, triangles = 0;
+			for( size_t j = 0; j < n; ++j ) {
+				if( !adjacency[ i ][ j ] ) {
+					continue;
+				}
+				(void) ++degree;
+				for( size_t k = j + 1; k < n; ++k ) {
+					if( adjacency[ i ][ k ] && adjacency[ j ][ k ] ) {
+						(void) ++triangles;
+					}
+				}
+			}
+			count += triangles;
+			if( degree > 1 ) {
+				expected[ i ] = static_cast< double >( 2 * triangles ) /
+					static_cast< double >( degree * (degree - 1) );
+			}
+		}
+		count /= 3;
+		Matrix< void > A( n, n );
+		RC rc = buildMatrixUnique( A, I.data(), J.data(), I.size(), SEQUENTIAL );
+		if( rc != SUCCESS ) {
+			std::cerr << "\t initialisation FAILED\n";
+			error = 45;
+			return;
+		}
+		error = check( "random graph", A, count, expected );
+		if( error ) {
+			error += 50;
+			return;
+		}
+
+		// illegal and mismatching arguments
+		Matrix< void > rectangular( n, n + 1 );
+		Vector< double > wrong( n + 1 );
+		rc = triangle_count( count, rectangular );
+		if( rc != ILLEGAL ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected ILLEGAL\n";
+			error = 60;
+			return;
+		}
+		rc = clustering_coefficient( wrong, A );
+		if( rc != MISMATCH ) {
+			std::cerr << "\t unexpected return code " << toString( rc )
+				<< ", expected MISMATCH\n";
+			error = 61;
+			return;
+		}
+	}
+}
+
+int main( int argc, char ** argv ) {
+	(void)argc;
+	std::cout << "Functional test executable: " << argv[ 0 ] << "\n";
+
+	int error;
+	grb::Launcher< AUTOMATIC > launcher;
+	if( launcher.exec( &grbProgram, nullptr, 0, error ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	return error;
+}
+
@@ -0,0 +1,298 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests the JSON and CSV output of the #grb::Benchmarker, including its
+ * statistics and the handling of warm-up calls, by parsing the output of a
+ * program with known timings.
+ */
+
+#include <map>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+
+#include <stdio.h> // remove
+#include <stdlib.h> // setenv
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+
+/** The number of outer repetitions. */
+static const size_t repetitions = 10;
+
+/** Counts the number of calls to #grbProgram. */
+static size_t calls = 0;
+
+struct output {
+	grb::utils::TimerResults times;
+};
+
+/** Reports the number of earlier calls as its useful time. */
+void grbProgram( const size_t &in, output &out ) {
+	(void) in;
+	out.times.useful = static_cast< double >( calls++ );
+}
+
+/** A minimal JSON value: a number, a string, an array, or an object. */
+struct JSON {
+	enum { NUMBER, STRING, ARRAY, OBJECT } kind;
+	double number;
+	std::string string;
+	std::vector< JSON > array;
+	std::map< std::string, JSON > object;
+};
+
+/** Parses a JSON value from \a in, and returns whether that succeeded. */
+static bool parse( std::istream &in, JSON &value ) {
+	in >> std::ws;
+	const int c = in.peek();
+	if( c == '"' ) {
+		value.kind = JSON::STRING;
+		(void) in.get();
+		for( int d = in.get(); d != '"'; d = in.get() ) {
+			if( d == EOF ) {
+				return false;
+			}
+			if( d == '\\' ) {
+				d = in.get();
+			}
+			value.string.push_back( static_cast< char >( d ) );
+		}
+		return true;
+	}
+	if( c == '[' || c == '{' ) {
+		const bool object = c == '{';
+		value.kind = object ? JSON::OBJECT : JSON::ARRAY;
+		(void) in.get();
+		in >> std::ws;
+		if( in.peek() == (object ? '}' : ']') ) {
+			(void) in.get();
+			return true;
+		}
+		while( true ) {
+			JSON element, key;
+			if( object ) {
+				if( !parse( in, key ) || key.kind != JSON::STRING ) {
+					return false;
+				}
+				in >> std::ws;
+				if( in.get() != ':' ) {
+					return false;
+				}
+			}
+			if( !parse( in, element ) ) {
+				return false;
+			}
+			if( object ) {
+				value.object[ key.string ] = element;
+			} else {
+				value.array.push_back( element );
+			}
+			in >> std::ws;
+			const int d = in.get();
+			if( d == (object ? '}' : ']') ) {
+				return true;
+			}
+			if( d != ',' ) {
+				return false;
+			}
+		}
+	}
+	value.kind = JSON::NUMBER;
+	return static_cast< bool >( in >> value.number );
+}
+
+/** Runs the benchmark with the given format, and returns its output. */
+static int run(
+	const char * const format, const char * const warmup,
+	const char * const file, std::string &result
+) {
+	setenv( "GRB_BENCH_FORMAT", format, 1 );
+	setenv( "GRB_BENCH_WARMUP", warmup, 1 );
+	setenv( "GRB_BENCH_OUTPUT", file, 1 );
+	setenv( "GRB_BENCH_LABEL", "a,\"label\"", 1 );
+	setenv( "GRB_BENCH_PAUSE", "0", 1 );
+	(void) remove( file );
+	calls = 0;
+
+	output out;
+	grb::Benchmarker< AUTOMATIC > benchmarker;
+	const size_t input = 0;
+	if( benchmarker.exec( &grbProgram, input, out, 1, repetitions, true ) !=
+		SUCCESS
+	) {
+		std::cerr << "\t benchmarker.exec FAILED\n";
+		return 1;
+	}
+	std::ifstream in( file );
+	if( !in.good() ) {
+		std::cerr << "\t no " << format << " output was written\n";
+		return 2;
+	}
+	std::stringstream ss;
+	ss << in.rdbuf();
+	result = ss.str();
+	(void) remove( file );
+	return 0;
+}
+
+/** Checks \a value against \a expect. */
+static bool check( const char * const name, const double value,
+	const double expect
+) {
+	if( std::fabs( value - expect ) > 1e-12 * (1 + std::fabs( expect )) ) {
+		std::cerr << "\t " << name << " is " << value << ", expected " << expect
+			<< "\n";
+		return false;
+	}
+	return true;
+}
+
+/** The expected statistics of the useful time, given \a warmup calls. */
+static std::map< std::string, double > expected( const size_t warmup ) {
+	// the samples are warmup, warmup + 1, ..., warmup + repetitions - 1
+	const double first = static_cast< double >( warmup );
+	double sdev = 0;
+	for( size_t i = 0; i < repetitions; ++i ) {
+		const double diff = static_cast< double >( i ) - (repetitions - 1) / 2.0;
+		sdev += diff * diff;
+	}
+	std::map< std::string, double > ret;
+	ret[ "avg" ] = first + (repetitions - 1) / 2.0;
+	ret[ "min" ] = first;
+	ret[ "max" ] = first + repetitions - 1;
+	ret[ "std" ] = std::sqrt( sdev / (repetitions - 1) );
+	ret[ "median" ] = first + (repetitions - 1) / 2.0;
+	ret[ "p90" ] = first + 0.9 * (repetitions - 1);
+	ret[ "p99" ] = first + 0.99 * (repetitions - 1);
+	return ret;
+}
+
+int main( int argc, char ** argv ) {
+	(void) argc;
+	std::cout << "Functional test executable: " << argv[ 0 ] << "\n";
+	const char * const file = "benchmarkerOutput.tmp";
+	int error = 0;
+
+	// JSON output with two warm-up calls
+	std::string result;
+	error = run( "json", "2", file, result );
+	if( !error ) {
+		std::istringstream in( result );
+		JSON json;
+		const auto &object = json.object;
+		if( !parse( in, json ) || json.kind != JSON::OBJECT ) {
+			std::cerr << "\t could not parse JSON output:\n" << result;
+			error = 10;
+		} else if( object.at( "label" ).string != "a,\"label\"" ||
+			object.at( "outer" ).number != repetitions ||
+			object.at( "inner" ).number != 1 ||
+			object.at( "warmup" ).number != 2 ||
+			object.at( "samples" ).array.size() != repetitions ||
+			object.at( "processes" ).array.size() !=
+				object.at( "nprocs" ).number
+		) {
+			std::cerr << "\t unexpected JSON header or sizes:\n" << result;
+			error = 11;
+		} else {
+			for( size_t i = 0; !error && i < repetitions; ++i ) {
+				const auto &sample = object.at( "samples" ).array[ i ].object;
+				if( !check( "sample", sample.at( "useful" ).number, 2.0 + i ) ||
+					!check( "io", sample.at( "io" ).number, 0 )
+				) {
+					error = 12;
+				}
+			}
+			for( const auto &pair : expected( 2 ) ) {
+				const auto &statistic = object.at( "statistics" ).object.at(
+					pair.first ).object;
+				if( !error && !check( pair.first.c_str(),
+					statistic.at( "useful" ).number, pair.second )
+				) {
+					error = 13;
+				}
+			}
+		}
+	}
+
+	// CSV output with an illegal number of warm-up calls, which is ignored
+	if( !error ) {
+		error = run( "csv", "-1", file, result );
+	}
+	if( !error ) {
+		std::istringstream in( result );
+		std::string line;
+		std::getline( in, line );
+		if( line != "label,kind,index,io,preamble,useful,postamble" ) {
+			std::cerr << "\t unexpected CSV header " << line << "\n";
+			error = 20;
+		}
+		const std::map< std::string, double > expect = expected( 0 );
+		size_t samples = 0, statistics = 0;
+		while( !error && std::getline( in, line ) ) {
+			std::vector< std::string > fields;
+			std::istringstream row( line );
+			for( std::string field; std::getline( row, field, ',' ); ) {
+				fields.push_back( field );
+			}
+			if( fields.size() != 7 || fields[ 0 ] != "a \"label\"" ) {
+				std::cerr << "\t unexpected CSV row " << line << "\n";
+				error = 21;
+				break;
+			}
+			const double useful = std::stod( fields[ 5 ] );
+			if( fields[ 1 ] == "sample" ) {
+				if( !check( "sample", useful,
+					static_cast< double >( std::stoul( fields[ 2 ] ) ) )
+				) {
+					error = 22;
+				}
+				(void) ++samples;
+			} else if( expect.count( fields[ 1 ] ) > 0 ) {
+				if( !check( fields[ 1 ].c_str(), useful, expect.at( fields[ 1 ] ) ) ) {
+					error = 23;
+				}
+				(void) ++statistics;
+			} else if( fields[ 1 ] != "process" ) {
+				std::cerr << "\t unexpected CSV row " << line << "\n";
+				error = 24;
+			}
+		}
+		if( !error && (samples != repetitions || statistics != expect.size()) ) {
+			std::cerr << "\t CSV output has " << samples << " samples and "
+				<< statistics << " statistics\n";
+			error = 25;
+		}
+	}
+
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+	return error;
+}
+
@@ -0,0 +1,170 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests building a matrix in parallel I/O mode from input that user processes
+ * ingest in many small rounds, by setting the BSP1D chunk size to a small
+ * value, as well as in a single round. The input is unevenly distributed over
+ * the user processes, so that they finish ingesting their input in different
+ * rounds. Backends other than BSP1D ignore the chunk size.
+ */
+
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <iostream>
+
+#include <stdlib.h> // setenv
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+
+/** The number of nonzeroes per row. */
+static const size_t per_row = 4;
+
+/** The value of the nonzero at \a i, \a j. */
+static double value( const size_t i, const size_t j, const size_t n ) {
+	return static_cast< double >( i * n + j );
+}
+
+void grbProgram( const size_t &n, int &error ) {
+	error = 0;
+	const size_t s = spmd<>::pid();
+	const size_t P = spmd<>::nprocs();
+
+	// every process contributes the nonzeroes assigned to it, where the last
+	// process is assigned about twice as many as any other
+	std::vector< size_t > I, J;
+	std::vector< double > V;
+	for( size_t k = 0; k < per_row * n; ++k ) {
+		const size_t owner = std::min( k % (P + 1), P - 1 );
+		if( owner != s ) {
+			continue;
+		}
+		const size_t i = k / per_row;
+		const size_t j = (i + k % per_row) % n;
+		I.push_back( i );
+		J.push_back( j );
+		V.push_back( value( i, j, n ) );
+	}
+
+	Matrix< double > A( n, n );
+	RC rc = buildMatrixUnique( A, I.data(), J.data(), V.data(), V.size(),
+		PARALLEL );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t buildMatrixUnique returns " << toString( rc ) << "\n";
+		error = 10;
+		return;
+	}
+	if( nnz( A ) != per_row * n ) {
+		std::cerr << "\t matrix has " << nnz( A ) << " nonzeroes, expected "
+			<< (per_row * n) << "\n";
+		error = 20;
+		return;
+	}
+
+	// every nonzero must have its expected value, and must be unique
+	size_t local = 0;
+	for( const auto &triple : A ) {
+		const size_t i = triple.first.first;
+		const size_t j = triple.first.second;
+		if( triple.second != value( i, j, n ) || (j + n - i) % n >= per_row ) {
+			std::cerr << "\t unexpected nonzero ( " << i << ", " << j << ", "
+				<< triple.second << " )\n";
+			error = 30;
+		}
+		(void) ++local;
+	}
+	if( collectives<>::allreduce( error, operators::max< int >() ) != SUCCESS ||
+		collectives<>::allreduce( local, operators::add< size_t >() ) != SUCCESS
+	) {
+		std::cerr << "\t allreduce FAILED\n";
+		error = 40;
+		return;
+	}
+	if( error == 0 && local != per_row * n ) {
+		std::cerr << "\t iterating over the matrix yields " << local
+			<< " nonzeroes, expected " << (per_row * n) << "\n";
+		error = 50;
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = 1000;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read < per_row ) {
+			std::cerr << "Given value for n is smaller than " << per_row << "\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is 1000): an integer no smaller than "
+			<< per_row << ".\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	grb::Launcher< AUTOMATIC > launcher;
+	int error = 0;
+
+	// many rounds of at most seven nonzeroes per process, followed by a single
+	// round; the BSP1D backend reads the chunk size during grb::init
+	for( const char * const chunk : { "7", "0" } ) {
+		(void) setenv( "GRB_BSP1D_BUILD_CHUNK_SIZE", chunk, 1 );
+		if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+			std::cerr << "Test failed to launch\n";
+			error = 255;
+		}
+		if( error != 0 ) {
+			std::cerr << "\t with a chunk size of " << chunk << "\n";
+			break;
+		}
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
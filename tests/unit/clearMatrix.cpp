@@ -57,6 +57,44 @@ void grb_program( const size_t &n, grb::RC &rc ) {
 		std::cerr << "\t unexpected number of nonzeroes in matrix "
 			<< "( " << grb::nnz( diag ) << " ), expected 0\n";
 		rc = FAILED;
+		return;
+	}
+
+	// a cleared matrix that is rebuilt without nonzeroes must remain empty,
+	// also to the multiplication kernels
+	{
+		const size_t * const no_indices = nullptr;
+		const double * const no_values = nullptr;
+		rc = grb::buildMatrixUnique( diag, no_indices, no_indices, no_values, 0,
+			PARALLEL );
+	}
+	if( rc != SUCCESS ) {
+		std::cerr << "\t rebuilding an empty matrix FAILED\n";
+		return;
+	}
+	for( const auto &triple : diag ) {
+		std::cerr << "\t unexpected nonzero ( " << triple.first.first << ", "
+			<< triple.first.second << " ) in the rebuilt matrix\n";
+		rc = FAILED;
+		return;
+	}
+	grb::Semiring<
+		grb::operators::add< double >, grb::operators::mul< double >,
+		grb::identities::zero, grb::identities::one
+	> ring;
+	grb::Vector< double > output( n );
+	rc = grb::set( vector, 1 );
+	rc = rc ? rc : grb::vxm( output, vector, diag, ring );
+	if( rc == SUCCESS && grb::nnz( output ) != 0 ) {
+		std::cerr << "\t vxm with the rebuilt matrix has " << grb::nnz( output )
+			<< " nonzeroes, expected 0\n";
+		rc = FAILED;
+	}
+	rc = rc ? rc : grb::mxv( output, diag, vector, ring );
+	if( rc == SUCCESS && grb::nnz( output ) != 0 ) {
+		std::cerr << "\t mxv with the rebuilt matrix has " << grb::nnz( output )
+			<< " nonzeroes, expected 0\n";
+		rc = FAILED;
 	}
 
 	// done
@@ -0,0 +1,192 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests that the memory of containers that are repeatedly constructed and
+ * destroyed is recycled via the #grb::utils::ContainerPool, and that recycled
+ * memory yields properly initialised containers.
+ */
+
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include "graphblas.hpp"
+#include "graphblas/utils/pool.hpp"
+
+
+using namespace grb;
+
+/**
+ * Constructs, fills, and destroys two vectors and a matrix of size \a n.
+ *
+ * @returns Zero on success, and an error code otherwise.
+ */
+static int iteration( const size_t n ) {
+	Vector< double > x( n ), y( n );
+	Matrix< double > A( n, n, n );
+	if( nnz( x ) != 0 || nnz( y ) != 0 || nnz( A ) != 0 ) {
+		std::cerr << "\t new containers are not empty\n";
+		return 1;
+	}
+	std::vector< size_t > I( n );
+	std::vector< double > V( n, 1.0 );
+	for( size_t i = 0; i < n; ++i ) {
+		I[ i ] = i;
+	}
+	RC rc = set( x, 1.0 );
+	rc = rc ? rc : setElement( y, 2.0, n / 2 );
+	rc = rc ? rc : buildMatrixUnique( A, I.data(), I.data(), V.data(), n,
+		SEQUENTIAL );
+	rc = rc ? rc : wait();
+	if( rc != SUCCESS ) {
+		std::cerr << "\t unexpected return code " << toString( rc ) << "\n";
+		return 2;
+	}
+	if( nnz( x ) != n || nnz( y ) != 1 || nnz( A ) != n ) {
+		std::cerr << "\t filled containers have unexpected nonzero counts\n";
+		return 3;
+	}
+	return 0;
+}
+
+void grbProgram( const size_t &n, int &error ) {
+	utils::ContainerPool &pool = utils::ContainerPool::instance();
+
+	// warm up, so that all memory areas required by an iteration are retained
+	error = iteration( n );
+	if( error ) {
+		std::cerr << "\t warm-up iteration FAILED\n";
+		return;
+	}
+	const utils::ContainerPool::Statistics before = pool.statistics();
+
+	// test 1: all further iterations should be served from the pool, and must
+	// return all memory they took
+	for( size_t k = 0; error == 0 && k < 10; ++k ) {
+		error = iteration( n );
+		if( error ) {
+			std::cerr << "\t iteration " << k << " FAILED\n";
+			error += 10;
+		}
+	}
+	if( error ) {
+		return;
+	}
+	const utils::ContainerPool::Statistics after = pool.statistics();
+	if( config::MEMORY_POOL::enabled() ) {
+		if( after.hits <= before.hits ) {
+			std::cerr << "\t test 1: no allocation was served from the pool\n";
+			error = 20;
+		}
+		if( after.misses != before.misses ) {
+			std::cerr << "\t test 1: " << (after.misses - before.misses) << " "
+				<< "allocations were not served from the pool\n";
+			error = 21;
+		}
+	}
+	if( after.inUse != before.inUse ) {
+		std::cerr << "\t test 1: usage changed from " << before.inUse << " to "
+			<< after.inUse << " bytes\n";
+		error = 22;
+	}
+	if( after.peak < after.inUse ) {
+		std::cerr << "\t test 1: peak usage is lower than current usage\n";
+		error = 23;
+	}
+	if( error ) {
+		return;
+	}
+
+	// test 2: statistics reset
+	pool.resetStatistics();
+	const utils::ContainerPool::Statistics reset = pool.statistics();
+	if( reset.hits != 0 || reset.misses != 0 || reset.evictions != 0 ||
+		reset.peak != reset.inUse
+	) {
+		std::cerr << "\t test 2: statistics were not reset\n";
+		error = 30;
+		return;
+	}
+
+	// test 3: clearing the pool returns all retained memory, after which
+	// containers remain functional
+	pool.clear();
+	if( pool.statistics().retained != 0 ) {
+		std::cerr << "\t test 3: memory is retained after clearing the pool\n";
+		error = 40;
+		return;
+	}
+	error = iteration( n );
+	if( error ) {
+		std::cerr << "\t test 3: iteration after clearing the pool FAILED\n";
+		error += 40;
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = 1000;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read < 2 ) {
+			std::cerr << "Given value for n is smaller than two\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is 1000): an integer larger than one.\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	grb::Launcher< AUTOMATIC > launcher;
+	int error;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
@@ -0,0 +1,275 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+
+typedef grb::Semiring<
+	grb::operators::add< double >, grb::operators::mul< double >,
+	grb::identities::zero, grb::identities::one
+> Ring;
+
+/** Checks whether two vectors have equal sparsity structure and values. */
+static bool equal( const Vector< double > &x, const Vector< double > &y ) {
+	if( nnz( x ) != nnz( y ) ) {
+		std::cerr << "\t number of nonzeroes " << nnz( x ) << " differs from "
+			<< nnz( y ) << "\n";
+		return false;
+	}
+	std::vector< double > values( size( y ) );
+	std::vector< bool > assigned( size( y ), false );
+	for( const auto &pair : y ) {
+		values[ pair.first ] = pair.second;
+		assigned[ pair.first ] = true;
+	}
+	for( const auto &pair : x ) {
+		if( !assigned[ pair.first ] ||
+			std::fabs( pair.second - values[ pair.first ] ) >
+				1e-12 * (1.0 + std::fabs( values[ pair.first ] ))
+		) {
+			std::cerr << "\t at index " << pair.first << ": got " << pair.second
+				<< ", expected " << values[ pair.first ] << "\n";
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Computes an output-masked vxm or mxv with epilogue, and compares it to the
+ * unfused equivalent. An empty mask selects the unmasked variant.
+ */
+template< Descriptor descr, bool left >
+static int check(
+	const Matrix< double > &A, const Vector< double > &v,
+	const Vector< bool > &mask, const Vector< double > &offsets,
+	const int error_base
+) {
+	const Ring ring;
+	const size_t n = size( v );
+	const double bias = -0.5;
+	const double threshold = 3.0;
+	const auto epilogue = epilogues::sequence(
+		epilogues::foldl( bias, operators::add< double >() ),
+		epilogues::foldl( offsets, operators::add< double >() ),
+		epilogues::foldl( 0.0, operators::relu< double >() ),
+		epilogues::foldl( threshold, operators::min< double >() )
+	);
+
+	// start from a sparse output so that pre-existing elements are covered
+	Vector< double > fused( n ), unfused( n );
+	RC rc = setElement( fused, 1.5, 0 );
+	rc = rc ? rc : setElement( fused, -2.0, n - 1 );
+	rc = rc ? rc : set( unfused, fused );
+	const bool masked = size( mask ) > 0;
+	if( left ) {
+		rc = rc ? rc : ( masked ?
+			vxm< descr >( fused, mask, v, A, ring, epilogue ) :
+			vxm< descr >( fused, v, A, ring, epilogue ) );
+		rc = rc ? rc : ( masked ?
+			vxm< descr >( unfused, mask, v, A, ring ) :
+			vxm< descr >( unfused, v, A, ring ) );
+	} else {
+		rc = rc ? rc : ( masked ?
+			mxv< descr >( fused, mask, A, v, ring, epilogue ) :
+			mxv< descr >( fused, A, v, ring, epilogue ) );
+		rc = rc ? rc : ( masked ?
+			mxv< descr >( unfused, mask, A, v, ring ) :
+			mxv< descr >( unfused, A, v, ring ) );
+	}
+	if( masked ) {
+		rc = rc ? rc : foldl( unfused, mask, bias, operators::add< double >() );
+		rc = rc ? rc : foldl( unfused, mask, offsets, operators::add< double >() );
+		rc = rc ? rc : foldl( unfused, mask, 0.0, operators::relu< double >() );
+		rc = rc ? rc : foldl( unfused, mask, threshold,
+			operators::min< double >() );
+	} else {
+		rc = rc ? rc : foldl( unfused, bias, operators::add< double >() );
+		rc = rc ? rc : foldl( unfused, offsets, operators::add< double >() );
+		rc = rc ? rc : foldl( unfused, 0.0, operators::relu< double >() );
+		rc = rc ? rc : foldl( unfused, threshold, operators::min< double >() );
+	}
+	if( rc != SUCCESS ) {
+		std::cerr << "\t unexpected return code " << toString( rc ) << "\n";
+		return error_base;
+	}
+	if( !equal( fused, unfused ) ) {
+		return error_base + 1;
+	}
+	return 0;
+}
+
+/** Runs all checks for a given input vector. */
+static int checkAll(
+	const Matrix< double > &A, const Vector< double > &v,
+	const Vector< bool > &mask, const Vector< double > &offsets,
+	const int error_base
+) {
+	int error = check< descriptors::no_operation, true >(
+		A, v, mask, offsets, error_base );
+	if( !error ) {
+		error = check< descriptors::transpose_matrix, true >(
+			A, v, mask, offsets, error_base + 2 );
+	}
+	if( !error ) {
+		error = check< descriptors::no_operation, false >(
+			A, v, mask, offsets, error_base + 4 );
+	}
+	if( !error ) {
+		error = check< descriptors::transpose_matrix, false >(
+			A, v, mask, offsets, error_base + 6 );
+	}
+	if( !error ) {
+		error = check< descriptors::force_row_major, false >(
+			A, v, mask, offsets, error_base + 8 );
+	}
+	return error;
+}
+
+void grbProgram( const size_t &n, int &error ) {
+	error = 0;
+
+	// a square matrix with a few nonzeroes per row
+	std::vector< size_t > I, J;
+	std::vector< double > V;
+	for( size_t i = 0; i < n; ++i ) {
+		const size_t j1 = (3 * i + 1) % n;
+		const size_t j2 = (7 * i + 2) % n;
+		I.push_back( i ); J.push_back( i ); V.push_back( 1.0 );
+		if( j1 != i ) {
+			I.push_back( i ); J.push_back( j1 );
+			V.push_back( static_cast< double >( i % 5 ) - 2.0 );
+		}
+		if( j2 != i && j2 != j1 ) {
+			I.push_back( i ); J.push_back( j2 );
+			V.push_back( static_cast< double >( i % 3 ) + 0.5 );
+		}
+	}
+	Matrix< double > A( n, n );
+	Vector< double > dense( n ), sparse( n ), empty( n ), offsets( n );
+	Vector< bool > mask( n ), no_mask( 0 );
+	RC rc = resize( A, V.size() );
+	rc = rc ? rc : buildMatrixUnique( A, I.data(), J.data(), V.data(), V.size(),
+		SEQUENTIAL );
+	for( size_t i = 0; rc == SUCCESS && i < n; ++i ) {
+		rc = setElement( dense, static_cast< double >( i % 7 ) - 3.0, i );
+		if( rc == SUCCESS && i % 2 == 0 ) {
+			rc = setElement( mask, true, i );
+		}
+		if( rc == SUCCESS && i % 3 == 0 ) {
+			rc = setElement( offsets, static_cast< double >( i % 4 ), i );
+		}
+	}
+	rc = rc ? rc : setElement( sparse, 2.0, n / 2 );
+	rc = rc ? rc : setElement( sparse, -1.0, n - 1 );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t initialisation FAILED\n";
+		error = 5;
+		return;
+	}
+
+	// test 1: dense input, which selects the gathering kernels
+	error = checkAll( A, dense, no_mask, offsets, 10 );
+	if( !error ) {
+		error = checkAll( A, dense, mask, offsets, 20 );
+	}
+
+	// test 2: sparse input, which selects the scattering kernels
+	if( !error ) {
+		error = checkAll( A, sparse, no_mask, offsets, 30 );
+	}
+	if( !error ) {
+		error = checkAll( A, sparse, mask, offsets, 40 );
+	}
+
+	// test 3: empty input, which is a trivial multiplication
+	if( !error ) {
+		error = checkAll( A, empty, no_mask, offsets, 50 );
+	}
+	if( error ) {
+		std::cerr << "\t epilogue test FAILED\n";
+		return;
+	}
+
+	// test 4: an epilogue operand of mismatching size
+	Vector< double > wrong( n + 1 ), u( n );
+	rc = vxm( u, dense, A, Ring(),
+		epilogues::foldl( wrong, operators::add< double >() ) );
+	if( rc != MISMATCH ) {
+		std::cerr << "\t test 4 (mismatch): unexpected return code "
+			<< toString( rc ) << ", expected MISMATCH\n";
+		error = 60;
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = 1000;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read < 2 ) {
+			std::cerr << "Given value for n is smaller than two\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is 1000): an integer larger than one.\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	grb::Launcher< AUTOMATIC > launcher;
+	int error;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
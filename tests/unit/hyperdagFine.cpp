@@ -0,0 +1,207 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests that the hyperdags backend extracts a fine-grained HyperDAG when
+ * <tt>GRB_HYPERDAGS_GRAIN</tt> is set to <tt>fine</tt>, and that coarsening and
+ * sampling reduce its size.
+ */
+
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include <stdlib.h> //setenv
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+using namespace grb::internal::hyperdags;
+
+/**
+ * Computes z = A x over a matrix with nonzeroes on its diagonal and on its
+ * cyclic superdiagonal, with the fine-grained generator configured as given,
+ * and returns the resulting HyperDAG via \a dag.
+ */
+static RC run(
+	const size_t n, const size_t blockSize, const double sample,
+	DHypergraph &dag, size_t &numSources, size_t &numOutputs
+) {
+	FineHyperDAGGenerator &fine = generator.fineGrained();
+	fine.enable( blockSize, sample );
+	const Semiring<
+		operators::add< double >, operators::mul< double >,
+		identities::zero, identities::one
+	> ring;
+	Vector< double > x( n ), y( n ), z( n );
+	Matrix< double > A( n, n, 2 * n );
+	std::vector< size_t > I( 2 * n ), J( 2 * n );
+	std::vector< double > V( 2 * n, 1.0 );
+	for( size_t i = 0; i < n; ++i ) {
+		I[ 2 * i ] = I[ 2 * i + 1 ] = i;
+		J[ 2 * i ] = i;
+		J[ 2 * i + 1 ] = ( i + 1 ) % n;
+	}
+	RC rc = buildMatrixUnique( A, I.data(), J.data(), V.data(), 2 * n,
+		SEQUENTIAL );
+	rc = rc ? rc : set( x, 1.0 );
+	rc = rc ? rc : set( y, 0.0 );
+	rc = rc ? rc : mxv( y, A, x, ring );
+	rc = rc ? rc : set( z, y );
+	if( rc == SUCCESS ) {
+		const HyperDAG hyperdag = fine.finalize();
+		dag = hyperdag.get();
+		numSources = hyperdag.numSources();
+		numOutputs = hyperdag.numOutputs();
+	}
+	return rc;
+}
+
+void grbProgram( const size_t &n, int &error ) {
+	error = 0;
+	if( !generator.fineGrained().isEnabled() ) {
+		std::cerr << "\t GRB_HYPERDAGS_GRAIN=fine did not enable fine-grained "
+			<< "HyperDAG generation\n";
+		error = 5;
+		return;
+	}
+
+	// test 1: one vertex per element and per nonzero
+	DHypergraph full;
+	size_t sources, outputs;
+	if( run( n, 1, 1.0, full, sources, outputs ) != SUCCESS ) {
+		std::cerr << "\t test 1: unexpected error\n";
+		error = 10;
+		return;
+	}
+	// x, y, z, 2n nonzeroes, 2n products, and n reductions
+	if( full.numVertices() != 8 * n || sources != 4 * n || outputs != n ) {
+		std::cerr << "\t test 1: expected " << 8 * n << " vertices of which "
+			<< 4 * n << " sources and " << n << " outputs, got "
+			<< full.numVertices() << ", " << sources << ", and " << outputs << "\n";
+		error = 11;
+	}
+	// nonzeroes, x, products, and y feed into operations, and so do reductions
+	if( full.numHyperedges() != 7 * n || full.numPins() != 8 * n ) {
+		std::cerr << "\t test 1: expected " << 7 * n << " hyperedges and "
+			<< 8 * n << " pins, got " << full.numHyperedges() << " and "
+			<< full.numPins() << "\n";
+		error = 12;
+	}
+	if( error ) {
+		return;
+	}
+
+	// test 2: blocks of two indices halve the HyperDAG
+	DHypergraph coarse;
+	if( run( n, 2, 1.0, coarse, sources, outputs ) != SUCCESS ) {
+		std::cerr << "\t test 2: unexpected error\n";
+		error = 20;
+		return;
+	}
+	if( coarse.numVertices() != 4 * n || outputs != n / 2 ) {
+		std::cerr << "\t test 2: expected " << 4 * n << " vertices and " << n / 2
+			<< " outputs, got " << coarse.numVertices() << " and " << outputs
+			<< "\n";
+		error = 21;
+		return;
+	}
+
+	// test 3: sampling is deterministic and drops products, not elements
+	DHypergraph sampled, again;
+	if( run( n, 1, 0.5, sampled, sources, outputs ) != SUCCESS ||
+		run( n, 1, 0.5, again, sources, outputs ) != SUCCESS
+	) {
+		std::cerr << "\t test 3: unexpected error\n";
+		error = 30;
+		return;
+	}
+	if( sampled.numVertices() >= full.numVertices() ||
+		sampled.numVertices() < 3 * n
+	) {
+		std::cerr << "\t test 3: sampling half of the nonzeroes yields "
+			<< sampled.numVertices() << " vertices, which is not in [" << 3 * n
+			<< ", " << full.numVertices() << ")\n";
+		error = 31;
+		return;
+	}
+	if( sampled.numVertices() != again.numVertices() ||
+		sampled.numPins() != again.numPins()
+	) {
+		std::cerr << "\t test 3: sampling is not deterministic\n";
+		error = 32;
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = 100;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read < 2 || read % 2 != 0 ) {
+			std::cerr << "Given value for n is not an even integer larger than one\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is 100): an even integer larger than "
+			<< "one.\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	if( setenv( "GRB_HYPERDAGS_GRAIN", "fine", 1 ) != 0 ) {
+		std::cerr << "Could not set environment\n";
+		return 255;
+	}
+	grb::Launcher< AUTOMATIC > launcher;
+	int error;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
@@ -0,0 +1,231 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests that the hyperdags backend streams a well-formed binary HyperDAG to the
+ * file named by <tt>GRB_HYPERDAGS_OUTPUT</tt>, and that it does so while the
+ * computation is ongoing.
+ */
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <stdlib.h> //setenv
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+using namespace grb::internal::hyperdags;
+
+struct input {
+	std::string path;
+	size_t iterations;
+};
+
+void grbProgram( const struct input &in, int &error ) {
+	error = 0;
+	const size_t n = 100;
+	const Semiring<
+		operators::add< double >, operators::mul< double >,
+		identities::zero, identities::one
+	> ring;
+	Vector< double > x( n ), y( n );
+	double alpha = 0.0;
+	RC rc = set( x, 1.0 );
+	for( size_t i = 0; rc == SUCCESS && i < in.iterations; ++i ) {
+		rc = rc ? rc : set( y, x );
+		rc = rc ? rc : dot( alpha, x, y, ring );
+		rc = rc ? rc : set( x, y );
+	}
+	if( rc != SUCCESS ) {
+		std::cerr << "\t unexpected return code " << toString( rc ) << "\n";
+		error = 10;
+		return;
+	}
+
+	// records must have been written before finalisation
+	std::ifstream file( in.path, std::ios::binary | std::ios::ate );
+	if( !file.is_open() ) {
+		std::cerr << "\t could not open " << in.path << " during the computation\n";
+		error = 20;
+		return;
+	}
+	if( static_cast< size_t >( file.tellg() ) <= sizeof( streamMagic ) ) {
+		std::cerr << "\t no records were streamed during the computation\n";
+		error = 21;
+	}
+}
+
+/** Checks the stream at \a path, and returns a nonzero error code if invalid. */
+static int checkStream( const std::string &path ) {
+	std::ifstream file( path, std::ios::binary );
+	char magic[ sizeof( streamMagic ) ];
+	if( !file.read( magic, sizeof( magic ) ) ||
+		memcmp( magic, streamMagic, sizeof( magic ) ) != 0
+	) {
+		std::cerr << "\t stream does not start with the expected magic bytes\n";
+		return 30;
+	}
+	std::vector< uint64_t > words;
+	uint64_t word;
+	while( file.read( reinterpret_cast< char * >( &word ), sizeof( word ) ) ) {
+		words.push_back( word );
+	}
+
+	std::vector< size_t > vertices, sources, pins;
+	size_t kinds[ 3 ] = { 0, 0, 0 };
+	size_t numVertices = 0, numHyperedges = 0, numPins = 0;
+	bool ended = false;
+	for( size_t i = 0; i < words.size(); ) {
+		if( ended ) {
+			std::cerr << "\t records follow the end record\n";
+			return 31;
+		}
+		const uint64_t type = words[ i++ ];
+		if( type == VERTEX_RECORD && i + 4 <= words.size() ) {
+			if( words[ i ] > OUTPUT ) {
+				std::cerr << "\t unknown vertex kind " << words[ i ] << "\n";
+				return 32;
+			}
+			(void) ++kinds[ words[ i ] ];
+			vertices.push_back( words[ i + 3 ] );
+			i += 4;
+		} else if( type == HYPEREDGE_RECORD && i + 2 <= words.size() &&
+			i + 2 + words[ i + 1 ] <= words.size()
+		) {
+			sources.push_back( words[ i ] );
+			pins.insert( pins.end(), words.begin() + i + 2,
+				words.begin() + i + 2 + words[ i + 1 ] );
+			i += 2 + words[ i + 1 ];
+		} else if( type == END_RECORD && i + 3 <= words.size() ) {
+			numVertices = words[ i ];
+			numHyperedges = words[ i + 1 ];
+			numPins = words[ i + 2 ];
+			ended = true;
+			i += 3;
+		} else {
+			std::cerr << "\t malformed record of type " << type << "\n";
+			return 33;
+		}
+	}
+	if( !ended ) {
+		std::cerr << "\t stream is not terminated by an end record\n";
+		return 34;
+	}
+
+	// every vertex is declared exactly once
+	std::vector< bool > seen( numVertices, false );
+	for( const size_t &id : vertices ) {
+		if( id >= numVertices || seen[ id ] ) {
+			std::cerr << "\t vertex " << id << " is out of range or repeated\n";
+			return 35;
+		}
+		seen[ id ] = true;
+	}
+	if( vertices.size() != numVertices ) {
+		std::cerr << "\t expected " << numVertices << " vertices, got "
+			<< vertices.size() << "\n";
+		return 36;
+	}
+	if( kinds[ SOURCE ] == 0 || kinds[ OPERATION ] == 0 || kinds[ OUTPUT ] == 0 ) {
+		std::cerr << "\t expected source, operation, and output vertices\n";
+		return 37;
+	}
+
+	// hyperedges and pins match the totals
+	std::vector< bool > isSource( numVertices, false );
+	size_t distinct = 0;
+	for( const size_t &id : sources ) {
+		if( id >= numVertices ) {
+			std::cerr << "\t hyperedge source " << id << " is out of range\n";
+			return 38;
+		}
+		if( !isSource[ id ] ) {
+			isSource[ id ] = true;
+			(void) ++distinct;
+		}
+	}
+	for( const size_t &id : pins ) {
+		if( id >= numVertices ) {
+			std::cerr << "\t pin " << id << " is out of range\n";
+			return 39;
+		}
+	}
+	if( distinct != numHyperedges || pins.size() != numPins ) {
+		std::cerr << "\t expected " << numHyperedges << " hyperedges and "
+			<< numPins << " pins, got " << distinct << " and " << pins.size() << "\n";
+		return 40;
+	}
+	return 0;
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	struct input in;
+	in.path = "hyperdagStream.bin";
+	in.iterations = 100;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		in.path = argv[ 1 ];
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [file]\n";
+		std::cerr << "  -file (optional, default is hyperdagStream.bin): where to stream "
+			<< "the HyperDAG to.\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	// a small buffer forces records to be written during the computation
+	if( setenv( "GRB_HYPERDAGS_OUTPUT", in.path.c_str(), 1 ) != 0 ||
+		setenv( "GRB_HYPERDAGS_STREAM_BUFFER", "64", 1 ) != 0
+	) {
+		std::cerr << "Could not set environment\n";
+		return 255;
+	}
+	grb::Launcher< AUTOMATIC > launcher;
+	int error;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		error = checkStream( in.path );
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
@@ -0,0 +1,223 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests containers that are placed by first touch, i.e., that are allocated
+ * in #grb::config::ALLOC_MODE::LOCAL mode, with the replication of the input
+ * vectors of vxm and mxv requested. This test must be compiled with
+ * <tt>_GRB_NUMA_FIRST_TOUCH</tt> defined.
+ *
+ * The input vector is large enough to be replicated on systems with more than
+ * one NUMA node, and is modified in between multiplications to check that
+ * the replicas are refreshed.
+ */
+
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include <stdlib.h> // setenv
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+
+typedef Semiring<
+	operators::add< double >, operators::mul< double >,
+	identities::zero, identities::one
+> Ring;
+
+/** The column offsets of the nonzeroes in every row. */
+static const size_t offsets[] = { 0, 1, 7, 1000 };
+
+/** The number of nonzeroes per row. */
+static const size_t per_row = sizeof( offsets ) / sizeof( size_t );
+
+/** The value of the nonzero at \a i, \a j. */
+static double value( const size_t i, const size_t j ) {
+	return static_cast< double >( (i + 2 * j) % 5 ) - 2.0;
+}
+
+/** The value of the input vector at \a i in the given \a round. */
+static double input( const size_t i, const size_t round ) {
+	return static_cast< double >( (i + 3 * round) % 7 ) - 3.0;
+}
+
+/**
+ * Computes y = Ax and y = xA in the given \a round and checks them against
+ * a direct computation.
+ */
+static int multiply(
+	const Matrix< double > &A, Vector< double > &x, const size_t round,
+	const int base
+) {
+	const size_t n = size( x );
+	RC rc = eWiseLambda( [ &x, round ]( const size_t i ) {
+			x[ i ] = input( i, round );
+		}, x );
+	Vector< double > y( n ), z( n );
+	rc = rc ? rc : set( y, 0.0 );
+	rc = rc ? rc : set( z, 0.0 );
+	rc = rc ? rc : mxv( y, A, x, Ring() );
+	rc = rc ? rc : vxm( z, x, A, Ring() );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t round " << round << ": multiplication returns "
+			<< toString( rc ) << "\n";
+		return base + 1;
+	}
+
+	std::vector< double > y_expect( n, 0.0 ), z_expect( n, 0.0 );
+	for( size_t i = 0; i < n; ++i ) {
+		for( const size_t offset : offsets ) {
+			const size_t j = (i + offset) % n;
+			y_expect[ i ] += value( i, j ) * input( j, round );
+			z_expect[ j ] += input( i, round ) * value( i, j );
+		}
+	}
+	for( const auto &pair : y ) {
+		if( pair.second != y_expect[ pair.first ] ) {
+			std::cerr << "\t round " << round << ": ( Ax )_" << pair.first << " is "
+				<< pair.second << ", expected " << y_expect[ pair.first ] << "\n";
+			return base + 2;
+		}
+	}
+	for( const auto &pair : z ) {
+		if( pair.second != z_expect[ pair.first ] ) {
+			std::cerr << "\t round " << round << ": ( xA )_" << pair.first << " is "
+				<< pair.second << ", expected " << z_expect[ pair.first ] << "\n";
+			return base + 3;
+		}
+	}
+	return 0;
+}
+
+void grbProgram( const size_t &n, int &error ) {
+	error = 0;
+
+	if( config::IMPLEMENTATION<>::sharedAllocMode() !=
+		config::ALLOC_MODE::LOCAL
+	) {
+		std::cerr << "\t shared containers are allocated in mode "
+			<< config::toString( config::IMPLEMENTATION<>::sharedAllocMode() )
+			<< ", expected local\n";
+		error = 10;
+		return;
+	}
+	if( !internal::replicationRequested() ) {
+		std::cerr << "\t replication of input vectors was not requested\n";
+		error = 20;
+		return;
+	}
+
+	// the CRS and CCS of a matrix built in parallel are placed after ingestion
+	std::vector< size_t > I, J;
+	std::vector< double > V;
+	for( size_t i = 0; i < n; ++i ) {
+		for( const size_t offset : offsets ) {
+			I.push_back( i );
+			J.push_back( (i + offset) % n );
+			V.push_back( value( i, J.back() ) );
+		}
+	}
+	Matrix< double > A( n, n );
+	RC rc = buildMatrixUnique( A, I.data(), J.data(), V.data(), V.size(),
+		PARALLEL );
+	if( rc != SUCCESS || nnz( A ) != per_row * n ) {
+		std::cerr << "\t buildMatrixUnique returns " << toString( rc ) << " and "
+			<< nnz( A ) << " nonzeroes, expected " << (per_row * n) << "\n";
+		error = 30;
+		return;
+	}
+	for( const auto &triple : A ) {
+		if( triple.second != value( triple.first.first, triple.first.second ) ) {
+			std::cerr << "\t unexpected nonzero ( " << triple.first.first << ", "
+				<< triple.first.second << ", " << triple.second << " )\n";
+			error = 40;
+			return;
+		}
+	}
+
+	Vector< double > x( n );
+	rc = set( x, 0.0 );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t set returns " << toString( rc ) << "\n";
+		error = 45;
+		return;
+	}
+	for( size_t round = 0; error == 0 && round < 3; ++round ) {
+		error = multiply( A, x, round, 50 + 10 * static_cast< int >( round ) );
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = (1 << 17) + 3;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read <= offsets[ per_row - 1 ] ) {
+			std::cerr << "Given value for n is not larger than "
+				<< offsets[ per_row - 1 ] << "\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is " << ((1 << 17) + 3) << "): an "
+			<< "integer larger than " << offsets[ per_row - 1 ] << ".\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+
+	// request replication before the first multiplication reads the setting
+	(void) setenv( "GRB_NUMA_REPLICATE", "1", 1 );
+	grb::Launcher< AUTOMATIC > launcher;
+	int error = 0;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
@@ -0,0 +1,267 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include <graphblas/interfaces/pregel.hpp>
+#include <graphblas/SynchronizedNonzeroIterator.hpp>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+
+typedef grb::interfaces::Aggregator<
+	size_t,
+	grb::Monoid< grb::operators::add< size_t >, grb::identities::zero >
+> SumAggregator;
+
+typedef grb::interfaces::Aggregator<
+	size_t,
+	grb::Monoid<
+		grb::operators::max< size_t >, grb::identities::negative_infinity
+	>
+> MaxAggregator;
+
+/**
+ * A label propagation program that does not vote to halt locally, but only
+ * once the previous round did not change any label anywhere.
+ */
+struct GlobalLabelPropagation {
+
+	struct Data {
+		SumAggregator * changed;
+		MaxAggregator * maximum;
+	};
+
+	static void program(
+		size_t &label,
+		const size_t &incoming,
+		size_t &outgoing,
+		const Data &data,
+		grb::interfaces::PregelState &pregel
+	) {
+		if( pregel.round == 0 ) {
+			label = pregel.vertexID + 1;
+			data.changed->contribute( 1 );
+		} else if( label < incoming ) {
+			label = incoming;
+			data.changed->contribute( 1 );
+		}
+		data.maximum->contribute( label );
+		if( pregel.round > 1 && data.changed->value() == 0 ) {
+			pregel.voteToHalt = true;
+		}
+		outgoing = label;
+	}
+
+};
+
+static int run(
+	grb::interfaces::Pregel< void > &pregel,
+	const grb::interfaces::ExecutionMode mode,
+	const size_t n,
+	const bool check_rounds,
+	const int base
+) {
+	SumAggregator changed;
+	MaxAggregator maximum;
+	const GlobalLabelPropagation::Data data = { &changed, &maximum };
+	std::vector< grb::interfaces::AggregatorBase * > aggregators = {
+		&changed, &maximum
+	};
+
+	Vector< size_t > labels( n ), in( n ), out( n ), out_buffer( 0 );
+	RC rc = set( labels, 0 );
+	size_t rounds = 0;
+	rc = rc ? rc : pregel.execute<
+		grb::operators::max< size_t >,
+		grb::identities::negative_infinity
+	>(
+		&GlobalLabelPropagation::program,
+		labels, data, in, out,
+		rounds, out_buffer, 0, mode, aggregators
+	);
+	if( rc != SUCCESS ) {
+		std::cerr << "\t mode " << mode << ": execute returns "
+			<< toString( rc ) << "\n";
+		return base + 1;
+	}
+
+	// the last round did not change any label, and the maximum label is n
+	if( changed.value() != 0 ) {
+		std::cerr << "\t mode " << mode << ": last round changed "
+			<< changed.value() << " labels, expected none\n";
+		return base + 2;
+	}
+	if( maximum.value() != n ) {
+		std::cerr << "\t mode " << mode << ": maximum label is "
+			<< maximum.value() << ", expected " << n << "\n";
+		return base + 3;
+	}
+
+	// one round to initialise, n - 1 to propagate the maximum along the path,
+	// one to observe no changes, and one to vote to halt
+	if( check_rounds && rounds != n + 2 ) {
+		std::cerr << "\t mode " << mode << ": took " << rounds << " rounds, "
+			<< "expected " << (n + 2) << "\n";
+		return base + 4;
+	}
+
+	for( const auto &pair : labels ) {
+		if( pair.second != n ) {
+			std::cerr << "\t mode " << mode << ": vertex " << pair.first
+				<< " has label " << pair.second << ", expected " << n << "\n";
+			return base + 5;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Runs the asynchronous mode for at most two rounds, which is too few to
+ * terminate, and checks that the labels of both rounds are retained.
+ */
+static int truncated(
+	grb::interfaces::Pregel< void > &pregel,
+	const size_t n,
+	const int base
+) {
+	SumAggregator changed;
+	MaxAggregator maximum;
+	const GlobalLabelPropagation::Data data = { &changed, &maximum };
+	std::vector< grb::interfaces::AggregatorBase * > aggregators = {
+		&changed, &maximum
+	};
+
+	Vector< size_t > labels( n ), in( n ), out( n ), out_buffer( 0 );
+	RC rc = set( labels, 0 );
+	size_t rounds = 0;
+	rc = rc ? rc : pregel.execute<
+		grb::operators::max< size_t >,
+		grb::identities::negative_infinity
+	>(
+		&GlobalLabelPropagation::program,
+		labels, data, in, out,
+		rounds, out_buffer, 2, grb::interfaces::ASYNCHRONOUS, aggregators
+	);
+	if( rc != FAILED ) {
+		std::cerr << "\t truncated: execute returns " << toString( rc ) << ", "
+			<< "expected FAILED\n";
+		return base + 1;
+	}
+	if( rounds != 2 ) {
+		std::cerr << "\t truncated: took " << rounds << " rounds, expected 2\n";
+		return base + 2;
+	}
+
+	// every label was initialised and may only have grown since
+	for( const auto &pair : labels ) {
+		if( pair.second <= pair.first || pair.second > n ) {
+			std::cerr << "\t truncated: vertex " << pair.first << " has label "
+				<< pair.second << ", expected one in ( " << pair.first << ", " << n
+				<< " ]\n";
+			return base + 3;
+		}
+	}
+
+	return 0;
+}
+
+void grbProgram( const size_t &n, int &error ) {
+	error = 0;
+
+	// an undirected path
+	std::vector< size_t > I, J;
+	for( size_t i = 0; i + 1 < n; ++i ) {
+		I.push_back( i ); J.push_back( i + 1 );
+		I.push_back( i + 1 ); J.push_back( i );
+	}
+	grb::interfaces::Pregel< void > pregel(
+		n, n,
+		grb::internal::makeSynchronized( I.data(), J.data(),
+			I.data() + I.size(), J.data() + J.size() ),
+		grb::internal::makeSynchronized( I.data() + I.size(),
+			J.data() + J.size(), I.data() + I.size(), J.data() + J.size() ),
+		SEQUENTIAL
+	);
+
+	error = run( pregel, grb::interfaces::BULK_SYNCHRONOUS, n, true, 10 );
+	if( !error ) {
+		error = run( pregel, grb::interfaces::SPARSE_ACTIVE_SET, n, true, 20 );
+	}
+	if( !error ) {
+		error = run( pregel, grb::interfaces::ASYNCHRONOUS, n, false, 30 );
+	}
+	if( !error ) {
+		error = truncated( pregel, n, 40 );
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = 100;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read < 2 ) {
+			std::cerr << "Given value for n is smaller than two\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is 100): an integer larger than one.\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	grb::Launcher< AUTOMATIC > launcher;
+	int error;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
@@ -0,0 +1,203 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests that every round of the ALP/Pregel sparse active-set mode executes
+ * exactly the vertices that hold a message, and that the incoming and outgoing
+ * message vectors only hold entries for those vertices, across rounds that
+ * operate on both dense and sparse vectors.
+ */
+
+#include <atomic>
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include <graphblas/interfaces/pregel.hpp>
+#include <graphblas/SynchronizedNonzeroIterator.hpp>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+
+/**
+ * Vertex \f$ i \f$ broadcasts during rounds \f$ 0, 1, \ldots, i - 1 \f$, and
+ * votes to halt from round \f$ i \f$ on. Every vertex records the last round
+ * it executed in, and every execution is counted per round.
+ */
+struct Countdown {
+
+	struct Data {
+		std::atomic< size_t > * executions;
+	};
+
+	static void program(
+		size_t &last,
+		const size_t &incoming,
+		size_t &outgoing,
+		const Data &data,
+		grb::interfaces::PregelState &pregel
+	) {
+		(void) incoming;
+		(void) ++data.executions[ pregel.round ];
+		last = pregel.round;
+		outgoing = 1;
+		if( pregel.round >= pregel.vertexID ) {
+			pregel.voteToHalt = true;
+		}
+	}
+
+};
+
+void grbProgram( const size_t &n, int &error ) {
+	error = 0;
+
+	// an undirected path
+	std::vector< size_t > I, J;
+	for( size_t i = 0; i + 1 < n; ++i ) {
+		I.push_back( i ); J.push_back( i + 1 );
+		I.push_back( i + 1 ); J.push_back( i );
+	}
+	grb::interfaces::Pregel< void > pregel(
+		n, n,
+		grb::internal::makeSynchronized( I.data(), J.data(),
+			I.data() + I.size(), J.data() + J.size() ),
+		grb::internal::makeSynchronized( I.data() + I.size(),
+			J.data() + J.size(), I.data() + I.size(), J.data() + J.size() ),
+		SEQUENTIAL
+	);
+
+	std::vector< std::atomic< size_t > > executions( n + 1 );
+	for( auto &count : executions ) {
+		count = 0;
+	}
+	const Countdown::Data data = { executions.data() };
+	Vector< size_t > last( n ), in( n ), out( n ), out_buffer( 0 );
+	RC rc = set( last, 0 );
+	size_t rounds = 0;
+	rc = rc ? rc : pregel.execute<
+		grb::operators::max< size_t >,
+		grb::identities::negative_infinity
+	>(
+		&Countdown::program,
+		last, data, in, out,
+		rounds, out_buffer, n + 1, grb::interfaces::SPARSE_ACTIVE_SET
+	);
+	if( rc != SUCCESS ) {
+		std::cerr << "\t execute returns " << toString( rc ) << "\n";
+		error = 10;
+		return;
+	}
+
+	// during round r > 0, vertex i executes if it or one of its neighbours
+	// broadcast during round r - 1, that is, if i >= r - 1; vertex n - 1 is the
+	// last to vote to halt, during round n - 1
+	if( rounds != n ) {
+		std::cerr << "\t took " << rounds << " rounds, expected " << n << "\n";
+		error = 20;
+		return;
+	}
+	for( size_t round = 0; round <= n; ++round ) {
+		size_t count = executions[ round ];
+		if( collectives<>::allreduce( count,
+			grb::operators::add< size_t >() ) != SUCCESS
+		) {
+			std::cerr << "\t allreduce FAILED\n";
+			error = 30;
+			return;
+		}
+		const size_t expected = round == 0 ? n : (round < n ? n - round + 1 : 0);
+		if( count != expected ) {
+			std::cerr << "\t " << count << " vertices executed during round "
+				<< round << ", expected " << expected << "\n";
+			error = 31;
+			return;
+		}
+	}
+	for( const auto &pair : last ) {
+		const size_t expected = pair.first + 1 < n ? pair.first + 1 : n - 1;
+		if( pair.second != expected ) {
+			std::cerr << "\t vertex " << pair.first << " last executed during round "
+				<< pair.second << ", expected " << expected << "\n";
+			error = 40;
+			return;
+		}
+	}
+
+	// only the two vertices that executed during the last round hold messages
+	if( nnz( in ) != 2 || nnz( out ) != 2 ) {
+		std::cerr << "\t after the last round, the incoming messages have "
+			<< nnz( in ) << " entries and the outgoing messages " << nnz( out )
+			<< ", expected two each\n";
+		error = 50;
+		return;
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = 100;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read < 2 ) {
+			std::cerr << "Given value for n is smaller than two\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is 100): an integer larger than one.\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	grb::Launcher< AUTOMATIC > launcher;
+	int error;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
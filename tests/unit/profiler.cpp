@@ -0,0 +1,188 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests that the profile backend counts calls to primitives and estimates
+ * their work, and that it reports the results per primitive.
+ */
+
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+using namespace grb::internal::profile;
+
+void grbProgram( const size_t &n, int &error ) {
+	error = 0;
+	Vector< double > x( n ), y( n );
+	Matrix< double > A( n, n, n );
+	std::vector< size_t > I( n );
+	std::vector< double > V( n, 1.0 );
+	for( size_t i = 0; i < n; ++i ) {
+		I[ i ] = i;
+	}
+	profiler.clear();
+
+	// test 1: successful calls are counted, with their work
+	const Semiring<
+		operators::add< double >, operators::mul< double >,
+		identities::zero, identities::one
+	> ring;
+	double alpha = 0.0;
+	RC rc = set( x, 1.0 );
+	rc = rc ? rc : buildMatrixUnique( A, I.data(), I.data(), V.data(), n,
+		SEQUENTIAL );
+	rc = rc ? rc : dot( alpha, x, x, ring );
+	rc = rc ? rc : mxv( y, A, x, ring, grb::RESIZE );
+	rc = rc ? rc : mxv( y, A, x, ring );
+	rc = rc ? rc : mxv( y, A, x, ring );
+	rc = rc ? rc : wait();
+	if( rc != SUCCESS ) {
+		std::cerr << "\t test 1: unexpected return code " << toString( rc ) << "\n";
+		error = 10;
+		return;
+	}
+	const Counters sets = profiler.total( SET );
+	const Counters builds = profiler.total( BUILD_MATRIX_UNIQUE );
+	const Counters dots = profiler.total( DOT );
+	const Counters mxvs = profiler.total( MXV );
+	if( sets.calls != 1 || builds.calls != 1 || dots.calls != 1 ) {
+		std::cerr << "\t test 1: unexpected call counts " << sets.calls << ", "
+			<< builds.calls << ", " << dots.calls << "\n";
+		error = 11;
+	}
+	if( mxvs.calls != 2 ) {
+		std::cerr << "\t test 1: resize phases should not be counted, but "
+			<< mxvs.calls << " calls to mxv were\n";
+		error = 12;
+	}
+	if( !Properties< _GRB_WITH_PROFILE_USING >::isNonblockingExecution ) {
+		if( dots.nonzeroes != 2 * n || dots.flops != 2 * n ||
+			dots.bytes != 2 * n * sizeof( double )
+		) {
+			std::cerr << "\t test 1: unexpected work estimates for dot: "
+				<< dots.nonzeroes << " nonzeroes, " << dots.flops << " flops, "
+				<< dots.bytes << " bytes\n";
+			error = 13;
+		}
+		if( mxvs.nonzeroes != 2 * 3 * n || mxvs.flops != 2 * 2 * n ) {
+			std::cerr << "\t test 1: unexpected work estimates for mxv: "
+				<< mxvs.nonzeroes << " nonzeroes, " << mxvs.flops << " flops\n";
+			error = 14;
+		}
+		if( builds.flops != 0 || builds.nonzeroes != n ) {
+			std::cerr << "\t test 1: unexpected work estimates for "
+				<< "buildMatrixUnique: " << builds.nonzeroes << " nonzeroes, "
+				<< builds.flops << " flops\n";
+			error = 15;
+		}
+	}
+	if( error ) {
+		return;
+	}
+
+	// test 2: failing calls are not counted
+	Vector< double > z( n + 1 );
+	if( grb::dot( alpha, x, z, ring ) != MISMATCH ) {
+		std::cerr << "\t test 2: expected a mismatch\n";
+		error = 20;
+		return;
+	}
+	if( profiler.total( DOT ).calls != 1 ) {
+		std::cerr << "\t test 2: a failing call was counted\n";
+		error = 21;
+		return;
+	}
+
+	// test 3: the report lists all called primitives
+	std::ostringstream report;
+	profiler.report( report );
+	const std::string text = report.str();
+	if( text.find( "dot" ) == std::string::npos ||
+		text.find( "mxv" ) == std::string::npos ||
+		text.find( "buildMatrixUnique" ) == std::string::npos ||
+		text.find( "(all call sites)" ) == std::string::npos
+	) {
+		std::cerr << "\t test 3: incomplete report:\n" << text;
+		error = 30;
+		return;
+	}
+
+	// test 4: clearing resets all counters
+	profiler.clear();
+	if( profiler.total( DOT ).calls != 0 || profiler.total( MXV ).calls != 0 ) {
+		std::cerr << "\t test 4: counters were not cleared\n";
+		error = 40;
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = 1000;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read < 2 ) {
+			std::cerr << "Given value for n is smaller than two\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is 1000): an integer larger than one.\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	grb::Launcher< AUTOMATIC > launcher;
+	int error;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
@@ -0,0 +1,231 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests that #grb::Replay eliminates dead stages, reorders the remaining ones
+ * such that fusable stages form a single run, and re-executes them correctly
+ * on new inputs.
+ */
+
+#include <cmath>
+#include <sstream>
+#include <iostream>
+
+#include "graphblas.hpp"
+#include "graphblas/replay.hpp"
+
+
+using namespace grb;
+
+/** Checks that w = 4x and alpha = x^T x, for x = c. */
+static int check(
+	const Vector< double > &w, const double alpha, const double c,
+	const size_t n
+) {
+	if( nnz( w ) != n ) {
+		std::cerr << "\t expected " << n << " nonzeroes, got " << nnz( w ) << "\n";
+		return 1;
+	}
+	for( const auto &pair : w ) {
+		if( pair.second != 4 * c ) {
+			std::cerr << "\t expected w[ " << pair.first << " ] = " << 4 * c
+				<< ", got " << pair.second << "\n";
+			return 2;
+		}
+	}
+	if( std::fabs( alpha - n * c * c ) > 1e-10 * n * c * c ) {
+		std::cerr << "\t expected alpha = " << n * c * c << ", got " << alpha << "\n";
+		return 3;
+	}
+	return 0;
+}
+
+void grbProgram( const size_t &n, int &error ) {
+	error = 0;
+	const Semiring<
+		operators::add< double >, operators::mul< double >,
+		identities::zero, identities::one
+	> ring;
+	const operators::add< double > plus;
+	Vector< double > x( n ), y( n ), z( n ), t( n ), w( n );
+	double alpha = 0.0;
+
+	// record w = 4x and alpha = x^T x, with a dead temporary t, and a barrier
+	// between two fusable stages
+	Replay replay;
+	RC rc = replay.record( Replay::FUSABLE,
+		[ &y, &x ]() { return set( y, x ); }, { &x }, { &y } );
+	rc = rc ? rc : replay.record( Replay::FUSABLE,
+		[ &t, &x ]() { return set( t, x ); }, { &x }, { &t } );
+	rc = rc ? rc : replay.record( Replay::BARRIER,
+		[ &alpha, &x, &ring ]() {
+			alpha = 0.0;
+			return dot( alpha, x, x, ring );
+		}, { &x }, { &alpha } );
+	rc = rc ? rc : replay.record( Replay::FUSABLE,
+		[ &y, &x, &plus ]() { return foldl( y, x, plus ); }, { &y, &x }, { &y } );
+	rc = rc ? rc : replay.record( Replay::FUSABLE,
+		[ &z, &y ]() { return set( z, y ); }, { &y }, { &z } );
+	rc = rc ? rc : replay.record( Replay::FUSABLE,
+		[ &w, &z, &y, &plus ]() { return eWiseApply( w, z, y, plus ); },
+		{ &z, &y }, { &w } );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t unexpected return code " << toString( rc ) << "\n";
+		error = 5;
+		return;
+	}
+
+	// test 1: without optimisation, stages execute as recorded
+	rc = set( x, 1.0 );
+	rc = rc ? rc : replay.execute();
+	rc = rc ? rc : wait();
+	if( rc != SUCCESS ) {
+		std::cerr << "\t test 1: unexpected return code " << toString( rc ) << "\n";
+		error = 10;
+		return;
+	}
+	if( replay.numScheduled() != 6 || replay.numFusedGroups() != 2 ) {
+		std::cerr << "\t test 1: expected 6 stages in 2 groups, got "
+			<< replay.numScheduled() << " stages in " << replay.numFusedGroups()
+			<< " groups\n";
+		error = 11;
+		return;
+	}
+	error = check( w, alpha, 1.0, n );
+	if( error ) {
+		error += 11;
+		return;
+	}
+
+	// test 2: optimisation removes the dead stage and delays the barrier
+	rc = replay.optimise( { &w, &alpha } );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t test 2: unexpected return code " << toString( rc ) << "\n";
+		error = 20;
+		return;
+	}
+	const size_t expected[ 5 ] = { 0, 3, 4, 5, 2 };
+	if( replay.numScheduled() != 5 || replay.numFusedGroups() != 1 ) {
+		std::cerr << "\t test 2: expected 5 stages in 1 group, got "
+			<< replay.numScheduled() << " stages in " << replay.numFusedGroups()
+			<< " groups\n";
+		error = 21;
+		return;
+	}
+	for( size_t k = 0; k < 5; ++k ) {
+		if( replay.scheduled( k ) != expected[ k ] ) {
+			std::cerr << "\t test 2: expected stage " << expected[ k ] << " at "
+				<< "position " << k << ", got " << replay.scheduled( k ) << "\n";
+			error = 22;
+			return;
+		}
+	}
+
+	// test 3: the optimised recording computes the same on new inputs, and does
+	//         not touch the dead temporary
+	rc = clear( t );
+	rc = rc ? rc : set( x, 2.0 );
+	rc = rc ? rc : replay.execute();
+	rc = rc ? rc : wait();
+	if( rc != SUCCESS ) {
+		std::cerr << "\t test 3: unexpected return code " << toString( rc ) << "\n";
+		error = 30;
+		return;
+	}
+	error = check( w, alpha, 2.0, n );
+	if( error ) {
+		error += 30;
+		return;
+	}
+	if( nnz( t ) != 0 ) {
+		std::cerr << "\t test 3: the dead stage was executed\n";
+		error = 34;
+		return;
+	}
+
+	// test 4: execution stops at the first failing stage
+	Vector< double > small( n - 1 );
+	bool called = false;
+	rc = replay.record( Replay::FUSABLE,
+		[ &small, &x ]() { return set( small, x ); }, { &x }, { &small } );
+	rc = rc ? rc : replay.record( Replay::FUSABLE,
+		[ &called ]() { called = true; return SUCCESS; }, { &small }, {} );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t test 4: unexpected return code " << toString( rc ) << "\n";
+		error = 40;
+		return;
+	}
+	rc = replay.execute();
+	if( rc != MISMATCH || called ) {
+		std::cerr << "\t test 4: expected a mismatch that stops execution, got "
+			<< toString( rc ) << "\n";
+		error = 41;
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = 1000;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read < 2 ) {
+			std::cerr << "Given value for n is smaller than two\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is 1000): an integer larger than one.\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	grb::Launcher< AUTOMATIC > launcher;
+	int error;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
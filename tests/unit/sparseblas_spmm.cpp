@@ -0,0 +1,230 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests the sparse matrix times dense block multiplications of the SparseBLAS
+ * and SpBLAS transition path interfaces, #BLAS_dusmm and #spblas_dcsrmm,
+ * against a dense reference computation.
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <iostream>
+
+#include "blas_sparse.h"
+#include "spblas.h"
+
+
+static const int m = 43;
+static const int k = 29;
+static const int nrhs = 4;
+
+/** The value of the nonzero at (i, j), or zero if there is none. */
+static double entry( const int i, const int j ) {
+	if( (5 * i + 3 * j) % 7 == 0 || i == j ) {
+		return static_cast< double >( (2 * i + j) % 9 ) - 4.0;
+	}
+	return 0.0;
+}
+
+/**
+ * Allocates the dense blocks B and C of the given orientation, pads their
+ * leading dimensions, and computes the expected result of
+ * C = beta C + alpha op(A) B. A zero \a beta overwrites C, which is
+ * initialised with NaNs in that case to check that its contents are ignored.
+ */
+static void prepare(
+	const bool transposed, const bool row_major,
+	const double alpha, const double beta,
+	std::vector< double > &B, int &ldb,
+	std::vector< double > &C, int &ldc,
+	std::vector< double > &expect
+) {
+	const int rows = transposed ? k : m;
+	const int inner = transposed ? m : k;
+	ldb = (row_major ? nrhs : inner) + 3;
+	ldc = (row_major ? nrhs : rows) + 2;
+	B.resize( ldb * (row_major ? inner : nrhs) );
+	C.resize( ldc * (row_major ? rows : nrhs) );
+	expect.resize( C.size() );
+	for( size_t l = 0; l < B.size(); ++l ) {
+		B[ l ] = static_cast< double >( l % 7 ) - 3.0;
+	}
+	for( size_t l = 0; l < C.size(); ++l ) {
+		C[ l ] = expect[ l ] = static_cast< double >( l % 5 );
+	}
+	for( int i = 0; i < rows; ++i ) {
+		for( int r = 0; r < nrhs; ++r ) {
+			double sum = 0;
+			for( int j = 0; j < inner; ++j ) {
+				const double a = transposed ? entry( j, i ) : entry( i, j );
+				sum += a * B[ row_major ? j * ldb + r : j + r * ldb ];
+			}
+			const int c = row_major ? i * ldc + r : i + r * ldc;
+			if( beta == 0.0 ) {
+				C[ c ] = std::numeric_limits< double >::quiet_NaN();
+				expect[ c ] = alpha * sum;
+			} else {
+				expect[ c ] = beta * expect[ c ] + alpha * sum;
+			}
+		}
+	}
+}
+
+/** Compares the computed block against the expected one. */
+static int compare(
+	const std::vector< double > &C, const std::vector< double > &expect,
+	const int error
+) {
+	for( size_t l = 0; l < C.size(); ++l ) {
+		if( !(std::fabs( C[ l ] - expect[ l ] ) <= 1e-12) ) {
+			std::cerr << "\t at offset " << l << ": got " << C[ l ] << ", expected "
+				<< expect[ l ] << "\n";
+			return error;
+		}
+	}
+	return 0;
+}
+
+/** Tests #BLAS_dusmm for both orders, both transposition modes, and several
+ *  values of alpha. */
+static int testDusmm() {
+	blas_sparse_matrix A = BLAS_duscr_begin( m, k );
+	for( int i = 0; i < m; ++i ) {
+		for( int j = 0; j < k; ++j ) {
+			if( entry( i, j ) != 0.0 &&
+				BLAS_duscr_insert_entry( A, entry( i, j ), i, j ) != 0
+			) {
+				std::cerr << "\t BLAS_duscr_insert_entry FAILED\n";
+				return 10;
+			}
+		}
+	}
+	if( BLAS_duscr_end( A ) != 0 ) {
+		std::cerr << "\t BLAS_duscr_end FAILED\n";
+		return 20;
+	}
+
+	int error = 0;
+	for( const bool row_major : { true, false } ) {
+		for( const bool transposed : { false, true } ) {
+			for( const double alpha : { 1.0, -1.5, 0.0 } ) {
+				std::vector< double > B, C, expect;
+				int ldb, ldc;
+				prepare( transposed, row_major, alpha, 1.0, B, ldb, C, ldc, expect );
+				if( BLAS_dusmm(
+						row_major ? blas_rowmajor : blas_colmajor,
+						transposed ? blas_trans : blas_no_trans,
+						nrhs, alpha, A, B.data(), ldb, C.data(), ldc
+					) != 0
+				) {
+					std::cerr << "\t BLAS_dusmm FAILED\n";
+					error = 30;
+				} else {
+					error = compare( C, expect, 40 );
+				}
+				if( error ) {
+					std::cerr << "\t BLAS_dusmm with "
+						<< (row_major ? "row" : "column") << "-major blocks, "
+						<< (transposed ? "" : "no ") << "transposition, and alpha "
+						<< alpha << "\n";
+					(void) BLAS_usds( A );
+					return error;
+				}
+			}
+		}
+	}
+	if( BLAS_usds( A ) != 0 ) {
+		std::cerr << "\t BLAS_usds FAILED\n";
+		return 50;
+	}
+	return 0;
+}
+
+/** Tests #spblas_dcsrmm for zero- and one-based input, both transposition
+ *  modes, and several values of beta. */
+static int testDcsrmm() {
+	// the CRS arrays of A, zero-based and one-based
+	std::vector< int > ptr0( 1, 0 ), ptr1( 1, 1 ), ind0, ind1;
+	std::vector< double > val;
+	for( int i = 0; i < m; ++i ) {
+		for( int j = 0; j < k; ++j ) {
+			if( entry( i, j ) != 0.0 ) {
+				ind0.push_back( j );
+				ind1.push_back( j + 1 );
+				val.push_back( entry( i, j ) );
+			}
+		}
+		ptr0.push_back( static_cast< int >( val.size() ) );
+		ptr1.push_back( static_cast< int >( val.size() ) + 1 );
+	}
+
+	const double alpha = -1.5;
+	for( const bool one_based : { false, true } ) {
+		// one-based indexing implies column-major blocks
+		const bool row_major = !one_based;
+		const char matdescra[] = { 'G', 'L', 'N', one_based ? 'F' : 'C' };
+		const std::vector< int > &ptr = one_based ? ptr1 : ptr0;
+		const std::vector< int > &ind = one_based ? ind1 : ind0;
+		for( const bool transposed : { false, true } ) {
+			for( const double beta : { 1.0, 0.5, 0.0 } ) {
+				std::vector< double > B, C, expect;
+				int ldb, ldc;
+				prepare( transposed, row_major, alpha, beta, B, ldb, C, ldc,
+					expect );
+				spblas_dcsrmm( transposed ? "T" : "N", &m, &nrhs, &k, &alpha,
+					matdescra, val.data(), ind.data(), ptr.data(), ptr.data() + 1,
+					B.data(), &ldb, &beta, C.data(), &ldc );
+				const int error = compare( C, expect, 60 );
+				if( error ) {
+					std::cerr << "\t spblas_dcsrmm with "
+						<< (one_based ? "one" : "zero") << "-based input, "
+						<< (transposed ? "" : "no ") << "transposition, and beta "
+						<< beta << "\n";
+					return error;
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+int main( int argc, char ** argv ) {
+	(void) argc;
+	std::cout << "Functional test executable: " << argv[ 0 ] << "\n";
+
+	int error = testDusmm();
+	if( !error ) {
+		error = testDcsrmm();
+	}
+	if( EXTBLAS_free() != 0 ) {
+		std::cerr << "\t EXTBLAS_free FAILED\n";
+		error = error ? error : 70;
+	}
+
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+	return error;
+}
+
@@ -0,0 +1,227 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests the SparseBLAS triangular solve, #BLAS_dussv, against a dense
+ * reference computation. This covers the deduction of the triangle and of the
+ * diagonal type from the nonzero structure, the reuse of the cached level-set
+ * schedule, and its invalidation once the matrix is cleared via
+ * #EXTBLAS_dusm_clear and refilled with a different triangle.
+ */
+
+#include <cmath>
+#include <vector>
+#include <iostream>
+
+#include "blas_sparse.h"
+
+
+static const int n = 37;
+
+/** The scalar the solutions are multiplied with. */
+static const double alpha = 2.0;
+
+/**
+ * The value of the nonzero at (i, j) of a lower triangular matrix, or zero if
+ * there is none. If \a unit is true, no diagonal is stored.
+ */
+static double lower( const int i, const int j, const bool unit ) {
+	if( i == j ) {
+		return unit ? 0.0 : 2.0 + static_cast< double >( i % 3 );
+	}
+	if( j < i && (3 * i + 5 * j) % 4 == 0 ) {
+		return 0.25 * (static_cast< double >( (i + j) % 5 ) - 2.0);
+	}
+	return 0.0;
+}
+
+/** The value of the nonzero at (i, j) of an upper triangular matrix. */
+static double upper( const int i, const int j ) {
+	if( i == j ) {
+		return 3.0 - static_cast< double >( i % 2 );
+	}
+	if( i < j && (i + 2 * j) % 3 == 0 ) {
+		return 0.5 - 0.125 * static_cast< double >( (i * j) % 7 );
+	}
+	return 0.0;
+}
+
+/** Creates a finalised SparseBLAS matrix from a dense one. */
+static blas_sparse_matrix create( const std::vector< double > &dense ) {
+	blas_sparse_matrix A = BLAS_duscr_begin( n, n );
+	for( int i = 0; i < n; ++i ) {
+		for( int j = 0; j < n; ++j ) {
+			if( dense[ i * n + j ] != 0.0 ) {
+				(void) BLAS_duscr_insert_entry( A, dense[ i * n + j ], i, j );
+			}
+		}
+	}
+	(void) BLAS_duscr_end( A );
+	return A;
+}
+
+/**
+ * Solves alpha op(T)^{-1} b by dense substitution, where op(T) is lower or
+ * upper triangular. A zero diagonal is taken to be all ones.
+ */
+static std::vector< double > solve(
+	const std::vector< double > &T, const bool transposed,
+	const std::vector< double > &b
+) {
+	const auto at = [ &T, transposed ]( const int i, const int j ) {
+		return transposed ? T[ j * n + i ] : T[ i * n + j ];
+	};
+	bool is_lower = true;
+	for( int i = 0; i < n; ++i ) {
+		for( int j = i + 1; j < n; ++j ) {
+			is_lower = is_lower && at( i, j ) == 0.0;
+		}
+	}
+	std::vector< double > x( b );
+	for( int l = 0; l < n; ++l ) {
+		const int i = is_lower ? l : n - 1 - l;
+		for( int j = 0; j < n; ++j ) {
+			if( j != i ) {
+				x[ i ] -= at( i, j ) * x[ j ];
+			}
+		}
+		if( at( i, i ) != 0.0 ) {
+			x[ i ] /= at( i, i );
+		}
+	}
+	for( int i = 0; i < n; ++i ) {
+		x[ i ] *= alpha;
+	}
+	return x;
+}
+
+/**
+ * Solves with the given SparseBLAS matrix and compares the result against
+ * the dense reference.
+ */
+static int check(
+	const blas_sparse_matrix A, const std::vector< double > &dense,
+	const bool transposed, const int shift, const int error
+) {
+	std::vector< double > b( n );
+	for( int i = 0; i < n; ++i ) {
+		b[ i ] = static_cast< double >( (i + shift) % 7 ) - 3.0;
+	}
+	const std::vector< double > expect = solve( dense, transposed, b );
+	std::vector< double > x( b );
+	if( BLAS_dussv( transposed ? blas_trans : blas_no_trans, alpha, A,
+		x.data(), 1 ) != 0
+	) {
+		std::cerr << "\t BLAS_dussv FAILED\n";
+		return error;
+	}
+	for( int i = 0; i < n; ++i ) {
+		if( !(std::fabs( x[ i ] - expect[ i ] ) <= 1e-10) ) {
+			std::cerr << "\t at index " << i << ": got " << x[ i ] << ", expected "
+				<< expect[ i ] << "\n";
+			return error + 1;
+		}
+	}
+	return 0;
+}
+
+int main( int argc, char ** argv ) {
+	(void) argc;
+	std::cout << "Functional test executable: " << argv[ 0 ] << "\n";
+
+	std::vector< double > L( n * n ), U( n * n ), I( n * n ), Z( n * n, 0.0 );
+	std::vector< double > unitL( n * n );
+	for( int i = 0; i < n; ++i ) {
+		for( int j = 0; j < n; ++j ) {
+			L[ i * n + j ] = lower( i, j, false );
+			unitL[ i * n + j ] = lower( i, j, true );
+			U[ i * n + j ] = upper( i, j );
+			I[ i * n + j ] = i == j ? 1.0 : 0.0;
+		}
+	}
+	blas_sparse_matrix A = create( L );
+	blas_sparse_matrix B = create( unitL );
+	blas_sparse_matrix C = create( U );
+	blas_sparse_matrix D = create( I );
+
+	int error = 0;
+
+	// lower non-unit, where the second solve reuses the cached schedule, and
+	// the transposed solve replaces it
+	std::cerr << "\t testing a lower triangular matrix\n";
+	error = check( A, L, false, 0, 10 );
+	if( !error ) { error = check( A, L, false, 3, 20 ); }
+	if( !error ) { error = check( A, L, true, 0, 30 ); }
+	if( !error ) { error = check( A, L, false, 5, 40 ); }
+
+	// lower with an implicit unit diagonal
+	if( !error ) {
+		std::cerr << "\t testing a lower triangular matrix with a unit diagonal\n";
+		error = check( B, unitL, false, 1, 50 );
+	}
+	if( !error ) { error = check( B, unitL, true, 1, 60 ); }
+
+	// upper non-unit
+	if( !error ) {
+		std::cerr << "\t testing an upper triangular matrix\n";
+		error = check( C, U, false, 2, 70 );
+	}
+	if( !error ) { error = check( C, U, true, 2, 80 ); }
+
+	// a cleared matrix has no nonzeroes, and hence is the identity; the
+	// schedule of the lower triangular matrix must not be reused
+	if( !error ) {
+		std::cerr << "\t testing a cleared matrix\n";
+		if( EXTBLAS_dusm_clear( A ) != 0 ) {
+			std::cerr << "\t EXTBLAS_dusm_clear FAILED\n";
+			error = 90;
+		}
+	}
+	if( !error ) { error = check( A, Z, false, 4, 100 ); }
+
+	// refill the cleared matrix with the upper triangle, as A = U I
+	if( !error ) {
+		std::cerr << "\t testing a cleared matrix refilled with another triangle\n";
+		if( EXTBLAS_dusm_clear( A ) != 0 ||
+			EXTBLAS_dusmsm( blas_no_trans, 1.0, C, blas_no_trans, D, A ) != 0
+		) {
+			std::cerr << "\t refilling the cleared matrix FAILED\n";
+			error = 110;
+		}
+	}
+	if( !error ) { error = check( A, U, false, 6, 120 ); }
+	if( !error ) { error = check( A, U, true, 6, 130 ); }
+
+	for( const blas_sparse_matrix X : { A, B, C, D } ) {
+		(void) BLAS_usds( X );
+	}
+	if( EXTBLAS_free() != 0 ) {
+		std::cerr << "\t EXTBLAS_free FAILED\n";
+		error = error ? error : 140;
+	}
+
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+	return error;
+}
+
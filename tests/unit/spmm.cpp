@@ -0,0 +1,176 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <vector>
+#include <iostream>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+
+typedef grb::Semiring<
+	grb::operators::add< double >, grb::operators::mul< double >,
+	grb::identities::zero, grb::identities::one
+> Ring;
+
+static const size_t m = 97;
+static const size_t k = 61;
+static const size_t nrhs = 5;
+
+/** The value of the nonzero at (i, j), or zero if there is none. */
+static double entry( const size_t i, const size_t j ) {
+	if( (3 * i + 7 * j) % 11 == 0 || i == j ) {
+		return static_cast< double >( (i + 2 * j) % 13 ) - 6.0;
+	}
+	return 0.0;
+}
+
+/**
+ * Computes C = C + alpha op(A) B using the internal SpMM kernel, and compares
+ * the result against a dense reference computation.
+ */
+template< Descriptor descr >
+static int check(
+	const Matrix< double > &A, const bool row_major, const double alpha,
+	const int error_base
+) {
+	constexpr bool transposed = descr & descriptors::transpose_matrix;
+	const size_t rows = transposed ? k : m;
+	const size_t inner = transposed ? m : k;
+	// pad the leading dimensions to check they are taken into account
+	const size_t ldb = (row_major ? nrhs : inner) + 3;
+	const size_t ldc = (row_major ? nrhs : rows) + 2;
+	const size_t b_size = ldb * (row_major ? inner : nrhs);
+	const size_t c_size = ldc * (row_major ? rows : nrhs);
+	std::vector< double > B( b_size ), C( c_size ), expect( c_size );
+	for( size_t l = 0; l < b_size; ++l ) {
+		B[ l ] = static_cast< double >( l % 7 ) - 3.0;
+	}
+	for( size_t l = 0; l < c_size; ++l ) {
+		C[ l ] = expect[ l ] = static_cast< double >( l % 5 );
+	}
+	for( size_t i = 0; i < rows; ++i ) {
+		for( size_t r = 0; r < nrhs; ++r ) {
+			double sum = 0;
+			for( size_t j = 0; j < inner; ++j ) {
+				const double a = transposed ? entry( j, i ) : entry( i, j );
+				sum += a * B[ row_major ? j * ldb + r : j + r * ldb ];
+			}
+			expect[ row_major ? i * ldc + r : i + r * ldc ] += alpha * sum;
+		}
+	}
+
+	RC rc = internal::spmm< descr >( C.data(), ldc, A, B.data(), ldb, nrhs,
+		row_major, alpha, Ring() );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t unexpected return code " << toString( rc ) << "\n";
+		return error_base;
+	}
+	for( size_t l = 0; l < c_size; ++l ) {
+		if( std::fabs( C[ l ] - expect[ l ] ) > 1e-12 ) {
+			std::cerr << "\t at offset " << l << ": got " << C[ l ] << ", expected "
+				<< expect[ l ] << "\n";
+			return error_base + 1;
+		}
+	}
+
+	// too small a leading dimension is illegal
+	rc = internal::spmm< descr >( C.data(), row_major ? nrhs - 1 : rows - 1, A,
+		B.data(), ldb, nrhs, row_major, alpha, Ring() );
+	if( rc != ILLEGAL ) {
+		std::cerr << "\t unexpected return code " << toString( rc )
+			<< " for an illegal leading dimension\n";
+		return error_base + 2;
+	}
+	return 0;
+}
+
+void grbProgram( const void *, const size_t in_size, int &error ) {
+	error = 0;
+
+	if( in_size != 0 ) {
+		(void)fprintf( stderr, "Unit tests called with unexpected input\n" );
+		error = 1;
+		return;
+	}
+
+	std::vector< size_t > I, J;
+	std::vector< double > V;
+	for( size_t i = 0; i < m; ++i ) {
+		for( size_t j = 0; j < k; ++j ) {
+			if( entry( i, j ) != 0.0 ) {
+				I.push_back( i ); J.push_back( j ); V.push_back( entry( i, j ) );
+			}
+		}
+	}
+	Matrix< double > A( m, k );
+	RC rc = buildMatrixUnique( A, I.data(), J.data(), V.data(), V.size(),
+		SEQUENTIAL );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t initialisation FAILED\n";
+		error = 5;
+		return;
+	}
+
+	for( const bool row_major : { true, false } ) {
+		const int offset = row_major ? 0 : 50;
+		std::cerr << "\t testing with " << (row_major ? "row" : "column")
+			<< "-major blocks\n";
+		error = check< descriptors::no_operation >(
+			A, row_major, 1.0, offset + 10 );
+		if( !error ) {
+			error = check< descriptors::transpose_matrix >(
+				A, row_major, -2.5, offset + 20 );
+		}
+		if( !error ) {
+			error = check< descriptors::force_row_major >(
+				A, row_major, 0.5, offset + 30 );
+		}
+		if( !error ) {
+			error = check<
+				descriptors::transpose_matrix | descriptors::force_row_major
+			>( A, row_major, -2.5, offset + 40 );
+		}
+		if( error ) {
+			return;
+		}
+	}
+}
+
+int main( int argc, char ** argv ) {
+	(void)argc;
+	std::cout << "Functional test executable: " << argv[ 0 ] << "\n";
+
+	int error;
+	grb::Launcher< AUTOMATIC > launcher;
+	if( launcher.exec( &grbProgram, nullptr, 0, error ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
@@ -0,0 +1,262 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+
+typedef grb::Semiring<
+	grb::operators::add< double >, grb::operators::mul< double >,
+	grb::identities::zero, grb::identities::one
+> Ring;
+
+/**
+ * Builds a lower triangular matrix with nonzeroes on the diagonal (if
+ * requested) and on two sub-diagonals, which results in a schedule with
+ * multiple rows per level. The off-diagonal values are chosen such that the
+ * matrix is strongly diagonally dominant, also when its diagonal is implied.
+ */
+static RC buildLower( Matrix< double > &L, const size_t n, const bool diag ) {
+	std::vector< size_t > I, J;
+	std::vector< double > V;
+	const double scale = diag ? 4.0 : 1.0;
+	for( size_t i = 0; i < n; ++i ) {
+		if( diag ) {
+			I.push_back( i ); J.push_back( i ); V.push_back( scale );
+		}
+		if( i >= 1 ) {
+			I.push_back( i ); J.push_back( i - 1 ); V.push_back( -0.25 * scale );
+		}
+		if( i >= 7 ) {
+			I.push_back( i ); J.push_back( i - 7 ); V.push_back( 0.125 * scale );
+		}
+	}
+	return buildMatrixUnique( L, I.data(), J.data(), V.data(), V.size(),
+		SEQUENTIAL );
+}
+
+/**
+ * Checks whether \a x solves the given system by comparing \a Tx against
+ * \a b, with missing entries in \a b interpreted as zeroes. When \a unit is
+ * given, \a T must not store its (implied) unit diagonal.
+ */
+template< Descriptor descr >
+static bool verify(
+	const Matrix< double > &T, const Vector< double > &x,
+	const Vector< double > &b, const bool unit
+) {
+	const size_t n = size( x );
+	Vector< double > Tx( n );
+	const Ring ring;
+	RC rc = grb::set( Tx, 0.0 );
+	rc = rc ? rc : grb::mxv< descr >( Tx, T, x, ring );
+	if( unit ) {
+		rc = rc ? rc : grb::foldl( Tx, x, ring.getAdditiveOperator() );
+	}
+	if( rc != SUCCESS || nnz( x ) != n ) {
+		std::cerr << "\t verification failed to compute residual\n";
+		return false;
+	}
+	std::vector< double > expect( n, 0.0 );
+	for( const auto &pair : b ) {
+		expect[ pair.first ] = pair.second;
+	}
+	for( const auto &pair : Tx ) {
+		const double diff = std::fabs( pair.second - expect[ pair.first ] );
+		if( diff > 1e-10 * ( 1.0 + std::fabs( expect[ pair.first ] ) ) ) {
+			std::cerr << "\t at index " << pair.first << ", residual is "
+				<< diff << "\n";
+			return false;
+		}
+	}
+	return true;
+}
+
+void grbProgram( const size_t &n, int &error ) {
+	error = 0;
+	const Ring ring;
+
+	Matrix< double > L( n, n ), S( n, n ), R( n, n + 1 );
+	Vector< double > x( n ), b( n ), ones( n );
+	TriangularSchedule schedule;
+
+	RC rc = buildLower( L, n, true );
+	rc = rc ? rc : buildLower( S, n, false );
+	rc = rc ? rc : grb::set( ones, 1.0 );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t initialisation FAILED\n";
+		error = 5;
+		return;
+	}
+
+	// test 1: lower, non-unit
+	rc = triangularAnalysis( schedule, L, LOWER );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t test 1 (lower analysis): " << toString( rc ) << "\n";
+		error = 10;
+		return;
+	}
+	if( schedule.size() != n || schedule.levels() == 0 ||
+		schedule.levels() > n || ( n > 1 && schedule.levels() < 2 )
+	) {
+		std::cerr << "\t test 1: unexpected schedule with " << schedule.levels()
+			<< " levels\n";
+		error = 15;
+		return;
+	}
+	rc = grb::set( b, 0.0 );
+	rc = rc ? rc : grb::mxv( b, L, ones, ring );
+	rc = rc ? rc : triangularSolve( x, L, b, schedule, ring );
+	if( rc != SUCCESS || !verify< descriptors::no_operation >( L, x, b, false ) ) {
+		std::cerr << "\t test 1 (lower solve) FAILED\n";
+		error = 20;
+		return;
+	}
+
+	// test 2: upper, non-unit, via the transpose of a lower triangular matrix
+	rc = triangularAnalysis< descriptors::transpose_matrix >( schedule, L, UPPER );
+	rc = rc ? rc : grb::set( b, 0.0 );
+	rc = rc ? rc : grb::mxv< descriptors::transpose_matrix >( b, L, ones, ring );
+	rc = rc ? rc : triangularSolve< descriptors::transpose_matrix >(
+		x, L, b, schedule, ring );
+	if( rc != SUCCESS ||
+		!verify< descriptors::transpose_matrix >( L, x, b, false )
+	) {
+		std::cerr << "\t test 2 (upper solve) FAILED\n";
+		error = 25;
+		return;
+	}
+
+	// test 3: a schedule for the transpose may not be used without it
+	rc = triangularSolve( x, L, b, schedule, ring );
+	if( rc != ILLEGAL ) {
+		std::cerr << "\t test 3 (schedule mismatch): unexpected return code "
+			<< toString( rc ) << ", expected ILLEGAL\n";
+		error = 30;
+		return;
+	}
+
+	// test 4: lower, unit, with a sparse right-hand side
+	rc = triangularAnalysis( schedule, S, LOWER, UNIT );
+	rc = rc ? rc : grb::clear( b );
+	rc = rc ? rc : grb::setElement( b, 1.0, 0 );
+	rc = rc ? rc : grb::setElement( b, -2.0, n / 2 );
+	rc = rc ? rc : triangularSolve( x, S, b, schedule, ring );
+	if( rc != SUCCESS || !verify< descriptors::no_operation >( S, x, b, true ) ) {
+		std::cerr << "\t test 4 (unit solve, sparse input) FAILED\n";
+		error = 35;
+		return;
+	}
+
+	// test 5: dense descriptor with a sparse right-hand side
+	rc = triangularSolve< descriptors::dense >( x, S, b, schedule, ring );
+	if( nnz( b ) < n && rc != ILLEGAL ) {
+		std::cerr << "\t test 5 (dense descriptor): unexpected return code "
+			<< toString( rc ) << ", expected ILLEGAL\n";
+		error = 40;
+		return;
+	}
+
+	// test 6: in-place solve
+	rc = triangularAnalysis( schedule, L, LOWER );
+	rc = rc ? rc : grb::set( b, 0.0 );
+	rc = rc ? rc : grb::mxv( b, L, ones, ring );
+	rc = rc ? rc : grb::set( x, b );
+	rc = rc ? rc : triangularSolve( x, L, x, schedule, ring );
+	if( rc != SUCCESS || !verify< descriptors::no_operation >( L, x, b, false ) ) {
+		std::cerr << "\t test 6 (in-place solve) FAILED\n";
+		error = 45;
+		return;
+	}
+
+	// test 7: missing diagonal entries with a non-unit diagonal
+	if( n > 1 ) {
+		rc = triangularAnalysis( schedule, S, LOWER, NON_UNIT );
+		if( rc != ILLEGAL ) {
+			std::cerr << "\t test 7 (missing diagonal): unexpected return code "
+				<< toString( rc ) << ", expected ILLEGAL\n";
+			error = 50;
+			return;
+		}
+	}
+
+	// test 8: non-square matrix
+	rc = triangularAnalysis( schedule, R, LOWER );
+	if( rc != MISMATCH ) {
+		std::cerr << "\t test 8 (non-square): unexpected return code "
+			<< toString( rc ) << ", expected MISMATCH\n";
+		error = 55;
+		return;
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = 1000;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read == 0 ) {
+			std::cerr << "Given value for n is zero\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is 1000): a positive integer.\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	grb::Launcher< AUTOMATIC > launcher;
+	int error;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
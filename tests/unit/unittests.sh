@@ -33,6 +33,13 @@ for MODE in debug ndebug; do
 	grep 'Test OK' ${TEST_OUT_DIR}/equals_${MODE}.log || echo "Test FAILED"
 	echo " "
 
+	echo ">>>      [x]           [ ]       Testing the JSON and CSV output of grb::Benchmarker"
+	echo "                                 on a program with known timings"
+	${TEST_BIN_DIR}/benchmarkerOutput_${MODE} &> ${TEST_OUT_DIR}/benchmarkerOutput_${MODE}.log
+	head -1 ${TEST_OUT_DIR}/benchmarkerOutput_${MODE}.log
+	grep 'Test OK' ${TEST_OUT_DIR}/benchmarkerOutput_${MODE}.log || echo "Test FAILED"
+	echo " "
+
 	echo ">>>      [x]           [ ]       Testing numerical addition operator over doubles"
 	${TEST_BIN_DIR}/add15d_${MODE}
 
@@ -152,6 +159,36 @@ for MODE in debug ndebug; do
 					head -1 ${TEST_OUT_DIR}/eWiseApplyMatrixReference_${MODE}_${BACKEND}_${T}.log
 					grep 'Test OK' ${TEST_OUT_DIR}/eWiseApplyMatrixReference_${MODE}_${BACKEND}_${T}.log || echo "Test FAILED"
 					echo " "
+
+					echo ">>>      [x]           [ ]       Testing the sparse matrix times dense block kernel"
+					echo "                                 on row- and column-major blocks"
+					$runner ${TEST_BIN_DIR}/spmm_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/spmm_${MODE}_${BACKEND}_${T}.log
+					head -1 ${TEST_OUT_DIR}/spmm_${MODE}_${BACKEND}_${T}.log
+					grep 'Test OK' ${TEST_OUT_DIR}/spmm_${MODE}_${BACKEND}_${T}.log || echo "Test FAILED"
+					echo " "
+
+					echo ">>>      [x]           [ ]       Testing the SparseBLAS and SpBLAS sparse matrix times"
+					echo "                                 dense block multiplications against a dense reference"
+					$runner ${TEST_BIN_DIR}/sparseblas_spmm_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/sparseblas_spmm_${MODE}_${BACKEND}_${T}.log
+					head -1 ${TEST_OUT_DIR}/sparseblas_spmm_${MODE}_${BACKEND}_${T}.log
+					grep 'Test OK' ${TEST_OUT_DIR}/sparseblas_spmm_${MODE}_${BACKEND}_${T}.log || echo "Test FAILED"
+					echo " "
+
+					echo ">>>      [x]           [ ]       Testing the SparseBLAS triangular solve against a dense"
+					echo "                                 reference, including its cached schedule"
+					$runner ${TEST_BIN_DIR}/sparseblas_triangular_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/sparseblas_triangular_${MODE}_${BACKEND}_${T}.log
+					head -1 ${TEST_OUT_DIR}/sparseblas_triangular_${MODE}_${BACKEND}_${T}.log
+					grep 'Test OK' ${TEST_OUT_DIR}/sparseblas_triangular_${MODE}_${BACKEND}_${T}.log || echo "Test FAILED"
+					echo " "
+
+					if [ "${BACKEND}" = "reference_omp" ]; then
+						echo ">>>      [x]           [ ]       Testing vxm and mxv on containers placed by first touch,"
+						echo "                                 with replication of the input vector requested"
+						$runner ${TEST_BIN_DIR}/numaFirstTouch_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/numaFirstTouch_${MODE}_${BACKEND}_${T}.log
+						head -1 ${TEST_OUT_DIR}/numaFirstTouch_${MODE}_${BACKEND}_${T}.log
+						grep 'Test OK' ${TEST_OUT_DIR}/numaFirstTouch_${MODE}_${BACKEND}_${T}.log || echo "Test FAILED"
+						echo " "
+					fi
 				fi
 
 				echo "#################################################################"
@@ -252,6 +289,13 @@ for MODE in debug ndebug; do
 				grep 'Test OK' ${TEST_OUT_DIR}/moveVector_${MODE}_${BACKEND}_${P}_${T} || echo "Test FAILED"
 				echo " "
 
+				echo ">>>      [x]           [ ]       Testing dead stage elimination, reordering, and"
+				echo "                                 re-execution of a recorded sequence of primitives"
+				$runner ${TEST_BIN_DIR}/replay_${MODE}_${BACKEND} 100 &> ${TEST_OUT_DIR}/replay_${MODE}_${BACKEND}_${P}_${T}
+				head -1 ${TEST_OUT_DIR}/replay_${MODE}_${BACKEND}_${P}_${T}
+				grep 'Test OK' ${TEST_OUT_DIR}/replay_${MODE}_${BACKEND}_${P}_${T} || echo "Test FAILED"
+				echo " "
+
 				echo ">>>      [x]           [ ]       Testing std::move on two vectors of doubles of"
 				echo "                                 size 100."
 				$runner ${TEST_BIN_DIR}/moveMatrix_${MODE}_${BACKEND} 100 &> ${TEST_OUT_DIR}/moveMatrix_${MODE}_${BACKEND}_${P}_${T}
@@ -350,7 +394,8 @@ for MODE in debug ndebug; do
 				echo " "
 
 				echo ">>>      [x]           [ ]       Testing grb::clear on a 1M by 1M matrix of"
-				echo "                                 doubles"
+				echo "                                 doubles, and multiplying with it after an"
+				echo "                                 empty rebuild"
 				$runner ${TEST_BIN_DIR}/clearMatrix_${MODE}_${BACKEND} 10000000 &> ${TEST_OUT_DIR}/clearMatrix_${MODE}_${BACKEND}_${P}_${T}.log
 				head -1 ${TEST_OUT_DIR}/clearMatrix_${MODE}_${BACKEND}_${P}_${T}.log
 				grep 'Test OK' ${TEST_OUT_DIR}/clearMatrix_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
@@ -528,6 +573,13 @@ for MODE in debug ndebug; do
 				grep 'Test OK' ${TEST_OUT_DIR}/buildMatrixUnique_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
 				echo " "
 
+				echo ">>>      [x]           [ ]       Testing building a matrix in parallel over many"
+				echo "                                 ingestion rounds, as well as in a single round"
+				$runner ${TEST_BIN_DIR}/buildMatrixChunks_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/buildMatrixChunks_${MODE}_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/buildMatrixChunks_${MODE}_${BACKEND}_${P}_${T}.log
+				grep 'Test OK' ${TEST_OUT_DIR}/buildMatrixChunks_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+				echo " "
+
 				echo ">>>      [x]           [ ]       Testing grb::eWiseApply using + on matrices"
 				$runner ${TEST_BIN_DIR}/eWiseApply_matrix_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/eWiseApply_matrix_${MODE}_${BACKEND}_${P}_${T}
 				head -1 ${TEST_OUT_DIR}/eWiseApply_matrix_${MODE}_${BACKEND}_${P}_${T}
@@ -574,6 +626,79 @@ for MODE in debug ndebug; do
 				grep 'Test OK' ${TEST_OUT_DIR}/outer_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
 				echo " "
 
+				echo ">>>      [x]           [ ]       Testing grb::triangularSolve on lower and upper"
+				echo "                                 triangular matrices of size 1000 x 1000"
+				$runner ${TEST_BIN_DIR}/triangularSolve_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/triangularSolve_${MODE}_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/triangularSolve_${MODE}_${BACKEND}_${P}_${T}.log
+				grep 'Test OK' ${TEST_OUT_DIR}/triangularSolve_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+				echo " "
+
+				echo ">>>      [x]           [ ]       Testing grb::vxm and grb::mxv with epilogues on a"
+				echo "                                 matrix of size 1000 x 1000"
+				$runner ${TEST_BIN_DIR}/epilogue_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/epilogue_${MODE}_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/epilogue_${MODE}_${BACKEND}_${P}_${T}.log
+				grep 'Test OK' ${TEST_OUT_DIR}/epilogue_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+				echo " "
+
+				echo ">>>      [x]           [ ]       Testing ALP/Pregel aggregators with a label propagation"
+				echo "                                 program over a path of 100 vertices"
+				$runner ${TEST_BIN_DIR}/pregel_aggregators_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/pregel_aggregators_${MODE}_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/pregel_aggregators_${MODE}_${BACKEND}_${P}_${T}.log
+				grep 'Test OK' ${TEST_OUT_DIR}/pregel_aggregators_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+				echo " "
+
+				echo ">>>      [x]           [ ]       Testing the ALP/Pregel sparse active-set mode executes only"
+				echo "                                 vertices with messages, over a path of 100 vertices"
+				$runner ${TEST_BIN_DIR}/pregel_sparse_active_set_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/pregel_sparse_active_set_${MODE}_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/pregel_sparse_active_set_${MODE}_${BACKEND}_${P}_${T}.log
+				grep 'Test OK' ${TEST_OUT_DIR}/pregel_sparse_active_set_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+				echo " "
+
+				echo ">>>      [x]           [ ]       Testing level-1 and level-2 primitives on input"
+				echo "                                 vectors of size 1000 and increasing density"
+				$runner ${TEST_BIN_DIR}/vectorRepresentation_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/vectorRepresentation_${MODE}_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/vectorRepresentation_${MODE}_${BACKEND}_${P}_${T}.log
+				grep 'Test OK' ${TEST_OUT_DIR}/vectorRepresentation_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+				echo " "
+
+				echo ">>>      [x]           [ ]       Testing the recycling of container memory"
+				$runner ${TEST_BIN_DIR}/containerPool_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/containerPool_${MODE}_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/containerPool_${MODE}_${BACKEND}_${P}_${T}.log
+				grep 'Test OK' ${TEST_OUT_DIR}/containerPool_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+				echo " "
+
+				echo ">>>      [x]           [ ]       Testing the recycling of container memory that is"
+				echo "                                 backed by huge pages"
+				GRB_HUGE_PAGES=1 $runner ${TEST_BIN_DIR}/containerPool_${MODE}_${BACKEND} 300000 &> ${TEST_OUT_DIR}/containerPool_hugepages_${MODE}_${BACKEND}_${P}_${T}.log
+				head -1 ${TEST_OUT_DIR}/containerPool_hugepages_${MODE}_${BACKEND}_${P}_${T}.log
+				grep 'Test OK' ${TEST_OUT_DIR}/containerPool_hugepages_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+				echo " "
+
+				if [ "$BACKEND" = "profile" ]; then
+					echo ">>>      [x]           [ ]       Testing the call counters and work estimates of the"
+					echo "                                 profile backend"
+					$runner ${TEST_BIN_DIR}/profiler_${MODE}_${BACKEND} &> ${TEST_OUT_DIR}/profiler_${MODE}_${BACKEND}_${P}_${T}.log
+					head -1 ${TEST_OUT_DIR}/profiler_${MODE}_${BACKEND}_${P}_${T}.log
+					grep 'Test OK' ${TEST_OUT_DIR}/profiler_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+					echo " "
+				fi
+
+				if [ "$BACKEND" = "hyperdags" ]; then
+					echo ">>>      [x]           [ ]       Testing streaming of a binary HyperDAG during the"
+					echo "                                 computation"
+					$runner ${TEST_BIN_DIR}/hyperdagStream_${MODE}_${BACKEND} ${TEST_OUT_DIR}/hyperdagStream_${MODE}_${BACKEND}_${P}_${T}.bin &> ${TEST_OUT_DIR}/hyperdagStream_${MODE}_${BACKEND}_${P}_${T}.log
+					head -1 ${TEST_OUT_DIR}/hyperdagStream_${MODE}_${BACKEND}_${P}_${T}.log
+					grep 'Test OK' ${TEST_OUT_DIR}/hyperdagStream_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+					echo " "
+
+					echo ">>>      [x]           [ ]       Testing extraction of a fine-grained HyperDAG,"
+					echo "                                 with and without coarsening and sampling"
+					$runner ${TEST_BIN_DIR}/hyperdagFine_${MODE}_${BACKEND} 2> ${TEST_OUT_DIR}/hyperdagFine_${MODE}_${BACKEND}_${P}_${T}.err 1> ${TEST_OUT_DIR}/hyperdagFine_${MODE}_${BACKEND}_${P}_${T}.log
+					head -1 ${TEST_OUT_DIR}/hyperdagFine_${MODE}_${BACKEND}_${P}_${T}.log
+					grep 'Test OK' ${TEST_OUT_DIR}/hyperdagFine_${MODE}_${BACKEND}_${P}_${T}.log || echo "Test FAILED"
+					echo " "
+				fi
+
 				echo ">>>      [x]           [ ]       Testing vector times matrix using the normal (+,*)"
 				echo "                                 semiring over integers on a diagonal matrix"
 				echo " "
@@ -0,0 +1,279 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Tests level-1 and level-2 primitives on input vectors of increasing density,
+ * so that backends which pick their kernels by the number of nonzeroes of a
+ * vector are exercised in every regime: very sparse, moderately sparse, and
+ * dense.
+ */
+
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include "graphblas.hpp"
+
+
+using namespace grb;
+
+typedef grb::Semiring<
+	grb::operators::add< int >, grb::operators::mul< int >,
+	grb::identities::zero, grb::identities::one
+> Ring;
+
+/**
+ * Compares a vector against an expected sparsity pattern and values, where
+ * \a expect_assigned is indexed by vector coordinates.
+ */
+static bool check(
+	const Vector< int > &x,
+	const std::vector< bool > &expect_assigned,
+	const std::vector< int > &expect_values
+) {
+	size_t expect_nnz = 0;
+	for( const bool assigned : expect_assigned ) {
+		if( assigned ) {
+			(void) ++expect_nnz;
+		}
+	}
+	if( nnz( x ) != expect_nnz ) {
+		std::cerr << "\t got " << nnz( x ) << " nonzeroes, expected " << expect_nnz
+			<< "\n";
+		return false;
+	}
+	for( const auto &pair : x ) {
+		if( !expect_assigned[ pair.first ] ) {
+			std::cerr << "\t unexpected nonzero at index " << pair.first << "\n";
+			return false;
+		}
+		if( pair.second != expect_values[ pair.first ] ) {
+			std::cerr << "\t at index " << pair.first << ": got " << pair.second
+				<< ", expected " << expect_values[ pair.first ] << "\n";
+			return false;
+		}
+	}
+	return true;
+}
+
+/** Runs all checks on an input vector with every <tt>stride</tt>-th element set. */
+static int checkDensity(
+	const size_t n, const size_t stride, const Matrix< int > &A,
+	const int error_base
+) {
+	// the input vector and its expected contents
+	Vector< int > x( n );
+	std::vector< bool > x_assigned( n, false );
+	std::vector< int > x_values( n, 0 );
+	RC rc = SUCCESS;
+	for( size_t i = 0; rc == SUCCESS && i < n; i += stride ) {
+		x_assigned[ i ] = true;
+		x_values[ i ] = static_cast< int >( i % 13 ) + 1;
+		rc = setElement( x, x_values[ i ], i );
+	}
+	if( rc != SUCCESS ) {
+		std::cerr << "\t initialisation FAILED\n";
+		return error_base;
+	}
+
+	// test 1: eWiseLambda should visit exactly the nonzeroes
+	rc = eWiseLambda( [ &x ]( const size_t i ) {
+			x[ i ] += 2;
+		}, x );
+	rc = rc ? rc : wait();
+	for( size_t i = 0; i < n; ++i ) {
+		if( x_assigned[ i ] ) {
+			x_values[ i ] += 2;
+		}
+	}
+	if( rc != SUCCESS || !check( x, x_assigned, x_values ) ) {
+		std::cerr << "\t eWiseLambda (stride " << stride << ") FAILED\n";
+		return error_base + 1;
+	}
+
+	// test 2: folding a scalar into a possibly sparse vector
+	rc = foldl( x, 3, operators::mul< int >() );
+	for( size_t i = 0; i < n; ++i ) {
+		if( x_assigned[ i ] ) {
+			x_values[ i ] *= 3;
+		}
+	}
+	if( rc != SUCCESS || !check( x, x_assigned, x_values ) ) {
+		std::cerr << "\t foldl of scalar (stride " << stride << ") FAILED\n";
+		return error_base + 2;
+	}
+
+	// test 3: folding into a vector with a different sparsity pattern, once
+	// using an operator (intersection) and once using a monoid (union)
+	Vector< int > y( n ), z( n );
+	std::vector< bool > y_assigned( n, false ), z_assigned( n, false );
+	std::vector< int > y_values( n, 0 ), z_values( n, 0 );
+	for( size_t i = 0; rc == SUCCESS && i < n; i += 3 ) {
+		y_assigned[ i ] = z_assigned[ i ] = true;
+		y_values[ i ] = z_values[ i ] = static_cast< int >( i % 5 );
+		rc = setElement( y, y_values[ i ], i );
+		rc = rc ? rc : setElement( z, z_values[ i ], i );
+	}
+	rc = rc ? rc : foldl( y, x, operators::add< int >() );
+	rc = rc ? rc : foldl( z, x, Monoid< operators::add< int >, identities::zero >() );
+	for( size_t i = 0; i < n; ++i ) {
+		if( x_assigned[ i ] ) {
+			if( y_assigned[ i ] ) {
+				y_values[ i ] += x_values[ i ];
+			}
+			if( !z_assigned[ i ] ) {
+				z_assigned[ i ] = true;
+			}
+			z_values[ i ] += x_values[ i ];
+		}
+	}
+	if( rc != SUCCESS || !check( y, y_assigned, y_values ) ) {
+		std::cerr << "\t operator-based foldl of vector (stride " << stride << ") "
+			<< "FAILED\n";
+		return error_base + 3;
+	}
+	if( !check( z, z_assigned, z_values ) ) {
+		std::cerr << "\t monoid-based foldl of vector (stride " << stride << ") "
+			<< "FAILED\n";
+		return error_base + 4;
+	}
+
+	// test 4: vxm and mxv with A bidiagonal, i.e., with A_{i,i} = 1 and
+	// A_{i,i+1} = 2
+	std::vector< bool > left_assigned( n, false ), right_assigned( n, false );
+	std::vector< int > left_values( n, 0 ), right_values( n, 0 );
+	for( size_t i = 0; i < n; ++i ) {
+		if( !x_assigned[ i ] ) {
+			continue;
+		}
+		// (xA)_j = x_j + 2 x_{j-1}
+		left_assigned[ i ] = true;
+		left_values[ i ] += x_values[ i ];
+		if( i + 1 < n ) {
+			left_assigned[ i + 1 ] = true;
+			left_values[ i + 1 ] += 2 * x_values[ i ];
+		}
+		// (Ax)_i = x_i + 2 x_{i+1}
+		right_assigned[ i ] = true;
+		right_values[ i ] += x_values[ i ];
+		if( i > 0 ) {
+			right_assigned[ i - 1 ] = true;
+			right_values[ i - 1 ] += 2 * x_values[ i ];
+		}
+	}
+	Vector< int > u( n );
+	rc = vxm( u, x, A, Ring() );
+	if( rc != SUCCESS || !check( u, left_assigned, left_values ) ) {
+		std::cerr << "\t vxm (stride " << stride << ") FAILED\n";
+		return error_base + 5;
+	}
+	rc = clear( u );
+	rc = rc ? rc : vxm< descriptors::transpose_matrix >( u, x, A, Ring() );
+	if( rc != SUCCESS || !check( u, right_assigned, right_values ) ) {
+		std::cerr << "\t vxm with transposed matrix (stride " << stride << ") "
+			<< "FAILED\n";
+		return error_base + 6;
+	}
+	rc = clear( u );
+	rc = rc ? rc : mxv( u, A, x, Ring() );
+	if( rc != SUCCESS || !check( u, right_assigned, right_values ) ) {
+		std::cerr << "\t mxv (stride " << stride << ") FAILED\n";
+		return error_base + 7;
+	}
+	return 0;
+}
+
+void grbProgram( const size_t &n, int &error ) {
+	error = 0;
+
+	std::vector< size_t > I, J;
+	std::vector< int > V;
+	for( size_t i = 0; i < n; ++i ) {
+		I.push_back( i ); J.push_back( i ); V.push_back( 1 );
+		if( i + 1 < n ) {
+			I.push_back( i ); J.push_back( i + 1 ); V.push_back( 2 );
+		}
+	}
+	Matrix< int > A( n, n );
+	RC rc = resize( A, V.size() );
+	rc = rc ? rc : buildMatrixUnique( A, I.data(), J.data(), V.data(), V.size(),
+		SEQUENTIAL );
+	if( rc != SUCCESS ) {
+		std::cerr << "\t matrix initialisation FAILED\n";
+		error = 5;
+		return;
+	}
+
+	// a very sparse, a moderately sparse, and a dense input vector
+	const size_t strides[] = { 97, 5, 1 };
+	for( size_t k = 0; error == 0 && k < 3; ++k ) {
+		error = checkDensity( n, strides[ k ], A, 10 * (k + 1) );
+	}
+}
+
+int main( int argc, char ** argv ) {
+	// defaults
+	bool printUsage = false;
+	size_t in = 1000;
+
+	// error checking
+	if( argc > 2 ) {
+		printUsage = true;
+	}
+	if( argc == 2 ) {
+		size_t read;
+		std::istringstream ss( argv[ 1 ] );
+		if( !( ss >> read ) ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( !ss.eof() ) {
+			std::cerr << "Error parsing first argument\n";
+			printUsage = true;
+		} else if( read < 2 ) {
+			std::cerr << "Given value for n is smaller than two\n";
+			printUsage = true;
+		} else {
+			// all OK
+			in = read;
+		}
+	}
+	if( printUsage ) {
+		std::cerr << "Usage: " << argv[ 0 ] << " [n]\n";
+		std::cerr << "  -n (optional, default is 1000): an integer larger than one.\n";
+		return 1;
+	}
+
+	std::cout << "This is functional test " << argv[ 0 ] << "\n";
+	grb::Launcher< AUTOMATIC > launcher;
+	int error;
+	if( launcher.exec( &grbProgram, in, error, true ) != SUCCESS ) {
+		std::cerr << "Test failed to launch\n";
+		error = 255;
+	}
+	if( error == 0 ) {
+		std::cout << "Test OK\n" << std::endl;
+	} else {
+		std::cerr << std::flush;
+		std::cout << "Test FAILED\n" << std::endl;
+	}
+
+	// done
+	return error;
+}
+
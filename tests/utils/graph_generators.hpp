@@ -0,0 +1,527 @@
+
+/*
+ *   Copyright 2021 Huawei Technologies Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Synthetic graph and matrix generators for self-contained performance tests.
+ *
+ * Generators are selected by a specification string, so that performance
+ * drivers may accept one wherever they otherwise accept a file name:
+ *  - <tt>rmat:scale[:edgefactor[:seed]]</tt>: a Graph500 R-MAT graph with
+ *    \f$ 2^{scale} \f$ vertices and on average \a edgefactor (default 16) edges
+ *    per vertex;
+ *  - <tt>er:n[:degree[:seed]]</tt>: an Erd&odblac;s&ndash;R&eacute;nyi graph
+ *    with \a n vertices where every edge exists with probability \a degree
+ *    (default 16) over \a n;
+ *  - <tt>stencil2d:nx[:ny]</tt>: the 5-point Laplacian on an \a nx by \a ny
+ *    grid, with \a ny equal to \a nx by default;
+ *  - <tt>stencil3d:nx[:ny:nz]</tt>: the 7-point Laplacian on an \a nx by
+ *    \a ny by \a nz grid, with \a ny and \a nz equal to \a nx by default.
+ * The default seed is 1.
+ *
+ * All generators are row-wise: the nonzeroes of every row are a function of
+ * the row index and the seed only. Every user process therefore generates a
+ * contiguous block of rows independently of all other processes, and the
+ * generated matrix does not depend on the number of processes nor on the
+ * number of threads. Rows never contain duplicate nonzeroes, so that the
+ * result may be ingested by #grb::buildMatrixUnique directly.
+ *
+ * The random graphs are directed and may contain self-loops. The R-MAT
+ * generator draws the number of edges of every row from the Poisson
+ * distribution that approximates the R-MAT degree of that row, and then draws
+ * the columns from the R-MAT distribution conditioned on the row. As in the
+ * Graph500 reference code, vertex labels are scrambled afterwards, such that
+ * high-degree vertices are not clustered.
+ */
+
+#ifndef _GRB_UTILS_GRAPH_GENERATORS
+#define _GRB_UTILS_GRAPH_GENERATORS
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <sstream>
+#include <algorithm>
+
+#include <graphblas.hpp>
+
+#include "matrix_generators.hpp"
+
+
+namespace grb {
+
+	namespace utils {
+
+		namespace internal {
+
+			/**
+			 * A counter-based pseudo-random number generator that draws from an
+			 * independent stream per row.
+			 *
+			 * Implements SplitMix64, which is cheap to seed and passes BigCrush.
+			 */
+			class RowRandom {
+
+				private:
+
+					/** The current state. */
+					uint64_t state;
+
+					/** Scrambles \a x. */
+					static uint64_t mix( uint64_t x ) noexcept {
+						x = ( x ^ ( x >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+						x = ( x ^ ( x >> 27 ) ) * 0x94D049BB133111EBull;
+						return x ^ ( x >> 31 );
+					}
+
+
+				public:
+
+					/** Starts the stream of the given \a row. */
+					RowRandom( const uint64_t seed, const uint64_t row ) noexcept :
+						state( mix( seed ) ^ mix( row + 0x9E3779B97F4A7C15ull ) )
+					{}
+
+					/** @returns The next 64 random bits. */
+					uint64_t next() noexcept {
+						state += 0x9E3779B97F4A7C15ull;
+						return mix( state );
+					}
+
+					/** @returns A uniformly distributed number in \f$ [0, 1) \f$. */
+					double uniform() noexcept {
+						return static_cast< double >( next() >> 11 ) / 9007199254740992.0;
+					}
+
+					/** @returns A Poisson distributed number with mean \a lambda. */
+					size_t poisson( const double lambda ) noexcept {
+						if( lambda < 30.0 ) {
+							// Knuth's method
+							const double limit = std::exp( -lambda );
+							size_t k = 0;
+							double p = uniform();
+							while( p > limit ) {
+								(void) ++k;
+								p *= uniform();
+							}
+							return k;
+						}
+						// normal approximation, via Box-Muller
+						const double u = 1.0 - uniform();
+						const double z = std::sqrt( -2.0 * std::log( u ) ) *
+							std::cos( 6.283185307179586 * uniform() );
+						const double k = std::round( lambda + std::sqrt( lambda ) * z );
+						return k > 0.0 ? static_cast< size_t >( k ) : 0;
+					}
+
+			};
+
+		} // end namespace ``grb::utils::internal''
+
+		/**
+		 * Generates synthetic matrices from a specification string.
+		 *
+		 * See the file documentation for the supported specifications and their
+		 * properties.
+		 */
+		class GraphGenerator {
+
+			public:
+
+				/** The supported generators. */
+				enum Kind { NONE, RMAT, ERDOS_RENYI, STENCIL_2D, STENCIL_3D };
+
+
+			private:
+
+				/** The selected generator. */
+				Kind kind;
+
+				/** The grid sizes, or the number of vertices in <tt>dims[ 0 ]</tt>. */
+				size_t dims[ 3 ];
+
+				/** The R-MAT scale. */
+				size_t scale;
+
+				/** The average number of edges per vertex. */
+				double degree;
+
+				/** The seed. */
+				uint64_t seed;
+
+				/** The Graph500 R-MAT quadrant probabilities. */
+				static constexpr double a = 0.57, b = 0.19, c = 0.19, d = 0.05;
+
+				/** Scrambles the vertex label \a x; a bijection on \f$ [0, 2^{scale}) \f$. */
+				uint64_t scramble( uint64_t x ) const noexcept {
+					const uint64_t mask = ( static_cast< uint64_t >( 1 ) << scale ) - 1;
+					const unsigned int shift = static_cast< unsigned int >( ( scale + 1 ) / 2 );
+					x = ( x * 0x9E3779B97F4A7C15ull + seed ) & mask;
+					x ^= x >> shift;
+					x = ( x * 0xBF58476D1CE4E5B9ull ) & mask;
+					x ^= x >> shift;
+					return x;
+				}
+
+				/**
+				 * Appends the columns and values of the R-MAT row with unscrambled index
+				 * \a row to \a J and \a V.
+				 */
+				template< typename T >
+				void rmatRow(
+					const size_t row, std::vector< size_t > &J, std::vector< T > &V
+				) const {
+					internal::RowRandom random( seed, row );
+					double probability = 1.0;
+					for( size_t level = 0; level < scale; ++level ) {
+						probability *= ( row >> level ) & 1 ? c + d : a + b;
+					}
+					const size_t n = dims[ 0 ];
+					const size_t count = std::min( n, random.poisson(
+						degree * static_cast< double >( n ) * probability ) );
+					const size_t first = J.size();
+					for( size_t k = 0; k < count; ++k ) {
+						uint64_t col = 0;
+						for( size_t level = scale; level > 0; --level ) {
+							const double right = ( row >> ( level - 1 ) ) & 1
+								? d / ( c + d )
+								: b / ( a + b );
+							col = ( col << 1 ) | ( random.uniform() < right ? 1 : 0 );
+						}
+						J.push_back( scramble( col ) );
+					}
+					std::sort( J.begin() + first, J.end() );
+					J.erase( std::unique( J.begin() + first, J.end() ), J.end() );
+					V.resize( J.size(), static_cast< T >( 1 ) );
+				}
+
+				/**
+				 * Appends the columns and values of the Erd&odblac;s&ndash;R&eacute;nyi
+				 * row \a row to \a J and \a V, by geometric skipping.
+				 */
+				template< typename T >
+				void erdosRenyiRow(
+					const size_t row, std::vector< size_t > &J, std::vector< T > &V
+				) const {
+					const size_t n = dims[ 0 ];
+					const double p = degree / static_cast< double >( n );
+					if( p >= 1.0 ) {
+						for( size_t j = 0; j < n; ++j ) {
+							J.push_back( j );
+						}
+					} else {
+						internal::RowRandom random( seed, row );
+						const double logq = std::log1p( -p );
+						double j = -1.0;
+						while( true ) {
+							j += 1.0 + std::floor( std::log( 1.0 - random.uniform() ) / logq );
+							if( j >= static_cast< double >( n ) ) {
+								break;
+							}
+							J.push_back( static_cast< size_t >( j ) );
+						}
+					}
+					V.resize( J.size(), static_cast< T >( 1 ) );
+				}
+
+				/**
+				 * Appends the columns and values of the stencil row \a row to \a J and
+				 * \a V, in increasing column order.
+				 */
+				template< typename T >
+				void stencilRow(
+					const size_t row, std::vector< size_t > &J, std::vector< T > &V
+				) const {
+					const size_t nd = kind == STENCIL_2D ? 2 : 3;
+					size_t coords[ 3 ], stride[ 3 ];
+					size_t rest = row;
+					for( size_t k = 0; k < nd; ++k ) {
+						stride[ k ] = k == 0 ? 1 : stride[ k - 1 ] * dims[ k - 1 ];
+						coords[ k ] = rest % dims[ k ];
+						rest /= dims[ k ];
+					}
+					for( size_t k = nd; k > 0; --k ) {
+						if( coords[ k - 1 ] > 0 ) {
+							J.push_back( row - stride[ k - 1 ] );
+							V.push_back( static_cast< T >( -1 ) );
+						}
+					}
+					J.push_back( row );
+					V.push_back( static_cast< T >( 2 * nd ) );
+					for( size_t k = 0; k < nd; ++k ) {
+						if( coords[ k ] + 1 < dims[ k ] ) {
+							J.push_back( row + stride[ k ] );
+							V.push_back( static_cast< T >( -1 ) );
+						}
+					}
+				}
+
+				/** Appends the nonzeroes of the given \a row to \a I, \a J, and \a V. */
+				template< typename T >
+				void generateRow(
+					const size_t row,
+					std::vector< size_t > &I, std::vector< size_t > &J,
+					std::vector< T > &V
+				) const {
+					size_t label = row;
+					switch( kind ) {
+						case RMAT:
+							rmatRow( row, J, V );
+							label = scramble( row );
+							break;
+						case ERDOS_RENYI:
+							erdosRenyiRow( row, J, V );
+							break;
+						case STENCIL_2D:
+						case STENCIL_3D:
+							stencilRow( row, J, V );
+							break;
+						default:
+							assert( false );
+					}
+					I.resize( J.size(), label );
+				}
+
+
+			public:
+
+				/** Creates a generator that does not generate anything. */
+				GraphGenerator() : kind( NONE ), scale( 0 ), degree( 16 ), seed( 1 ) {
+					dims[ 0 ] = dims[ 1 ] = dims[ 2 ] = 0;
+				}
+
+				/**
+				 * Selects a generator.
+				 *
+				 * @param[in] spec The specification string; see the file documentation.
+				 *
+				 * @returns Whether \a spec is a valid specification. If not, this
+				 *          generator does not generate anything.
+				 */
+				bool parse( const std::string &spec ) {
+					kind = NONE;
+					const size_t colon = spec.find( ':' );
+					if( colon == std::string::npos ) {
+						return false;
+					}
+					const std::string name = spec.substr( 0, colon );
+					std::vector< double > args;
+					std::istringstream ss( spec.substr( colon + 1 ) );
+					std::string token;
+					while( std::getline( ss, token, ':' ) ) {
+						std::istringstream ts( token );
+						double value;
+						if( !( ts >> value ) || !ts.eof() || value < 0 ) {
+							return false;
+						}
+						args.push_back( value );
+					}
+					if( args.empty() || args[ 0 ] < 1 ) {
+						return false;
+					}
+					seed = 1;
+					if( name == "rmat" && args.size() <= 3 && args[ 0 ] < 48 ) {
+						kind = RMAT;
+						scale = static_cast< size_t >( args[ 0 ] );
+						dims[ 0 ] = static_cast< size_t >( 1 ) << scale;
+						degree = args.size() > 1 ? args[ 1 ] : 16;
+						seed = args.size() > 2 ? static_cast< uint64_t >( args[ 2 ] ) : 1;
+					} else if( name == "er" && args.size() <= 3 ) {
+						kind = ERDOS_RENYI;
+						dims[ 0 ] = static_cast< size_t >( args[ 0 ] );
+						degree = args.size() > 1 ? args[ 1 ] : 16;
+						seed = args.size() > 2 ? static_cast< uint64_t >( args[ 2 ] ) : 1;
+					} else if( name == "stencil2d" && args.size() <= 2 ) {
+						kind = STENCIL_2D;
+						dims[ 0 ] = static_cast< size_t >( args[ 0 ] );
+						dims[ 1 ] = static_cast< size_t >( args.back() );
+						dims[ 2 ] = 1;
+					} else if( name == "stencil3d" && ( args.size() == 1 || args.size() == 3 ) ) {
+						kind = STENCIL_3D;
+						for( size_t k = 0; k < 3; ++k ) {
+							dims[ k ] = static_cast< size_t >( args[ args.size() == 1 ? 0 : k ] );
+						}
+					} else {
+						return false;
+					}
+					if( dims[ 0 ] == 0 || ( kind >= STENCIL_2D && ( dims[ 1 ] == 0 ||
+						dims[ 2 ] == 0 ) )
+					) {
+						kind = NONE;
+						return false;
+					}
+					return true;
+				}
+
+				/** @returns The selected generator. */
+				Kind selected() const noexcept {
+					return kind;
+				}
+
+				/** @returns The number of rows, and columns, of the generated matrix. */
+				size_t size() const noexcept {
+					switch( kind ) {
+						case RMAT:
+						case ERDOS_RENYI:
+							return dims[ 0 ];
+						case STENCIL_2D:
+							return dims[ 0 ] * dims[ 1 ];
+						case STENCIL_3D:
+							return dims[ 0 ] * dims[ 1 ] * dims[ 2 ];
+						default:
+							return 0;
+					}
+				}
+
+				/**
+				 * Generates the local rows of the selected matrix into \a I, \a J, and
+				 * \a V.
+				 *
+				 * Every user process generates a contiguous block of rows. If the
+				 * selected backend is shared-memory parallel, the threads of every
+				 * process generate contiguous sub-blocks in parallel. The nonzeroes
+				 * are appended in the order of the unscrambled row index, regardless of
+				 * the number of processes and threads.
+				 *
+				 * @returns #grb::SUCCESS  When generation succeeded.
+				 * @returns #grb::ILLEGAL  When no generator was selected.
+				 * @returns #grb::OUTOFMEM When generation failed due to an out-of-memory
+				 *                         condition.
+				 */
+				template< typename T >
+				RC generate(
+					std::vector< size_t > &I, std::vector< size_t > &J,
+					std::vector< T > &V
+				) const {
+					if( kind == NONE ) {
+						return ILLEGAL;
+					}
+					const size_t n = size();
+					const size_t lo = compute_parallel_first_nonzero( n );
+					const size_t hi = compute_parallel_last_nonzero( n );
+					I.clear();
+					J.clear();
+					V.clear();
+					RC ret = SUCCESS;
+#ifdef _GRB_WITH_OMP
+					std::vector< size_t > offsets;
+					#pragma omp parallel
+					{
+						size_t start, end;
+						config::OMP::localRange( start, end, lo, hi, 1 );
+						std::vector< size_t > localI, localJ;
+						std::vector< T > localV;
+						RC local_rc = SUCCESS;
+						try {
+							for( size_t i = start; i < end; ++i ) {
+								generateRow( i, localI, localJ, localV );
+							}
+						} catch( ... ) {
+							local_rc = OUTOFMEM;
+						}
+						#pragma omp critical
+						{
+							if( local_rc != SUCCESS ) {
+								ret = local_rc;
+							}
+						}
+						#pragma omp barrier
+						#pragma omp single
+						{
+							const size_t threads = config::OMP::current_threads();
+							try {
+								offsets.resize( threads + 1, 0 );
+							} catch( ... ) {
+								ret = OUTOFMEM;
+							}
+						}
+						if( ret == SUCCESS ) {
+							offsets[ config::OMP::current_thread_ID() + 1 ] = localJ.size();
+						}
+						#pragma omp barrier
+						#pragma omp single
+						{
+							if( ret == SUCCESS ) {
+								for( size_t t = 1; t < offsets.size(); ++t ) {
+									offsets[ t ] += offsets[ t - 1 ];
+								}
+								try {
+									I.resize( offsets.back() );
+									J.resize( offsets.back() );
+									V.resize( offsets.back() );
+								} catch( ... ) {
+									ret = OUTOFMEM;
+								}
+							}
+						}
+						if( ret == SUCCESS ) {
+							const size_t offset = offsets[ config::OMP::current_thread_ID() ];
+							std::copy( localI.begin(), localI.end(), I.begin() + offset );
+							std::copy( localJ.begin(), localJ.end(), J.begin() + offset );
+							std::copy( localV.begin(), localV.end(), V.begin() + offset );
+						}
+					}
+#else
+					try {
+						for( size_t i = lo; i < hi; ++i ) {
+							generateRow( i, I, J, V );
+						}
+					} catch( ... ) {
+						ret = OUTOFMEM;
+					}
+#endif
+					return ret;
+				}
+
+				/**
+				 * Generates the selected matrix into \a A, which must be of size
+				 * #size by #size.
+				 *
+				 * Every user process ingests its locally generated rows in parallel
+				 * I/O mode.
+				 *
+				 * @returns #grb::SUCCESS  When generation succeeded.
+				 * @returns #grb::ILLEGAL  When no generator was selected.
+				 * @returns #grb::MISMATCH When \a A has an unexpected size.
+				 * @returns #grb::OUTOFMEM When generation failed due to an out-of-memory
+				 *                         condition.
+				 * @returns Any other error code #grb::buildMatrixUnique returns.
+				 */
+				template< typename T, Backend implementation >
+				RC generate( Matrix< T, implementation > &A ) const {
+					if( nrows( A ) != size() || ncols( A ) != size() ) {
+						return kind == NONE ? ILLEGAL : MISMATCH;
+					}
+					std::vector< size_t > I, J;
+					std::vector< T > V;
+					RC ret = generate( I, J, V );
+					if( ret == SUCCESS ) {
+						ret = buildMatrixUnique( A, I.data(), J.data(), V.data(), I.size(),
+							PARALLEL );
+					}
+					return ret;
+				}
+
+		};
+
+	} // end namespace ``grb::utils''
+
+} // end namespace ``grb''
+
+#endif // end ``_GRB_UTILS_GRAPH_GENERATORS''
+
@@ -29,6 +29,7 @@
 #ifndef _GRB_UTILS_MATRIX_GENERATORS
 #define _GRB_UTILS_MATRIX_GENERATORS
 
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <stdexcept>